@@ -86,6 +86,52 @@ START_TIME=$(date +%s)
 
 TEST_EXIT_CODE=$?
 
+# Optional headless performance benchmark (NullRHI), gated against a checked-in baseline
+# RUN_BENCHMARK=1 enables it; BENCHMARK_REFERENCE points at the reference baseline (.ddbaseline or legacy .json);
+# BENCHMARK_ARGS passes extra scenario flags (e.g. "-Monsters=500 -Frames=3600")
+RUN_BENCHMARK="${RUN_BENCHMARK:-0}"
+BENCHMARK_REFERENCE="${BENCHMARK_REFERENCE:-$(cd "$(dirname "$0")" && pwd)/Config/PerformanceBaselines/HeadlessBenchmark.ddbaseline}"
+BENCHMARK_ARGS="${BENCHMARK_ARGS:-}"
+
+if [ $TEST_EXIT_CODE -eq 0 ] && [ "$RUN_BENCHMARK" = "1" ]; then
+    echo ""
+    echo -e "${YELLOW}Running headless performance benchmark...${NC}"
+
+    REFERENCE_ARG=""
+    if [ -f "$BENCHMARK_REFERENCE" ]; then
+        REFERENCE_ARG="-Reference=$BENCHMARK_REFERENCE"
+        echo "  Reference baseline: $BENCHMARK_REFERENCE"
+    else
+        echo -e "${YELLOW}  No reference baseline at $BENCHMARK_REFERENCE (capture only)${NC}"
+    fi
+
+    set +e
+    "$EDITOR_CMD" \
+        "$PROJECT_PATH" \
+        -run=DelveDeepPerformanceBenchmark \
+        -Output="$OUTPUT_PATH/HeadlessBenchmark.ddbaseline" \
+        $REFERENCE_ARG \
+        $BENCHMARK_ARGS \
+        -unattended \
+        -nopause \
+        -NullRHI \
+        -log \
+        -stdout \
+        -FullStdOutLogOutput
+    BENCHMARK_EXIT_CODE=$?
+    set -e
+
+    if [ $BENCHMARK_EXIT_CODE -eq 1 ]; then
+        echo -e "${RED}✗ Performance regression detected (see the comparison report in the log)${NC}"
+    elif [ $BENCHMARK_EXIT_CODE -ne 0 ]; then
+        echo -e "${RED}✗ Benchmark failed to run (exit code $BENCHMARK_EXIT_CODE)${NC}"
+    else
+        echo -e "${GREEN}✓ Benchmark within baseline tolerance${NC}"
+    fi
+
+    TEST_EXIT_CODE=$BENCHMARK_EXIT_CODE
+fi
+
 END_TIME=$(date +%s)
 DURATION=$((END_TIME - START_TIME))
 
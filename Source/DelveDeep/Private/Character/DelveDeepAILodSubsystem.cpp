@@ -0,0 +1,374 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepAILodSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "DelveDeepStats.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepAILod, Log, All);
+
+void UDelveDeepAILodSubsystem::Deinitialize()
+{
+	// Hand brains back to their own tick
+	for (int32 Slot = 0; Slot < Actors.Num(); ++Slot)
+	{
+		UnregisterAgent(Slot);
+	}
+
+	Actors.Empty();
+	Updates.Empty();
+	Controllers.Empty();
+	Lods.Empty();
+	PendingTime.Empty();
+	Phases.Empty();
+	Pinned.Empty();
+	Active.Empty();
+	FreeSlots.Empty();
+	FullDue.Empty();
+	ReducedDue.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepAILodSubsystem::Tick(float DeltaTime)
+{
+	if (const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+	{
+		if (const APawn* PlayerPawn = PlayerController->GetPawn())
+		{
+			LastViewerLocation = PlayerPawn->GetActorLocation();
+		}
+	}
+
+	Update(DeltaTime, LastViewerLocation);
+}
+
+TStatId UDelveDeepAILodSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepAILodSubsystem, STATGROUP_Tickables);
+}
+
+int32 UDelveDeepAILodSubsystem::RegisterAgent(AActor* Actor, FDelveDeepAIUpdate Update)
+{
+	if (!IsValid(Actor) || !Update.IsBound())
+	{
+		UE_LOG(LogDelveDeepAILod, Warning, TEXT("RegisterAgent: Agent needs an actor and an update"));
+		return INDEX_NONE;
+	}
+
+	return AllocateAgent(Actor, MoveTemp(Update), nullptr);
+}
+
+int32 UDelveDeepAILodSubsystem::RegisterAIController(AAIController* Controller)
+{
+	APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+	if (!IsValid(Pawn))
+	{
+		return INDEX_NONE;
+	}
+
+	return AllocateAgent(Pawn, FDelveDeepAIUpdate(), Controller);
+}
+
+int32 UDelveDeepAILodSubsystem::AllocateAgent(AActor* Actor, FDelveDeepAIUpdate&& Update, AAIController* Controller)
+{
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Actors.AddDefaulted();
+		Updates.AddDefaulted();
+		Controllers.AddDefaulted();
+		Lods.Add(EDelveDeepAILod::Full);
+		PendingTime.AddDefaulted();
+		Phases.AddDefaulted();
+		Pinned.Add(false);
+		Active.Add(false);
+	}
+
+	// Full until the first reclassification reaches it
+	Actors[Slot] = Actor;
+	Updates[Slot] = MoveTemp(Update);
+	Controllers[Slot] = Controller;
+	Lods[Slot] = EDelveDeepAILod::Full;
+	PendingTime[Slot] = 0.0f;
+	Phases[Slot] = NextPhase++;
+	Pinned[Slot] = false;
+	Active[Slot] = true;
+	++BucketCounts[static_cast<int32>(EDelveDeepAILod::Full)];
+
+	return Slot;
+}
+
+void UDelveDeepAILodSubsystem::UnregisterAgent(int32 Handle)
+{
+	if (!IsAgentValid(Handle))
+	{
+		return;
+	}
+
+	if (AAIController* Controller = Controllers[Handle].Get())
+	{
+		if (UBrainComponent* Brain = Controller->GetBrainComponent())
+		{
+			Brain->SetComponentTickEnabled(true);
+		}
+	}
+
+	--BucketCounts[static_cast<int32>(Lods[Handle])];
+
+	Actors[Handle].Reset();
+	Updates[Handle].Unbind();
+	Controllers[Handle].Reset();
+	Active[Handle] = false;
+	FreeSlots.Add(Handle);
+}
+
+void UDelveDeepAILodSubsystem::PinAgentLod(int32 Handle, EDelveDeepAILod Lod)
+{
+	if (IsAgentValid(Handle))
+	{
+		Pinned[Handle] = true;
+		SetLod(Handle, Lod);
+	}
+}
+
+void UDelveDeepAILodSubsystem::UnpinAgentLod(int32 Handle)
+{
+	if (IsAgentValid(Handle))
+	{
+		Pinned[Handle] = false;
+	}
+}
+
+int32 UDelveDeepAILodSubsystem::Update(float DeltaTime, const FVector& ViewerLocation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_AISystem);
+	TRACE_DELVEDEEP_AI();
+
+	ClassifySlice(ViewerLocation);
+
+	// Collect due agents first so each bucket's cost can be timed on its own
+	FullDue.Reset();
+	ReducedDue.Reset();
+
+	const uint32 ReducedPhase = FrameCounter % static_cast<uint32>(ReducedInterval);
+	for (int32 Slot = 0; Slot < Actors.Num(); ++Slot)
+	{
+		if (!Active[Slot])
+		{
+			continue;
+		}
+
+		if (!Actors[Slot].IsValid())
+		{
+			UnregisterAgent(Slot);
+			continue;
+		}
+
+		switch (Lods[Slot])
+		{
+		case EDelveDeepAILod::Full:
+			PendingTime[Slot] += DeltaTime;
+			FullDue.Add(Slot);
+			break;
+
+		case EDelveDeepAILod::Reduced:
+			PendingTime[Slot] += DeltaTime;
+			if (Phases[Slot] % ReducedInterval == ReducedPhase)
+			{
+				ReducedDue.Add(Slot);
+			}
+			else
+			{
+				HoldBrainTick(Slot);
+			}
+			break;
+
+		default:
+			HoldBrainTick(Slot);
+			break;
+		}
+	}
+
+	++FrameCounter;
+
+	double FullMs;
+	double ReducedMs;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_DelveDeep_BehaviorTree);
+		TRACE_DELVEDEEP_BEHAVIORTREE();
+
+		double StartTime = FPlatformTime::Seconds();
+		for (const int32 Slot : FullDue)
+		{
+			RunAgent(Slot);
+		}
+		FullMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		for (const int32 Slot : ReducedDue)
+		{
+			RunAgent(Slot);
+		}
+		ReducedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+	const UWorld* World = GetWorld();
+	if (const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr)
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			static const FName FullName(TEXT("AILodFull"));
+			static const FName ReducedName(TEXT("AILodReduced"));
+			Telemetry->RecordSystemTime(FullName, FullMs);
+			Telemetry->RecordSystemTime(ReducedName, ReducedMs);
+		}
+	}
+
+	return FullDue.Num() + ReducedDue.Num();
+}
+
+EDelveDeepAILod UDelveDeepAILodSubsystem::ClassifyAgent(float DistanceSq, bool bVisible) const
+{
+	if (DistanceSq <= FMath::Square(FullRadius))
+	{
+		return EDelveDeepAILod::Full;
+	}
+
+	// Anything on screen keeps thinking, however far away
+	if (bVisible || DistanceSq <= FMath::Square(ReducedRadius))
+	{
+		return EDelveDeepAILod::Reduced;
+	}
+
+	return EDelveDeepAILod::Frozen;
+}
+
+void UDelveDeepAILodSubsystem::SetLodDistances(float InFullRadius, float InReducedRadius)
+{
+	FullRadius = FMath::Max(InFullRadius, 0.0f);
+	ReducedRadius = FMath::Max(InReducedRadius, FullRadius);
+}
+
+void UDelveDeepAILodSubsystem::SetReducedInterval(int32 Frames)
+{
+	ReducedInterval = FMath::Clamp(Frames, 1, 255);
+}
+
+EDelveDeepAILod UDelveDeepAILodSubsystem::GetAgentLod(int32 Handle) const
+{
+	return IsAgentValid(Handle) ? Lods[Handle] : EDelveDeepAILod::Frozen;
+}
+
+int32 UDelveDeepAILodSubsystem::GetBucketCount(EDelveDeepAILod Lod) const
+{
+	return BucketCounts[static_cast<int32>(Lod)];
+}
+
+void UDelveDeepAILodSubsystem::ClassifySlice(const FVector& ViewerLocation)
+{
+	const int32 NumSlots = Actors.Num();
+	if (NumSlots == 0)
+	{
+		return;
+	}
+
+	const int32 SliceSize = FMath::DivideAndRoundUp(NumSlots, ClassifyFrames);
+	for (int32 Count = 0; Count < SliceSize; ++Count)
+	{
+		if (ClassifyCursor >= NumSlots)
+		{
+			ClassifyCursor = 0;
+		}
+
+		const int32 Slot = ClassifyCursor++;
+		if (!Active[Slot] || Pinned[Slot])
+		{
+			continue;
+		}
+
+		const AActor* Actor = Actors[Slot].Get();
+		if (!Actor)
+		{
+			continue;
+		}
+
+		// Batched characters never render their own sprite; the batch tracks their visibility
+		const ADelveDeepCharacter* Character = Cast<ADelveDeepCharacter>(Actor);
+		const bool bVisible = Character
+			? Character->WasSpriteRecentlyRendered(VisibilityTolerance)
+			: Actor->WasRecentlyRendered(VisibilityTolerance);
+
+		const float DistanceSq = FVector::DistSquared2D(Actor->GetActorLocation(), ViewerLocation);
+		SetLod(Slot, ClassifyAgent(DistanceSq, bVisible));
+	}
+}
+
+void UDelveDeepAILodSubsystem::SetLod(int32 Slot, EDelveDeepAILod Lod)
+{
+	if (Lods[Slot] == Lod)
+	{
+		return;
+	}
+
+	--BucketCounts[static_cast<int32>(Lods[Slot])];
+	++BucketCounts[static_cast<int32>(Lod)];
+	Lods[Slot] = Lod;
+
+	// Frozen agents do not catch up on the time they spent frozen
+	if (Lod == EDelveDeepAILod::Frozen)
+	{
+		PendingTime[Slot] = 0.0f;
+	}
+}
+
+void UDelveDeepAILodSubsystem::RunAgent(int32 Slot)
+{
+	const float DeltaTime = PendingTime[Slot];
+	PendingTime[Slot] = 0.0f;
+
+	if (AAIController* Controller = Controllers[Slot].Get())
+	{
+		// The brain ticks only from here; a behavior tree rescheduling its own
+		// tick turns it back on, so it is switched off again after each update
+		if (UBrainComponent* Brain = Controller->GetBrainComponent())
+		{
+			Brain->TickComponent(DeltaTime, LEVELTICK_All, &Brain->PrimaryComponentTick);
+			Brain->SetComponentTickEnabled(false);
+		}
+		return;
+	}
+
+	Updates[Slot].ExecuteIfBound(DeltaTime);
+}
+
+void UDelveDeepAILodSubsystem::HoldBrainTick(int32 Slot)
+{
+	// Behavior trees re-enable their own tick whenever they schedule work (a task
+	// finishing, a message, a blackboard change), including while not due here
+	if (AAIController* Controller = Controllers[Slot].Get())
+	{
+		if (UBrainComponent* Brain = Controller->GetBrainComponent())
+		{
+			if (Brain->IsComponentTickEnabled())
+			{
+				Brain->SetComponentTickEnabled(false);
+			}
+		}
+	}
+}
+
+bool UDelveDeepAILodSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -1,6 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Character/DelveDeepAbilitiesComponent.h"
+#include "Character/DelveDeepAoESubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepCooldownSubsystem.h"
+#include "Character/DelveDeepStatsComponent.h"
+#include "Engine/World.h"
 #include "Configuration/DelveDeepCharacterData.h"
 #include "Configuration/DelveDeepAbilityData.h"
 #include "Validation/ValidationContext.h"
@@ -13,6 +18,13 @@ UDelveDeepAbilitiesComponent::UDelveDeepAbilitiesComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
+void UDelveDeepAbilitiesComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseCooldownSlots();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UDelveDeepAbilitiesComponent::InitializeFromCharacterData(const UDelveDeepCharacterData* Data)
 {
 	if (!Data)
@@ -81,6 +93,7 @@ void UDelveDeepAbilitiesComponent::AddAbility(const UDelveDeepAbilityData* Abili
 
 	// Add ability to list
 	Abilities.Add(Ability);
+	CooldownSlots.Add(INDEX_NONE);
 
 	UE_LOG(LogDelveDeepAbilities, Verbose,
 		TEXT("Added ability (Total: %d)"), Abilities.Num());
@@ -95,12 +108,21 @@ void UDelveDeepAbilitiesComponent::RemoveAbility(const UDelveDeepAbilityData* Ab
 	}
 
 	// Remove ability from list
-	int32 RemovedCount = Abilities.Remove(Ability);
+	const int32 AbilityIndex = Abilities.IndexOfByKey(Ability);
 
-	if (RemovedCount > 0)
+	if (AbilityIndex != INDEX_NONE)
 	{
-		// Remove cooldown entry if exists
-		AbilityCooldowns.Remove(Ability);
+		// Free its cooldown slot
+		if (CooldownSlots[AbilityIndex] != INDEX_NONE)
+		{
+			if (UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem())
+			{
+				Cooldowns->ReleaseCooldown(CooldownSlots[AbilityIndex]);
+			}
+		}
+
+		Abilities.RemoveAt(AbilityIndex);
+		CooldownSlots.RemoveAt(AbilityIndex);
 
 		UE_LOG(LogDelveDeepAbilities, Verbose,
 			TEXT("Removed ability (Total: %d)"), Abilities.Num());
@@ -132,9 +154,26 @@ bool UDelveDeepAbilitiesComponent::UseAbility(int32 AbilityIndex)
 		return false;
 	}
 
-	// Placeholder: Actual ability execution will be implemented in future tasks
-	UE_LOG(LogDelveDeepAbilities, Display,
-		TEXT("Used ability at index %d (placeholder)"), AbilityIndex);
+	// Start the cooldown; the slot is allocated the first time the ability is used
+	const UDelveDeepAbilityData* Ability = Abilities[AbilityIndex];
+	if (UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem())
+	{
+		if (CooldownSlots[AbilityIndex] == INDEX_NONE)
+		{
+			CooldownSlots[AbilityIndex] = Cooldowns->AllocateCooldown(this, Ability);
+		}
+
+		Cooldowns->StartCooldown(CooldownSlots[AbilityIndex], Ability->Cooldown);
+	}
+
+	// Area abilities hit everything in a circle around the caster in one batch
+	if (Ability->AoERadius > 0.0f)
+	{
+		ApplyAreaDamage(Ability);
+	}
+
+	UE_LOG(LogDelveDeepAbilities, Verbose,
+		TEXT("Used ability at index %d"), AbilityIndex);
 
 	return true;
 }
@@ -153,10 +192,11 @@ bool UDelveDeepAbilitiesComponent::CanUseAbility(int32 AbilityIndex) const
 		return false;
 	}
 
-	// Check cooldown
-	if (const float* Cooldown = AbilityCooldowns.Find(Ability))
+	// Check cooldown (one timestamp compare)
+	if (CooldownSlots[AbilityIndex] != INDEX_NONE)
 	{
-		if (*Cooldown > 0.0f)
+		const UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem();
+		if (Cooldowns && !Cooldowns->IsReady(CooldownSlots[AbilityIndex]))
 		{
 			return false; // Still on cooldown
 		}
@@ -166,3 +206,69 @@ bool UDelveDeepAbilitiesComponent::CanUseAbility(int32 AbilityIndex) const
 	// For now, assume ability can be used if not on cooldown
 	return true;
 }
+
+float UDelveDeepAbilitiesComponent::GetAbilityCooldownRemaining(int32 AbilityIndex) const
+{
+	if (!CooldownSlots.IsValidIndex(AbilityIndex) || CooldownSlots[AbilityIndex] == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	const UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem();
+	return Cooldowns ? Cooldowns->GetRemaining(CooldownSlots[AbilityIndex]) : 0.0f;
+}
+
+void UDelveDeepAbilitiesComponent::ResetAbilityCooldown(int32 AbilityIndex)
+{
+	if (!CooldownSlots.IsValidIndex(AbilityIndex) || CooldownSlots[AbilityIndex] == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem())
+	{
+		Cooldowns->ResetCooldown(CooldownSlots[AbilityIndex]);
+	}
+}
+
+UDelveDeepCooldownSubsystem* UDelveDeepAbilitiesComponent::GetCooldownSubsystem() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UDelveDeepCooldownSubsystem>() : nullptr;
+}
+
+void UDelveDeepAbilitiesComponent::ReleaseCooldownSlots()
+{
+	if (UDelveDeepCooldownSubsystem* Cooldowns = GetCooldownSubsystem())
+	{
+		for (const int32 Slot : CooldownSlots)
+		{
+			if (Slot != INDEX_NONE)
+			{
+				Cooldowns->ReleaseCooldown(Slot);
+			}
+		}
+	}
+
+	for (int32& Slot : CooldownSlots)
+	{
+		Slot = INDEX_NONE;
+	}
+}
+
+int32 UDelveDeepAbilitiesComponent::ApplyAreaDamage(const UDelveDeepAbilityData* Ability)
+{
+	const ADelveDeepCharacter* Caster = Cast<ADelveDeepCharacter>(GetOwner());
+	UWorld* World = GetWorld();
+	UDelveDeepAoESubsystem* AoE = World ? World->GetSubsystem<UDelveDeepAoESubsystem>() : nullptr;
+	if (!Ability || !Caster || !Caster->GetStatsComponent() || !AoE)
+	{
+		return 0;
+	}
+
+	const float Damage = Caster->GetStatsComponent()->GetStatValue(EDelveDeepStat::Damage) * Ability->DamageMultiplier;
+	const uint32 TeamMask = UDelveDeepAoESubsystem::GetAbilityTeamMask(Caster->GetTeamId(), Ability->bAffectsAllies);
+
+	return AoE->DamageCircle(Caster->GetActorLocation(), Ability->AoERadius, TeamMask,
+		Damage, Ability->DamageType, GetOwner());
+}
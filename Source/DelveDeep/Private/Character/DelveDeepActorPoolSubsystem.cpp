@@ -0,0 +1,183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepActorPoolSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "DelveDeepConfigurationManager.h"
+#include "DelveDeepMonsterConfig.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepActorPool, Log, All);
+
+void UDelveDeepActorPoolSubsystem::Deinitialize()
+{
+	// Parked actors belong to the world and go away with it
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+ADelveDeepCharacter* UDelveDeepActorPoolSubsystem::AcquireCharacter(TSubclassOf<ADelveDeepCharacter> CharacterClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!CharacterClass)
+	{
+		return nullptr;
+	}
+
+	FCharacterPool* Pool = Pools.Find(CharacterClass.Get());
+	if (!Pool || Pool->Capacity <= 0)
+	{
+		return SpawnNewCharacter(CharacterClass, Location, Rotation);
+	}
+
+	// Parked actors can still be destroyed by level unloads; skip those
+	while (Pool->Available.Num() > 0)
+	{
+		ADelveDeepCharacter* Character = Pool->Available.Pop(EAllowShrinking::No).Get();
+		if (IsValid(Character))
+		{
+			Character->ActivateFromPool(Location, Rotation);
+			RecordAcquire(CharacterClass, true, Pool->Available.Num());
+			return Character;
+		}
+	}
+
+	RecordAcquire(CharacterClass, false, 0);
+	return SpawnNewCharacter(CharacterClass, Location, Rotation);
+}
+
+bool UDelveDeepActorPoolSubsystem::ReleaseCharacter(ADelveDeepCharacter* Character)
+{
+	if (!IsValid(Character) || Character->IsPooled())
+	{
+		return false;
+	}
+
+	FCharacterPool* Pool = Pools.Find(Character->GetClass());
+	if (!Pool || Pool->Available.Num() >= Pool->Capacity)
+	{
+		return false;
+	}
+
+	Character->DeactivateForPool();
+	Pool->Available.Add(Character);
+
+	if (const UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			Telemetry->RecordActorPoolRelease(Character->GetClass()->GetFName(), Pool->Available.Num());
+		}
+	}
+
+	return true;
+}
+
+void UDelveDeepActorPoolSubsystem::SetPoolCapacity(TSubclassOf<ADelveDeepCharacter> CharacterClass, int32 Capacity)
+{
+	if (!CharacterClass)
+	{
+		UE_LOG(LogDelveDeepActorPool, Warning, TEXT("SetPoolCapacity: Invalid character class"));
+		return;
+	}
+
+	FCharacterPool& Pool = Pools.FindOrAdd(CharacterClass.Get());
+	Pool.Capacity = FMath::Max(Capacity, 0);
+
+	// Destroy whatever no longer fits
+	while (Pool.Available.Num() > Pool.Capacity)
+	{
+		if (ADelveDeepCharacter* Character = Pool.Available.Pop(EAllowShrinking::No).Get())
+		{
+			Character->Destroy();
+		}
+	}
+}
+
+int32 UDelveDeepActorPoolSubsystem::PrewarmPool(TSubclassOf<ADelveDeepCharacter> CharacterClass, int32 Count)
+{
+	if (!CharacterClass || Count <= 0)
+	{
+		return 0;
+	}
+
+	FCharacterPool& Pool = Pools.FindOrAdd(CharacterClass.Get());
+	Pool.Capacity = FMath::Max(Pool.Capacity, Count);
+
+	int32 Spawned = 0;
+	while (Pool.Available.Num() < Count)
+	{
+		ADelveDeepCharacter* Character = SpawnNewCharacter(CharacterClass, FVector::ZeroVector, FRotator::ZeroRotator);
+		if (!Character)
+		{
+			break;
+		}
+
+		Character->DeactivateForPool();
+		Pool.Available.Add(Character);
+		++Spawned;
+	}
+
+	UE_LOG(LogDelveDeepActorPool, Display, TEXT("Pre-warmed %d %s (pool: %d / %d)"),
+		Spawned, *CharacterClass->GetName(), Pool.Available.Num(), Pool.Capacity);
+
+	return Spawned;
+}
+
+int32 UDelveDeepActorPoolSubsystem::PrewarmFromMonsterConfig(FName MonsterName, TSubclassOf<ADelveDeepCharacter> CharacterClass)
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	const UDelveDeepConfigurationManager* ConfigManager = GameInstance ? GameInstance->GetSubsystem<UDelveDeepConfigurationManager>() : nullptr;
+	if (!ConfigManager)
+	{
+		UE_LOG(LogDelveDeepActorPool, Warning, TEXT("PrewarmFromMonsterConfig: Configuration manager unavailable"));
+		return 0;
+	}
+
+	FDelveDeepMonsterConfig MonsterConfig;
+	if (!ConfigManager->GetMonsterConfig(MonsterName, MonsterConfig))
+	{
+		UE_LOG(LogDelveDeepActorPool, Warning, TEXT("PrewarmFromMonsterConfig: No monster config '%s'"), *MonsterName.ToString());
+		return 0;
+	}
+
+	SetPoolCapacity(CharacterClass, MonsterConfig.PoolSize);
+	return PrewarmPool(CharacterClass, MonsterConfig.PoolSize);
+}
+
+int32 UDelveDeepActorPoolSubsystem::GetPoolCapacity(TSubclassOf<ADelveDeepCharacter> CharacterClass) const
+{
+	const FCharacterPool* Pool = CharacterClass ? Pools.Find(CharacterClass.Get()) : nullptr;
+	return Pool ? Pool->Capacity : 0;
+}
+
+int32 UDelveDeepActorPoolSubsystem::GetAvailableCount(TSubclassOf<ADelveDeepCharacter> CharacterClass) const
+{
+	const FCharacterPool* Pool = CharacterClass ? Pools.Find(CharacterClass.Get()) : nullptr;
+	return Pool ? Pool->Available.Num() : 0;
+}
+
+ADelveDeepCharacter* UDelveDeepActorPoolSubsystem::SpawnNewCharacter(UClass* CharacterClass, const FVector& Location, const FRotator& Rotation) const
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	return GetWorld()->SpawnActor<ADelveDeepCharacter>(CharacterClass, Location, Rotation, SpawnParams);
+}
+
+void UDelveDeepActorPoolSubsystem::RecordAcquire(const UClass* CharacterClass, bool bHit, int32 AvailableCount) const
+{
+	if (const UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			Telemetry->RecordActorPoolAcquire(CharacterClass->GetFName(), bHit, AvailableCount);
+		}
+	}
+}
+
+bool UDelveDeepActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
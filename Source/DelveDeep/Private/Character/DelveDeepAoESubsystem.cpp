@@ -0,0 +1,273 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepAoESubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+
+namespace DelveDeepAoE
+{
+	/**
+	 * Scan packed combatants four at a time, appending the handles that match the
+	 * team mask and pass the shape test. The vector test returns an all-ones lane
+	 * for each position inside the shape; the scalar test handles the tail.
+	 */
+	template <typename VectorTestType, typename ScalarTestType>
+	int32 ScanCombatants(const FDelveDeepCombatantView& View, uint32 TeamMask, TArray<int32>& OutHandles,
+		VectorTestType&& VectorTest, ScalarTestType&& ScalarTest)
+	{
+		const int32 StartNum = OutHandles.Num();
+		const VectorRegister4Int MaskBits = VectorIntSet1(static_cast<int32>(TeamMask));
+		const VectorRegister4Int Zero = VectorIntSet1(0);
+
+		int32 Index = 0;
+		for (; Index + 4 <= View.Num; Index += 4)
+		{
+			const VectorRegister4Int Teams = VectorIntLoad(View.TeamBits + Index);
+			const VectorRegister4Float TeamPass = VectorCastIntToFloat(VectorIntCompareNEQ(VectorIntAnd(Teams, MaskBits), Zero));
+			const VectorRegister4Float Inside = VectorBitwiseAnd(TeamPass, VectorTest(VectorLoad(View.X + Index), VectorLoad(View.Y + Index)));
+
+			uint32 Lanes = static_cast<uint32>(VectorMaskBits(Inside));
+			while (Lanes != 0)
+			{
+				OutHandles.Add(Index + static_cast<int32>(FMath::CountTrailingZeros(Lanes)));
+				Lanes &= Lanes - 1;
+			}
+		}
+
+		for (; Index < View.Num; ++Index)
+		{
+			if ((View.TeamBits[Index] & TeamMask) != 0 && ScalarTest(View.X[Index], View.Y[Index]))
+			{
+				OutHandles.Add(Index);
+			}
+		}
+
+		return OutHandles.Num() - StartNum;
+	}
+}
+
+int32 FDelveDeepAoEQuery::Circle(const FDelveDeepCombatantView& View, const FVector& Center, float Radius, uint32 TeamMask, TArray<int32>& OutHandles)
+{
+	if (Radius < 0.0f)
+	{
+		return 0;
+	}
+
+	const float CenterX = Center.X;
+	const float CenterY = Center.Y;
+	const float RadiusSq = Radius * Radius;
+
+	const VectorRegister4Float VCenterX = VectorSetFloat1(CenterX);
+	const VectorRegister4Float VCenterY = VectorSetFloat1(CenterY);
+	const VectorRegister4Float VRadiusSq = VectorSetFloat1(RadiusSq);
+
+	return DelveDeepAoE::ScanCombatants(View, TeamMask, OutHandles,
+		[&](const VectorRegister4Float& X, const VectorRegister4Float& Y)
+		{
+			const VectorRegister4Float DX = VectorSubtract(X, VCenterX);
+			const VectorRegister4Float DY = VectorSubtract(Y, VCenterY);
+			const VectorRegister4Float DistanceSq = VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX));
+			return VectorCompareLE(DistanceSq, VRadiusSq);
+		},
+		[&](float X, float Y)
+		{
+			const float DX = X - CenterX;
+			const float DY = Y - CenterY;
+			return DX * DX + DY * DY <= RadiusSq;
+		});
+}
+
+int32 FDelveDeepAoEQuery::Cone(const FDelveDeepCombatantView& View, const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, TArray<int32>& OutHandles)
+{
+	const FVector2D Axis = FVector2D(Direction).GetSafeNormal();
+	if (Range < 0.0f || Axis.IsZero())
+	{
+		return 0;
+	}
+
+	const float ApexX = Apex.X;
+	const float ApexY = Apex.Y;
+	const float AxisX = Axis.X;
+	const float AxisY = Axis.Y;
+	const float RangeSq = Range * Range;
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+
+	const VectorRegister4Float VApexX = VectorSetFloat1(ApexX);
+	const VectorRegister4Float VApexY = VectorSetFloat1(ApexY);
+	const VectorRegister4Float VAxisX = VectorSetFloat1(AxisX);
+	const VectorRegister4Float VAxisY = VectorSetFloat1(AxisY);
+	const VectorRegister4Float VRangeSq = VectorSetFloat1(RangeSq);
+	const VectorRegister4Float VCosHalfAngle = VectorSetFloat1(CosHalfAngle);
+
+	// Inside when within range and the angle to the axis is at most the half angle:
+	// dot(D, Axis) >= cos(HalfAngle) * |D|, which avoids normalizing D
+	return DelveDeepAoE::ScanCombatants(View, TeamMask, OutHandles,
+		[&](const VectorRegister4Float& X, const VectorRegister4Float& Y)
+		{
+			const VectorRegister4Float DX = VectorSubtract(X, VApexX);
+			const VectorRegister4Float DY = VectorSubtract(Y, VApexY);
+			const VectorRegister4Float DistanceSq = VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX));
+			const VectorRegister4Float Dot = VectorMultiplyAdd(DY, VAxisY, VectorMultiply(DX, VAxisX));
+			const VectorRegister4Float InRange = VectorCompareLE(DistanceSq, VRangeSq);
+			const VectorRegister4Float InAngle = VectorCompareGE(Dot, VectorMultiply(VCosHalfAngle, VectorSqrt(DistanceSq)));
+			return VectorBitwiseAnd(InRange, InAngle);
+		},
+		[&](float X, float Y)
+		{
+			const float DX = X - ApexX;
+			const float DY = Y - ApexY;
+			const float DistanceSq = DX * DX + DY * DY;
+			return DistanceSq <= RangeSq && DX * AxisX + DY * AxisY >= CosHalfAngle * FMath::Sqrt(DistanceSq);
+		});
+}
+
+int32 FDelveDeepAoEQuery::Line(const FDelveDeepCombatantView& View, const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, TArray<int32>& OutHandles)
+{
+	const float SegmentX = End.X - Start.X;
+	const float SegmentY = End.Y - Start.Y;
+	const float SegmentLengthSq = SegmentX * SegmentX + SegmentY * SegmentY;
+	if (SegmentLengthSq <= UE_SMALL_NUMBER)
+	{
+		return Circle(View, Start, HalfWidth, TeamMask, OutHandles);
+	}
+
+	if (HalfWidth < 0.0f)
+	{
+		return 0;
+	}
+
+	const float StartX = Start.X;
+	const float StartY = Start.Y;
+	const float InvLengthSq = 1.0f / SegmentLengthSq;
+	const float HalfWidthSq = HalfWidth * HalfWidth;
+
+	const VectorRegister4Float VStartX = VectorSetFloat1(StartX);
+	const VectorRegister4Float VStartY = VectorSetFloat1(StartY);
+	const VectorRegister4Float VSegmentX = VectorSetFloat1(SegmentX);
+	const VectorRegister4Float VSegmentY = VectorSetFloat1(SegmentY);
+	const VectorRegister4Float VInvLengthSq = VectorSetFloat1(InvLengthSq);
+	const VectorRegister4Float VHalfWidthSq = VectorSetFloat1(HalfWidthSq);
+	const VectorRegister4Float VZero = VectorZeroFloat();
+	const VectorRegister4Float VOne = VectorOneFloat();
+
+	// Distance to the closest point on the segment, with the projection clamped to [0, 1]
+	return DelveDeepAoE::ScanCombatants(View, TeamMask, OutHandles,
+		[&](const VectorRegister4Float& X, const VectorRegister4Float& Y)
+		{
+			const VectorRegister4Float DX = VectorSubtract(X, VStartX);
+			const VectorRegister4Float DY = VectorSubtract(Y, VStartY);
+			const VectorRegister4Float Dot = VectorMultiplyAdd(DY, VSegmentY, VectorMultiply(DX, VSegmentX));
+			const VectorRegister4Float T = VectorMin(VectorMax(VectorMultiply(Dot, VInvLengthSq), VZero), VOne);
+			const VectorRegister4Float OffsetX = VectorSubtract(DX, VectorMultiply(T, VSegmentX));
+			const VectorRegister4Float OffsetY = VectorSubtract(DY, VectorMultiply(T, VSegmentY));
+			const VectorRegister4Float DistanceSq = VectorMultiplyAdd(OffsetY, OffsetY, VectorMultiply(OffsetX, OffsetX));
+			return VectorCompareLE(DistanceSq, VHalfWidthSq);
+		},
+		[&](float X, float Y)
+		{
+			const float DX = X - StartX;
+			const float DY = Y - StartY;
+			const float T = FMath::Clamp((DX * SegmentX + DY * SegmentY) * InvLengthSq, 0.0f, 1.0f);
+			const float OffsetX = DX - T * SegmentX;
+			const float OffsetY = DY - T * SegmentY;
+			return OffsetX * OffsetX + OffsetY * OffsetY <= HalfWidthSq;
+		});
+}
+
+int32 UDelveDeepAoESubsystem::QueryCircle(const FVector& Center, float Radius, uint32 TeamMask, TArray<int32>& OutHandles) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_AoEQueries);
+
+	const UDelveDeepTargetingSubsystem* Targeting = GetTargeting();
+	return Targeting ? FDelveDeepAoEQuery::Circle(Targeting->GetPackedCombatants(), Center, Radius, TeamMask, OutHandles) : 0;
+}
+
+int32 UDelveDeepAoESubsystem::QueryCone(const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, TArray<int32>& OutHandles) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_AoEQueries);
+
+	const UDelveDeepTargetingSubsystem* Targeting = GetTargeting();
+	return Targeting ? FDelveDeepAoEQuery::Cone(Targeting->GetPackedCombatants(), Apex, Direction, Range, HalfAngleDegrees, TeamMask, OutHandles) : 0;
+}
+
+int32 UDelveDeepAoESubsystem::QueryLine(const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, TArray<int32>& OutHandles) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_AoEQueries);
+
+	const UDelveDeepTargetingSubsystem* Targeting = GetTargeting();
+	return Targeting ? FDelveDeepAoEQuery::Line(Targeting->GetPackedCombatants(), Start, End, HalfWidth, TeamMask, OutHandles) : 0;
+}
+
+int32 UDelveDeepAoESubsystem::ApplyDamage(TConstArrayView<int32> Handles, float Damage, FName DamageType, AActor* Instigator)
+{
+	const UDelveDeepTargetingSubsystem* Targeting = GetTargeting();
+	if (!Targeting || Handles.Num() == 0 || Damage <= 0.0f)
+	{
+		return 0;
+	}
+
+	UDelveDeepDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UDelveDeepDamageQueueSubsystem>();
+
+	int32 Damaged = 0;
+	for (const int32 Handle : Handles)
+	{
+		ADelveDeepCharacter* Target = Cast<ADelveDeepCharacter>(Targeting->GetCombatantActor(Handle));
+		if (!IsValid(Target) || Target == Instigator)
+		{
+			continue;
+		}
+
+		if (DamageQueue)
+		{
+			DamageQueue->EnqueueHit(Target, Damage, DamageType, Instigator);
+		}
+		else
+		{
+			Target->ApplySimpleDamage(Damage, Instigator);
+		}
+
+		++Damaged;
+	}
+
+	return Damaged;
+}
+
+int32 UDelveDeepAoESubsystem::DamageCircle(const FVector& Center, float Radius, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator)
+{
+	Scratch.Reset();
+	QueryCircle(Center, Radius, TeamMask, Scratch);
+	return ApplyDamage(Scratch, Damage, DamageType, Instigator);
+}
+
+int32 UDelveDeepAoESubsystem::DamageCone(const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator)
+{
+	Scratch.Reset();
+	QueryCone(Apex, Direction, Range, HalfAngleDegrees, TeamMask, Scratch);
+	return ApplyDamage(Scratch, Damage, DamageType, Instigator);
+}
+
+int32 UDelveDeepAoESubsystem::DamageLine(const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator)
+{
+	Scratch.Reset();
+	QueryLine(Start, End, HalfWidth, TeamMask, Scratch);
+	return ApplyDamage(Scratch, Damage, DamageType, Instigator);
+}
+
+uint32 UDelveDeepAoESubsystem::GetAbilityTeamMask(uint8 Team, bool bAffectsAllies)
+{
+	return bAffectsAllies ? DelveDeepTeam::All : DelveDeepTeam::Opposing(Team);
+}
+
+bool UDelveDeepAoESubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UDelveDeepTargetingSubsystem* UDelveDeepAoESubsystem::GetTargeting() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UDelveDeepTargetingSubsystem>() : nullptr;
+}
@@ -5,6 +5,12 @@
 #include "Character/DelveDeepStatsComponent.h"
 #include "Character/DelveDeepAbilitiesComponent.h"
 #include "Character/DelveDeepEquipmentComponent.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepActorPoolSubsystem.h"
+#include "Character/DelveDeepCharacterInitSubsystem.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "Character/DelveDeepAILodSubsystem.h"
+#include "Character/DelveDeepSpriteBatchSubsystem.h"
 #include "DelveDeepConfigurationManager.h"
 #include "DelveDeepCharacterData.h"
 #include "DelveDeepValidation.h"
@@ -12,6 +18,8 @@
 #include "DelveDeepEventPayload.h"
 #include "DelveDeepTelemetrySubsystem.h"
 #include "GameplayTagsManager.h"
+#include "AIController.h"
+#include "BrainComponent.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "PaperFlipbookComponent.h"
@@ -20,7 +28,6 @@
 DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepCharacter, Log, All);
 
 // Performance profiling stats
-DECLARE_STATS_GROUP(TEXT("DelveDeep"), STATGROUP_DelveDeep, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("Character TakeDamage"), STAT_CharacterTakeDamage, STATGROUP_DelveDeep);
 DECLARE_CYCLE_STAT(TEXT("Character Heal"), STAT_CharacterHeal, STATGROUP_DelveDeep);
 DECLARE_CYCLE_STAT(TEXT("Character Die"), STAT_CharacterDie, STATGROUP_DelveDeep);
@@ -43,8 +50,22 @@ ADelveDeepCharacter::ADelveDeepCharacter()
 	// Initialize character data to nullptr
 	CharacterData = nullptr;
 
-	// Initialize death flag
+	// Initialize death and pool flags
 	bIsDead = false;
+	bIsPooled = false;
+
+	// Stream assets in the background where the world supports it
+	bAsyncInitialization = true;
+	bInitializationPending = false;
+
+	// Drawn by the character's own flipbook component unless opted in
+	bUseSpriteBatching = false;
+
+	// Not targetable until play begins
+	TeamId = DelveDeepTeam::Players;
+	TargetingHandle = INDEX_NONE;
+	AILodHandle = INDEX_NONE;
+	SpriteBatchHandle = INDEX_NONE;
 }
 
 void ADelveDeepCharacter::BeginPlay()
@@ -52,13 +73,26 @@ void ADelveDeepCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	// Register with telemetry subsystem
-	if (UGameInstance* GameInstance = GetGameInstance())
+	TrackCharacterCount(1);
+
+	// Register with automatic targeting and, if opted in, the sprite batch
+	SetTargetable(true);
+	SetSpriteBatched(true);
+
+	// Spawn pending and finish once assets have streamed in
+	if (bAsyncInitialization)
 	{
-		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		if (UDelveDeepCharacterInitSubsystem* InitSubsystem = GetWorld()->GetSubsystem<UDelveDeepCharacterInitSubsystem>())
 		{
-			// Track character entity count
-			int32 CurrentCount = Telemetry->GetEntityCount(FName("Characters"));
-			Telemetry->TrackEntityCount(FName("Characters"), CurrentCount + 1);
+			if (ResolveCharacterData())
+			{
+				bInitializationPending = InitSubsystem->RequestInitialization(this);
+			}
+
+			if (bInitializationPending)
+			{
+				return;
+			}
 		}
 	}
 
@@ -68,28 +102,237 @@ void ADelveDeepCharacter::BeginPlay()
 
 void ADelveDeepCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Unregister from telemetry subsystem
+	// Unregister from telemetry subsystem (pooled characters already were)
+	if (!bIsPooled)
+	{
+		TrackCharacterCount(-1);
+	}
+
+	SetTargetable(false);
+	SetAILodManaged(false);
+	SetSpriteBatched(false);
+
+	// Drop any pending initialization and release streamed assets
+	if (UDelveDeepCharacterInitSubsystem* InitSubsystem = GetWorld()->GetSubsystem<UDelveDeepCharacterInitSubsystem>())
+	{
+		InitSubsystem->ReleaseCharacter(this);
+	}
+	bInitializationPending = false;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ADelveDeepCharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	SetAILodManaged(true);
+}
+
+void ADelveDeepCharacter::UnPossessed()
+{
+	SetAILodManaged(false);
+
+	Super::UnPossessed();
+}
+
+void ADelveDeepCharacter::TrackCharacterCount(int32 Delta)
+{
 	if (UGameInstance* GameInstance = GetGameInstance())
 	{
 		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
 		{
-			// Decrement character entity count
-			int32 CurrentCount = Telemetry->GetEntityCount(FName("Characters"));
-			Telemetry->TrackEntityCount(FName("Characters"), FMath::Max(0, CurrentCount - 1));
+			static const FName CharactersName(TEXT("Characters"));
+			const int32 CurrentCount = Telemetry->GetEntityCount(CharactersName);
+			Telemetry->TrackEntityCount(CharactersName, FMath::Max(0, CurrentCount + Delta));
 		}
 	}
+}
 
-	Super::EndPlay(EndPlayReason);
+void ADelveDeepCharacter::SetTargetable(bool bTargetable)
+{
+	UWorld* World = GetWorld();
+	UDelveDeepTargetingSubsystem* Targeting = World ? World->GetSubsystem<UDelveDeepTargetingSubsystem>() : nullptr;
+	if (!Targeting)
+	{
+		return;
+	}
+
+	if (bTargetable && TargetingHandle == INDEX_NONE)
+	{
+		TargetingHandle = Targeting->RegisterCombatant(this, GetActorLocation(), TeamId);
+	}
+	else if (!bTargetable && TargetingHandle != INDEX_NONE)
+	{
+		Targeting->UnregisterCombatant(TargetingHandle);
+		TargetingHandle = INDEX_NONE;
+	}
+}
+
+void ADelveDeepCharacter::SetAILodManaged(bool bManaged)
+{
+	UWorld* World = GetWorld();
+	UDelveDeepAILodSubsystem* AILod = World ? World->GetSubsystem<UDelveDeepAILodSubsystem>() : nullptr;
+	if (!AILod)
+	{
+		return;
+	}
+
+	AAIController* AIController = Cast<AAIController>(GetController());
+	if (bManaged && AILodHandle == INDEX_NONE && AIController && !bIsDead && !bIsPooled)
+	{
+		AILodHandle = AILod->RegisterAIController(AIController);
+	}
+	else if (!bManaged && AILodHandle != INDEX_NONE)
+	{
+		AILod->UnregisterAgent(AILodHandle);
+		AILodHandle = INDEX_NONE;
+	}
+}
+
+void ADelveDeepCharacter::SetAILogicRunning(bool bRunning)
+{
+	AAIController* AIController = Cast<AAIController>(GetController());
+	UBrainComponent* Brain = AIController ? AIController->GetBrainComponent() : nullptr;
+	if (!Brain)
+	{
+		return;
+	}
+
+	if (!bRunning)
+	{
+		AIController->StopMovement();
+		Brain->StopLogic(TEXT("Pooled"));
+	}
+	else if (!Brain->IsRunning())
+	{
+		Brain->RestartLogic();
+	}
+}
+
+void ADelveDeepCharacter::SetSpriteBatched(bool bBatched)
+{
+	UWorld* World = GetWorld();
+	UDelveDeepSpriteBatchSubsystem* SpriteBatch = World ? World->GetSubsystem<UDelveDeepSpriteBatchSubsystem>() : nullptr;
+	if (!SpriteBatch)
+	{
+		return;
+	}
+
+	if (bBatched && SpriteBatchHandle == INDEX_NONE && bUseSpriteBatching && !bIsPooled)
+	{
+		SpriteBatchHandle = SpriteBatch->RegisterCharacter(this);
+	}
+	else if (!bBatched && SpriteBatchHandle != INDEX_NONE)
+	{
+		SpriteBatch->UnregisterCharacter(SpriteBatchHandle);
+		SpriteBatchHandle = INDEX_NONE;
+	}
+}
+
+bool ADelveDeepCharacter::WasSpriteRecentlyRendered(float Tolerance) const
+{
+	if (SpriteBatchHandle != INDEX_NONE)
+	{
+		if (const UDelveDeepSpriteBatchSubsystem* SpriteBatch = GetWorld()->GetSubsystem<UDelveDeepSpriteBatchSubsystem>())
+		{
+			return SpriteBatch->WasInstanceRecentlyVisible(SpriteBatchHandle, Tolerance);
+		}
+	}
+
+	return WasRecentlyRendered(Tolerance);
+}
+
+void ADelveDeepCharacter::SetSpriteFlipbook(UPaperFlipbook* Flipbook, bool bLooping)
+{
+	if (SpriteBatchHandle != INDEX_NONE)
+	{
+		if (UDelveDeepSpriteBatchSubsystem* SpriteBatch = GetWorld()->GetSubsystem<UDelveDeepSpriteBatchSubsystem>())
+		{
+			SpriteBatch->PlayFlipbook(SpriteBatchHandle, Flipbook, bLooping);
+			return;
+		}
+	}
+
+	if (UPaperFlipbookComponent* SpriteComponent = GetSprite())
+	{
+		SpriteComponent->SetFlipbook(Flipbook);
+	}
+}
+
+void ADelveDeepCharacter::SetSpriteColor(const FLinearColor& Color)
+{
+	if (SpriteBatchHandle != INDEX_NONE)
+	{
+		if (UDelveDeepSpriteBatchSubsystem* SpriteBatch = GetWorld()->GetSubsystem<UDelveDeepSpriteBatchSubsystem>())
+		{
+			SpriteBatch->SetInstanceColor(SpriteBatchHandle, Color);
+			return;
+		}
+	}
+
+	if (UPaperFlipbookComponent* SpriteComponent = GetSprite())
+	{
+		SpriteComponent->SetSpriteColor(Color);
+	}
+}
+
+void ADelveDeepCharacter::SetTeamId(uint8 NewTeamId)
+{
+	TeamId = NewTeamId;
+
+	if (TargetingHandle != INDEX_NONE)
+	{
+		if (UDelveDeepTargetingSubsystem* Targeting = GetWorld()->GetSubsystem<UDelveDeepTargetingSubsystem>())
+		{
+			Targeting->SetCombatantTeam(TargetingHandle, TeamId);
+		}
+	}
 }
 
 void ADelveDeepCharacter::InitializeFromData()
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharacterInitialize);
+
+	if (!ResolveCharacterData())
+	{
+		return;
+	}
+
+	// Initialize components with character data
+	InitializeComponents();
+
+	UE_LOG(LogDelveDeepCharacter, Display, 
+		TEXT("Character initialized: %s (Class: %s)"), 
+		*GetName(), *CharacterClassName.ToString());
+}
+
+void ADelveDeepCharacter::FinishInitialization()
+{
+	if (!bInitializationPending)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_CharacterInitialize);
+	bInitializationPending = false;
+
+	// Starting weapon and abilities are resident, so components resolve them without blocking.
+	// The character was already targetable, so keep any damage or modifiers it picked up meanwhile.
+	InitializeComponents(true);
+
+	UE_LOG(LogDelveDeepCharacter, Verbose, 
+		TEXT("Character initialized asynchronously: %s (Class: %s)"), 
+		*GetName(), *CharacterClassName.ToString());
+}
+
+bool ADelveDeepCharacter::ResolveCharacterData()
+{
 	// Validate character class name is set
 	if (CharacterClassName.IsNone())
 	{
 		UE_LOG(LogDelveDeepCharacter, Error, TEXT("Character class name not set for %s"), *GetName());
-		return;
+		return false;
 	}
 
 	// Get configuration manager
@@ -97,14 +340,14 @@ void ADelveDeepCharacter::InitializeFromData()
 	if (!GameInstance)
 	{
 		UE_LOG(LogDelveDeepCharacter, Error, TEXT("Failed to get game instance for %s"), *GetName());
-		return;
+		return false;
 	}
 
 	UDelveDeepConfigurationManager* ConfigManager = GameInstance->GetSubsystem<UDelveDeepConfigurationManager>();
 	if (!ConfigManager)
 	{
 		UE_LOG(LogDelveDeepCharacter, Error, TEXT("Failed to get configuration manager for %s"), *GetName());
-		return;
+		return false;
 	}
 
 	// Query character data
@@ -114,7 +357,7 @@ void ADelveDeepCharacter::InitializeFromData()
 		UE_LOG(LogDelveDeepCharacter, Error, 
 			TEXT("Failed to load character data for class '%s' on %s"), 
 			*CharacterClassName.ToString(), *GetName());
-		return;
+		return false;
 	}
 
 	// Validate character data
@@ -132,12 +375,7 @@ void ADelveDeepCharacter::InitializeFromData()
 		UE_LOG(LogDelveDeepCharacter, Warning, TEXT("Using fallback values for %s"), *GetName());
 	}
 
-	// Initialize components with character data
-	InitializeComponents();
-
-	UE_LOG(LogDelveDeepCharacter, Display, 
-		TEXT("Character initialized: %s (Class: %s)"), 
-		*GetName(), *CharacterClassName.ToString());
+	return true;
 }
 
 bool ADelveDeepCharacter::ValidateCharacterData(FDelveDeepValidationContext& Context) const
@@ -191,7 +429,7 @@ bool ADelveDeepCharacter::ValidateCharacterData(FDelveDeepValidationContext& Con
 	return bIsValid;
 }
 
-void ADelveDeepCharacter::InitializeComponents()
+void ADelveDeepCharacter::InitializeComponents(bool bKeepCurrentStats)
 {
 	// Validate components exist
 	if (!StatsComponent || !AbilitiesComponent || !EquipmentComponent)
@@ -210,7 +448,14 @@ void ADelveDeepCharacter::InitializeComponents()
 	}
 
 	// Initialize stats component
-	StatsComponent->InitializeFromCharacterData(CharacterData);
+	if (bKeepCurrentStats)
+	{
+		StatsComponent->RebaseFromCharacterData(CharacterData);
+	}
+	else
+	{
+		StatsComponent->InitializeFromCharacterData(CharacterData);
+	}
 
 	// Initialize abilities component
 	AbilitiesComponent->InitializeFromCharacterData(CharacterData);
@@ -225,6 +470,7 @@ void ADelveDeepCharacter::InitializeComponents()
 float ADelveDeepCharacter::TakeDamage(float Damage, const FDamageEvent& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharacterTakeDamage);
+	TRACE_DELVEDEEP_DAMAGE();
 	
 	// Call parent implementation
 	const float ActualDamage = Super::TakeDamage(Damage, DamageEvent, EventInstigator, DamageCauser);
@@ -249,31 +495,40 @@ float ADelveDeepCharacter::TakeDamage(float Damage, const FDamageEvent& DamageEv
 		return 0.0f;
 	}
 
+	// In game worlds the hit joins this frame's batch and is resolved with the rest
+	UWorld* World = GetWorld();
+	if (UDelveDeepDamageQueueSubsystem* DamageQueue = World ? World->GetSubsystem<UDelveDeepDamageQueueSubsystem>() : nullptr)
+	{
+		const FName DamageType = DamageEvent.DamageTypeClass ? DamageEvent.DamageTypeClass->GetFName() : NAME_None;
+		DamageQueue->EnqueueHit(this, ActualDamage, DamageType, DamageCauser);
+		return DamageQueue->GetExpectedDamage(this, ActualDamage, DamageType);
+	}
+
+	// Apply armor the same way the damage queue does
+	const float MitigatedDamage = ActualDamage * UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(GetArmor());
+
 	// Apply damage to health
-	StatsComponent->ModifyHealth(-ActualDamage);
+	StatsComponent->ModifyHealth(-MitigatedDamage);
 
 	// Broadcast damage event
-	BroadcastDamageEvent(ActualDamage, DamageCauser);
+	BroadcastDamageEvent(MitigatedDamage, DamageCauser);
 
 	// Call Blueprint event
-	OnDamaged(ActualDamage, DamageCauser);
+	OnDamaged(MitigatedDamage, DamageCauser);
 
 	// Apply visual feedback (sprite flash)
-	if (UPaperFlipbookComponent* SpriteComponent = GetSprite())
+	if (GetSprite())
 	{
 		// Flash red for damage feedback
-		SpriteComponent->SetSpriteColor(FLinearColor(1.0f, 0.5f, 0.5f, 1.0f));
+		SetSpriteColor(FLinearColor(1.0f, 0.5f, 0.5f, 1.0f));
 		
 		// Reset color after 0.1 seconds
 		FTimerHandle FlashTimerHandle;
 		GetWorld()->GetTimerManager().SetTimer(
 			FlashTimerHandle,
-			[this, SpriteComponent]()
+			[this]()
 			{
-				if (SpriteComponent)
-				{
-					SpriteComponent->SetSpriteColor(FLinearColor::White);
-				}
+				SetSpriteColor(FLinearColor::White);
 			},
 			0.1f,
 			false
@@ -288,9 +543,28 @@ float ADelveDeepCharacter::TakeDamage(float Damage, const FDamageEvent& DamageEv
 
 	UE_LOG(LogDelveDeepCharacter, Verbose, 
 		TEXT("%s took %.2f damage from %s"), 
-		*GetName(), ActualDamage, DamageCauser ? *DamageCauser->GetName() : TEXT("Unknown"));
+		*GetName(), MitigatedDamage, DamageCauser ? *DamageCauser->GetName() : TEXT("Unknown"));
 	
-	return ActualDamage;
+	return MitigatedDamage;
+}
+
+bool ADelveDeepCharacter::ApplyResolvedDamage(float Damage, AActor* DamageSource)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharacterTakeDamage);
+
+	if (bIsDead || !StatsComponent || Damage <= 0.0f)
+	{
+		return false;
+	}
+
+	StatsComponent->ModifyHealth(-Damage);
+	OnDamaged(Damage, DamageSource);
+
+	UE_LOG(LogDelveDeepCharacter, Verbose, 
+		TEXT("%s took %.2f batched damage from %s"), 
+		*GetName(), Damage, DamageSource ? *DamageSource->GetName() : TEXT("Unknown"));
+
+	return StatsComponent->GetCurrentHealth() <= 0.0f;
 }
 
 void ADelveDeepCharacter::ApplySimpleDamage(float DamageAmount, AActor* DamageSource)
@@ -335,21 +609,18 @@ void ADelveDeepCharacter::Heal(float HealAmount)
 	OnHealed(HealAmount);
 
 	// Apply visual feedback (sprite glow)
-	if (UPaperFlipbookComponent* SpriteComponent = GetSprite())
+	if (GetSprite())
 	{
 		// Glow green for healing feedback
-		SpriteComponent->SetSpriteColor(FLinearColor(0.5f, 1.0f, 0.5f, 1.0f));
+		SetSpriteColor(FLinearColor(0.5f, 1.0f, 0.5f, 1.0f));
 		
 		// Reset color after 0.2 seconds
 		FTimerHandle GlowTimerHandle;
 		GetWorld()->GetTimerManager().SetTimer(
 			GlowTimerHandle,
-			[this, SpriteComponent]()
+			[this]()
 			{
-				if (SpriteComponent)
-				{
-					SpriteComponent->SetSpriteColor(FLinearColor::White);
-				}
+				SetSpriteColor(FLinearColor::White);
 			},
 			0.2f,
 			false
@@ -372,6 +643,10 @@ void ADelveDeepCharacter::Die()
 	// Set death flag
 	bIsDead = true;
 
+	// Stop being picked as a target and stop thinking
+	SetTargetable(false);
+	SetAILodManaged(false);
+
 	// Disable input
 	DisableInput(nullptr);
 
@@ -390,12 +665,16 @@ void ADelveDeepCharacter::Die()
 	// Play death animation
 	PlayDeathAnimation();
 
-	// Set timer to destroy actor after 2 seconds
+	// Set timer to return actor to its pool (or destroy it) after 2 seconds
 	GetWorld()->GetTimerManager().SetTimer(
 		DeathTimerHandle,
 		[this]()
 		{
-			Destroy();
+			UDelveDeepActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UDelveDeepActorPoolSubsystem>();
+			if (!Pool || !Pool->ReleaseCharacter(this))
+			{
+				Destroy();
+			}
 		},
 		2.0f,
 		false
@@ -412,9 +691,90 @@ void ADelveDeepCharacter::Respawn()
 		return;
 	}
 
+	ResetCharacterState();
+
+	UE_LOG(LogDelveDeepCharacter, Display, TEXT("%s respawned"), *GetName());
+}
+
+void ADelveDeepCharacter::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+	if (!bIsPooled)
+	{
+		return;
+	}
+
+	bIsPooled = false;
+
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->Activate();
+		Movement->SetMovementMode(MOVE_Walking);
+	}
+
+	ResetCharacterState();
+	TrackCharacterCount(1);
+
+	UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("%s reused from pool at %s"), *GetName(), *Location.ToString());
+}
+
+void ADelveDeepCharacter::DeactivateForPool()
+{
+	if (bIsPooled)
+	{
+		return;
+	}
+
+	bIsPooled = true;
+
+	// A pooled character must not be destroyed by a pending death timer
+	if (DeathTimerHandle.IsValid())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(DeathTimerHandle);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	DisableInput(nullptr);
+	SetTargetable(false);
+	SetAILodManaged(false);
+	SetAILogicRunning(false);
+	SetSpriteBatched(false);
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->Deactivate();
+	}
+
+	// Give back world-subsystem slots; ResetCharacterState takes them again on reuse
+	if (StatsComponent)
+	{
+		StatsComponent->SetResourceRegenPaused(true);
+	}
+
+	if (AbilitiesComponent)
+	{
+		AbilitiesComponent->ReleaseCooldownSlots();
+	}
+
+	TrackCharacterCount(-1);
+}
+
+void ADelveDeepCharacter::ResetCharacterState()
+{
 	// Reset death flag
 	bIsDead = false;
 
+	// Targetable, thinking and drawn again
+	SetTargetable(true);
+	SetAILodManaged(true);
+	SetAILogicRunning(true);
+	SetSpriteBatched(true);
+
 	// Clear death timer if active
 	if (DeathTimerHandle.IsValid())
 	{
@@ -426,6 +786,7 @@ void ADelveDeepCharacter::Respawn()
 	{
 		StatsComponent->ResetToMaxValues();
 		StatsComponent->ClearAllModifiers();
+		StatsComponent->SetResourceRegenPaused(false);
 	}
 
 	// Re-enable input
@@ -438,15 +799,10 @@ void ADelveDeepCharacter::Respawn()
 	}
 
 	// Reset sprite color
-	if (UPaperFlipbookComponent* SpriteComponent = GetSprite())
-	{
-		SpriteComponent->SetSpriteColor(FLinearColor::White);
-	}
+	SetSpriteColor(FLinearColor::White);
 
 	// Reset to idle animation
 	PlayIdleAnimation();
-
-	UE_LOG(LogDelveDeepCharacter, Display, TEXT("%s respawned"), *GetName());
 }
 
 float ADelveDeepCharacter::GetCurrentHealth() const
@@ -469,6 +825,11 @@ float ADelveDeepCharacter::GetMaxResource() const
 	return StatsComponent ? StatsComponent->GetMaxResource() : 0.0f;
 }
 
+float ADelveDeepCharacter::GetArmor() const
+{
+	return CharacterData ? CharacterData->BaseArmor : 0.0f;
+}
+
 void ADelveDeepCharacter::BroadcastDamageEvent(float DamageAmount, AActor* DamageSource)
 {
 	if (UGameInstance* GameInstance = GetGameInstance())
@@ -502,9 +863,9 @@ void ADelveDeepCharacter::BroadcastDamageEvent(float DamageAmount, AActor* Damag
 
 void ADelveDeepCharacter::UpdateSpriteFacingDirection()
 {
-	// Get sprite component
+	// Batched sprites get their facing from the sprite batch update
 	UPaperFlipbookComponent* SpriteComponent = GetSprite();
-	if (!SpriteComponent)
+	if (!SpriteComponent || SpriteBatchHandle != INDEX_NONE)
 	{
 		return;
 	}
@@ -552,7 +913,7 @@ void ADelveDeepCharacter::PlayIdleAnimation()
 	{
 		if (UPaperFlipbook* IdleFlipbook = CharacterData->IdleAnimation.LoadSynchronous())
 		{
-			SpriteComponent->SetFlipbook(IdleFlipbook);
+			SetSpriteFlipbook(IdleFlipbook);
 			UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("Playing idle animation for %s"), *GetName());
 		}
 		else
@@ -586,7 +947,7 @@ void ADelveDeepCharacter::PlayWalkAnimation()
 	{
 		if (UPaperFlipbook* WalkFlipbook = CharacterData->WalkAnimation.LoadSynchronous())
 		{
-			SpriteComponent->SetFlipbook(WalkFlipbook);
+			SetSpriteFlipbook(WalkFlipbook);
 			UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("Playing walk animation for %s"), *GetName());
 		}
 		else
@@ -620,7 +981,7 @@ void ADelveDeepCharacter::PlayAttackAnimation()
 	{
 		if (UPaperFlipbook* AttackFlipbook = CharacterData->AttackAnimation.LoadSynchronous())
 		{
-			SpriteComponent->SetFlipbook(AttackFlipbook);
+			SetSpriteFlipbook(AttackFlipbook);
 			UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("Playing attack animation for %s"), *GetName());
 		}
 		else
@@ -654,7 +1015,7 @@ void ADelveDeepCharacter::PlayDeathAnimation()
 	{
 		if (UPaperFlipbook* DeathFlipbook = CharacterData->DeathAnimation.LoadSynchronous())
 		{
-			SpriteComponent->SetFlipbook(DeathFlipbook);
+			SetSpriteFlipbook(DeathFlipbook, false);
 			UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("Playing death animation for %s"), *GetName());
 		}
 		else
@@ -9,8 +9,11 @@
 #include "Character/DelveDeepStatsComponent.h"
 #include "Character/DelveDeepAbilitiesComponent.h"
 #include "Character/DelveDeepEquipmentComponent.h"
+#include "Character/DelveDeepActorPoolSubsystem.h"
 #include "DelveDeepValidation.h"
+#include "DelveDeepTelemetrySubsystem.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -41,19 +44,41 @@ ADelveDeepCharacter* UDelveDeepCharacterBlueprintLibrary::SpawnCharacter(
 		return nullptr;
 	}
 
-	// Spawn character
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	// Respect the adaptive spawn cap so large waves cannot push the frame over budget
+	if (UGameInstance* GameInstance = World->GetGameInstance())
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			if (!Telemetry->CanSpawnEntity(FName("Characters")))
+			{
+				UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("SpawnCharacter: Spawn throttled by adaptive entity limit (%d)"),
+					Telemetry->GetAdaptiveEntityLimit(FName("Characters")));
+				return nullptr;
+			}
+		}
+	}
+
+	// Reuse a pooled character when the class is pooled, otherwise spawn one
+	ADelveDeepCharacter* SpawnedCharacter = nullptr;
+	if (UDelveDeepActorPoolSubsystem* Pool = World->GetSubsystem<UDelveDeepActorPoolSubsystem>())
+	{
+		SpawnedCharacter = Pool->AcquireCharacter(CharacterClass, Location, Rotation);
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-	ADelveDeepCharacter* SpawnedCharacter = World->SpawnActor<ADelveDeepCharacter>(
-		CharacterClass,
-		Location,
-		Rotation,
-		SpawnParams);
+		SpawnedCharacter = World->SpawnActor<ADelveDeepCharacter>(
+			CharacterClass,
+			Location,
+			Rotation,
+			SpawnParams);
+	}
 
 	if (SpawnedCharacter)
 	{
-		UE_LOG(LogDelveDeepCharacter, Display, TEXT("SpawnCharacter: Successfully spawned character at %s"), 
+		UE_LOG(LogDelveDeepCharacter, Verbose, TEXT("SpawnCharacter: Successfully spawned character at %s"), 
 			*Location.ToString());
 	}
 	else
@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepCharacterInitSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "DelveDeepCharacterData.h"
+#include "DelveDeepStats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepCharacterInit, Log, All);
+
+void UDelveDeepCharacterInitSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<ADelveDeepCharacter>, TSharedPtr<FStreamableHandle>>& Pair : Handles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->CancelHandle();
+		}
+	}
+
+	Handles.Empty();
+	Loading.Empty();
+	ReadyQueue.Empty();
+	ReadyHead = 0;
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepCharacterInitSubsystem::Tick(float DeltaTime)
+{
+	ProcessReadyCharacters(FrameBudgetMs / 1000.0);
+}
+
+TStatId UDelveDeepCharacterInitSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepCharacterInitSubsystem, STATGROUP_Tickables);
+}
+
+bool UDelveDeepCharacterInitSubsystem::RequestInitialization(ADelveDeepCharacter* Character)
+{
+	if (!IsValid(Character) || !Character->GetCharacterData())
+	{
+		UE_LOG(LogDelveDeepCharacterInit, Warning, TEXT("RequestInitialization: Character has no data to initialize from"));
+		return false;
+	}
+
+	const TWeakObjectPtr<ADelveDeepCharacter> WeakCharacter(Character);
+
+	TArray<FSoftObjectPath> Paths;
+	GatherInitializationAssets(Character->GetCharacterData(), Paths);
+
+	if (Paths.Num() == 0)
+	{
+		ReadyQueue.Add(WeakCharacter);
+		return true;
+	}
+
+	Loading.Add(WeakCharacter);
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths),
+		FStreamableDelegate::CreateUObject(this, &UDelveDeepCharacterInitSubsystem::OnAssetsLoaded, WeakCharacter));
+
+	if (!Handle.IsValid())
+	{
+		// Nothing to stream (all paths invalid); initialize from whatever resolves
+		Loading.Remove(WeakCharacter);
+		ReadyQueue.Add(WeakCharacter);
+		return true;
+	}
+
+	Handles.Add(WeakCharacter, MoveTemp(Handle));
+	return true;
+}
+
+void UDelveDeepCharacterInitSubsystem::ReleaseCharacter(ADelveDeepCharacter* Character)
+{
+	const TWeakObjectPtr<ADelveDeepCharacter> WeakCharacter(Character);
+
+	TSharedPtr<FStreamableHandle> Handle;
+	if (Handles.RemoveAndCopyValue(WeakCharacter, Handle) && Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		Handle->CancelHandle();
+	}
+
+	// Ready queue entries are skipped once the character is gone or no longer pending
+	Loading.Remove(WeakCharacter);
+}
+
+int32 UDelveDeepCharacterInitSubsystem::ProcessReadyCharacters(double BudgetSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_CharacterInitialization);
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 Initialized = 0;
+
+	while (ReadyHead < ReadyQueue.Num())
+	{
+		ADelveDeepCharacter* Character = ReadyQueue[ReadyHead++].Get();
+		if (!IsValid(Character) || !Character->IsInitializationPending())
+		{
+			continue;
+		}
+
+		Character->FinishInitialization();
+		++Initialized;
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	if (ReadyHead >= ReadyQueue.Num())
+	{
+		ReadyQueue.Reset();
+		ReadyHead = 0;
+	}
+
+	if (Initialized > 0)
+	{
+		UE_LOG(LogDelveDeepCharacterInit, Verbose, TEXT("Initialized %d characters (%d ready, %d loading)"),
+			Initialized, GetReadyCount(), GetLoadingCount());
+	}
+
+	return Initialized;
+}
+
+void UDelveDeepCharacterInitSubsystem::GatherInitializationAssets(const UDelveDeepCharacterData* Data, TArray<FSoftObjectPath>& OutPaths)
+{
+	if (!Data)
+	{
+		return;
+	}
+
+	if (!Data->StartingWeapon.IsNull())
+	{
+		OutPaths.Add(Data->StartingWeapon.ToSoftObjectPath());
+	}
+
+	for (const TSoftObjectPtr<UDelveDeepAbilityData>& Ability : Data->StartingAbilities)
+	{
+		if (!Ability.IsNull())
+		{
+			OutPaths.AddUnique(Ability.ToSoftObjectPath());
+		}
+	}
+}
+
+void UDelveDeepCharacterInitSubsystem::OnAssetsLoaded(TWeakObjectPtr<ADelveDeepCharacter> Character)
+{
+	// Released while streaming
+	if (Loading.Remove(Character) == 0)
+	{
+		return;
+	}
+
+	ReadyQueue.Add(Character);
+}
+
+bool UDelveDeepCharacterInitSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,150 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepCooldownSubsystem.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+
+int32 FDelveDeepCooldownTable::Allocate(UObject* Owner, const UObject* Source)
+{
+	if (FreeSlots.Num() > 0)
+	{
+		const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+		ReadyAt[Slot] = 0.0;
+		Owners[Slot] = Owner;
+		Sources[Slot] = Source;
+		return Slot;
+	}
+
+	const int32 Slot = ReadyAt.Add(0.0);
+	Stamps.Add(0);
+	Owners.Add(Owner);
+	Sources.Add(Source);
+	return Slot;
+}
+
+void FDelveDeepCooldownTable::Release(int32 Slot)
+{
+	if (!ReadyAt.IsValidIndex(Slot))
+	{
+		return;
+	}
+
+	ReadyAt[Slot] = 0.0;
+	++Stamps[Slot];
+	Owners[Slot].Reset();
+	Sources[Slot].Reset();
+	FreeSlots.Add(Slot);
+}
+
+void FDelveDeepCooldownTable::Start(int32 Slot, double Now, float Duration)
+{
+	if (!ReadyAt.IsValidIndex(Slot))
+	{
+		return;
+	}
+
+	// Earlier heap entries for this slot go stale
+	++Stamps[Slot];
+
+	if (Duration <= 0.0f)
+	{
+		ReadyAt[Slot] = Now;
+		return;
+	}
+
+	ReadyAt[Slot] = Now + Duration;
+
+	FHeapEntry Entry;
+	Entry.ReadyAt = ReadyAt[Slot];
+	Entry.Slot = Slot;
+	Entry.Stamp = Stamps[Slot];
+	Heap.HeapPush(Entry);
+}
+
+void FDelveDeepCooldownTable::Reset(int32 Slot)
+{
+	if (ReadyAt.IsValidIndex(Slot))
+	{
+		ReadyAt[Slot] = 0.0;
+		++Stamps[Slot];
+	}
+}
+
+float FDelveDeepCooldownTable::GetRemaining(int32 Slot, double Now) const
+{
+	return ReadyAt.IsValidIndex(Slot) ? static_cast<float>(FMath::Max(ReadyAt[Slot] - Now, 0.0)) : 0.0f;
+}
+
+void FDelveDeepCooldownTable::PopReady(double Now, TArray<int32>& OutSlots)
+{
+	while (Heap.Num() > 0 && Heap.HeapTop().ReadyAt <= Now)
+	{
+		FHeapEntry Entry;
+		Heap.HeapPop(Entry, EAllowShrinking::No);
+
+		// Restarted, reset or released since this entry was pushed
+		if (Entry.Stamp == Stamps[Entry.Slot])
+		{
+			OutSlots.Add(Entry.Slot);
+		}
+	}
+}
+
+void FDelveDeepCooldownTable::Empty()
+{
+	ReadyAt.Empty();
+	Stamps.Empty();
+	Owners.Empty();
+	Sources.Empty();
+	FreeSlots.Empty();
+	Heap.Empty();
+}
+
+void UDelveDeepCooldownSubsystem::Deinitialize()
+{
+	Cooldowns.Empty();
+	ReadyThisFrame.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepCooldownSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_Cooldowns);
+
+	ReadyThisFrame.Reset();
+	ReadyFrame = GFrameCounter;
+	Cooldowns.PopReady(GetNow(), ReadyThisFrame);
+
+	if (ReadyThisFrame.Num() > 0)
+	{
+		OnCooldownsReady.Broadcast(ReadyThisFrame);
+	}
+}
+
+TStatId UDelveDeepCooldownSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepCooldownSubsystem, STATGROUP_Tickables);
+}
+
+const TArray<int32>& UDelveDeepCooldownSubsystem::GetReadyThisFrame() const
+{
+	static const TArray<int32> NoneReady;
+	return ReadyFrame == GFrameCounter ? ReadyThisFrame : NoneReady;
+}
+
+void UDelveDeepCooldownSubsystem::StartCooldown(int32 Slot, float Duration)
+{
+	Cooldowns.Start(Slot, GetNow(), Duration);
+}
+
+double UDelveDeepCooldownSubsystem::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+bool UDelveDeepCooldownSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,327 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "DelveDeepEventSubsystem.h"
+#include "DelveDeepEventPayload.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "PaperFlipbookComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepDamageQueue, Log, All);
+
+namespace DelveDeepDamageQueue
+{
+	const FLinearColor FlashColor(1.0f, 0.5f, 0.5f, 1.0f);
+}
+
+void UDelveDeepDamageQueueSubsystem::FHitBuffer::Reset()
+{
+	Targets.Reset();
+	Sources.Reset();
+	Damage.Reset();
+	DamageTypes.Reset();
+}
+
+UDelveDeepDamageQueueSubsystem::UDelveDeepDamageQueueSubsystem()
+	: LastResolvedTargetCount(0)
+{
+	// Index 0 is untyped damage
+	DamageTypeNames.Add(NAME_None);
+	DamageTypeMultipliers.Add(1.0f);
+}
+
+void UDelveDeepDamageQueueSubsystem::Tick(float DeltaTime)
+{
+	ResolvePendingHits();
+	UpdateFlashes();
+}
+
+TStatId UDelveDeepDamageQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepDamageQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UDelveDeepDamageQueueSubsystem::EnqueueHit(ADelveDeepCharacter* Target, float Damage, FName DamageType, AActor* Source)
+{
+	if (!Target || Damage <= 0.0f)
+	{
+		return;
+	}
+
+	Pending.Targets.Add(Target);
+	Pending.Sources.Add(Source);
+	Pending.Damage.Add(Damage);
+	Pending.DamageTypes.Add(GetDamageTypeIndex(DamageType));
+}
+
+float UDelveDeepDamageQueueSubsystem::GetExpectedDamage(const ADelveDeepCharacter* Target, float Damage, FName DamageType) const
+{
+	if (!Target || Damage <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return Damage * GetDamageTypeMultiplier(DamageType) * GetArmorMultiplier(Target->GetArmor());
+}
+
+int32 UDelveDeepDamageQueueSubsystem::ResolvePendingHits()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_DamageCalculation);
+	TRACE_DELVEDEEP_DAMAGE();
+
+	LastResolvedTargetCount = 0;
+	LastDeaths.Reset();
+
+	const int32 NumHits = Pending.Num();
+	if (NumHits == 0)
+	{
+		return 0;
+	}
+
+	// Hits queued by the callbacks below go to the next batch
+	Swap(Pending, Resolving);
+	Pending.Reset();
+
+	// Gather: one slot per live target, armor read once per target
+	Targets.Reset();
+	TargetArmorMultipliers.Reset();
+	TargetSources.Reset();
+	TargetApplied.Reset();
+	TargetSlotLookup.Reset();
+	HitTargetSlots.SetNumUninitialized(NumHits, EAllowShrinking::No);
+	HitMultipliers.SetNumUninitialized(NumHits, EAllowShrinking::No);
+
+	for (int32 Hit = 0; Hit < NumHits; ++Hit)
+	{
+		ADelveDeepCharacter* Target = Resolving.Targets[Hit].Get();
+		if (!Target || Target->IsDead())
+		{
+			HitTargetSlots[Hit] = INDEX_NONE;
+			HitMultipliers[Hit] = 0.0f;
+			continue;
+		}
+
+		int32 Slot;
+		if (const int32* ExistingSlot = TargetSlotLookup.Find(Target))
+		{
+			Slot = *ExistingSlot;
+		}
+		else
+		{
+			Slot = Targets.Add(Target);
+			TargetArmorMultipliers.Add(GetArmorMultiplier(Target->GetArmor()));
+			TargetSources.Add(nullptr);
+			TargetApplied.Add(false);
+			TargetSlotLookup.Add(Target, Slot);
+		}
+
+		HitTargetSlots[Hit] = Slot;
+		HitMultipliers[Hit] = DamageTypeMultipliers[Resolving.DamageTypes[Hit]] * TargetArmorMultipliers[Slot];
+
+		// The last hit's source is credited for the target
+		if (AActor* Source = Resolving.Sources[Hit].Get())
+		{
+			TargetSources[Slot] = Source;
+		}
+	}
+
+	// Compute: mitigation over packed per-hit arrays
+	float* RESTRICT DamageData = Resolving.Damage.GetData();
+	const float* RESTRICT MultiplierData = HitMultipliers.GetData();
+	for (int32 Hit = 0; Hit < NumHits; ++Hit)
+	{
+		DamageData[Hit] *= MultiplierData[Hit];
+	}
+
+	// Sum per target
+	const int32 NumTargets = Targets.Num();
+	TargetDamage.SetNumZeroed(NumTargets, EAllowShrinking::No);
+	for (int32 Hit = 0; Hit < NumHits; ++Hit)
+	{
+		const int32 Slot = HitTargetSlots[Hit];
+		if (Slot != INDEX_NONE)
+		{
+			TargetDamage[Slot] += DamageData[Hit];
+		}
+	}
+
+	// Apply: one health change per target
+	FDelveDeepDamageBatchEventPayload Payload;
+	Payload.HitCount = NumHits;
+	Payload.Victims.Reserve(NumTargets);
+	Payload.DamageAmounts.Reserve(NumTargets);
+
+	TArray<ADelveDeepCharacter*, TInlineAllocator<16>> Killed;
+	for (int32 Slot = 0; Slot < NumTargets; ++Slot)
+	{
+		ADelveDeepCharacter* Target = Targets[Slot];
+		const float Damage = TargetDamage[Slot];
+
+		// Earlier callbacks in this loop may have destroyed or killed the target
+		if (Damage <= 0.0f || !IsValid(Target) || Target->IsDead())
+		{
+			continue;
+		}
+
+		const bool bKilled = Target->ApplyResolvedDamage(Damage, TargetSources[Slot]);
+		TargetApplied[Slot] = true;
+		StartFlash(Target);
+
+		Payload.Victims.Add(Target);
+		Payload.DamageAmounts.Add(Damage);
+		Payload.TotalDamage += Damage;
+
+		if (bKilled)
+		{
+			Payload.Killed.Add(Target);
+			Killed.Add(Target);
+		}
+	}
+
+	LastResolvedTargetCount = Payload.Victims.Num();
+
+	// Publish: per-hit events, one event for the frame, then the deaths
+	if (Payload.Victims.Num() > 0)
+	{
+		BroadcastHits(NumHits);
+		BroadcastBatch(Payload);
+	}
+
+	for (ADelveDeepCharacter* Character : Killed)
+	{
+		if (IsValid(Character))
+		{
+			Character->Die();
+			LastDeaths.Add(Character);
+		}
+	}
+
+	UE_LOG(LogDelveDeepDamageQueue, VeryVerbose,
+		TEXT("Resolved %d hits on %d targets (%.2f damage, %d killed)"),
+		NumHits, LastResolvedTargetCount, Payload.TotalDamage, LastDeaths.Num());
+
+	Resolving.Reset();
+	return NumHits;
+}
+
+void UDelveDeepDamageQueueSubsystem::SetDamageTypeMultiplier(FName DamageType, float Multiplier)
+{
+	if (DamageType.IsNone())
+	{
+		UE_LOG(LogDelveDeepDamageQueue, Warning, TEXT("Cannot set a multiplier for untyped damage"));
+		return;
+	}
+
+	DamageTypeMultipliers[GetDamageTypeIndex(DamageType)] = FMath::Max(Multiplier, 0.0f);
+}
+
+float UDelveDeepDamageQueueSubsystem::GetDamageTypeMultiplier(FName DamageType) const
+{
+	const int32 Index = DamageTypeNames.IndexOfByKey(DamageType);
+	return Index != INDEX_NONE ? DamageTypeMultipliers[Index] : 1.0f;
+}
+
+uint8 UDelveDeepDamageQueueSubsystem::GetDamageTypeIndex(FName DamageType)
+{
+	// A handful of damage types exist, so a linear scan of FName indices is cheapest
+	const int32 Index = DamageTypeNames.IndexOfByKey(DamageType);
+	if (Index != INDEX_NONE)
+	{
+		return static_cast<uint8>(Index);
+	}
+
+	if (DamageTypeNames.Num() > MAX_uint8)
+	{
+		UE_LOG(LogDelveDeepDamageQueue, Warning,
+			TEXT("Too many damage types; %s is treated as untyped"), *DamageType.ToString());
+		return 0;
+	}
+
+	DamageTypeNames.Add(DamageType);
+	DamageTypeMultipliers.Add(1.0f);
+	return static_cast<uint8>(DamageTypeNames.Num() - 1);
+}
+
+void UDelveDeepDamageQueueSubsystem::StartFlash(ADelveDeepCharacter* Character)
+{
+	const UWorld* World = GetWorld();
+	if (!World || !Character->GetSprite())
+	{
+		return;
+	}
+
+	Character->SetSpriteColor(DelveDeepDamageQueue::FlashColor);
+	FlashEndTimes.Add(Character, World->GetTimeSeconds() + FlashDuration);
+}
+
+void UDelveDeepDamageQueueSubsystem::UpdateFlashes()
+{
+	const UWorld* World = GetWorld();
+	if (!World || FlashEndTimes.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	for (auto It = FlashEndTimes.CreateIterator(); It; ++It)
+	{
+		if (It.Value() > Now)
+		{
+			continue;
+		}
+
+		if (ADelveDeepCharacter* Character = It.Key().Get())
+		{
+			Character->SetSpriteColor(FLinearColor::White);
+		}
+		It.RemoveCurrent();
+	}
+}
+
+void UDelveDeepDamageQueueSubsystem::BroadcastHits(int32 NumHits) const
+{
+	const UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UDelveDeepEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UDelveDeepEventSubsystem>() : nullptr;
+
+	// Per-hit payloads are only built for listeners that still want individual hits
+	static const FGameplayTag DamagedTag = FGameplayTag::RequestGameplayTag(FName("DelveDeep.Character.Damaged"), false);
+	if (!EventSubsystem || EventSubsystem->GetListenerCount(DamagedTag) == 0)
+	{
+		return;
+	}
+
+	const float* DamageData = Resolving.Damage.GetData();
+	for (int32 Hit = 0; Hit < NumHits; ++Hit)
+	{
+		const int32 Slot = HitTargetSlots[Hit];
+		if (Slot != INDEX_NONE && TargetApplied[Slot] && DamageData[Hit] > 0.0f && IsValid(Targets[Slot]))
+		{
+			Targets[Slot]->BroadcastDamageEvent(DamageData[Hit], Resolving.Sources[Hit].Get());
+		}
+	}
+}
+
+void UDelveDeepDamageQueueSubsystem::BroadcastBatch(const FDelveDeepDamageBatchEventPayload& Payload) const
+{
+	const UWorld* World = GetWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UDelveDeepEventSubsystem* EventSubsystem = GameInstance ? GameInstance->GetSubsystem<UDelveDeepEventSubsystem>() : nullptr;
+	if (!EventSubsystem)
+	{
+		return;
+	}
+
+	static const FGameplayTag BatchTag = FGameplayTag::RequestGameplayTag(FName("DelveDeep.Event.Combat.Damage.Batch"), false);
+
+	FDelveDeepDamageBatchEventPayload TaggedPayload = Payload;
+	TaggedPayload.EventTag = BatchTag;
+	EventSubsystem->BroadcastEvent(TaggedPayload);
+}
+
+bool UDelveDeepDamageQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,512 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepFlowFieldSubsystem.h"
+#include "DelveDeepStats.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepFlowField, Log, All);
+
+namespace DelveDeepFlowField
+{
+	/** Neighbour offsets, counter-clockwise from +X; odd entries are diagonal */
+	const FIntPoint Offsets[8] =
+	{
+		FIntPoint(1, 0), FIntPoint(1, 1), FIntPoint(0, 1), FIntPoint(-1, 1),
+		FIntPoint(-1, 0), FIntPoint(-1, -1), FIntPoint(0, -1), FIntPoint(1, -1)
+	};
+
+	const FVector Directions[8] =
+	{
+		FVector(1.0f, 0.0f, 0.0f), FVector(UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f),
+		FVector(0.0f, 1.0f, 0.0f), FVector(-UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f),
+		FVector(-1.0f, 0.0f, 0.0f), FVector(-UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f),
+		FVector(0.0f, -1.0f, 0.0f), FVector(UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f)
+	};
+
+	/** Rows per parallel batch of the direction pass */
+	constexpr int32 RowsPerBatch = 16;
+
+	/**
+	 * Whether a step from a cell toward a neighbour is allowed: the neighbour is
+	 * in the grid and passable, and a diagonal step does not cut a blocked corner
+	 */
+	FORCEINLINE bool CanStep(const uint8* Costs, FIntPoint Dimensions, int32 X, int32 Y, int32 Neighbour)
+	{
+		const FIntPoint& Offset = Offsets[Neighbour];
+		const int32 NX = X + Offset.X;
+		const int32 NY = Y + Offset.Y;
+		if (NX < 0 || NY < 0 || NX >= Dimensions.X || NY >= Dimensions.Y)
+		{
+			return false;
+		}
+
+		if (Costs[NY * Dimensions.X + NX] == UDelveDeepFlowFieldSubsystem::BlockedCost)
+		{
+			return false;
+		}
+
+		if ((Neighbour & 1) != 0)
+		{
+			return Costs[Y * Dimensions.X + NX] != UDelveDeepFlowFieldSubsystem::BlockedCost
+				&& Costs[NY * Dimensions.X + X] != UDelveDeepFlowFieldSubsystem::BlockedCost;
+		}
+
+		return true;
+	}
+}
+
+void FDelveDeepFlowField::Build(const TArray<uint8>& Costs, FIntPoint Dimensions, FIntPoint Goal, int32 MaxRadius, FDelveDeepFlowField& OutField)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_Pathfinding);
+
+	using namespace DelveDeepFlowField;
+
+	const int32 NumCells = Dimensions.X * Dimensions.Y;
+	OutField.GoalCell = Goal;
+	OutField.Integration.Init(MAX_flt, NumCells);
+	OutField.Directions.Init(NoDirection, NumCells);
+
+	if (Goal.X < 0 || Goal.Y < 0 || Goal.X >= Dimensions.X || Goal.Y >= Dimensions.Y || Costs.Num() != NumCells)
+	{
+		return;
+	}
+
+	const uint8* CostData = Costs.GetData();
+	float* Integration = OutField.Integration.GetData();
+
+	// Dijkstra outward from the goal, stepping in reverse (path cost is the cost of the cells entered)
+	const auto CheapestFirst = [](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; };
+
+	TArray<TPair<float, int32>> Open;
+	Open.Reserve(FMath::Min(NumCells, 4096));
+
+	const int32 GoalIndex = Goal.Y * Dimensions.X + Goal.X;
+	Integration[GoalIndex] = 0.0f;
+	Open.HeapPush(TPair<float, int32>(0.0f, GoalIndex), CheapestFirst);
+
+	while (Open.Num() > 0)
+	{
+		TPair<float, int32> Current;
+		Open.HeapPop(Current, CheapestFirst, EAllowShrinking::No);
+
+		const int32 Index = Current.Value;
+		if (Current.Key > Integration[Index])
+		{
+			continue;
+		}
+
+		const int32 X = Index % Dimensions.X;
+		const int32 Y = Index / Dimensions.X;
+		const float StepCost = CostData[Index];
+
+		for (int32 Neighbour = 0; Neighbour < 8; ++Neighbour)
+		{
+			if (!CanStep(CostData, Dimensions, X, Y, Neighbour))
+			{
+				continue;
+			}
+
+			const int32 NX = X + Offsets[Neighbour].X;
+			const int32 NY = Y + Offsets[Neighbour].Y;
+			if (FMath::Max(FMath::Abs(NX - Goal.X), FMath::Abs(NY - Goal.Y)) > MaxRadius)
+			{
+				continue;
+			}
+
+			// A monster at the neighbour pays for entering this cell
+			const int32 NeighbourIndex = NY * Dimensions.X + NX;
+			const float Cost = Current.Key + StepCost * (((Neighbour & 1) != 0) ? UE_SQRT_2 : 1.0f);
+			if (Cost < Integration[NeighbourIndex])
+			{
+				Integration[NeighbourIndex] = Cost;
+				Open.HeapPush(TPair<float, int32>(Cost, NeighbourIndex), CheapestFirst);
+			}
+		}
+	}
+
+	// Every reachable cell steers toward its cheapest neighbour; rows are independent
+	uint8* Directions = OutField.Directions.GetData();
+	const int32 NumBatches = FMath::DivideAndRoundUp(Dimensions.Y, RowsPerBatch);
+
+	ParallelFor(NumBatches, [=](int32 Batch)
+	{
+		const int32 RowBegin = Batch * RowsPerBatch;
+		const int32 RowEnd = FMath::Min(RowBegin + RowsPerBatch, Dimensions.Y);
+
+		for (int32 Y = RowBegin; Y < RowEnd; ++Y)
+		{
+			for (int32 X = 0; X < Dimensions.X; ++X)
+			{
+				const int32 Index = Y * Dimensions.X + X;
+				float Best = Integration[Index];
+				if (Best == MAX_flt || Best == 0.0f)
+				{
+					continue;
+				}
+
+				for (int32 Neighbour = 0; Neighbour < 8; ++Neighbour)
+				{
+					if (!CanStep(CostData, Dimensions, X, Y, Neighbour))
+					{
+						continue;
+					}
+
+					const float NeighbourCost = Integration[(Y + Offsets[Neighbour].Y) * Dimensions.X + X + Offsets[Neighbour].X];
+					if (NeighbourCost < Best)
+					{
+						Best = NeighbourCost;
+						Directions[Index] = static_cast<uint8>(Neighbour);
+					}
+				}
+			}
+		}
+	}, NumBatches == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void UDelveDeepFlowFieldSubsystem::Deinitialize()
+{
+	// Rebuilds in flight only hold the cost snapshot; their results are dropped
+	Goals.Empty();
+	FreeGoals.Empty();
+	PlayerGoals.Empty();
+	Costs.Empty();
+	CostSnapshot.Reset();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	SyncPlayerGoals();
+
+	const double StartTime = FPlatformTime::Seconds();
+	UpdateFields();
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	if (const UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			static const FName PathfindingName(TEXT("Pathfinding"));
+			Telemetry->RecordSystemTime(PathfindingName, FrameMs);
+		}
+	}
+}
+
+TStatId UDelveDeepFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UDelveDeepFlowFieldSubsystem::InitializeGrid(const FVector& Origin, FIntPoint Dimensions, float InCellSize)
+{
+	GridOrigin = Origin;
+	GridSize = FIntPoint(FMath::Max(Dimensions.X, 0), FMath::Max(Dimensions.Y, 0));
+	CellSize = FMath::Max(InCellSize, 1.0f);
+
+	Costs.Init(1, GridSize.X * GridSize.Y);
+	bCostsChanged = true;
+
+	// Fields of the old grid are meaningless; rebuild every goal for the new one
+	for (FGoal& Goal : Goals)
+	{
+		if (Goal.bActive)
+		{
+			Goal.Field.Reset();
+			Goal.PendingField = TFuture<FFieldPtr>();
+			Goal.Cell = GetCell(Goal.Location);
+		}
+	}
+}
+
+bool UDelveDeepFlowFieldSubsystem::BuildGridFromNavigation(const FBox& Bounds, float InCellSize)
+{
+	UWorld* World = GetWorld();
+	const UNavigationSystemV1* NavSystem = World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+	if (!NavSystem || !Bounds.IsValid)
+	{
+		UE_LOG(LogDelveDeepFlowField, Warning, TEXT("BuildGridFromNavigation: No navigation system or invalid bounds"));
+		return false;
+	}
+
+	const FVector Size = Bounds.GetSize();
+	const FIntPoint Dimensions(FMath::CeilToInt32(Size.X / InCellSize), FMath::CeilToInt32(Size.Y / InCellSize));
+	InitializeGrid(Bounds.Min, Dimensions, InCellSize);
+
+	const FVector QueryExtent(CellSize * 0.5f, CellSize * 0.5f, Size.Z * 0.5f);
+	const float CenterZ = Bounds.GetCenter().Z;
+
+	int32 BlockedCells = 0;
+	for (int32 Y = 0; Y < GridSize.Y; ++Y)
+	{
+		for (int32 X = 0; X < GridSize.X; ++X)
+		{
+			const FVector CellCenter(GridOrigin.X + (X + 0.5f) * CellSize, GridOrigin.Y + (Y + 0.5f) * CellSize, CenterZ);
+
+			FNavLocation Projected;
+			if (!NavSystem->ProjectPointToNavigation(CellCenter, Projected, QueryExtent))
+			{
+				Costs[Y * GridSize.X + X] = BlockedCost;
+				++BlockedCells;
+			}
+		}
+	}
+
+	UE_LOG(LogDelveDeepFlowField, Display, TEXT("Built flow field grid %dx%d (%d blocked cells)"),
+		GridSize.X, GridSize.Y, BlockedCells);
+
+	return true;
+}
+
+void UDelveDeepFlowFieldSubsystem::SetCellCost(const FIntPoint& Cell, uint8 Cost)
+{
+	if (!IsCellInGrid(Cell))
+	{
+		return;
+	}
+
+	uint8& CellCost = Costs[Cell.Y * GridSize.X + Cell.X];
+	if (CellCost != Cost)
+	{
+		CellCost = FMath::Max<uint8>(Cost, 1);
+		bCostsChanged = true;
+	}
+}
+
+int32 UDelveDeepFlowFieldSubsystem::AddGoal(const FVector& Location)
+{
+	const int32 GoalId = FreeGoals.Num() > 0 ? FreeGoals.Pop(EAllowShrinking::No) : Goals.AddDefaulted();
+
+	FGoal& Goal = Goals[GoalId];
+	Goal.Location = Location;
+	Goal.Cell = GetCell(Location);
+	Goal.Field.Reset();
+	Goal.PendingField = TFuture<FFieldPtr>();
+	Goal.bDirty = true;
+	Goal.bActive = true;
+
+	return GoalId;
+}
+
+void UDelveDeepFlowFieldSubsystem::SetGoalLocation(int32 GoalId, const FVector& Location)
+{
+	if (!IsGoalValid(GoalId))
+	{
+		return;
+	}
+
+	FGoal& Goal = Goals[GoalId];
+	Goal.Location = Location;
+
+	const FIntPoint Cell = GetCell(Location);
+	if (Cell != Goal.Cell)
+	{
+		Goal.Cell = Cell;
+		Goal.bDirty = true;
+	}
+}
+
+void UDelveDeepFlowFieldSubsystem::RemoveGoal(int32 GoalId)
+{
+	if (!IsGoalValid(GoalId))
+	{
+		return;
+	}
+
+	FGoal& Goal = Goals[GoalId];
+	Goal.Field.Reset();
+	Goal.PendingField = TFuture<FFieldPtr>();
+	Goal.bDirty = false;
+	Goal.bActive = false;
+	FreeGoals.Add(GoalId);
+}
+
+bool UDelveDeepFlowFieldSubsystem::SampleDirection(const FVector& Location, FVector& OutDirection) const
+{
+	const FIntPoint Cell = GetCell(Location);
+	if (!IsCellInGrid(Cell))
+	{
+		return false;
+	}
+
+	const int32 Index = Cell.Y * GridSize.X + Cell.X;
+	const FGoal* BestGoal = nullptr;
+	float BestCost = MAX_flt;
+
+	for (const FGoal& Goal : Goals)
+	{
+		if (Goal.Field.IsValid() && Goal.Field->Integration.IsValidIndex(Index) && Goal.Field->Integration[Index] < BestCost)
+		{
+			BestCost = Goal.Field->Integration[Index];
+			BestGoal = &Goal;
+		}
+	}
+
+	if (!BestGoal)
+	{
+		return false;
+	}
+
+	// In the goal's own cell, head straight for it
+	const uint8 Direction = BestGoal->Field->Directions[Index];
+	if (Direction == FDelveDeepFlowField::NoDirection)
+	{
+		OutDirection = (BestGoal->Location - Location).GetSafeNormal2D();
+		return true;
+	}
+
+	OutDirection = DelveDeepFlowField::Directions[Direction];
+	return true;
+}
+
+float UDelveDeepFlowFieldSubsystem::GetPathCost(int32 GoalId, const FVector& Location) const
+{
+	const FIntPoint Cell = GetCell(Location);
+	if (!IsGoalValid(GoalId) || !IsCellInGrid(Cell) || !Goals[GoalId].Field.IsValid())
+	{
+		return MAX_flt;
+	}
+
+	const TArray<float>& Integration = Goals[GoalId].Field->Integration;
+	const int32 Index = Cell.Y * GridSize.X + Cell.X;
+	return Integration.IsValidIndex(Index) ? Integration[Index] : MAX_flt;
+}
+
+void UDelveDeepFlowFieldSubsystem::UpdateFields()
+{
+	if (Costs.Num() == 0)
+	{
+		return;
+	}
+
+	// Rebuilds read an immutable copy so the grid can keep changing meanwhile
+	if (bCostsChanged || !CostSnapshot.IsValid())
+	{
+		CostSnapshot = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(Costs);
+		bCostsChanged = false;
+
+		for (FGoal& Goal : Goals)
+		{
+			Goal.bDirty |= Goal.bActive;
+		}
+	}
+
+	for (FGoal& Goal : Goals)
+	{
+		if (!Goal.bActive)
+		{
+			continue;
+		}
+
+		if (Goal.PendingField.IsValid() && Goal.PendingField.IsReady())
+		{
+			Goal.Field = Goal.PendingField.Get();
+			Goal.PendingField = TFuture<FFieldPtr>();
+		}
+
+		// One rebuild per goal at a time; a goal that moved meanwhile is rebuilt after it lands
+		if (!Goal.bDirty || Goal.PendingField.IsValid())
+		{
+			continue;
+		}
+
+		Goal.bDirty = false;
+		if (!IsCellInGrid(Goal.Cell))
+		{
+			Goal.Field.Reset();
+			continue;
+		}
+
+		Goal.PendingField = Async(EAsyncExecution::TaskGraph,
+			[Snapshot = CostSnapshot, Dimensions = GridSize, GoalCell = Goal.Cell, Radius = MaxFieldRadius]()
+			{
+				FFieldPtr Field = MakeShared<FDelveDeepFlowField, ESPMode::ThreadSafe>();
+				FDelveDeepFlowField::Build(*Snapshot, Dimensions, GoalCell, Radius, *Field);
+				return Field;
+			});
+	}
+}
+
+void UDelveDeepFlowFieldSubsystem::FlushBuilds()
+{
+	UpdateFields();
+
+	for (FGoal& Goal : Goals)
+	{
+		if (Goal.PendingField.IsValid())
+		{
+			Goal.PendingField.Wait();
+		}
+	}
+
+	UpdateFields();
+}
+
+void UDelveDeepFlowFieldSubsystem::SetMaxFieldRadius(int32 InMaxFieldRadius)
+{
+	MaxFieldRadius = FMath::Max(InMaxFieldRadius, 1);
+
+	// Rebuild every field at the new radius
+	bCostsChanged = true;
+}
+
+FIntPoint UDelveDeepFlowFieldSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32((Location.X - GridOrigin.X) / CellSize),
+		FMath::FloorToInt32((Location.Y - GridOrigin.Y) / CellSize));
+}
+
+int32 UDelveDeepFlowFieldSubsystem::GetBuildsInFlight() const
+{
+	int32 InFlight = 0;
+	for (const FGoal& Goal : Goals)
+	{
+		InFlight += (Goal.PendingField.IsValid() && !Goal.PendingField.IsReady()) ? 1 : 0;
+	}
+	return InFlight;
+}
+
+void UDelveDeepFlowFieldSubsystem::SyncPlayerGoals()
+{
+	// Drop goals of players that left or lost their pawn
+	for (auto It = PlayerGoals.CreateIterator(); It; ++It)
+	{
+		const APawn* Pawn = It.Key().Get();
+		if (!Pawn || !Pawn->IsPlayerControlled())
+		{
+			RemoveGoal(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APawn* Pawn = It->IsValid() ? (*It)->GetPawn() : nullptr;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		if (const int32* GoalId = PlayerGoals.Find(Pawn))
+		{
+			SetGoalLocation(*GoalId, Pawn->GetActorLocation());
+		}
+		else
+		{
+			PlayerGoals.Add(Pawn, AddGoal(Pawn->GetActorLocation()));
+		}
+	}
+}
+
+bool UDelveDeepFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
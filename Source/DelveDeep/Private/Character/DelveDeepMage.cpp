@@ -2,8 +2,11 @@
 
 #include "Character/DelveDeepMage.h"
 #include "Character/DelveDeepStatsComponent.h"
+#include "Character/DelveDeepEquipmentComponent.h"
+#include "Character/DelveDeepProjectileSubsystem.h"
+#include "DelveDeepWeaponData.h"
+#include "Engine/World.h"
 #include "DelveDeepLogChannels.h"
-#include "TimerManager.h"
 
 ADelveDeepMage::ADelveDeepMage()
 {
@@ -19,80 +22,74 @@ void ADelveDeepMage::BeginPlay()
 	StartManaRegeneration();
 }
 
-void ADelveDeepMage::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-	// Stop Mana regeneration timer
-	if (GetWorld() && ManaRegenTimerHandle.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(ManaRegenTimerHandle);
-	}
-
-	Super::EndPlay(EndPlayReason);
-}
-
 void ADelveDeepMage::StartManaRegeneration()
 {
-	if (!GetWorld())
+	if (!StatsComponent)
 	{
 		UE_LOG(LogDelveDeep, Warning, 
-			TEXT("Mage '%s' cannot start Mana regeneration - no world"), 
+			TEXT("Mage '%s' cannot start Mana regeneration - no stats component"), 
 			*GetName());
 		return;
 	}
 
-	// Set up timer for Mana regeneration (0.1 second intervals)
-	GetWorld()->GetTimerManager().SetTimer(
-		ManaRegenTimerHandle,
-		[this]()
-		{
-			RegenerateMana(0.1f);
-		},
-		0.1f,
-		true  // Loop
-	);
+	// Regenerated in one batched pass with every other character (stopped by the component's EndPlay)
+	StatsComponent->SetResourceRegenRate(ManaRegenRate);
 
 	UE_LOG(LogDelveDeep, Display, 
 		TEXT("Mage '%s' started Mana regeneration"), 
 		*GetName());
 }
 
-void ADelveDeepMage::RegenerateMana(float DeltaTime)
+void ADelveDeepMage::CastFireball(FVector TargetLocation)
 {
-	if (!StatsComponent)
+	UWorld* World = GetWorld();
+	UDelveDeepProjectileSubsystem* Projectiles = World ? World->GetSubsystem<UDelveDeepProjectileSubsystem>() : nullptr;
+	if (!Projectiles)
 	{
 		return;
 	}
 
-	// Don't regenerate if already at max
-	if (StatsComponent->GetCurrentResource() >= StatsComponent->GetMaxResource())
+	if (StatsComponent && StatsComponent->GetCurrentResource() < FireballManaCost)
 	{
+		UE_LOG(LogDelveDeep, Verbose, 
+			TEXT("Mage '%s' lacks Mana for Fireball (%.2f/%.2f)"), 
+			*GetName(), StatsComponent->GetCurrentResource(), FireballManaCost);
 		return;
 	}
 
-	// Calculate regeneration amount
-	float RegenAmount = ManaRegenRate * DeltaTime;
+	const FVector Origin = GetActorLocation();
+	const FVector ToTarget = TargetLocation - Origin;
 
-	// Add Mana (ModifyResource will clamp to MaxMana)
-	StatsComponent->ModifyResource(RegenAmount);
+	// Fly to the target location with the staff's projectile stats, or fireball defaults without one
+	FDelveDeepProjectileParams Params;
+	const UDelveDeepWeaponData* Weapon = EquipmentComponent ? EquipmentComponent->GetCurrentWeapon() : nullptr;
+	if (!UDelveDeepProjectileSubsystem::MakeWeaponProjectileParams(this, Weapon, Origin, ToTarget, GetTeamId(), Params))
+	{
+		Params.Origin = Origin;
+		Params.Direction = ToTarget;
+		Params.Speed = FireballSpeed;
+		Params.Damage = StatsComponent ? StatsComponent->GetStatValue(EDelveDeepStat::Damage) : Params.Damage;
+		Params.Team = GetTeamId();
+		Params.Instigator = this;
+	}
 
-	UE_LOG(LogDelveDeep, VeryVerbose, 
-		TEXT("Mage '%s' regenerated %.2f Mana (Current: %.2f/%.2f)"), 
-		*GetName(), RegenAmount, StatsComponent->GetCurrentResource(), StatsComponent->GetMaxResource());
-}
+	Params.Range = FVector2D(ToTarget).Size();
+	Params.MaxHits = 1;
+	Params.ExplosionRadius = FireballExplosionRadius;
+	Params.DamageType = FName(TEXT("Fire"));
+	if (!Projectiles->FireProjectile(Params))
+	{
+		return;
+	}
 
-void ADelveDeepMage::CastFireball(FVector TargetLocation)
-{
-	// Placeholder for future combat system integration
-	UE_LOG(LogDelveDeep, Display, 
-		TEXT("Mage '%s' casts Fireball at location (%.2f, %.2f, %.2f) (placeholder)"), 
-		*GetName(), TargetLocation.X, TargetLocation.Y, TargetLocation.Z);
+	if (StatsComponent)
+	{
+		StatsComponent->ModifyResource(-FireballManaCost);
+	}
 
-	// TODO: Implement fireball when combat system is available
-	// - Check Mana cost
-	// - Spawn fireball projectile
-	// - Projectile travels to target location
-	// - Explodes dealing AoE damage
-	// - Consume Mana
+	UE_LOG(LogDelveDeep, Verbose, 
+		TEXT("Mage '%s' casts Fireball at location (%.2f, %.2f, %.2f)"), 
+		*GetName(), TargetLocation.X, TargetLocation.Y, TargetLocation.Z);
 }
 
 void ADelveDeepMage::OnResourceChanged(float OldValue, float NewValue)
@@ -0,0 +1,408 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepMinionSubsystem.h"
+#include "Character/DelveDeepActorPoolSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepCharacterBlueprintLibrary.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepStatsComponent.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "DelveDeepCharacterData.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepMinions, Log, All);
+
+FVector2D FDelveDeepMinionSteering::ComputeSteering(const FVector2D& Position, const FVector2D& Goal, float StopDistance,
+	const FVector2D& GroupCenter, TConstArrayView<FVector2D> Neighbours) const
+{
+	FVector2D Steer = FVector2D::ZeroVector;
+
+	// Seek the goal until within the stop distance
+	const FVector2D ToGoal = Goal - Position;
+	const float GoalDistance = ToGoal.Size();
+	if (GoalDistance > StopDistance)
+	{
+		Steer += ToGoal / GoalDistance;
+	}
+
+	// Cohesion: drift toward the rest of the group
+	const FVector2D ToCenter = GroupCenter - Position;
+	const float CenterDistance = ToCenter.Size();
+	if (CenterDistance > SeparationRadius)
+	{
+		Steer += (ToCenter / CenterDistance) * CohesionWeight;
+	}
+
+	// Separation: push away from close neighbours, harder the closer they are
+	for (const FVector2D& Neighbour : Neighbours)
+	{
+		const FVector2D Away = Position - Neighbour;
+		const float Distance = Away.Size();
+		if (Distance > UE_KINDA_SMALL_NUMBER && Distance < SeparationRadius)
+		{
+			Steer += (Away / Distance) * (1.0f - Distance / SeparationRadius) * SeparationWeight;
+		}
+	}
+
+	const float SteerSize = Steer.Size();
+	return SteerSize > 1.0f ? Steer / SteerSize : Steer;
+}
+
+void UDelveDeepMinionSubsystem::Deinitialize()
+{
+	Minions.Empty();
+	Owners.Empty();
+	Targets.Empty();
+	AttackReadyTimes.Empty();
+	Positions.Empty();
+	NeighbourHandles.Empty();
+	NeighbourPositions.Empty();
+	UpkeepDebts.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepMinionSubsystem::Tick(float DeltaTime)
+{
+	UpdateMinions(DeltaTime);
+}
+
+TStatId UDelveDeepMinionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepMinionSubsystem, STATGROUP_Tickables);
+}
+
+void UDelveDeepMinionSubsystem::PrewarmMinions(TSubclassOf<ADelveDeepCharacter> MinionClass, int32 Count)
+{
+	if (!MinionClass || Count <= 0)
+	{
+		return;
+	}
+
+	if (UDelveDeepActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UDelveDeepActorPoolSubsystem>())
+	{
+		const int32 Spawned = Pool->PrewarmPool(MinionClass, Count);
+		UE_LOG(LogDelveDeepMinions, Verbose, TEXT("PrewarmMinions: Parked %d %s"), Spawned, *MinionClass->GetName());
+	}
+}
+
+ADelveDeepCharacter* UDelveDeepMinionSubsystem::SummonMinion(ADelveDeepCharacter* Owner, TSubclassOf<ADelveDeepCharacter> MinionClass, const FVector& Location)
+{
+	if (!IsValid(Owner) || !MinionClass)
+	{
+		UE_LOG(LogDelveDeepMinions, Warning, TEXT("SummonMinion: Minion needs an owner and a class"));
+		return nullptr;
+	}
+
+	ADelveDeepCharacter* Minion = UDelveDeepCharacterBlueprintLibrary::SpawnCharacter(this, MinionClass, Location, Owner->GetActorRotation());
+	if (!Minion)
+	{
+		return nullptr;
+	}
+
+	Minion->SetTeamId(Owner->GetTeamId());
+
+	// Minions have no controller; movement input comes from the steering pass
+	if (UCharacterMovementComponent* Movement = Minion->GetCharacterMovement())
+	{
+		Movement->bRunPhysicsWithNoController = true;
+	}
+
+	Minions.Add(Minion);
+	Owners.Add(Owner);
+	Targets.AddDefaulted();
+	AttackReadyTimes.Add(0.0);
+
+	return Minion;
+}
+
+void UDelveDeepMinionSubsystem::DismissMinion(ADelveDeepCharacter* Minion)
+{
+	const int32 Index = Minions.IndexOfByKey(Minion);
+	if (Index != INDEX_NONE)
+	{
+		RemoveMinion(Index);
+	}
+}
+
+void UDelveDeepMinionSubsystem::DismissAllMinions(const ADelveDeepCharacter* Owner)
+{
+	for (int32 Index = Minions.Num() - 1; Index >= 0; --Index)
+	{
+		if (Owners[Index].Get() == Owner)
+		{
+			RemoveMinion(Index);
+		}
+	}
+}
+
+void UDelveDeepMinionSubsystem::UpdateMinions(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_AISystem);
+	TRACE_DELVEDEEP_AI();
+
+	RemoveInvalidMinions();
+	ApplyUpkeep(DeltaTime);
+
+	if (Minions.Num() == 0)
+	{
+		return;
+	}
+
+	RetargetSlice();
+	SteerAndAttack();
+}
+
+int32 UDelveDeepMinionSubsystem::GetMinionCount(const ADelveDeepCharacter* Owner) const
+{
+	int32 Count = 0;
+	for (const TWeakObjectPtr<ADelveDeepCharacter>& MinionOwner : Owners)
+	{
+		if (MinionOwner.Get() == Owner)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void UDelveDeepMinionSubsystem::SetSoulUpkeep(float SoulsPerMinionPerSecond)
+{
+	SoulUpkeep = FMath::Max(SoulsPerMinionPerSecond, 0.0f);
+}
+
+void UDelveDeepMinionSubsystem::RemoveInvalidMinions()
+{
+	for (int32 Index = Minions.Num() - 1; Index >= 0; --Index)
+	{
+		// Parked, destroyed or killed elsewhere (killed minions return to the pool through their own death timer)
+		const ADelveDeepCharacter* Minion = Minions[Index].Get();
+		if (!Minion || Minion->IsPooled() || Minion->IsDead())
+		{
+			Minions.RemoveAt(Index);
+			Owners.RemoveAt(Index);
+			Targets.RemoveAt(Index);
+			AttackReadyTimes.RemoveAt(Index);
+		}
+		else if (!IsValid(Owners[Index].Get()) || Owners[Index]->IsDead())
+		{
+			RemoveMinion(Index);
+		}
+	}
+}
+
+void UDelveDeepMinionSubsystem::ApplyUpkeep(float DeltaTime)
+{
+	if (SoulUpkeep <= 0.0f)
+	{
+		return;
+	}
+
+	// Debt is charged in whole Souls so the owner's resource (and its events)
+	// only changes when a Soul is actually spent
+	for (auto It = UpkeepDebts.CreateIterator(); It; ++It)
+	{
+		ADelveDeepCharacter* Owner = It.Key().Get();
+		const int32 Count = Owner ? GetMinionCount(Owner) : 0;
+		if (Count == 0)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		It.Value() += SoulUpkeep * Count * DeltaTime;
+		if (It.Value() < 1.0f)
+		{
+			continue;
+		}
+
+		const float Due = FMath::FloorToFloat(It.Value());
+		UDelveDeepStatsComponent* Stats = Owner->GetStatsComponent();
+		if (Stats && Stats->GetCurrentResource() >= Due)
+		{
+			Stats->ModifyResource(-Due);
+			It.Value() -= Due;
+			continue;
+		}
+
+		// Out of Souls: the oldest minion crumbles and the rest keep draining
+		const int32 Oldest = Owners.IndexOfByKey(Owner);
+		UE_LOG(LogDelveDeepMinions, Verbose, TEXT("ApplyUpkeep: %s cannot pay upkeep; dismissing its oldest minion"), *Owner->GetName());
+		if (Stats)
+		{
+			Stats->ModifyResource(-Stats->GetCurrentResource());
+		}
+		It.Value() = 0.0f;
+		RemoveMinion(Oldest);
+	}
+
+	// Start tracking owners summoned since the last update
+	for (const TWeakObjectPtr<ADelveDeepCharacter>& Owner : Owners)
+	{
+		if (!UpkeepDebts.Contains(Owner))
+		{
+			UpkeepDebts.Add(Owner, 0.0f);
+		}
+	}
+}
+
+void UDelveDeepMinionSubsystem::RetargetSlice()
+{
+	const UDelveDeepTargetingSubsystem* Targeting = GetWorld()->GetSubsystem<UDelveDeepTargetingSubsystem>();
+	if (!Targeting)
+	{
+		return;
+	}
+
+	const int32 NumMinions = Minions.Num();
+	const int32 SliceSize = FMath::DivideAndRoundUp(NumMinions, RetargetFrames);
+	for (int32 Count = 0; Count < SliceSize; ++Count)
+	{
+		if (RetargetCursor >= NumMinions)
+		{
+			RetargetCursor = 0;
+		}
+
+		const int32 Index = RetargetCursor++;
+		const ADelveDeepCharacter* Minion = Minions[Index].Get();
+		const ADelveDeepCharacter* Owner = Owners[Index].Get();
+
+		const int32 Handle = Targeting->FindBestTarget(Minion->GetActorLocation(), Steering.AggroRadius,
+			DelveDeepTeam::Opposing(Minion->GetTeamId()), EDelveDeepTargetPriority::Nearest);
+
+		// Keep to targets within the leash so minions stay with their owner
+		AActor* NewTarget = nullptr;
+		if (Handle != INDEX_NONE
+			&& FVector::DistSquared2D(Targeting->GetCombatantLocation(Handle), Owner->GetActorLocation()) <= FMath::Square(Steering.LeashRadius))
+		{
+			NewTarget = Targeting->GetCombatantActor(Handle);
+		}
+		Targets[Index] = NewTarget;
+	}
+}
+
+void UDelveDeepMinionSubsystem::SteerAndAttack()
+{
+	const UWorld* World = GetWorld();
+	const UDelveDeepTargetingSubsystem* Targeting = World->GetSubsystem<UDelveDeepTargetingSubsystem>();
+	UDelveDeepDamageQueueSubsystem* DamageQueue = World->GetSubsystem<UDelveDeepDamageQueueSubsystem>();
+	const double Now = World->GetTimeSeconds();
+
+	// Gather locations and each owner's group center
+	struct FGroup
+	{
+		const ADelveDeepCharacter* Owner;
+		FVector2D Sum;
+		int32 Count;
+	};
+	TArray<FGroup, TInlineAllocator<4>> Groups;
+
+	const int32 NumMinions = Minions.Num();
+	Positions.SetNumUninitialized(NumMinions, EAllowShrinking::No);
+	for (int32 Index = 0; Index < NumMinions; ++Index)
+	{
+		Positions[Index] = FVector2D(Minions[Index]->GetActorLocation());
+
+		const ADelveDeepCharacter* Owner = Owners[Index].Get();
+		FGroup* Group = Groups.FindByPredicate([Owner](const FGroup& Candidate) { return Candidate.Owner == Owner; });
+		if (!Group)
+		{
+			Group = &Groups.Add_GetRef({ Owner, FVector2D::ZeroVector, 0 });
+		}
+		Group->Sum += Positions[Index];
+		++Group->Count;
+	}
+
+	for (int32 Index = 0; Index < NumMinions; ++Index)
+	{
+		ADelveDeepCharacter* Minion = Minions[Index].Get();
+		const ADelveDeepCharacter* Owner = Owners[Index].Get();
+		const FVector2D Position = Positions[Index];
+		const FVector2D OwnerPosition(Owner->GetActorLocation());
+
+		const UDelveDeepCharacterData* Data = Minion->GetCharacterData();
+		const float AttackRange = Data ? Data->AttackRange : 100.0f;
+
+		// Drop targets that died or pulled the minion off its leash
+		ADelveDeepCharacter* Target = Cast<ADelveDeepCharacter>(Targets[Index].Get());
+		if (Target && (Target->IsDead() || FVector2D::DistSquared(FVector2D(Target->GetActorLocation()), OwnerPosition) > FMath::Square(Steering.LeashRadius)))
+		{
+			Targets[Index].Reset();
+			Target = nullptr;
+		}
+
+		FVector2D Goal = OwnerPosition;
+		float StopDistance = Steering.FollowDistance;
+		if (Target)
+		{
+			Goal = FVector2D(Target->GetActorLocation());
+			StopDistance = AttackRange * 0.8f;
+		}
+
+		NeighbourPositions.Reset();
+		if (Targeting)
+		{
+			Targeting->QueryRadius(Minion->GetActorLocation(), Steering.SeparationRadius, DelveDeepTeam::All, NeighbourHandles);
+			for (const int32 Handle : NeighbourHandles)
+			{
+				if (Handle != Minion->GetTargetingHandle())
+				{
+					NeighbourPositions.Add(FVector2D(Targeting->GetCombatantLocation(Handle)));
+				}
+			}
+			NeighbourHandles.Reset();
+		}
+
+		const FGroup* Group = Groups.FindByPredicate([Owner](const FGroup& Candidate) { return Candidate.Owner == Owner; });
+		const FVector2D GroupCenter = Group->Sum / static_cast<float>(Group->Count);
+
+		const FVector2D Direction = Steering.ComputeSteering(Position, Goal, StopDistance, GroupCenter, NeighbourPositions);
+		if (!Direction.IsNearlyZero())
+		{
+			Minion->AddMovementInput(FVector(Direction, 0.0f), 1.0f, true);
+		}
+
+		// Melee the target once in range and off cooldown
+		if (Target && Now >= AttackReadyTimes[Index]
+			&& FVector2D::DistSquared(Position, FVector2D(Target->GetActorLocation())) <= FMath::Square(AttackRange))
+		{
+			const float AttackSpeed = Data ? FMath::Max(Data->BaseAttackSpeed, 0.1f) : 1.0f;
+			AttackReadyTimes[Index] = Now + BaseAttackInterval / AttackSpeed;
+
+			const UDelveDeepStatsComponent* Stats = Minion->GetStatsComponent();
+			const float Damage = Stats ? Stats->GetStatValue(EDelveDeepStat::Damage) : 0.0f;
+			if (DamageQueue)
+			{
+				DamageQueue->EnqueueHit(Target, Damage, NAME_None, Minion);
+			}
+			else
+			{
+				Target->ApplySimpleDamage(Damage, Minion);
+			}
+		}
+	}
+}
+
+void UDelveDeepMinionSubsystem::RemoveMinion(int32 Index)
+{
+	if (ADelveDeepCharacter* Minion = Minions[Index].Get())
+	{
+		UDelveDeepActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UDelveDeepActorPoolSubsystem>();
+		if (!Pool || !Pool->ReleaseCharacter(Minion))
+		{
+			Minion->Destroy();
+		}
+	}
+
+	Minions.RemoveAt(Index);
+	Owners.RemoveAt(Index);
+	Targets.RemoveAt(Index);
+	AttackReadyTimes.RemoveAt(Index);
+}
+
+bool UDelveDeepMinionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
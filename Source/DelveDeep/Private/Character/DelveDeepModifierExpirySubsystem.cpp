@@ -0,0 +1,220 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepModifierExpirySubsystem.h"
+#include "Character/DelveDeepStatsComponent.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepModifierExpiry, Log, All);
+
+FDelveDeepTimingWheel::FDelveDeepTimingWheel()
+	: CurrentTick(0)
+	, NumEntries(0)
+{
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		LevelCounts[Level] = 0;
+	}
+}
+
+uint64 FDelveDeepTimingWheel::TimeToTick(double Time)
+{
+	return Time > 0.0 ? static_cast<uint64>(Time / TickSeconds) : 0;
+}
+
+void FDelveDeepTimingWheel::Schedule(const FDelveDeepModifierExpiry& Expiry)
+{
+	FEntry Entry;
+	Entry.Expiry = Expiry;
+
+	// Anything already due goes in the current slot and fires on the next Advance
+	Entry.Tick = FMath::Max(TimeToTick(Expiry.ExpireTime), CurrentTick);
+
+	Insert(MoveTemp(Entry));
+	++NumEntries;
+}
+
+void FDelveDeepTimingWheel::Insert(FEntry&& Entry)
+{
+	const uint64 Delta = Entry.Tick - CurrentTick;
+
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const int32 Shift = Level * SlotBits;
+		if (Delta < (uint64(1) << (Shift + SlotBits)))
+		{
+			const int32 SlotIndex = static_cast<int32>((Entry.Tick >> Shift) & (SlotsPerLevel - 1));
+			Levels[Level][SlotIndex].Add(MoveTemp(Entry));
+			++LevelCounts[Level];
+			return;
+		}
+	}
+
+	// Past the wheel's range: park in the last slot the top level reaches and re-cascade from there
+	const int32 TopShift = (NumLevels - 1) * SlotBits;
+	const int32 SlotIndex = static_cast<int32>(((CurrentTick >> TopShift) - 1) & (SlotsPerLevel - 1));
+	Levels[NumLevels - 1][SlotIndex].Add(MoveTemp(Entry));
+	++LevelCounts[NumLevels - 1];
+}
+
+void FDelveDeepTimingWheel::Cascade(int32 Level)
+{
+	const int32 Shift = Level * SlotBits;
+	const int32 SlotIndex = static_cast<int32>((CurrentTick >> Shift) & (SlotsPerLevel - 1));
+
+	FSlot Entries = MoveTemp(Levels[Level][SlotIndex]);
+	Levels[Level][SlotIndex].Reset();
+	LevelCounts[Level] -= Entries.Num();
+
+	for (FEntry& Entry : Entries)
+	{
+		Insert(MoveTemp(Entry));
+	}
+}
+
+void FDelveDeepTimingWheel::Advance(double Now, TArray<FDelveDeepModifierExpiry>& OutExpired)
+{
+	if (NumEntries == 0)
+	{
+		// Nothing to move; keep the clock in step so new entries land in the right slots
+		CurrentTick = FMath::Max(CurrentTick, TimeToTick(Now));
+		return;
+	}
+
+	const uint64 NowTick = TimeToTick(Now);
+
+	while (CurrentTick < NowTick)
+	{
+		// Every entry in a slot the clock has passed is due
+		FSlot& Slot = Levels[0][static_cast<int32>(CurrentTick & (SlotsPerLevel - 1))];
+		for (FEntry& Entry : Slot)
+		{
+			OutExpired.Add(MoveTemp(Entry.Expiry));
+		}
+		NumEntries -= Slot.Num();
+		LevelCounts[0] -= Slot.Num();
+		Slot.Reset();
+
+		if (NumEntries == 0)
+		{
+			CurrentTick = NowTick;
+			break;
+		}
+
+		// Nothing can fire before the next range of the lowest non-empty level comes up
+		int32 EmptyLevels = 0;
+		while (EmptyLevels < NumLevels - 1 && LevelCounts[EmptyLevels] == 0)
+		{
+			++EmptyLevels;
+		}
+
+		uint64 NextTick = CurrentTick + 1;
+		if (EmptyLevels > 0)
+		{
+			const int32 Shift = EmptyLevels * SlotBits;
+			NextTick = ((CurrentTick >> Shift) + 1) << Shift;
+		}
+		CurrentTick = FMath::Min(NextTick, NowTick);
+
+		// Entering a new range at a level pulls that range's entries down
+		for (int32 Level = 1; Level < NumLevels; ++Level)
+		{
+			if ((CurrentTick & ((uint64(1) << (Level * SlotBits)) - 1)) != 0)
+			{
+				break;
+			}
+			Cascade(Level);
+		}
+	}
+
+	// The current slot also holds entries due later within the same tick
+	FSlot& CurrentSlot = Levels[0][static_cast<int32>(CurrentTick & (SlotsPerLevel - 1))];
+	for (int32 Index = CurrentSlot.Num() - 1; Index >= 0; --Index)
+	{
+		if (CurrentSlot[Index].Expiry.ExpireTime <= Now)
+		{
+			OutExpired.Add(MoveTemp(CurrentSlot[Index].Expiry));
+			CurrentSlot.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			--NumEntries;
+			--LevelCounts[0];
+		}
+	}
+}
+
+void FDelveDeepTimingWheel::Reset()
+{
+	for (TStaticArray<FSlot, SlotsPerLevel>& Level : Levels)
+	{
+		for (FSlot& Slot : Level)
+		{
+			Slot.Empty();
+		}
+	}
+
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		LevelCounts[Level] = 0;
+	}
+
+	CurrentTick = 0;
+	NumEntries = 0;
+}
+
+void UDelveDeepModifierExpirySubsystem::Deinitialize()
+{
+	Wheel.Reset();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepModifierExpirySubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_ModifierExpiry);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ExpiredScratch.Reset();
+	Wheel.Advance(World->GetTimeSeconds(), ExpiredScratch);
+
+	for (const FDelveDeepModifierExpiry& Expiry : ExpiredScratch)
+	{
+		// Components destroyed or modifiers removed early are simply skipped
+		if (UDelveDeepStatsComponent* Component = Expiry.Component.Get())
+		{
+			if (Component->RemoveStatModifierByHandle(Expiry.Handle))
+			{
+				UE_LOG(LogDelveDeepModifierExpiry, Verbose,
+					TEXT("Stat modifier %d expired on %s"), Expiry.Handle, *Component->GetName());
+			}
+		}
+	}
+}
+
+TStatId UDelveDeepModifierExpirySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepModifierExpirySubsystem, STATGROUP_Tickables);
+}
+
+void UDelveDeepModifierExpirySubsystem::ScheduleModifierExpiry(UDelveDeepStatsComponent* Component, int32 Handle, double ExpireTime)
+{
+	if (!Component || Handle == INDEX_NONE)
+	{
+		return;
+	}
+
+	FDelveDeepModifierExpiry Expiry;
+	Expiry.Component = Component;
+	Expiry.Handle = Handle;
+	Expiry.ExpireTime = ExpireTime;
+
+	Wheel.Schedule(Expiry);
+}
+
+bool UDelveDeepModifierExpirySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,504 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepMonsterSimulationSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepCharacterBlueprintLibrary.h"
+#include "Character/DelveDeepActorPoolSubsystem.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepFlowFieldSubsystem.h"
+#include "Character/DelveDeepStatsComponent.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "DelveDeepConfigurationManager.h"
+#include "DelveDeepMonsterConfig.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "DelveDeepStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepMonsterSimulation, Log, All);
+
+void UDelveDeepMonsterSimulationSubsystem::Deinitialize()
+{
+	// Promoted actors belong to the world and go away with it
+	for (int32 Slot = Health.Num() - 1; Slot >= 0; --Slot)
+	{
+		RemoveSlot(Slot);
+	}
+	HandleToSlot.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepMonsterSimulationSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr)
+	{
+		if (const APawn* PlayerPawn = PlayerController->GetPawn())
+		{
+			LastPlayerLocation = PlayerPawn->GetActorLocation();
+		}
+	}
+
+	Simulate(DeltaTime, LastPlayerLocation, World ? World->GetSubsystem<UDelveDeepFlowFieldSubsystem>() : nullptr);
+	UpdatePromotions(LastPlayerLocation);
+
+	if (const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr)
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			static const FName MonstersName(TEXT("Monsters"));
+			Telemetry->TrackEntityCount(MonstersName, Health.Num());
+		}
+	}
+}
+
+TStatId UDelveDeepMonsterSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepMonsterSimulationSubsystem, STATGROUP_Tickables);
+}
+
+bool UDelveDeepMonsterSimulationSubsystem::RegisterMonsterType(FName MonsterName, TSubclassOf<ADelveDeepCharacter> ActorClass)
+{
+	const UWorld* World = GetWorld();
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	const UDelveDeepConfigurationManager* ConfigManager = GameInstance ? GameInstance->GetSubsystem<UDelveDeepConfigurationManager>() : nullptr;
+	if (!ConfigManager)
+	{
+		UE_LOG(LogDelveDeepMonsterSimulation, Warning, TEXT("RegisterMonsterType: Configuration manager unavailable"));
+		return false;
+	}
+
+	FDelveDeepMonsterConfig Config;
+	if (!ConfigManager->GetMonsterConfig(MonsterName, Config))
+	{
+		UE_LOG(LogDelveDeepMonsterSimulation, Warning, TEXT("RegisterMonsterType: No monster config '%s'"), *MonsterName.ToString());
+		return false;
+	}
+
+	RegisterMonsterTypeFromConfig(MonsterName, Config, ActorClass);
+	return true;
+}
+
+void UDelveDeepMonsterSimulationSubsystem::RegisterMonsterTypeFromConfig(FName MonsterName, const FDelveDeepMonsterConfig& Config, TSubclassOf<ADelveDeepCharacter> ActorClass)
+{
+	int32 TypeIndex = INDEX_NONE;
+	if (const int32* ExistingIndex = TypeIndexByName.Find(MonsterName))
+	{
+		// Re-registering updates the type; live monsters keep the stats they spawned with
+		TypeIndex = *ExistingIndex;
+	}
+	else
+	{
+		if (Types.Num() > MAX_uint16)
+		{
+			UE_LOG(LogDelveDeepMonsterSimulation, Error, TEXT("RegisterMonsterType: Too many monster types"));
+			return;
+		}
+
+		TypeIndex = Types.AddDefaulted();
+		TypeIndexByName.Add(MonsterName, TypeIndex);
+	}
+
+	FMonsterType& Type = Types[TypeIndex];
+	Type.Name = MonsterName;
+	Type.MaxHealth = FMath::Max(Config.Health, 1.0f);
+	Type.MoveSpeed = Config.MoveSpeed;
+	Type.Armor = Config.Armor;
+	Type.DetectionRange = Config.DetectionRange;
+	Type.AttackRange = Config.AttackRange;
+	Type.ActorClass = ActorClass;
+}
+
+int32 UDelveDeepMonsterSimulationSubsystem::SpawnMonster(FName MonsterName, const FVector& Location)
+{
+	const int32* TypeIndex = TypeIndexByName.Find(MonsterName);
+	if (!TypeIndex)
+	{
+		UE_LOG(LogDelveDeepMonsterSimulation, Warning, TEXT("SpawnMonster: Unknown monster type '%s'"), *MonsterName.ToString());
+		return INDEX_NONE;
+	}
+
+	const FMonsterType& Type = Types[*TypeIndex];
+
+	const int32 Slot = Health.Add(Type.MaxHealth);
+	PositionX.Add(Location.X);
+	PositionY.Add(Location.Y);
+	PositionZ.Add(Location.Z);
+	VelocityX.Add(0.0f);
+	VelocityY.Add(0.0f);
+	CombatTime.Add(0.0f);
+	States.Add(EDelveDeepMonsterState::Idle);
+	MoveSpeeds.Add(Type.MoveSpeed);
+	DetectionRangesSq.Add(FMath::Square(Type.DetectionRange));
+	AttackRangesSq.Add(FMath::Square(Type.AttackRange));
+	TypeIndices.Add(static_cast<uint16>(*TypeIndex));
+	Actors.AddDefaulted();
+
+	const int32 Handle = NextHandle++;
+	SlotHandles.Add(Handle);
+	HandleToSlot.Add(Handle, Slot);
+
+	SET_DWORD_STAT(STAT_DelveDeep_ActiveMonsters, Health.Num());
+
+	return Handle;
+}
+
+bool UDelveDeepMonsterSimulationSubsystem::DamageMonster(int32 Handle, float Damage)
+{
+	const int32 Slot = FindSlot(Handle);
+	if (Slot == INDEX_NONE || Damage <= 0.0f || States[Slot] == EDelveDeepMonsterState::Dead)
+	{
+		return false;
+	}
+
+	if (States[Slot] == EDelveDeepMonsterState::Promoted)
+	{
+		// The actor owns health while promoted; its death is picked up by the next update
+		if (ADelveDeepCharacter* Actor = Actors[Slot].Get())
+		{
+			Actor->ApplySimpleDamage(Damage, nullptr);
+		}
+		return false;
+	}
+
+	// Same mitigation as the damage queue
+	const float Armor = Types[TypeIndices[Slot]].Armor;
+	Health[Slot] -= Damage * UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(Armor);
+	CombatTime[Slot] = CombatDuration;
+
+	if (Health[Slot] <= 0.0f)
+	{
+		Health[Slot] = 0.0f;
+		States[Slot] = EDelveDeepMonsterState::Dead;
+		return true;
+	}
+
+	return false;
+}
+
+void UDelveDeepMonsterSimulationSubsystem::Simulate(float DeltaTime, const FVector& PlayerLocation, const UDelveDeepFlowFieldSubsystem* FlowFields)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_MonsterSimulation);
+	TRACE_DELVEDEEP_AI();
+
+	const int32 Count = Health.Num();
+	if (Count == 0 || DeltaTime <= 0.0f)
+	{
+		RemoveDeadMonsters();
+		return;
+	}
+
+	const float PlayerX = PlayerLocation.X;
+	const float PlayerY = PlayerLocation.Y;
+
+	float* RESTRICT PosX = PositionX.GetData();
+	float* RESTRICT PosY = PositionY.GetData();
+	float* RESTRICT VelX = VelocityX.GetData();
+	float* RESTRICT VelY = VelocityY.GetData();
+	float* RESTRICT Combat = CombatTime.GetData();
+	EDelveDeepMonsterState* RESTRICT State = States.GetData();
+	const float* RESTRICT Speed = MoveSpeeds.GetData();
+	const float* RESTRICT DetectSq = DetectionRangesSq.GetData();
+	const float* RESTRICT AttackSq = AttackRangesSq.GetData();
+
+	const int32 NumBatches = FMath::DivideAndRoundUp(Count, BatchSize);
+
+	// Batches touch disjoint slot ranges, so they need no synchronization
+	ParallelFor(NumBatches, [=](int32 Batch)
+	{
+		const int32 Begin = Batch * BatchSize;
+		const int32 End = FMath::Min(Begin + BatchSize, Count);
+
+		for (int32 Slot = Begin; Slot < End; ++Slot)
+		{
+			// Combat also runs out for promoted monsters so they can be demoted
+			Combat[Slot] = FMath::Max(Combat[Slot] - DeltaTime, 0.0f);
+
+			if (State[Slot] == EDelveDeepMonsterState::Promoted || State[Slot] == EDelveDeepMonsterState::Dead)
+			{
+				continue;
+			}
+
+			const float ToPlayerX = PlayerX - PosX[Slot];
+			const float ToPlayerY = PlayerY - PosY[Slot];
+			const float DistanceSq = ToPlayerX * ToPlayerX + ToPlayerY * ToPlayerY;
+
+			if (DistanceSq <= AttackSq[Slot])
+			{
+				State[Slot] = EDelveDeepMonsterState::Attacking;
+				VelX[Slot] = 0.0f;
+				VelY[Slot] = 0.0f;
+			}
+			else if (DistanceSq <= DetectSq[Slot] || Combat[Slot] > 0.0f)
+			{
+				State[Slot] = EDelveDeepMonsterState::Chasing;
+
+				// Follow the flow field around walls; straight at the player outside it
+				FVector Steering;
+				if (FlowFields && FlowFields->SampleDirection(FVector(PosX[Slot], PosY[Slot], 0.0f), Steering))
+				{
+					VelX[Slot] = Steering.X * Speed[Slot];
+					VelY[Slot] = Steering.Y * Speed[Slot];
+				}
+				else
+				{
+					const float InvDistance = FMath::InvSqrt(DistanceSq);
+					VelX[Slot] = ToPlayerX * InvDistance * Speed[Slot];
+					VelY[Slot] = ToPlayerY * InvDistance * Speed[Slot];
+				}
+			}
+			else
+			{
+				State[Slot] = EDelveDeepMonsterState::Idle;
+				VelX[Slot] = 0.0f;
+				VelY[Slot] = 0.0f;
+			}
+
+			PosX[Slot] += VelX[Slot] * DeltaTime;
+			PosY[Slot] += VelY[Slot] * DeltaTime;
+		}
+	}, NumBatches == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	RemoveDeadMonsters();
+}
+
+void UDelveDeepMonsterSimulationSubsystem::UpdatePromotions(const FVector& PlayerLocation)
+{
+	const float PromotionRadiusSq = FMath::Square(PromotionRadius);
+	const float DemotionRadiusSq = FMath::Square(DemotionRadius);
+
+	PromotionCandidates.Reset();
+
+	for (int32 Slot = 0; Slot < Health.Num(); ++Slot)
+	{
+		if (States[Slot] == EDelveDeepMonsterState::Promoted)
+		{
+			ADelveDeepCharacter* Actor = Actors[Slot].Get();
+			if (!IsValid(Actor) || Actor->IsDead() || Actor->IsPooled())
+			{
+				// Killed as an actor; the actor handles its own death and release
+				Actors[Slot].Reset();
+				--PromotedCount;
+				States[Slot] = EDelveDeepMonsterState::Dead;
+				continue;
+			}
+
+			const FVector ActorLocation = Actor->GetActorLocation();
+			if (FVector::DistSquared2D(ActorLocation, PlayerLocation) > DemotionRadiusSq && CombatTime[Slot] <= 0.0f)
+			{
+				DemoteMonster(Slot);
+			}
+			continue;
+		}
+
+		if (States[Slot] == EDelveDeepMonsterState::Dead || !Types[TypeIndices[Slot]].ActorClass)
+		{
+			continue;
+		}
+
+		const float DistanceSq = FMath::Square(PositionX[Slot] - PlayerLocation.X) + FMath::Square(PositionY[Slot] - PlayerLocation.Y);
+		if (DistanceSq <= PromotionRadiusSq || CombatTime[Slot] > 0.0f)
+		{
+			PromotionCandidates.Emplace(DistanceSq, Slot);
+		}
+	}
+
+	// Closest monsters get the actor budget first
+	const int32 Budget = MaxPromoted - PromotedCount;
+	if (Budget > 0 && PromotionCandidates.Num() > 0)
+	{
+		if (PromotionCandidates.Num() > Budget)
+		{
+			PromotionCandidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+			PromotionCandidates.SetNum(Budget, EAllowShrinking::No);
+		}
+
+		for (const TPair<float, int32>& Candidate : PromotionCandidates)
+		{
+			if (!PromoteMonster(Candidate.Value))
+			{
+				// Spawning is throttled or failing; try again next frame
+				break;
+			}
+		}
+	}
+
+	RemoveDeadMonsters();
+}
+
+bool UDelveDeepMonsterSimulationSubsystem::PromoteMonster(int32 Slot)
+{
+	const FMonsterType& Type = Types[TypeIndices[Slot]];
+	const FVector Location(PositionX[Slot], PositionY[Slot], PositionZ[Slot]);
+	const FRotator Rotation = FVector(VelocityX[Slot], VelocityY[Slot], 0.0f).Rotation();
+
+	ADelveDeepCharacter* Actor = UDelveDeepCharacterBlueprintLibrary::SpawnCharacter(this, Type.ActorClass, Location, Rotation);
+	if (!Actor)
+	{
+		return false;
+	}
+
+	// Carry the simulated health over as a fraction of the actor's maximum
+	if (UDelveDeepStatsComponent* Stats = Actor->GetStatsComponent())
+	{
+		const float TargetHealth = Stats->GetMaxHealth() * (Health[Slot] / Type.MaxHealth);
+		Stats->ModifyHealth(TargetHealth - Stats->GetCurrentHealth());
+	}
+
+	Actor->SetTeamId(DelveDeepTeam::Monsters);
+
+	Actors[Slot] = Actor;
+	States[Slot] = EDelveDeepMonsterState::Promoted;
+	VelocityX[Slot] = 0.0f;
+	VelocityY[Slot] = 0.0f;
+	++PromotedCount;
+
+	return true;
+}
+
+void UDelveDeepMonsterSimulationSubsystem::DemoteMonster(int32 Slot)
+{
+	ADelveDeepCharacter* Actor = Actors[Slot].Get();
+	if (Actor)
+	{
+		const FVector Location = Actor->GetActorLocation();
+		PositionX[Slot] = Location.X;
+		PositionY[Slot] = Location.Y;
+		PositionZ[Slot] = Location.Z;
+
+		const FMonsterType& Type = Types[TypeIndices[Slot]];
+		if (const UDelveDeepStatsComponent* Stats = Actor->GetStatsComponent())
+		{
+			const float Fraction = Stats->GetMaxHealth() > 0.0f ? Stats->GetCurrentHealth() / Stats->GetMaxHealth() : 1.0f;
+			Health[Slot] = Type.MaxHealth * Fraction;
+		}
+
+		UDelveDeepActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UDelveDeepActorPoolSubsystem>();
+		if (!Pool || !Pool->ReleaseCharacter(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+
+	Actors[Slot].Reset();
+	States[Slot] = EDelveDeepMonsterState::Idle;
+	--PromotedCount;
+}
+
+void UDelveDeepMonsterSimulationSubsystem::RemoveDeadMonsters()
+{
+	for (int32 Slot = Health.Num() - 1; Slot >= 0; --Slot)
+	{
+		if (States[Slot] == EDelveDeepMonsterState::Dead)
+		{
+			RemoveSlot(Slot);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_DelveDeep_ActiveMonsters, Health.Num());
+}
+
+void UDelveDeepMonsterSimulationSubsystem::RemoveSlot(int32 Slot)
+{
+	if (Actors[Slot].IsValid())
+	{
+		--PromotedCount;
+	}
+
+	HandleToSlot.Remove(SlotHandles[Slot]);
+
+	PositionX.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	PositionY.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	PositionZ.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	VelocityX.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	VelocityY.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Health.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	CombatTime.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	MoveSpeeds.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	DetectionRangesSq.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	AttackRangesSq.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	TypeIndices.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Actors.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	SlotHandles.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	// The former last slot now lives here
+	if (SlotHandles.IsValidIndex(Slot))
+	{
+		HandleToSlot[SlotHandles[Slot]] = Slot;
+	}
+}
+
+void UDelveDeepMonsterSimulationSubsystem::SetPromotionSettings(float InPromotionRadius, float InDemotionRadius, int32 InMaxPromoted)
+{
+	PromotionRadius = FMath::Max(InPromotionRadius, 0.0f);
+
+	// Demoting closer than promoting would flip monsters back and forth every frame
+	DemotionRadius = FMath::Max(InDemotionRadius, PromotionRadius);
+	MaxPromoted = FMath::Max(InMaxPromoted, 0);
+}
+
+bool UDelveDeepMonsterSimulationSubsystem::IsMonsterAlive(int32 Handle) const
+{
+	const int32 Slot = FindSlot(Handle);
+	return Slot != INDEX_NONE && States[Slot] != EDelveDeepMonsterState::Dead;
+}
+
+FVector UDelveDeepMonsterSimulationSubsystem::GetMonsterLocation(int32 Handle) const
+{
+	const int32 Slot = FindSlot(Handle);
+	if (Slot == INDEX_NONE)
+	{
+		return FVector::ZeroVector;
+	}
+
+	if (const ADelveDeepCharacter* Actor = Actors[Slot].Get())
+	{
+		return Actor->GetActorLocation();
+	}
+
+	return FVector(PositionX[Slot], PositionY[Slot], PositionZ[Slot]);
+}
+
+float UDelveDeepMonsterSimulationSubsystem::GetMonsterHealth(int32 Handle) const
+{
+	const int32 Slot = FindSlot(Handle);
+	if (Slot == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	if (const ADelveDeepCharacter* Actor = Actors[Slot].Get())
+	{
+		return Actor->GetCurrentHealth();
+	}
+
+	return Health[Slot];
+}
+
+EDelveDeepMonsterState UDelveDeepMonsterSimulationSubsystem::GetMonsterState(int32 Handle) const
+{
+	const int32 Slot = FindSlot(Handle);
+	return Slot != INDEX_NONE ? States[Slot] : EDelveDeepMonsterState::Dead;
+}
+
+ADelveDeepCharacter* UDelveDeepMonsterSimulationSubsystem::GetMonsterActor(int32 Handle) const
+{
+	const int32 Slot = FindSlot(Handle);
+	return Slot != INDEX_NONE ? Actors[Slot].Get() : nullptr;
+}
+
+int32 UDelveDeepMonsterSimulationSubsystem::FindSlot(int32 Handle) const
+{
+	const int32* Slot = HandleToSlot.Find(Handle);
+	return Slot ? *Slot : INDEX_NONE;
+}
+
+bool UDelveDeepMonsterSimulationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
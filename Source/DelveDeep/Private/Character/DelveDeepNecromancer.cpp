@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Character/DelveDeepNecromancer.h"
+#include "Character/DelveDeepMinionSubsystem.h"
 #include "Character/DelveDeepStatsComponent.h"
 #include "Events/DelveDeepEventSubsystem.h"
 #include "DelveDeepLogChannels.h"
@@ -18,6 +19,12 @@ void ADelveDeepNecromancer::BeginPlay()
 
 	// Register for enemy death events
 	RegisterForEnemyDeathEvents();
+
+	// Park minions up front so summoning mid-fight reuses pooled actors
+	if (UDelveDeepMinionSubsystem* MinionSubsystem = GetWorld()->GetSubsystem<UDelveDeepMinionSubsystem>())
+	{
+		MinionSubsystem->PrewarmMinions(MinionClass, MaxMinions);
+	}
 }
 
 void ADelveDeepNecromancer::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -25,8 +32,14 @@ void ADelveDeepNecromancer::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	// Unregister from enemy death events
 	UnregisterFromEnemyDeathEvents();
 
-	// Clean up active minions
-	ActiveMinions.Empty();
+	// Return active minions to their pool
+	if (UWorld* World = GetWorld())
+	{
+		if (UDelveDeepMinionSubsystem* MinionSubsystem = World->GetSubsystem<UDelveDeepMinionSubsystem>())
+		{
+			MinionSubsystem->DismissAllMinions(this);
+		}
+	}
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -129,41 +142,72 @@ void ADelveDeepNecromancer::CollectSoul()
 
 void ADelveDeepNecromancer::SummonMinion()
 {
-	// Placeholder for future minion system integration
-	UE_LOG(LogDelveDeep, Display, 
-		TEXT("Necromancer '%s' summons minion (placeholder)"), 
-		*GetName());
-
-	// TODO: Implement minion summoning when minion system is available
-	// - Check Soul cost (e.g., 3 Souls per minion)
-	// - Check if at max minion count
-	// - Spawn minion actor
-	// - Add to ActiveMinions array
-	// - Consume Souls
+	UDelveDeepMinionSubsystem* MinionSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UDelveDeepMinionSubsystem>() : nullptr;
+	if (!MinionSubsystem || !MinionClass)
+	{
+		UE_LOG(LogDelveDeep, Warning, 
+			TEXT("Necromancer '%s' cannot summon minion - no minion subsystem or minion class"), 
+			*GetName());
+		return;
+	}
 
 	// Check if at max minions
-	if (ActiveMinions.Num() >= MaxMinions)
+	const int32 ActiveMinionCount = MinionSubsystem->GetMinionCount(this);
+	if (ActiveMinionCount >= MaxMinions)
 	{
 		UE_LOG(LogDelveDeep, Warning, 
 			TEXT("Necromancer '%s' cannot summon minion - already at maximum (%d/%d)"), 
-			*GetName(), ActiveMinions.Num(), MaxMinions);
+			*GetName(), ActiveMinionCount, MaxMinions);
 		return;
 	}
 
-	// Check if enough Souls (placeholder cost: 3 Souls)
-	const float SoulCost = 3.0f;
-	if (StatsComponent && StatsComponent->GetCurrentResource() < SoulCost)
+	// Check if enough Souls
+	if (StatsComponent && StatsComponent->GetCurrentResource() < SummonSoulCost)
 	{
 		UE_LOG(LogDelveDeep, Warning, 
 			TEXT("Necromancer '%s' cannot summon minion - not enough Souls (%.0f/%.0f required)"), 
-			*GetName(), StatsComponent->GetCurrentResource(), SoulCost);
+			*GetName(), StatsComponent->GetCurrentResource(), SummonSoulCost);
+		return;
+	}
+
+	// Spread minions around the Necromancer
+	const float Angle = ActiveMinionCount * (UE_TWO_PI / FMath::Max(MaxMinions, 1));
+	const FVector Offset(FMath::Cos(Angle) * SummonOffset, FMath::Sin(Angle) * SummonOffset, 0.0f);
+
+	if (!MinionSubsystem->SummonMinion(this, MinionClass, GetActorLocation() + Offset))
+	{
 		return;
 	}
 
 	// Consume Souls
 	if (StatsComponent)
 	{
-		StatsComponent->ModifyResource(-SoulCost);
+		StatsComponent->ModifyResource(-SummonSoulCost);
+	}
+
+	UE_LOG(LogDelveDeep, Display, 
+		TEXT("Necromancer '%s' summoned minion (%d/%d)"), 
+		*GetName(), ActiveMinionCount + 1, MaxMinions);
+}
+
+int32 ADelveDeepNecromancer::GetActiveMinionCount() const
+{
+	const UWorld* World = GetWorld();
+	const UDelveDeepMinionSubsystem* MinionSubsystem = World ? World->GetSubsystem<UDelveDeepMinionSubsystem>() : nullptr;
+	return MinionSubsystem ? MinionSubsystem->GetMinionCount(this) : 0;
+}
+
+void ADelveDeepNecromancer::SetMaxMinions(int32 NewMaxMinions)
+{
+	MaxMinions = FMath::Max(NewMaxMinions, 0);
+
+	// Grow the pool with the limit so new slots do not spawn mid-fight
+	if (UWorld* World = GetWorld())
+	{
+		if (UDelveDeepMinionSubsystem* MinionSubsystem = World->GetSubsystem<UDelveDeepMinionSubsystem>())
+		{
+			MinionSubsystem->PrewarmMinions(MinionClass, MaxMinions - MinionSubsystem->GetMinionCount(this));
+		}
 	}
 }
 
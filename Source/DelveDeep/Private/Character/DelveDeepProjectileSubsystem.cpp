@@ -0,0 +1,424 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepProjectileSubsystem.h"
+#include "Character/DelveDeepAoESubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "DelveDeepWeaponData.h"
+#include "DelveDeepStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PaperGroupedSpriteComponent.h"
+#include "PaperSprite.h"
+
+void UDelveDeepProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PositionX.Reserve(InitialCapacity);
+	PositionY.Reserve(InitialCapacity);
+	PositionZ.Reserve(InitialCapacity);
+	DirectionX.Reserve(InitialCapacity);
+	DirectionY.Reserve(InitialCapacity);
+	Speeds.Reserve(InitialCapacity);
+	Damages.Reserve(InitialCapacity);
+	RemainingRanges.Reserve(InitialCapacity);
+	HitsLeft.Reserve(InitialCapacity);
+	ExplosionRadii.Reserve(InitialCapacity);
+	Teams.Reserve(InitialCapacity);
+	VisualGroups.Reserve(InitialCapacity);
+	DamageTypes.Reserve(InitialCapacity);
+	Instigators.Reserve(InitialCapacity);
+	HitTargets.Reserve(InitialCapacity);
+}
+
+void UDelveDeepProjectileSubsystem::Deinitialize()
+{
+	PositionX.Empty();
+	PositionY.Empty();
+	PositionZ.Empty();
+	DirectionX.Empty();
+	DirectionY.Empty();
+	Speeds.Empty();
+	Damages.Empty();
+	RemainingRanges.Empty();
+	HitsLeft.Empty();
+	ExplosionRadii.Empty();
+	Teams.Empty();
+	VisualGroups.Empty();
+	DamageTypes.Empty();
+	Instigators.Empty();
+	HitTargets.Empty();
+	LastHits.Empty();
+	LastExplosions.Empty();
+	VisualGroupList.Empty();
+	VisualsActor = nullptr;
+
+	SET_DWORD_STAT(STAT_DelveDeep_ActiveProjectiles, 0);
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepProjectileSubsystem::Tick(float DeltaTime)
+{
+	const UDelveDeepTargetingSubsystem* Targeting = GetWorld()->GetSubsystem<UDelveDeepTargetingSubsystem>();
+
+	Simulate(DeltaTime, Targeting);
+	ApplyHits(Targeting);
+	ApplyExplosions();
+	UpdateVisuals();
+}
+
+TStatId UDelveDeepProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepProjectileSubsystem, STATGROUP_Tickables);
+}
+
+bool UDelveDeepProjectileSubsystem::FireProjectile(const FDelveDeepProjectileParams& Params)
+{
+	const FVector2D Direction = FVector2D(Params.Direction.X, Params.Direction.Y).GetSafeNormal();
+	if (Direction.IsZero() || Params.Speed <= 0.0f || Params.Range <= 0.0f)
+	{
+		return false;
+	}
+
+	PositionX.Add(Params.Origin.X);
+	PositionY.Add(Params.Origin.Y);
+	PositionZ.Add(Params.Origin.Z);
+	DirectionX.Add(Direction.X);
+	DirectionY.Add(Direction.Y);
+	Speeds.Add(Params.Speed);
+	Damages.Add(Params.Damage);
+	RemainingRanges.Add(Params.Range);
+	HitsLeft.Add(FMath::Max(Params.MaxHits, 1));
+	ExplosionRadii.Add(FMath::Max(Params.ExplosionRadius, 0.0f));
+	Teams.Add(Params.Team);
+	VisualGroups.Add(GetVisualGroup(Params.Sprite));
+	DamageTypes.Add(Params.DamageType);
+	Instigators.Add(Params.Instigator);
+	HitTargets.AddDefaulted();
+
+	SET_DWORD_STAT(STAT_DelveDeep_ActiveProjectiles, Speeds.Num());
+	return true;
+}
+
+bool UDelveDeepProjectileSubsystem::MakeWeaponProjectileParams(AActor* Instigator, const UDelveDeepWeaponData* Weapon, const FVector& Origin, const FVector& Direction, uint8 Team, FDelveDeepProjectileParams& OutParams)
+{
+	if (!Weapon || Weapon->ProjectileSpeed <= 0.0f)
+	{
+		return false;
+	}
+
+	OutParams.Origin = Origin;
+	OutParams.Direction = Direction;
+	OutParams.Speed = Weapon->ProjectileSpeed;
+	OutParams.Damage = Weapon->BaseDamage;
+	OutParams.Range = Weapon->Range;
+	OutParams.MaxHits = Weapon->bPiercing ? FMath::Max(Weapon->MaxPierceTargets, 1) : 1;
+	OutParams.DamageType = Weapon->DamageType;
+	OutParams.Team = Team;
+	OutParams.Instigator = Instigator;
+
+	// Loaded once on the first shot, resident afterwards
+	OutParams.Sprite = Weapon->ProjectileSprite.IsNull() ? nullptr : Weapon->ProjectileSprite.LoadSynchronous();
+
+	return true;
+}
+
+bool UDelveDeepProjectileSubsystem::FireWeaponProjectile(AActor* Instigator, const UDelveDeepWeaponData* Weapon, const FVector& Origin, const FVector& Direction, uint8 Team)
+{
+	FDelveDeepProjectileParams Params;
+	if (!MakeWeaponProjectileParams(Instigator, Weapon, Origin, Direction, Team, Params))
+	{
+		return false;
+	}
+
+	return FireProjectile(Params);
+}
+
+int32 UDelveDeepProjectileSubsystem::Simulate(float DeltaTime, const UDelveDeepTargetingSubsystem* Targeting)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_ProjectileSimulation);
+	TRACE_DELVEDEEP_COMBAT();
+
+	LastHits.Reset();
+	LastExplosions.Reset();
+	Expired.Reset();
+
+	const float HitRadiusSq = HitRadius * HitRadius;
+
+	for (int32 Index = 0; Index < Speeds.Num(); ++Index)
+	{
+		const float Step = FMath::Min(Speeds[Index] * DeltaTime, RemainingRanges[Index]);
+		const float StartX = PositionX[Index];
+		const float StartY = PositionY[Index];
+		const float DirX = DirectionX[Index];
+		const float DirY = DirectionY[Index];
+		float Travelled = Step;
+
+		// Sweep this step's segment against nearby combatants
+		if (Targeting && Step > 0.0f)
+		{
+			const FVector Midpoint(StartX + DirX * Step * 0.5f, StartY + DirY * Step * 0.5f, PositionZ[Index]);
+			Candidates.Reset();
+			Targeting->QueryRadius(Midpoint, Step * 0.5f + HitRadius, DelveDeepTeam::Opposing(Teams[Index]), Candidates);
+
+			SegmentHits.Reset();
+			for (const int32 Handle : Candidates)
+			{
+				if (HitTargets[Index].Contains(Handle))
+				{
+					continue;
+				}
+
+				// Closest point on the segment to the combatant
+				const FVector Location = Targeting->GetCombatantLocation(Handle);
+				const float ToX = Location.X - StartX;
+				const float ToY = Location.Y - StartY;
+				const float T = FMath::Clamp(ToX * DirX + ToY * DirY, 0.0f, Step);
+				const float DX = ToX - DirX * T;
+				const float DY = ToY - DirY * T;
+
+				if (DX * DX + DY * DY <= HitRadiusSq)
+				{
+					SegmentHits.Emplace(T, Handle);
+				}
+			}
+
+			// Hit in order along the segment until the pierce count is spent
+			SegmentHits.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+			for (const TPair<float, int32>& SegmentHit : SegmentHits)
+			{
+				// Exploding projectiles stop at the first combatant and damage through their blast
+				if (ExplosionRadii[Index] > 0.0f)
+				{
+					HitsLeft[Index] = 0;
+					Travelled = SegmentHit.Key;
+					break;
+				}
+
+				FDelveDeepProjectileHit& Hit = LastHits.AddDefaulted_GetRef();
+				Hit.TargetHandle = SegmentHit.Value;
+				Hit.Damage = Damages[Index];
+				Hit.DamageType = DamageTypes[Index];
+				Hit.Instigator = Instigators[Index];
+
+				HitTargets[Index].Add(SegmentHit.Value);
+
+				if (--HitsLeft[Index] <= 0)
+				{
+					Travelled = SegmentHit.Key;
+					break;
+				}
+			}
+		}
+
+		PositionX[Index] = StartX + DirX * Travelled;
+		PositionY[Index] = StartY + DirY * Travelled;
+		RemainingRanges[Index] -= Step;
+
+		if (HitsLeft[Index] <= 0 || RemainingRanges[Index] <= 0.0f)
+		{
+			Expired.Add(Index);
+
+			if (ExplosionRadii[Index] > 0.0f)
+			{
+				FDelveDeepProjectileExplosion& Explosion = LastExplosions.AddDefaulted_GetRef();
+				Explosion.Location = FVector(PositionX[Index], PositionY[Index], PositionZ[Index]);
+				Explosion.Radius = ExplosionRadii[Index];
+				Explosion.Damage = Damages[Index];
+				Explosion.DamageType = DamageTypes[Index];
+				Explosion.Team = Teams[Index];
+				Explosion.Instigator = Instigators[Index];
+			}
+		}
+	}
+
+	// Highest first, so swap-remove never moves a projectile that still has to go
+	for (int32 ExpiredIndex = Expired.Num() - 1; ExpiredIndex >= 0; --ExpiredIndex)
+	{
+		RemoveProjectile(Expired[ExpiredIndex]);
+	}
+
+	SET_DWORD_STAT(STAT_DelveDeep_ActiveProjectiles, Speeds.Num());
+	return LastHits.Num();
+}
+
+FVector UDelveDeepProjectileSubsystem::GetProjectileLocation(int32 Index) const
+{
+	return Speeds.IsValidIndex(Index) ? FVector(PositionX[Index], PositionY[Index], PositionZ[Index]) : FVector::ZeroVector;
+}
+
+void UDelveDeepProjectileSubsystem::RemoveProjectile(int32 Index)
+{
+	PositionX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DirectionX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DirectionY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Speeds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RemainingRanges.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HitsLeft.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ExplosionRadii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Teams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VisualGroups.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DamageTypes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HitTargets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UDelveDeepProjectileSubsystem::ApplyHits(const UDelveDeepTargetingSubsystem* Targeting)
+{
+	if (!Targeting || LastHits.Num() == 0)
+	{
+		return;
+	}
+
+	UDelveDeepDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UDelveDeepDamageQueueSubsystem>();
+
+	for (const FDelveDeepProjectileHit& Hit : LastHits)
+	{
+		ADelveDeepCharacter* Target = Cast<ADelveDeepCharacter>(Targeting->GetCombatantActor(Hit.TargetHandle));
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		if (DamageQueue)
+		{
+			DamageQueue->EnqueueHit(Target, Hit.Damage, Hit.DamageType, Hit.Instigator.Get());
+		}
+		else
+		{
+			Target->ApplySimpleDamage(Hit.Damage, Hit.Instigator.Get());
+		}
+	}
+}
+
+void UDelveDeepProjectileSubsystem::ApplyExplosions()
+{
+	if (LastExplosions.Num() == 0)
+	{
+		return;
+	}
+
+	UDelveDeepAoESubsystem* AoE = GetWorld()->GetSubsystem<UDelveDeepAoESubsystem>();
+	if (!AoE)
+	{
+		return;
+	}
+
+	for (const FDelveDeepProjectileExplosion& Explosion : LastExplosions)
+	{
+		AoE->DamageCircle(Explosion.Location, Explosion.Radius, DelveDeepTeam::Opposing(Explosion.Team),
+			Explosion.Damage, Explosion.DamageType, Explosion.Instigator.Get());
+	}
+}
+
+int32 UDelveDeepProjectileSubsystem::GetVisualGroup(UPaperSprite* Sprite)
+{
+	UWorld* World = GetWorld();
+	if (!Sprite || !World)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 GroupIndex = 0; GroupIndex < VisualGroupList.Num(); ++GroupIndex)
+	{
+		if (VisualGroupList[GroupIndex].Sprite == Sprite && VisualGroupList[GroupIndex].Component.IsValid())
+		{
+			return GroupIndex;
+		}
+	}
+
+	if (!VisualsActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = MakeUniqueObjectName(World, AActor::StaticClass(), TEXT("DelveDeepProjectileVisuals"));
+		SpawnParams.ObjectFlags = RF_Transient;
+		VisualsActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!VisualsActor)
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	UPaperGroupedSpriteComponent* Component = NewObject<UPaperGroupedSpriteComponent>(VisualsActor);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetMobility(EComponentMobility::Movable);
+	if (!VisualsActor->GetRootComponent())
+	{
+		VisualsActor->SetRootComponent(Component);
+	}
+	else
+	{
+		Component->SetupAttachment(VisualsActor->GetRootComponent());
+	}
+	Component->RegisterComponent();
+
+	FVisualGroup& Group = VisualGroupList.AddDefaulted_GetRef();
+	Group.Sprite = Sprite;
+	Group.Component = Component;
+	return VisualGroupList.Num() - 1;
+}
+
+void UDelveDeepProjectileSubsystem::UpdateVisuals()
+{
+	if (VisualGroupList.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<8>> Written;
+	Written.SetNumZeroed(VisualGroupList.Num());
+
+	// Instances are anonymous: rewrite them in projectile order every frame
+	for (int32 Index = 0; Index < Speeds.Num(); ++Index)
+	{
+		const int32 GroupIndex = VisualGroups[Index];
+		if (GroupIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		UPaperGroupedSpriteComponent* Component = VisualGroupList[GroupIndex].Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		const float Yaw = FMath::RadiansToDegrees(FMath::Atan2(DirectionY[Index], DirectionX[Index]));
+		const FTransform Transform(FRotator(0.0f, Yaw, 0.0f), FVector(PositionX[Index], PositionY[Index], PositionZ[Index]));
+
+		const int32 InstanceIndex = Written[GroupIndex]++;
+		if (InstanceIndex < Component->GetInstanceCount())
+		{
+			Component->UpdateInstanceTransform(InstanceIndex, Transform, true, false, true);
+		}
+		else
+		{
+			Component->AddInstance(Transform, VisualGroupList[GroupIndex].Sprite.Get(), true);
+		}
+	}
+
+	// Drop instances of projectiles that expired
+	for (int32 GroupIndex = 0; GroupIndex < VisualGroupList.Num(); ++GroupIndex)
+	{
+		if (UPaperGroupedSpriteComponent* Component = VisualGroupList[GroupIndex].Component.Get())
+		{
+			while (Component->GetInstanceCount() > Written[GroupIndex])
+			{
+				Component->RemoveInstance(Component->GetInstanceCount() - 1);
+			}
+
+			Component->MarkRenderStateDirty();
+		}
+	}
+}
+
+bool UDelveDeepProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
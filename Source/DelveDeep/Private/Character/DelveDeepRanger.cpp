@@ -2,8 +2,11 @@
 
 #include "Character/DelveDeepRanger.h"
 #include "Character/DelveDeepStatsComponent.h"
+#include "Character/DelveDeepEquipmentComponent.h"
+#include "Character/DelveDeepProjectileSubsystem.h"
+#include "DelveDeepWeaponData.h"
+#include "Engine/World.h"
 #include "DelveDeepLogChannels.h"
-#include "TimerManager.h"
 
 ADelveDeepRanger::ADelveDeepRanger()
 {
@@ -19,79 +22,63 @@ void ADelveDeepRanger::BeginPlay()
 	StartEnergyRegeneration();
 }
 
-void ADelveDeepRanger::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-	// Stop Energy regeneration timer
-	if (GetWorld() && EnergyRegenTimerHandle.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(EnergyRegenTimerHandle);
-	}
-
-	Super::EndPlay(EndPlayReason);
-}
-
 void ADelveDeepRanger::StartEnergyRegeneration()
 {
-	if (!GetWorld())
+	if (!StatsComponent)
 	{
 		UE_LOG(LogDelveDeep, Warning, 
-			TEXT("Ranger '%s' cannot start Energy regeneration - no world"), 
+			TEXT("Ranger '%s' cannot start Energy regeneration - no stats component"), 
 			*GetName());
 		return;
 	}
 
-	// Set up timer for Energy regeneration (0.1 second intervals)
-	GetWorld()->GetTimerManager().SetTimer(
-		EnergyRegenTimerHandle,
-		[this]()
-		{
-			RegenerateEnergy(0.1f);
-		},
-		0.1f,
-		true  // Loop
-	);
+	// Regenerated in one batched pass with every other character (stopped by the component's EndPlay)
+	StatsComponent->SetResourceRegenRate(EnergyRegenRate);
 
 	UE_LOG(LogDelveDeep, Display, 
 		TEXT("Ranger '%s' started Energy regeneration"), 
 		*GetName());
 }
 
-void ADelveDeepRanger::RegenerateEnergy(float DeltaTime)
+void ADelveDeepRanger::PerformPiercingShot()
 {
-	if (!StatsComponent)
+	UWorld* World = GetWorld();
+	UDelveDeepProjectileSubsystem* Projectiles = World ? World->GetSubsystem<UDelveDeepProjectileSubsystem>() : nullptr;
+	const UDelveDeepWeaponData* Weapon = EquipmentComponent ? EquipmentComponent->GetCurrentWeapon() : nullptr;
+
+	if (StatsComponent && StatsComponent->GetCurrentResource() < PiercingShotEnergyCost)
 	{
+		UE_LOG(LogDelveDeep, Verbose, 
+			TEXT("Ranger '%s' lacks Energy for Piercing Shot (%.2f/%.2f)"), 
+			*GetName(), StatsComponent->GetCurrentResource(), PiercingShotEnergyCost);
 		return;
 	}
 
-	// Don't regenerate if already at max
-	if (StatsComponent->GetCurrentResource() >= StatsComponent->GetMaxResource())
+	FDelveDeepProjectileParams Params;
+	if (!Projectiles || !UDelveDeepProjectileSubsystem::MakeWeaponProjectileParams(
+		this, Weapon, GetActorLocation(), GetActorForwardVector(), GetTeamId(), Params))
 	{
+		UE_LOG(LogDelveDeep, Warning, 
+			TEXT("Ranger '%s' cannot perform Piercing Shot without a projectile weapon"), 
+			*GetName());
 		return;
 	}
 
-	// Calculate regeneration amount
-	float RegenAmount = EnergyRegenRate * DeltaTime;
-
-	// Add Energy (ModifyResource will clamp to MaxEnergy)
-	StatsComponent->ModifyResource(RegenAmount);
-
-	UE_LOG(LogDelveDeep, VeryVerbose, 
-		TEXT("Ranger '%s' regenerated %.2f Energy (Current: %.2f/%.2f)"), 
-		*GetName(), RegenAmount, StatsComponent->GetCurrentResource(), StatsComponent->GetMaxResource());
-}
+	// Piercing Shot always passes through a few enemies, more with a piercing weapon
+	Params.MaxHits = FMath::Max(Params.MaxHits, PiercingShotMinTargets);
+	if (!Projectiles->FireProjectile(Params))
+	{
+		return;
+	}
 
-void ADelveDeepRanger::PerformPiercingShot()
-{
-	// Placeholder for future combat system integration
-	UE_LOG(LogDelveDeep, Display, 
-		TEXT("Ranger '%s' performs Piercing Shot (placeholder)"), 
-		*GetName());
+	if (StatsComponent)
+	{
+		StatsComponent->ModifyResource(-PiercingShotEnergyCost);
+	}
 
-	// TODO: Implement piercing shot when combat system is available
-	// - Check Energy cost
-	// - Spawn projectile
-	// - Projectile pierces through multiple enemies
-	// - Consume Energy
+	UE_LOG(LogDelveDeep, Verbose, 
+		TEXT("Ranger '%s' performs Piercing Shot (pierces %d)"), 
+		*GetName(), Params.MaxHits);
 }
 
 void ADelveDeepRanger::OnResourceChanged(float OldValue, float NewValue)
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepResourceRegenSubsystem.h"
+#include "Character/DelveDeepStatsComponent.h"
+#include "DelveDeepStats.h"
+
+void UDelveDeepResourceRegenSubsystem::Tick(float DeltaTime)
+{
+	Advance(DeltaTime);
+}
+
+TStatId UDelveDeepResourceRegenSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepResourceRegenSubsystem, STATGROUP_Tickables);
+}
+
+int32 UDelveDeepResourceRegenSubsystem::Register(UDelveDeepStatsComponent* Component, float InCurrent, float InMax, float InRate)
+{
+	check(Component);
+
+	const int32 Slot = Current.Add(FMath::Min(InCurrent, InMax));
+	Max.Add(InMax);
+	Rate.Add(InRate);
+	Displayed.Add(FMath::FloorToInt32(Current[Slot]));
+	Components.Add(Component);
+
+	return Slot;
+}
+
+void UDelveDeepResourceRegenSubsystem::Unregister(int32 Slot)
+{
+	if (!Current.IsValidIndex(Slot))
+	{
+		return;
+	}
+
+	Current.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Max.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Rate.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Displayed.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Components.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	// The former last slot now lives here
+	if (Components.IsValidIndex(Slot))
+	{
+		if (UDelveDeepStatsComponent* Moved = Components[Slot].Get())
+		{
+			Moved->ResourceRegenSlot = Slot;
+		}
+	}
+}
+
+void UDelveDeepResourceRegenSubsystem::SetCurrent(int32 Slot, float Value)
+{
+	if (Current.IsValidIndex(Slot))
+	{
+		Current[Slot] = Value;
+		Displayed[Slot] = FMath::FloorToInt32(Value);
+	}
+}
+
+void UDelveDeepResourceRegenSubsystem::SetMax(int32 Slot, float Value)
+{
+	if (Max.IsValidIndex(Slot))
+	{
+		Max[Slot] = Value;
+	}
+}
+
+void UDelveDeepResourceRegenSubsystem::SetRate(int32 Slot, float Value)
+{
+	if (Rate.IsValidIndex(Slot))
+	{
+		Rate[Slot] = Value;
+	}
+}
+
+void UDelveDeepResourceRegenSubsystem::Advance(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_ResourceRegen);
+
+	const int32 Count = Current.Num();
+	LastNotificationCount = 0;
+	if (Count == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Regenerate and clamp in one pass over contiguous arrays (no branches, vectorizable)
+	float* RESTRICT CurrentData = Current.GetData();
+	const float* RESTRICT MaxData = Max.GetData();
+	const float* RESTRICT RateData = Rate.GetData();
+	for (int32 Slot = 0; Slot < Count; ++Slot)
+	{
+		CurrentData[Slot] = FMath::Min(CurrentData[Slot] + RateData[Slot] * DeltaTime, MaxData[Slot]);
+	}
+
+	// Only whole-number changes are worth a notification
+	PendingNotifications.Reset();
+	int32* RESTRICT DisplayedData = Displayed.GetData();
+	for (int32 Slot = 0; Slot < Count; ++Slot)
+	{
+		const int32 Shown = FMath::FloorToInt32(CurrentData[Slot]);
+		if (Shown != DisplayedData[Slot])
+		{
+			DisplayedData[Slot] = Shown;
+			PendingNotifications.Emplace(Components[Slot], CurrentData[Slot]);
+		}
+	}
+
+	// Notifications can run Blueprint code that unregisters (swap-removing slots),
+	// so notify from the snapshot rather than by slot index
+	for (const TPair<TWeakObjectPtr<UDelveDeepStatsComponent>, float>& Notification : PendingNotifications)
+	{
+		if (UDelveDeepStatsComponent* Component = Notification.Key.Get())
+		{
+			Component->ApplyRegeneratedResource(Notification.Value);
+			++LastNotificationCount;
+		}
+	}
+}
+
+bool UDelveDeepResourceRegenSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepSpriteBatchComponent.h"
+#include "PaperSprite.h"
+
+void UDelveDeepSpriteBatchComponent::SetInstance(int32 InstanceIndex, const FTransform& Transform, UPaperSprite* Sprite, const FLinearColor& Color)
+{
+	if (!PerInstanceSpriteData.IsValidIndex(InstanceIndex))
+	{
+		return;
+	}
+
+	FSpriteInstanceData& Instance = PerInstanceSpriteData[InstanceIndex];
+	Instance.Transform = Transform.ToMatrixWithScale();
+	Instance.VertexColor = Color.ToFColor(false);
+
+	// Frames of one atlas usually share a material; only look it up when the sprite changes
+	if (Instance.SourceSprite != Sprite)
+	{
+		Instance.SourceSprite = Sprite;
+		Instance.MaterialIndex = Sprite ? InstanceMaterials.AddUnique(Sprite->GetDefaultMaterial()) : INDEX_NONE;
+	}
+}
+
+void UDelveDeepSpriteBatchComponent::TrimInstances(int32 Count)
+{
+	if (PerInstanceSpriteData.Num() > Count)
+	{
+		PerInstanceSpriteData.SetNum(FMath::Max(Count, 0), EAllowShrinking::No);
+	}
+}
+
+void UDelveDeepSpriteBatchComponent::FinishBatch()
+{
+	UpdateBounds();
+	MarkRenderStateDirty();
+}
@@ -0,0 +1,439 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepSpriteBatchSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepSpriteBatchComponent.h"
+#include "DelveDeepStats.h"
+#include "ConvexVolume.h"
+#include "SceneView.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "PaperFlipbook.h"
+#include "PaperFlipbookComponent.h"
+#include "PaperSprite.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepSpriteBatch, Log, All);
+
+void UDelveDeepSpriteBatchSubsystem::Deinitialize()
+{
+	// Give characters their flipbook components back
+	for (int32 Slot = 0; Slot < Characters.Num(); ++Slot)
+	{
+		UnregisterCharacter(Slot);
+	}
+
+	Characters.Empty();
+	AnimationIndices.Empty();
+	PlayTimes.Empty();
+	CurrentFrames.Empty();
+	Colors.Empty();
+	SpriteOffsets.Empty();
+	Looping.Empty();
+	FacingLeft.Empty();
+	LastVisibleTimes.Empty();
+	Active.Empty();
+	FreeSlots.Empty();
+	Animations.Empty();
+	AnimationFlipbooks.Empty();
+	Atlases.Empty();
+	VisualsActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepSpriteBatchSubsystem::Tick(float DeltaTime)
+{
+	UpdateInstances(DeltaTime);
+}
+
+TStatId UDelveDeepSpriteBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepSpriteBatchSubsystem, STATGROUP_Tickables);
+}
+
+int32 UDelveDeepSpriteBatchSubsystem::RegisterCharacter(ADelveDeepCharacter* Character)
+{
+	UPaperFlipbookComponent* SpriteComponent = Character ? Character->GetSprite() : nullptr;
+	if (!SpriteComponent)
+	{
+		UE_LOG(LogDelveDeepSpriteBatch, Warning, TEXT("RegisterCharacter: Character has no sprite component"));
+		return INDEX_NONE;
+	}
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Characters.AddDefaulted();
+		AnimationIndices.AddDefaulted();
+		PlayTimes.AddDefaulted();
+		CurrentFrames.AddDefaulted();
+		Colors.AddDefaulted();
+		SpriteOffsets.AddDefaulted();
+		Looping.Add(true);
+		FacingLeft.Add(false);
+		LastVisibleTimes.AddDefaulted();
+		Active.Add(false);
+	}
+
+	// Facing replaces the component's rotation; its offset and scale are kept
+	const FTransform& Relative = SpriteComponent->GetRelativeTransform();
+
+	Characters[Slot] = Character;
+	AnimationIndices[Slot] = INDEX_NONE;
+	PlayTimes[Slot] = 0.0f;
+	CurrentFrames[Slot] = INDEX_NONE;
+	Colors[Slot] = SpriteComponent->GetSpriteColor();
+	SpriteOffsets[Slot] = FTransform(FQuat::Identity, Relative.GetLocation(), Relative.GetScale3D());
+	Looping[Slot] = SpriteComponent->IsLooping();
+	FacingLeft[Slot] = FMath::Abs(Relative.Rotator().Yaw) > 90.0f;
+	LastVisibleTimes[Slot] = -1000.0;
+	Active[Slot] = true;
+
+	SpriteComponent->SetVisibility(false);
+	SpriteComponent->SetComponentTickEnabled(false);
+
+	if (UPaperFlipbook* Flipbook = SpriteComponent->GetFlipbook())
+	{
+		AnimationIndices[Slot] = FindOrAddAnimation(Flipbook);
+	}
+
+	return Slot;
+}
+
+void UDelveDeepSpriteBatchSubsystem::UnregisterCharacter(int32 Handle)
+{
+	if (!IsInstanceValid(Handle))
+	{
+		return;
+	}
+
+	if (ADelveDeepCharacter* Character = Characters[Handle].Get())
+	{
+		if (UPaperFlipbookComponent* SpriteComponent = Character->GetSprite())
+		{
+			if (AnimationIndices[Handle] != INDEX_NONE)
+			{
+				SpriteComponent->SetFlipbook(AnimationFlipbooks[AnimationIndices[Handle]]);
+				SpriteComponent->SetPlaybackPosition(PlayTimes[Handle], false);
+			}
+			SpriteComponent->SetLooping(Looping[Handle]);
+			SpriteComponent->SetSpriteColor(Colors[Handle]);
+			SpriteComponent->SetRelativeRotation(FacingLeft[Handle] ? FRotator(0.0f, 180.0f, 0.0f) : FRotator::ZeroRotator);
+			SpriteComponent->SetComponentTickEnabled(true);
+			SpriteComponent->SetVisibility(true);
+		}
+	}
+
+	Characters[Handle].Reset();
+	AnimationIndices[Handle] = INDEX_NONE;
+	Active[Handle] = false;
+	FreeSlots.Add(Handle);
+}
+
+void UDelveDeepSpriteBatchSubsystem::PlayFlipbook(int32 Handle, UPaperFlipbook* Flipbook, bool bLooping)
+{
+	if (!IsInstanceValid(Handle))
+	{
+		return;
+	}
+
+	AnimationIndices[Handle] = Flipbook ? FindOrAddAnimation(Flipbook) : INDEX_NONE;
+	PlayTimes[Handle] = 0.0f;
+	CurrentFrames[Handle] = Flipbook ? 0 : INDEX_NONE;
+	Looping[Handle] = bLooping;
+}
+
+void UDelveDeepSpriteBatchSubsystem::SetInstanceColor(int32 Handle, const FLinearColor& Color)
+{
+	if (IsInstanceValid(Handle))
+	{
+		Colors[Handle] = Color;
+	}
+}
+
+void UDelveDeepSpriteBatchSubsystem::UpdateInstances(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_SpriteBatching);
+	TRACE_DELVEDEEP_WORLD();
+
+	// Advance every animation and facing in one pass over the instance arrays
+	for (int32 Slot = 0; Slot < Characters.Num(); ++Slot)
+	{
+		if (!Active[Slot])
+		{
+			continue;
+		}
+
+		const ADelveDeepCharacter* Character = Characters[Slot].Get();
+		if (!Character)
+		{
+			UnregisterCharacter(Slot);
+			continue;
+		}
+
+		const int32 AnimationIndex = AnimationIndices[Slot];
+		if (AnimationIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FAnimation& Animation = Animations[AnimationIndex];
+		PlayTimes[Slot] += DeltaTime;
+		CurrentFrames[Slot] = GetFrameAtTime(PlayTimes[Slot], Animation.FramesPerSecond, Animation.Frames.Num(), Looping[Slot]);
+
+		// Positive X = facing right, negative X = facing left; keep facing when moving vertically
+		const float VelocityX = Character->GetVelocity().X;
+		if (FMath::Abs(VelocityX) > FacingSpeedThreshold)
+		{
+			FacingLeft[Slot] = VelocityX < 0.0f;
+		}
+	}
+
+	FConvexVolume ViewFrustum;
+	if (GetPlayerViewFrustum(ViewFrustum))
+	{
+		UpdateInstanceVisibility(ViewFrustum);
+	}
+
+	WriteBatches();
+}
+
+void UDelveDeepSpriteBatchSubsystem::UpdateInstanceVisibility(const FConvexVolume& ViewFrustum)
+{
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	for (int32 Slot = 0; Slot < Characters.Num(); ++Slot)
+	{
+		const ADelveDeepCharacter* Character = Active[Slot] ? Characters[Slot].Get() : nullptr;
+		if (!Character || Character->IsHidden())
+		{
+			continue;
+		}
+
+		// The current frame's sprite bounds, or the collision bounds before anything plays
+		FBoxSphereBounds Bounds(Character->GetActorLocation(), FVector(Character->GetSimpleCollisionRadius()), Character->GetSimpleCollisionRadius());
+		if (AnimationIndices[Slot] != INDEX_NONE && CurrentFrames[Slot] != INDEX_NONE)
+		{
+			if (const UPaperSprite* Sprite = Animations[AnimationIndices[Slot]].Frames[CurrentFrames[Slot]])
+			{
+				Bounds = Sprite->GetRenderBounds().TransformBy(SpriteOffsets[Slot] * Character->GetActorTransform());
+			}
+		}
+
+		if (ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius))
+		{
+			LastVisibleTimes[Slot] = Now;
+		}
+	}
+}
+
+bool UDelveDeepSpriteBatchSubsystem::WasInstanceRecentlyVisible(int32 Handle, float Tolerance) const
+{
+	if (!IsInstanceValid(Handle))
+	{
+		return false;
+	}
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	return Now - LastVisibleTimes[Handle] <= Tolerance;
+}
+
+int32 UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(float Time, float FramesPerSecond, int32 NumFrames, bool bLooping)
+{
+	if (NumFrames <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Frame = FramesPerSecond > 0.0f ? FMath::FloorToInt32(FMath::Max(Time, 0.0f) * FramesPerSecond) : 0;
+	return bLooping ? Frame % NumFrames : FMath::Min(Frame, NumFrames - 1);
+}
+
+int32 UDelveDeepSpriteBatchSubsystem::GetInstanceFrame(int32 Handle) const
+{
+	return IsInstanceValid(Handle) ? CurrentFrames[Handle] : INDEX_NONE;
+}
+
+bool UDelveDeepSpriteBatchSubsystem::IsInstanceFacingLeft(int32 Handle) const
+{
+	return IsInstanceValid(Handle) && FacingLeft[Handle];
+}
+
+int32 UDelveDeepSpriteBatchSubsystem::FindOrAddAnimation(UPaperFlipbook* Flipbook)
+{
+	const int32 Existing = AnimationFlipbooks.IndexOfByKey(Flipbook);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	FAnimation& Animation = Animations.AddDefaulted_GetRef();
+	Animation.FramesPerSecond = Flipbook->GetFramesPerSecond();
+
+	UTexture* AtlasTexture = nullptr;
+	for (int32 KeyFrameIndex = 0; KeyFrameIndex < Flipbook->GetNumKeyFrames(); ++KeyFrameIndex)
+	{
+		const FPaperFlipbookKeyFrame& KeyFrame = Flipbook->GetKeyFrameChecked(KeyFrameIndex);
+		for (int32 Run = 0; Run < KeyFrame.FrameRun; ++Run)
+		{
+			Animation.Frames.Add(KeyFrame.Sprite);
+		}
+
+		if (!AtlasTexture && KeyFrame.Sprite)
+		{
+			AtlasTexture = KeyFrame.Sprite->GetBakedTexture();
+		}
+	}
+
+	Animation.Atlas = AtlasTexture ? FindOrAddAtlas(AtlasTexture) : INDEX_NONE;
+	AnimationFlipbooks.Add(Flipbook);
+
+	return Animations.Num() - 1;
+}
+
+int32 UDelveDeepSpriteBatchSubsystem::FindOrAddAtlas(UTexture* Texture)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 AtlasIndex = 0; AtlasIndex < Atlases.Num(); ++AtlasIndex)
+	{
+		if (Atlases[AtlasIndex].Texture == Texture && Atlases[AtlasIndex].Component.IsValid())
+		{
+			return AtlasIndex;
+		}
+	}
+
+	if (!VisualsActor)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = MakeUniqueObjectName(World, AActor::StaticClass(), TEXT("DelveDeepSpriteBatches"));
+		SpawnParams.ObjectFlags = RF_Transient;
+		VisualsActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!VisualsActor)
+		{
+			return INDEX_NONE;
+		}
+	}
+
+	UDelveDeepSpriteBatchComponent* Component = NewObject<UDelveDeepSpriteBatchComponent>(VisualsActor);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetMobility(EComponentMobility::Movable);
+	if (!VisualsActor->GetRootComponent())
+	{
+		VisualsActor->SetRootComponent(Component);
+	}
+	else
+	{
+		Component->SetupAttachment(VisualsActor->GetRootComponent());
+	}
+	Component->RegisterComponent();
+
+	FAtlas& Atlas = Atlases.AddDefaulted_GetRef();
+	Atlas.Texture = Texture;
+	Atlas.Component = Component;
+
+	UE_LOG(LogDelveDeepSpriteBatch, Verbose, TEXT("Added sprite batch for atlas %s"), *Texture->GetName());
+	return Atlases.Num() - 1;
+}
+
+void UDelveDeepSpriteBatchSubsystem::WriteBatches()
+{
+	if (Atlases.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<8>> Written;
+	Written.SetNumZeroed(Atlases.Num());
+
+	// Instances are anonymous: rewrite them in handle order every frame
+	static const FQuat FacingLeftRotation(FRotator(0.0f, 180.0f, 0.0f));
+	for (int32 Slot = 0; Slot < Characters.Num(); ++Slot)
+	{
+		if (!Active[Slot] || AnimationIndices[Slot] == INDEX_NONE || CurrentFrames[Slot] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const ADelveDeepCharacter* Character = Characters[Slot].Get();
+		const FAnimation& Animation = Animations[AnimationIndices[Slot]];
+		UPaperSprite* Sprite = Animation.Frames[CurrentFrames[Slot]];
+		if (!Character || Character->IsHidden() || !Sprite || Animation.Atlas == INDEX_NONE)
+		{
+			continue;
+		}
+
+		UDelveDeepSpriteBatchComponent* Component = Atlases[Animation.Atlas].Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		FTransform Transform = SpriteOffsets[Slot];
+		if (FacingLeft[Slot])
+		{
+			Transform.SetRotation(FacingLeftRotation);
+		}
+		Transform *= Character->GetActorTransform();
+
+		const int32 InstanceIndex = Written[Animation.Atlas]++;
+		if (InstanceIndex < Component->GetInstanceCount())
+		{
+			Component->SetInstance(InstanceIndex, Transform, Sprite, Colors[Slot]);
+		}
+		else
+		{
+			Component->AddInstance(Transform, Sprite, true, Colors[Slot]);
+		}
+	}
+
+	// Drop instances of characters that left or are hidden, then push each batch once
+	for (int32 AtlasIndex = 0; AtlasIndex < Atlases.Num(); ++AtlasIndex)
+	{
+		UDelveDeepSpriteBatchComponent* Component = Atlases[AtlasIndex].Component.Get();
+		if (!Component || (Written[AtlasIndex] == 0 && Component->GetInstanceCount() == 0))
+		{
+			continue;
+		}
+
+		Component->TrimInstances(Written[AtlasIndex]);
+		Component->FinishBatch();
+	}
+}
+
+bool UDelveDeepSpriteBatchSubsystem::GetPlayerViewFrustum(FConvexVolume& OutFrustum) const
+{
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || !LocalPlayer->ViewportClient->Viewport)
+	{
+		return false;
+	}
+
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return false;
+	}
+
+	GetViewFrustumBounds(OutFrustum, ProjectionData.ComputeViewProjectionMatrix(), false);
+	return true;
+}
+
+bool UDelveDeepSpriteBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -1,22 +1,78 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Character/DelveDeepStatsComponent.h"
+#include "DelveDeepStats.h"
+#include "Character/DelveDeepModifierExpirySubsystem.h"
+#include "Character/DelveDeepResourceRegenSubsystem.h"
 #include "Configuration/DelveDeepCharacterData.h"
 #include "Validation/ValidationContext.h"
 #include "DelveDeepEventSubsystem.h"
 #include "DelveDeepEventPayload.h"
 #include "GameplayTagsManager.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Character/DelveDeepCharacter.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepStats, Log, All);
 
-// Performance profiling stats
-DECLARE_STATS_GROUP(TEXT("DelveDeep"), STATGROUP_DelveDeep, STATCAT_Advanced);
+// Performance profiling stats (STATGROUP_DelveDeep comes from DelveDeepStats.h)
 DECLARE_CYCLE_STAT(TEXT("Stats RecalculateStats"), STAT_StatsRecalculate, STATGROUP_DelveDeep);
 
+namespace DelveDeepStatsComponent
+{
+	/** Stat index lives in the low byte of a modifier handle */
+	constexpr int32 HandleStatBits = 8;
+	constexpr int32 HandleStatMask = (1 << HandleStatBits) - 1;
+
+	/** Names for the non-modifiable stats reported through OnStatChanged */
+	static const FName& HealthName()
+	{
+		static const FName Name(TEXT("Health"));
+		return Name;
+	}
+
+	static const FName& ResourceName()
+	{
+		static const FName Name(TEXT("Resource"));
+		return Name;
+	}
+}
+
+void UDelveDeepStatsComponent::FStatModifierStack::RemoveAtSwap(int32 Index)
+{
+	check(Index >= 0 && Index < Num);
+
+	const FDelveDeepStatModifier& Removed = Modifiers[Index];
+	if (Removed.Op == EDelveDeepModifierOp::Multiplicative)
+	{
+		MultiplicativeSum -= Removed.Modifier;
+	}
+	else
+	{
+		AdditiveSum -= Removed.Modifier;
+	}
+
+	--Num;
+	if (Index != Num)
+	{
+		Modifiers[Index] = Modifiers[Num];
+	}
+
+	// Drop accumulated float drift once the stack is empty
+	if (Num == 0)
+	{
+		AdditiveSum = 0.0f;
+		MultiplicativeSum = 0.0f;
+	}
+}
+
+void UDelveDeepStatsComponent::FStatModifierStack::Reset()
+{
+	Num = 0;
+	AdditiveSum = 0.0f;
+	MultiplicativeSum = 0.0f;
+}
+
 UDelveDeepStatsComponent::UDelveDeepStatsComponent()
 {
 	// Disable tick by default for performance
@@ -35,7 +91,15 @@ UDelveDeepStatsComponent::UDelveDeepStatsComponent()
 	MaxResource = BaseResource;
 
 	// Stats are clean on initialization
-	bStatsDirty = false;
+	DirtyStatMask = 0;
+	NextModifierSerial = 0;
+	ResourceRegenRate = 0.0f;
+	ResourceRegenSlot = INDEX_NONE;
+	bResourceRegenPaused = false;
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		StatStacks[StatIndex].CachedValue = GetBaseStatValue(static_cast<EDelveDeepStat>(StatIndex));
+	}
 }
 
 void UDelveDeepStatsComponent::InitializeFromCharacterData(const UDelveDeepCharacterData* Data)
@@ -58,32 +122,54 @@ void UDelveDeepStatsComponent::InitializeFromCharacterData(const UDelveDeepChara
 	MaxResource = BaseResource;
 	CurrentResource = MaxResource;
 
-	// Clear any existing modifiers
-	ActiveModifiers.Empty();
-	bStatsDirty = false;
-
-	// Initialize cached stats
-	CachedMaxHealth = MaxHealth;
-	CachedMaxResource = MaxResource;
-	CachedMoveSpeed = BaseMoveSpeed;
-
-	// Set up timer for cleaning up expired modifiers
-	if (UWorld* World = GetWorld())
+	// Clear any existing modifiers and cache the base values
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
 	{
-		World->GetTimerManager().SetTimer(
-			CleanupTimerHandle,
-			this,
-			&UDelveDeepStatsComponent::CleanupExpiredModifiers,
-			1.0f, // Check every second
-			true  // Loop
-		);
+		FStatModifierStack& Stack = StatStacks[StatIndex];
+		Stack.Reset();
+		Stack.CachedValue = GetBaseStatValue(static_cast<EDelveDeepStat>(StatIndex));
 	}
+	DirtyStatMask = 0;
+
+	SyncResourceRegen();
 
 	UE_LOG(LogDelveDeepStats, Display, 
 		TEXT("Stats initialized: Health=%.2f, Resource=%.2f, Damage=%.2f, MoveSpeed=%.2f"),
 		BaseHealth, BaseResource, BaseDamage, BaseMoveSpeed);
 }
 
+void UDelveDeepStatsComponent::RebaseFromCharacterData(const UDelveDeepCharacterData* Data)
+{
+	if (!Data)
+	{
+		UE_LOG(LogDelveDeepStats, Error, TEXT("Cannot rebase stats component on null character data"));
+		return;
+	}
+
+	const float HealthFraction = MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 1.0f;
+	const float ResourceFraction = MaxResource > 0.0f ? GetCurrentResource() / MaxResource : 1.0f;
+
+	BaseHealth = Data->BaseHealth;
+	BaseResource = Data->MaxResource;
+	BaseDamage = Data->BaseDamage;
+	BaseMoveSpeed = Data->MoveSpeed;
+
+	// Re-evaluate every stat against the new base values with the modifiers already applied
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		MarkStatDirty(static_cast<EDelveDeepStat>(StatIndex));
+	}
+	RecalculateStats();
+
+	CurrentHealth = MaxHealth * FMath::Clamp(HealthFraction, 0.0f, 1.0f);
+	CurrentResource = MaxResource * FMath::Clamp(ResourceFraction, 0.0f, 1.0f);
+	SyncResourceRegen();
+
+	UE_LOG(LogDelveDeepStats, Display, 
+		TEXT("Stats rebased: Health=%.2f/%.2f, Resource=%.2f/%.2f, Damage=%.2f, MoveSpeed=%.2f"),
+		CurrentHealth, MaxHealth, CurrentResource, MaxResource, GetStatValue(EDelveDeepStat::Damage), GetStatValue(EDelveDeepStat::MoveSpeed));
+}
+
 bool UDelveDeepStatsComponent::ValidateComponent(FDelveDeepValidationContext& Context) const
 {
 	bool bIsValid = true;
@@ -125,16 +211,32 @@ bool UDelveDeepStatsComponent::ValidateComponent(FDelveDeepValidationContext& Co
 			CurrentHealth, MaxHealth));
 	}
 
-	if (CurrentResource < 0.0f || CurrentResource > MaxResource)
+	const float Resource = GetCurrentResource();
+	if (Resource < 0.0f || Resource > MaxResource)
 	{
 		Context.AddWarning(FString::Printf(
 			TEXT("CurrentResource out of range: %.2f (expected 0-%.2f)"), 
-			CurrentResource, MaxResource));
+			Resource, MaxResource));
 	}
 
 	return bIsValid;
 }
 
+void UDelveDeepStatsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Leave the regeneration arrays; the value stays on the component
+	SetResourceRegenRate(0.0f);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+float UDelveDeepStatsComponent::GetCurrentResource() const
+{
+	return IsResourceRegenerating()
+		? ResourceRegenSubsystem->GetCurrent(ResourceRegenSlot)
+		: CurrentResource;
+}
+
 void UDelveDeepStatsComponent::ModifyHealth(float Delta)
 {
 	// Store old value for event broadcasting
@@ -147,7 +249,7 @@ void UDelveDeepStatsComponent::ModifyHealth(float Delta)
 	if (!FMath::IsNearlyEqual(OldHealth, CurrentHealth))
 	{
 		// Broadcast stat changed event
-		OnStatChanged(FName("Health"), OldHealth, CurrentHealth);
+		OnStatChanged(DelveDeepStatsComponent::HealthName(), OldHealth, CurrentHealth);
 
 		// Broadcast health change event through event subsystem
 		if (UWorld* World = GetWorld())
@@ -177,11 +279,12 @@ void UDelveDeepStatsComponent::ModifyHealth(float Delta)
 
 void UDelveDeepStatsComponent::ModifyResource(float Delta)
 {
-	// Store old value for event broadcasting
-	float OldResource = CurrentResource;
+	// Store old value for event broadcasting (the regeneration subsystem may hold a newer one)
+	float OldResource = GetCurrentResource();
 
 	// Apply delta and clamp to valid range
-	CurrentResource = FMath::Clamp(CurrentResource + Delta, 0.0f, MaxResource);
+	CurrentResource = FMath::Clamp(OldResource + Delta, 0.0f, MaxResource);
+	SyncResourceRegen();
 
 	// Only broadcast events if resource actually changed
 	if (!FMath::IsNearlyEqual(OldResource, CurrentResource))
@@ -190,7 +293,7 @@ void UDelveDeepStatsComponent::ModifyResource(float Delta)
 		OnResourceChanged(OldResource, CurrentResource);
 
 		// Broadcast stat changed event
-		OnStatChanged(FName("Resource"), OldResource, CurrentResource);
+		OnStatChanged(DelveDeepStatsComponent::ResourceName(), OldResource, CurrentResource);
 
 		UE_LOG(LogDelveDeepStats, Verbose, 
 			TEXT("Resource modified: %.2f -> %.2f (Delta: %.2f)"), 
@@ -201,10 +304,11 @@ void UDelveDeepStatsComponent::ModifyResource(float Delta)
 void UDelveDeepStatsComponent::ResetToMaxValues()
 {
 	float OldHealth = CurrentHealth;
-	float OldResource = CurrentResource;
+	float OldResource = GetCurrentResource();
 
 	CurrentHealth = MaxHealth;
 	CurrentResource = MaxResource;
+	SyncResourceRegen();
 
 	UE_LOG(LogDelveDeepStats, Display, 
 		TEXT("Stats reset to max values: Health=%.2f, Resource=%.2f"), 
@@ -213,13 +317,13 @@ void UDelveDeepStatsComponent::ResetToMaxValues()
 	// Broadcast events if values changed
 	if (!FMath::IsNearlyEqual(OldHealth, CurrentHealth))
 	{
-		OnStatChanged(FName("Health"), OldHealth, CurrentHealth);
+		OnStatChanged(DelveDeepStatsComponent::HealthName(), OldHealth, CurrentHealth);
 	}
 
 	if (!FMath::IsNearlyEqual(OldResource, CurrentResource))
 	{
 		OnResourceChanged(OldResource, CurrentResource);
-		OnStatChanged(FName("Resource"), OldResource, CurrentResource);
+		OnStatChanged(DelveDeepStatsComponent::ResourceName(), OldResource, CurrentResource);
 	}
 }
 
@@ -231,219 +335,373 @@ void UDelveDeepStatsComponent::AddStatModifier(FName StatName, float Modifier, f
 		return;
 	}
 
-	// Create new modifier
-	FDelveDeepStatModifier NewModifier(Modifier, Duration);
-	
-	// Add or update modifier in map
-	ActiveModifiers.Add(StatName, NewModifier);
-	
-	// Mark stats as dirty for recalculation
-	bStatsDirty = true;
-	
-	// Recalculate stats immediately
-	RecalculateStats();
-	
-	UE_LOG(LogDelveDeepStats, Verbose, 
-		TEXT("Added stat modifier: %s = %.2f for %.2f seconds"), 
-		*StatName.ToString(), Modifier, Duration);
+	EDelveDeepStat Stat;
+	if (!FindStatByName(StatName, Stat))
+	{
+		UE_LOG(LogDelveDeepStats, Warning, TEXT("Attempted to add modifier to unknown stat: %s"), *StatName.ToString());
+		return;
+	}
+
+	AddStatModifierById(Stat, Modifier, Duration, EDelveDeepModifierOp::Additive);
 }
 
-void UDelveDeepStatsComponent::RemoveStatModifier(FName StatName)
+void UDelveDeepStatsComponent::SetResourceRegenRate(float RatePerSecond)
 {
-	if (ActiveModifiers.Remove(StatName) > 0)
+	ResourceRegenRate = FMath::Max(RatePerSecond, 0.0f);
+
+	if (ResourceRegenRate <= 0.0f || bResourceRegenPaused)
 	{
-		// Mark stats as dirty for recalculation
-		bStatsDirty = true;
-		
-		// Recalculate stats immediately
-		RecalculateStats();
-		
-		UE_LOG(LogDelveDeepStats, Verbose, 
-			TEXT("Removed stat modifier: %s"), *StatName.ToString());
+		ReleaseResourceRegen();
+		return;
 	}
+
+	if (IsResourceRegenerating())
+	{
+		ResourceRegenSubsystem->SetRate(ResourceRegenSlot, ResourceRegenRate);
+		return;
+	}
+
+	AcquireResourceRegen();
 }
 
-void UDelveDeepStatsComponent::ClearAllModifiers()
+void UDelveDeepStatsComponent::SetResourceRegenPaused(bool bPaused)
 {
-	if (ActiveModifiers.Num() > 0)
+	if (bResourceRegenPaused == bPaused)
 	{
-		ActiveModifiers.Empty();
-		
-		// Mark stats as dirty for recalculation
-		bStatsDirty = true;
-		
-		// Recalculate stats immediately
-		RecalculateStats();
-		
-		UE_LOG(LogDelveDeepStats, Display, TEXT("Cleared all stat modifiers"));
+		return;
+	}
+
+	bResourceRegenPaused = bPaused;
+
+	if (bPaused)
+	{
+		ReleaseResourceRegen();
+	}
+	else if (ResourceRegenRate > 0.0f)
+	{
+		AcquireResourceRegen();
 	}
 }
 
-float UDelveDeepStatsComponent::GetModifiedStat(FName StatName) const
+void UDelveDeepStatsComponent::AcquireResourceRegen()
 {
-	// Return cached values if stats are clean
-	if (!bStatsDirty)
+	UWorld* World = GetWorld();
+	UDelveDeepResourceRegenSubsystem* RegenSubsystem = World ? World->GetSubsystem<UDelveDeepResourceRegenSubsystem>() : nullptr;
+	if (!RegenSubsystem)
 	{
-		if (StatName == FName("MaxHealth"))
-		{
-			return CachedMaxHealth;
-		}
-		else if (StatName == FName("MaxResource"))
-		{
-			return CachedMaxResource;
-		}
-		else if (StatName == FName("MoveSpeed"))
+		UE_LOG(LogDelveDeepStats, Verbose, TEXT("No resource regeneration subsystem; %s will not regenerate"), *GetName());
+		return;
+	}
+
+	ResourceRegenSubsystem = RegenSubsystem;
+	ResourceRegenSlot = RegenSubsystem->Register(this, CurrentResource, MaxResource, ResourceRegenRate);
+}
+
+void UDelveDeepStatsComponent::ReleaseResourceRegen()
+{
+	if (ResourceRegenSlot != INDEX_NONE)
+	{
+		// Take the latest value back before leaving the subsystem
+		CurrentResource = GetCurrentResource();
+		if (UDelveDeepResourceRegenSubsystem* RegenSubsystem = ResourceRegenSubsystem.Get())
 		{
-			return CachedMoveSpeed;
+			RegenSubsystem->Unregister(ResourceRegenSlot);
 		}
-		else if (StatName == FName("Damage"))
+	}
+
+	ResourceRegenSlot = INDEX_NONE;
+	ResourceRegenSubsystem.Reset();
+}
+
+void UDelveDeepStatsComponent::SyncResourceRegen()
+{
+	if (IsResourceRegenerating())
+	{
+		ResourceRegenSubsystem->SetMax(ResourceRegenSlot, MaxResource);
+		ResourceRegenSubsystem->SetCurrent(ResourceRegenSlot, CurrentResource);
+	}
+}
+
+void UDelveDeepStatsComponent::ApplyRegeneratedResource(float NewResource)
+{
+	const float OldResource = CurrentResource;
+	CurrentResource = NewResource;
+
+	OnResourceChanged(OldResource, CurrentResource);
+	OnStatChanged(DelveDeepStatsComponent::ResourceName(), OldResource, CurrentResource);
+}
+
+int32 UDelveDeepStatsComponent::AddStatModifierById(EDelveDeepStat Stat, float Modifier, float Duration, EDelveDeepModifierOp Op)
+{
+	const int32 StatIndex = static_cast<int32>(Stat);
+	if (StatIndex < 0 || StatIndex >= NumStats)
+	{
+		UE_LOG(LogDelveDeepStats, Warning, TEXT("Attempted to add modifier to invalid stat id %d"), StatIndex);
+		return INDEX_NONE;
+	}
+
+	FStatModifierStack& Stack = StatStacks[StatIndex];
+	if (Stack.Num >= MaxModifiersPerStat)
+	{
+		UE_LOG(LogDelveDeepStats, Warning, 
+			TEXT("Stat %s already has %d modifiers; modifier %.2f dropped"), 
+			*GetStatName(Stat).ToString(), MaxModifiersPerStat, Modifier);
+		return INDEX_NONE;
+	}
+
+	// Serial in the high bits keeps handles unique and positive; the stat in the low byte finds the stack
+	NextModifierSerial = (NextModifierSerial + 1) & (MAX_int32 >> DelveDeepStatsComponent::HandleStatBits);
+	const int32 Handle = (NextModifierSerial << DelveDeepStatsComponent::HandleStatBits) | StatIndex;
+
+	FDelveDeepStatModifier& NewModifier = Stack.Modifiers[Stack.Num++];
+	NewModifier = FDelveDeepStatModifier(Modifier, Duration, Op);
+	NewModifier.Handle = Handle;
+
+	// Timed modifiers are expired by the world's timing wheel
+	if (Duration > 0.0f)
+	{
+		if (UWorld* World = GetWorld())
 		{
-			return ApplyModifiers(StatName, BaseDamage);
+			if (UDelveDeepModifierExpirySubsystem* ExpirySubsystem = World->GetSubsystem<UDelveDeepModifierExpirySubsystem>())
+			{
+				NewModifier.ExpireTime = World->GetTimeSeconds() + Duration;
+				ExpirySubsystem->ScheduleModifierExpiry(this, Handle, NewModifier.ExpireTime);
+			}
 		}
 	}
-	
-	// Recalculate if dirty (shouldn't happen in const function, but handle it)
-	if (StatName == FName("MaxHealth"))
+
+	if (Op == EDelveDeepModifierOp::Multiplicative)
 	{
-		return ApplyModifiers(StatName, BaseHealth);
+		Stack.MultiplicativeSum += Modifier;
 	}
-	else if (StatName == FName("MaxResource"))
+	else
 	{
-		return ApplyModifiers(StatName, BaseResource);
+		Stack.AdditiveSum += Modifier;
 	}
-	else if (StatName == FName("MoveSpeed"))
+
+	MarkStatDirty(Stat);
+	RecalculateStats();
+
+	UE_LOG(LogDelveDeepStats, Verbose, 
+		TEXT("Added stat modifier: %s %s %.2f for %.2f seconds (handle %d)"), 
+		*GetStatName(Stat).ToString(), Op == EDelveDeepModifierOp::Multiplicative ? TEXT("x") : TEXT("+"),
+		Modifier, Duration, Handle);
+
+	return Handle;
+}
+
+void UDelveDeepStatsComponent::RemoveStatModifier(FName StatName)
+{
+	EDelveDeepStat Stat;
+	if (!FindStatByName(StatName, Stat))
 	{
-		return ApplyModifiers(StatName, BaseMoveSpeed);
+		return;
 	}
-	else if (StatName == FName("Damage"))
+
+	FStatModifierStack& Stack = StatStacks[static_cast<int32>(Stat)];
+	if (Stack.Num > 0)
 	{
-		return ApplyModifiers(StatName, BaseDamage);
+		Stack.Reset();
+		MarkStatDirty(Stat);
+		RecalculateStats();
+
+		UE_LOG(LogDelveDeepStats, Verbose, 
+			TEXT("Removed stat modifiers: %s"), *StatName.ToString());
 	}
-	
-	return 0.0f;
 }
 
-void UDelveDeepStatsComponent::RecalculateStats()
+bool UDelveDeepStatsComponent::RemoveStatModifierByHandle(int32 Handle)
 {
-	SCOPE_CYCLE_COUNTER(STAT_StatsRecalculate);
-	if (!bStatsDirty)
+	if (Handle <= 0)
 	{
-		return;
+		return false;
+	}
+
+	const int32 StatIndex = Handle & DelveDeepStatsComponent::HandleStatMask;
+	if (StatIndex >= NumStats)
+	{
+		return false;
 	}
-	
-	// Store old values
-	float OldMaxHealth = MaxHealth;
-	float OldMaxResource = MaxResource;
-	
-	// Recalculate max stats with modifiers
-	CachedMaxHealth = ApplyModifiers(FName("MaxHealth"), BaseHealth);
-	CachedMaxResource = ApplyModifiers(FName("MaxResource"), BaseResource);
-	CachedMoveSpeed = ApplyModifiers(FName("MoveSpeed"), BaseMoveSpeed);
-	
-	// Update actual max values
-	MaxHealth = CachedMaxHealth;
-	MaxResource = CachedMaxResource;
-	
-	// Clamp current values to new maximums
-	if (CurrentHealth > MaxHealth)
-	{
-		CurrentHealth = MaxHealth;
-	}
-	if (CurrentResource > MaxResource)
-	{
-		CurrentResource = MaxResource;
-	}
-	
-	// Update character movement speed if we have a character owner
-	if (ADelveDeepCharacter* Character = Cast<ADelveDeepCharacter>(GetOwner()))
-	{
-		if (UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement())
+
+	FStatModifierStack& Stack = StatStacks[StatIndex];
+	for (int32 Index = 0; Index < Stack.Num; ++Index)
+	{
+		if (Stack.Modifiers[Index].Handle == Handle)
+		{
+			Stack.RemoveAtSwap(Index);
+			MarkStatDirty(static_cast<EDelveDeepStat>(StatIndex));
+			RecalculateStats();
+
+			UE_LOG(LogDelveDeepStats, Verbose, 
+				TEXT("Removed stat modifier %d from %s"), 
+				Handle, *GetStatName(static_cast<EDelveDeepStat>(StatIndex)).ToString());
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UDelveDeepStatsComponent::ClearAllModifiers()
+{
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
+	{
+		FStatModifierStack& Stack = StatStacks[StatIndex];
+		if (Stack.Num > 0)
 		{
-			MovementComp->MaxWalkSpeed = CachedMoveSpeed;
+			Stack.Reset();
+			MarkStatDirty(static_cast<EDelveDeepStat>(StatIndex));
 		}
 	}
-	
-	// Mark stats as clean
-	bStatsDirty = false;
-	
-	// Broadcast events if max values changed
-	if (!FMath::IsNearlyEqual(OldMaxHealth, MaxHealth))
+
+	if (DirtyStatMask != 0)
 	{
-		OnStatChanged(FName("MaxHealth"), OldMaxHealth, MaxHealth);
+		RecalculateStats();
+		
+		UE_LOG(LogDelveDeepStats, Display, TEXT("Cleared all stat modifiers"));
 	}
-	
-	if (!FMath::IsNearlyEqual(OldMaxResource, MaxResource))
+}
+
+float UDelveDeepStatsComponent::GetModifiedStat(FName StatName) const
+{
+	EDelveDeepStat Stat;
+	return FindStatByName(StatName, Stat) ? GetStatValue(Stat) : 0.0f;
+}
+
+float UDelveDeepStatsComponent::GetStatValue(EDelveDeepStat Stat) const
+{
+	const int32 StatIndex = static_cast<int32>(Stat);
+	if (StatIndex < 0 || StatIndex >= NumStats)
 	{
-		OnStatChanged(FName("MaxResource"), OldMaxResource, MaxResource);
+		return 0.0f;
 	}
-	
-	UE_LOG(LogDelveDeepStats, Verbose, 
-		TEXT("Stats recalculated: MaxHealth=%.2f, MaxResource=%.2f, MoveSpeed=%.2f"), 
-		MaxHealth, MaxResource, CachedMoveSpeed);
+
+	const FStatModifierStack& Stack = StatStacks[StatIndex];
+
+	// Pending changes are evaluated on the fly; the cache is refreshed by RecalculateStats
+	return (DirtyStatMask & (1u << StatIndex)) != 0
+		? Stack.Evaluate(GetBaseStatValue(Stat))
+		: Stack.CachedValue;
 }
 
-float UDelveDeepStatsComponent::ApplyModifiers(FName StatName, float BaseValue) const
+int32 UDelveDeepStatsComponent::GetModifierCount(EDelveDeepStat Stat) const
 {
-	float ModifiedValue = BaseValue;
-	
-	// Apply all modifiers for this stat
-	for (const auto& ModifierPair : ActiveModifiers)
+	const int32 StatIndex = static_cast<int32>(Stat);
+	return StatIndex >= 0 && StatIndex < NumStats ? StatStacks[StatIndex].Num : 0;
+}
+
+bool UDelveDeepStatsComponent::FindStatByName(FName StatName, EDelveDeepStat& OutStat)
+{
+	// FName comparison is an index compare; the names themselves are interned once
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
 	{
-		if (ModifierPair.Key == StatName)
+		if (GetStatName(static_cast<EDelveDeepStat>(StatIndex)) == StatName)
 		{
-			// Additive modifier
-			ModifiedValue += ModifierPair.Value.Modifier;
+			OutStat = static_cast<EDelveDeepStat>(StatIndex);
+			return true;
 		}
 	}
-	
-	// Ensure modified value is not negative
-	return FMath::Max(ModifiedValue, 0.0f);
+
+	return false;
 }
 
-void UDelveDeepStatsComponent::CleanupExpiredModifiers()
+FName UDelveDeepStatsComponent::GetStatName(EDelveDeepStat Stat)
 {
-	if (ActiveModifiers.Num() == 0)
+	static const FName StatNames[] =
+	{
+		FName(TEXT("MaxHealth")),
+		FName(TEXT("MaxResource")),
+		FName(TEXT("Damage")),
+		FName(TEXT("MoveSpeed"))
+	};
+	static_assert(UE_ARRAY_COUNT(StatNames) == static_cast<int32>(EDelveDeepStat::Count), "StatNames must match EDelveDeepStat");
+
+	const int32 StatIndex = static_cast<int32>(Stat);
+	return StatIndex >= 0 && StatIndex < NumStats ? StatNames[StatIndex] : NAME_None;
+}
+
+void UDelveDeepStatsComponent::RecalculateStats()
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatsRecalculate);
+	if (DirtyStatMask == 0)
 	{
 		return;
 	}
-	
-	bool bAnyExpired = false;
-	TArray<FName> ExpiredModifiers;
-	
-	// Find expired modifiers
-	for (auto& ModifierPair : ActiveModifiers)
+
+	TRACE_DELVEDEEP_COMBAT();
+
+	// Only stats whose modifiers changed are re-evaluated
+	const uint32 PendingMask = DirtyStatMask;
+	DirtyStatMask = 0;
+
+	for (int32 StatIndex = 0; StatIndex < NumStats; ++StatIndex)
 	{
-		FDelveDeepStatModifier& Modifier = ModifierPair.Value;
-		
-		// Skip permanent modifiers (Duration == 0)
-		if (Modifier.Duration <= 0.0f)
-		{
-			continue;
-		}
-		
-		// Decrease remaining time
-		Modifier.RemainingTime -= 1.0f; // Timer runs every second
-		
-		// Check if expired
-		if (Modifier.RemainingTime <= 0.0f)
+		if ((PendingMask & (1u << StatIndex)) != 0)
 		{
-			ExpiredModifiers.Add(ModifierPair.Key);
-			bAnyExpired = true;
+			RecalculateStat(static_cast<EDelveDeepStat>(StatIndex));
 		}
 	}
-	
-	// Remove expired modifiers
-	if (bAnyExpired)
+}
+
+float UDelveDeepStatsComponent::GetBaseStatValue(EDelveDeepStat Stat) const
+{
+	switch (Stat)
+	{
+	case EDelveDeepStat::MaxHealth:
+		return BaseHealth;
+	case EDelveDeepStat::MaxResource:
+		return BaseResource;
+	case EDelveDeepStat::Damage:
+		return BaseDamage;
+	case EDelveDeepStat::MoveSpeed:
+		return BaseMoveSpeed;
+	default:
+		return 0.0f;
+	}
+}
+
+void UDelveDeepStatsComponent::RecalculateStat(EDelveDeepStat Stat)
+{
+	FStatModifierStack& Stack = StatStacks[static_cast<int32>(Stat)];
+	const float OldValue = Stack.CachedValue;
+	const float NewValue = Stack.Evaluate(GetBaseStatValue(Stat));
+	Stack.CachedValue = NewValue;
+
+	switch (Stat)
 	{
-		for (const FName& StatName : ExpiredModifiers)
+	case EDelveDeepStat::MaxHealth:
+		// Clamp current health to the new maximum
+		MaxHealth = NewValue;
+		CurrentHealth = FMath::Min(CurrentHealth, MaxHealth);
+		break;
+
+	case EDelveDeepStat::MaxResource:
+		MaxResource = NewValue;
+		CurrentResource = FMath::Min(GetCurrentResource(), MaxResource);
+		SyncResourceRegen();
+		break;
+
+	case EDelveDeepStat::MoveSpeed:
+		// Update character movement speed if we have a character owner
+		if (ADelveDeepCharacter* Character = Cast<ADelveDeepCharacter>(GetOwner()))
 		{
-			ActiveModifiers.Remove(StatName);
-			UE_LOG(LogDelveDeepStats, Verbose, 
-				TEXT("Stat modifier expired: %s"), *StatName.ToString());
+			if (UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement())
+			{
+				MovementComp->MaxWalkSpeed = NewValue;
+			}
 		}
-		
-		// Mark stats as dirty and recalculate
-		bStatsDirty = true;
-		const_cast<UDelveDeepStatsComponent*>(this)->RecalculateStats();
+		break;
+
+	default:
+		break;
+	}
+
+	if (!FMath::IsNearlyEqual(OldValue, NewValue))
+	{
+		OnStatChanged(GetStatName(Stat), OldValue, NewValue);
 	}
+
+	UE_LOG(LogDelveDeepStats, Verbose, 
+		TEXT("Stat recalculated: %s %.2f -> %.2f (%d modifiers)"), 
+		*GetStatName(Stat).ToString(), OldValue, NewValue, Stack.Num);
 }
@@ -0,0 +1,417 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "Character/DelveDeepCharacter.h"
+#include "DelveDeepCharacterData.h"
+#include "DelveDeepStats.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepTargeting, Log, All);
+
+void UDelveDeepTargetingSubsystem::Deinitialize()
+{
+	PositionX.Empty();
+	PositionY.Empty();
+	PositionZ.Empty();
+	Teams.Empty();
+	TeamBits.Empty();
+	Threats.Empty();
+	Actors.Empty();
+	CellCoords.Empty();
+	IndexInCell.Empty();
+	Active.Empty();
+	FreeSlots.Empty();
+	Cells.Empty();
+	ActorBackedCount = 0;
+
+	Super::Deinitialize();
+}
+
+void UDelveDeepTargetingSubsystem::Tick(float DeltaTime)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	SyncActorLocations();
+
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime + QuerySecondsThisFrame) * 1000.0;
+	QuerySecondsThisFrame = 0.0;
+
+	if (const UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UDelveDeepTelemetrySubsystem* Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>())
+		{
+			Telemetry->RecordSystemTime(TEXT("TargetingSystem"), FrameMs);
+		}
+	}
+}
+
+TStatId UDelveDeepTargetingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDelveDeepTargetingSubsystem, STATGROUP_Tickables);
+}
+
+int32 UDelveDeepTargetingSubsystem::RegisterCombatant(AActor* Actor, const FVector& Location, uint8 Team)
+{
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = PositionX.AddDefaulted();
+		PositionY.AddDefaulted();
+		PositionZ.AddDefaulted();
+		Teams.AddDefaulted();
+		TeamBits.AddDefaulted();
+		Threats.AddDefaulted();
+		Actors.AddDefaulted();
+		CellCoords.AddDefaulted();
+		IndexInCell.AddDefaulted();
+		Active.Add(false);
+	}
+
+	PositionX[Slot] = Location.X;
+	PositionY[Slot] = Location.Y;
+	PositionZ[Slot] = Location.Z;
+	Teams[Slot] = Team;
+	TeamBits[Slot] = DelveDeepTeam::Bit(Team);
+	Threats[Slot] = 0.0f;
+	Actors[Slot] = Actor;
+	Active[Slot] = true;
+
+	if (Actor)
+	{
+		++ActorBackedCount;
+	}
+
+	AddToCell(Slot, GetCell(Location.X, Location.Y));
+	return Slot;
+}
+
+void UDelveDeepTargetingSubsystem::UnregisterCombatant(int32 Handle)
+{
+	if (!IsCombatantValid(Handle))
+	{
+		return;
+	}
+
+	RemoveFromCell(Handle);
+
+	if (!Actors[Handle].IsExplicitlyNull())
+	{
+		--ActorBackedCount;
+	}
+
+	Actors[Handle].Reset();
+	TeamBits[Handle] = 0;
+	Active[Handle] = false;
+	FreeSlots.Add(Handle);
+}
+
+void UDelveDeepTargetingSubsystem::UpdateCombatantLocation(int32 Handle, const FVector& Location)
+{
+	if (!IsCombatantValid(Handle))
+	{
+		return;
+	}
+
+	PositionX[Handle] = Location.X;
+	PositionY[Handle] = Location.Y;
+	PositionZ[Handle] = Location.Z;
+
+	const FIntPoint Cell = GetCell(Location.X, Location.Y);
+	if (Cell != CellCoords[Handle])
+	{
+		RemoveFromCell(Handle);
+		AddToCell(Handle, Cell);
+	}
+}
+
+void UDelveDeepTargetingSubsystem::SetCombatantTeam(int32 Handle, uint8 Team)
+{
+	if (IsCombatantValid(Handle))
+	{
+		Teams[Handle] = Team;
+		TeamBits[Handle] = DelveDeepTeam::Bit(Team);
+	}
+}
+
+void UDelveDeepTargetingSubsystem::AddThreat(int32 Handle, float Amount)
+{
+	if (IsCombatantValid(Handle))
+	{
+		Threats[Handle] += Amount;
+	}
+}
+
+void UDelveDeepTargetingSubsystem::SetThreat(int32 Handle, float Threat)
+{
+	if (IsCombatantValid(Handle))
+	{
+		Threats[Handle] = Threat;
+	}
+}
+
+template <typename FuncType>
+void UDelveDeepTargetingSubsystem::ForEachInRadius(const FVector& Origin, float Radius, uint32 TeamMask, FuncType&& Func) const
+{
+	if (Radius < 0.0f || Cells.Num() == 0)
+	{
+		return;
+	}
+
+	const float RadiusSq = Radius * Radius;
+	const FIntPoint MinCell = GetCell(Origin.X - Radius, Origin.Y - Radius);
+	const FIntPoint MaxCell = GetCell(Origin.X + Radius, Origin.Y + Radius);
+
+	const float* RESTRICT X = PositionX.GetData();
+	const float* RESTRICT Y = PositionY.GetData();
+	const uint8* RESTRICT TeamIds = Teams.GetData();
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(CellX, CellY));
+			if (!Bucket)
+			{
+				continue;
+			}
+
+			for (const int32 Slot : *Bucket)
+			{
+				if ((DelveDeepTeam::Bit(TeamIds[Slot]) & TeamMask) == 0)
+				{
+					continue;
+				}
+
+				const float DX = X[Slot] - Origin.X;
+				const float DY = Y[Slot] - Origin.Y;
+				const float DistanceSq = DX * DX + DY * DY;
+				if (DistanceSq <= RadiusSq)
+				{
+					Func(Slot, DistanceSq);
+				}
+			}
+		}
+	}
+}
+
+void UDelveDeepTargetingSubsystem::QueryRadius(const FVector& Origin, float Radius, uint32 TeamMask, TArray<int32>& OutHandles) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_TargetingSystem);
+	const double StartTime = FPlatformTime::Seconds();
+
+	ForEachInRadius(Origin, Radius, TeamMask, [&OutHandles](int32 Slot, float)
+	{
+		OutHandles.Add(Slot);
+	});
+
+	QuerySecondsThisFrame += FPlatformTime::Seconds() - StartTime;
+}
+
+void UDelveDeepTargetingSubsystem::QueryKNearest(const FVector& Origin, int32 K, float MaxRadius, uint32 TeamMask, TArray<int32>& OutHandles) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_TargetingSystem);
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (K > 0)
+	{
+		// Bounded max-heap on distance: the top is the farthest of the K kept so far
+		const auto FarthestFirst = [](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; };
+
+		NearestScratch.Reset();
+		ForEachInRadius(Origin, MaxRadius, TeamMask, [this, K, &FarthestFirst](int32 Slot, float DistanceSq)
+		{
+			if (NearestScratch.Num() < K)
+			{
+				NearestScratch.HeapPush(TPair<float, int32>(DistanceSq, Slot), FarthestFirst);
+			}
+			else if (DistanceSq < NearestScratch.HeapTop().Key)
+			{
+				NearestScratch.HeapPopDiscard(FarthestFirst, EAllowShrinking::No);
+				NearestScratch.HeapPush(TPair<float, int32>(DistanceSq, Slot), FarthestFirst);
+			}
+		});
+
+		NearestScratch.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+		for (const TPair<float, int32>& Entry : NearestScratch)
+		{
+			OutHandles.Add(Entry.Value);
+		}
+	}
+
+	QuerySecondsThisFrame += FPlatformTime::Seconds() - StartTime;
+}
+
+int32 UDelveDeepTargetingSubsystem::FindBestTarget(const FVector& Origin, float Radius, uint32 TeamMask, TFunctionRef<float(const FDelveDeepTargetCandidate&)> Score) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_TargetingSystem);
+	TRACE_DELVEDEEP_TARGETING();
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 BestHandle = INDEX_NONE;
+	float BestScore = -MAX_flt;
+
+	ForEachInRadius(Origin, Radius, TeamMask, [&](int32 Slot, float DistanceSq)
+	{
+		FDelveDeepTargetCandidate Candidate;
+		Candidate.Handle = Slot;
+		Candidate.Actor = Actors[Slot].Get();
+		Candidate.Location = FVector(PositionX[Slot], PositionY[Slot], PositionZ[Slot]);
+		Candidate.DistanceSq = DistanceSq;
+		Candidate.Team = Teams[Slot];
+		Candidate.Threat = Threats[Slot];
+
+		const float CandidateScore = Score(Candidate);
+		if (CandidateScore > BestScore)
+		{
+			BestScore = CandidateScore;
+			BestHandle = Slot;
+		}
+	});
+
+	QuerySecondsThisFrame += FPlatformTime::Seconds() - StartTime;
+	return BestHandle;
+}
+
+int32 UDelveDeepTargetingSubsystem::FindBestTarget(const FVector& Origin, float Radius, uint32 TeamMask, EDelveDeepTargetPriority Priority) const
+{
+	switch (Priority)
+	{
+	case EDelveDeepTargetPriority::LowestHealth:
+		return FindBestTarget(Origin, Radius, TeamMask, [](const FDelveDeepTargetCandidate& Candidate)
+		{
+			// Non-character combatants rank behind any damaged character; ties go to the nearest
+			const ADelveDeepCharacter* Character = Cast<ADelveDeepCharacter>(Candidate.Actor);
+			const float Health = Character ? Character->GetCurrentHealth() : MAX_flt * 0.5f;
+			return -Health - Candidate.DistanceSq * KINDA_SMALL_NUMBER;
+		});
+
+	case EDelveDeepTargetPriority::HighestThreat:
+		return FindBestTarget(Origin, Radius, TeamMask, [](const FDelveDeepTargetCandidate& Candidate)
+		{
+			return Candidate.Threat - Candidate.DistanceSq * KINDA_SMALL_NUMBER;
+		});
+
+	case EDelveDeepTargetPriority::Nearest:
+	default:
+		return FindBestTarget(Origin, Radius, TeamMask, [](const FDelveDeepTargetCandidate& Candidate)
+		{
+			return -Candidate.DistanceSq;
+		});
+	}
+}
+
+AActor* UDelveDeepTargetingSubsystem::FindTargetFor(const ADelveDeepCharacter* Seeker, EDelveDeepTargetPriority Priority, float Range) const
+{
+	if (!IsValid(Seeker))
+	{
+		return nullptr;
+	}
+
+	// Character data only carries the hero attack range; monsters supply their detection range
+	if (Range <= 0.0f)
+	{
+		const UDelveDeepCharacterData* Data = Seeker->GetCharacterData();
+		Range = Data ? Data->AttackRange : 100.0f;
+	}
+
+	const int32 Handle = FindBestTarget(Seeker->GetActorLocation(), Range, DelveDeepTeam::Opposing(Seeker->GetTeamId()), Priority);
+	return GetCombatantActor(Handle);
+}
+
+void UDelveDeepTargetingSubsystem::SetCellSize(float InCellSize)
+{
+	if (InCellSize <= 1.0f)
+	{
+		UE_LOG(LogDelveDeepTargeting, Warning, TEXT("SetCellSize: Invalid cell size %.2f"), InCellSize);
+		return;
+	}
+
+	CellSize = InCellSize;
+	InvCellSize = 1.0f / InCellSize;
+
+	Cells.Reset();
+	for (int32 Slot = 0; Slot < Active.Num(); ++Slot)
+	{
+		if (Active[Slot])
+		{
+			AddToCell(Slot, GetCell(PositionX[Slot], PositionY[Slot]));
+		}
+	}
+}
+
+FDelveDeepCombatantView UDelveDeepTargetingSubsystem::GetPackedCombatants() const
+{
+	FDelveDeepCombatantView View;
+	View.X = PositionX.GetData();
+	View.Y = PositionY.GetData();
+	View.TeamBits = TeamBits.GetData();
+	View.Num = PositionX.Num();
+	return View;
+}
+
+FVector UDelveDeepTargetingSubsystem::GetCombatantLocation(int32 Handle) const
+{
+	return IsCombatantValid(Handle) ? FVector(PositionX[Handle], PositionY[Handle], PositionZ[Handle]) : FVector::ZeroVector;
+}
+
+void UDelveDeepTargetingSubsystem::SyncActorLocations()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DelveDeep_TargetingSystem);
+
+	for (int32 Slot = 0; Slot < Active.Num(); ++Slot)
+	{
+		if (!Active[Slot] || Actors[Slot].IsExplicitlyNull())
+		{
+			continue;
+		}
+
+		const AActor* Actor = Actors[Slot].Get();
+		if (!Actor)
+		{
+			// Destroyed without unregistering
+			UnregisterCombatant(Slot);
+			continue;
+		}
+
+		UpdateCombatantLocation(Slot, Actor->GetActorLocation());
+	}
+}
+
+void UDelveDeepTargetingSubsystem::AddToCell(int32 Slot, const FIntPoint& Cell)
+{
+	TArray<int32>& Bucket = Cells.FindOrAdd(Cell);
+	CellCoords[Slot] = Cell;
+	IndexInCell[Slot] = Bucket.Add(Slot);
+}
+
+void UDelveDeepTargetingSubsystem::RemoveFromCell(int32 Slot)
+{
+	TArray<int32>* Bucket = Cells.Find(CellCoords[Slot]);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	// Swap-remove, fixing up the index of the entry moved into the hole
+	const int32 Index = IndexInCell[Slot];
+	const int32 LastSlot = Bucket->Last();
+	(*Bucket)[Index] = LastSlot;
+	IndexInCell[LastSlot] = Index;
+	Bucket->Pop(EAllowShrinking::No);
+
+	if (Bucket->Num() == 0)
+	{
+		Cells.Remove(CellCoords[Slot]);
+	}
+}
+
+bool UDelveDeepTargetingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
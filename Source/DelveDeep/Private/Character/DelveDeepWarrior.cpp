@@ -1,8 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Character/DelveDeepWarrior.h"
+#include "Character/DelveDeepAoESubsystem.h"
 #include "Character/DelveDeepStatsComponent.h"
 #include "DelveDeepLogChannels.h"
+#include "Engine/World.h"
 
 ADelveDeepWarrior::ADelveDeepWarrior()
 {
@@ -37,16 +39,32 @@ void ADelveDeepWarrior::GenerateRage(float Amount)
 
 void ADelveDeepWarrior::PerformCleaveAttack()
 {
-	// Placeholder for future combat system integration
-	UE_LOG(LogDelveDeep, Display, 
-		TEXT("Warrior '%s' performs Cleave Attack (placeholder)"), 
-		*GetName());
-
-	// TODO: Implement cleave attack when combat system is available
-	// - Check Rage cost
-	// - Find enemies in front arc
-	// - Deal damage to all enemies in range
-	// - Consume Rage
+	UWorld* World = GetWorld();
+	UDelveDeepAoESubsystem* AoE = World ? World->GetSubsystem<UDelveDeepAoESubsystem>() : nullptr;
+	if (!AoE || !StatsComponent)
+	{
+		return;
+	}
+
+	if (StatsComponent->GetCurrentResource() < CleaveRageCost)
+	{
+		UE_LOG(LogDelveDeep, Verbose, 
+			TEXT("Warrior '%s' lacks Rage for Cleave Attack (%.2f/%.2f)"), 
+			*GetName(), StatsComponent->GetCurrentResource(), CleaveRageCost);
+		return;
+	}
+
+	// One cone query and a batch of queued hits for every enemy in the arc
+	const float Damage = StatsComponent->GetStatValue(EDelveDeepStat::Damage);
+	const int32 Hits = AoE->DamageCone(GetActorLocation(), GetActorForwardVector(), CleaveRange, CleaveHalfAngle,
+		UDelveDeepAoESubsystem::GetAbilityTeamMask(GetTeamId(), false), Damage, FName(TEXT("Physical")), this);
+
+	// The swing costs Rage whether or not anything was in the arc
+	StatsComponent->ModifyResource(-CleaveRageCost);
+
+	UE_LOG(LogDelveDeep, Verbose, 
+		TEXT("Warrior '%s' performs Cleave Attack hitting %d enemies"), 
+		*GetName(), Hits);
 }
 
 void ADelveDeepWarrior::TakeDamage(float DamageAmount, AActor* DamageSource)
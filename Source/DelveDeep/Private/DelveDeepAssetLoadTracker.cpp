@@ -3,13 +3,34 @@
 #include "DelveDeepAssetLoadTracker.h"
 #include "DelveDeepTelemetrySubsystem.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+
+namespace DelveDeepAssetLoadTracker
+{
+	/** Heap predicate: smallest load time on top */
+	struct FFasterLoad
+	{
+		bool operator()(const FAssetLoadRecord& A, const FAssetLoadRecord& B) const
+		{
+			return A.LoadTimeMs < B.LoadTimeMs;
+		}
+	};
+}
 
 FDelveDeepAssetLoadTracker::FDelveDeepAssetLoadTracker()
 {
 	LoadHistory.Reserve(MaxHistorySize);
+	SlowestLoadsHeap.Reserve(MaxSlowestLoads);
 }
 
-void FDelveDeepAssetLoadTracker::RecordAssetLoad(const FString& AssetPath, float LoadTimeMs, uint64 AssetSize, bool bSynchronous)
+FDelveDeepAssetLoadTracker::~FDelveDeepAssetLoadTracker()
+{
+	StopAutomaticCapture();
+}
+
+void FDelveDeepAssetLoadTracker::RecordAssetLoad(const FString& AssetPath, float LoadTimeMs, int64 AssetSize, bool bSynchronous)
 {
 	if (AssetPath.IsEmpty())
 	{
@@ -26,37 +47,70 @@ void FDelveDeepAssetLoadTracker::RecordAssetLoad(const FString& AssetPath, float
 	}
 
 	// Determine asset type from path
-	const FName AssetType = DetermineAssetType(AssetPath);
+	FAssetLoadRecord Record(AssetPath, DetermineAssetType(AssetPath), LoadTimeMs, AssetSize, bSynchronous);
 
-	// Create load record
-	FAssetLoadRecord Record(AssetPath, AssetType, LoadTimeMs, AssetSize, bSynchronous);
+	bool bGameplaySyncLoad = false;
+	{
+		FScopeLock Lock(&CriticalSection);
+		bGameplaySyncLoad = AddRecordLocked(Record);
+	}
 
-	// Add to history
-	LoadHistory.Add(Record);
+	if (bGameplaySyncLoad)
+	{
+		OnGameplaySyncLoad.ExecuteIfBound(Record);
+	}
+}
 
-	// Limit history size
-	if (LoadHistory.Num() > MaxHistorySize)
+void FDelveDeepAssetLoadTracker::StartAutomaticCapture()
+{
+	if (bAutomaticCaptureActive)
 	{
-		LoadHistory.RemoveAt(0);
+		return;
 	}
 
-	// Update statistics
-	UpdateStatistics(AssetType, LoadTimeMs, AssetSize, bSynchronous);
+	SyncLoadHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddRaw(this, &FDelveDeepAssetLoadTracker::HandleSyncLoadPackage);
+	AsyncLoadHandle = FCoreUObjectDelegates::OnAsyncLoadPackage.AddRaw(this, &FDelveDeepAssetLoadTracker::HandleAsyncLoadPackage);
+	EndLoadHandle = FCoreUObjectDelegates::OnEndLoadPackage.AddRaw(this, &FDelveDeepAssetLoadTracker::HandleEndLoadPackage);
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FDelveDeepAssetLoadTracker::HandlePreLoadMap);
 
-	// Check for slow loads
-	CheckSlowLoad(AssetPath, LoadTimeMs);
+	bAutomaticCaptureActive = true;
 
-	UE_LOG(LogDelveDeepTelemetry, Verbose,
-		TEXT("Recorded asset load: %s (Type: %s, Time: %.2fms, Size: %llu bytes, %s)"),
-		*AssetPath,
-		*AssetType.ToString(),
-		LoadTimeMs,
-		AssetSize,
-		bSynchronous ? TEXT("Sync") : TEXT("Async"));
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Automatic asset load capture started"));
+}
+
+void FDelveDeepAssetLoadTracker::StopAutomaticCapture()
+{
+	if (!bAutomaticCaptureActive)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::OnSyncLoadPackage.Remove(SyncLoadHandle);
+	FCoreUObjectDelegates::OnAsyncLoadPackage.Remove(AsyncLoadHandle);
+	FCoreUObjectDelegates::OnEndLoadPackage.Remove(EndLoadHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+
+	{
+		FScopeLock Lock(&CriticalSection);
+		PendingLoads.Empty();
+		SyncLoadStack.Empty();
+	}
+
+	bAutomaticCaptureActive = false;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Automatic asset load capture stopped"));
+}
+
+TArray<FAssetLoadRecord> FDelveDeepAssetLoadTracker::GetGameplaySyncLoads() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return GameplaySyncLoads;
 }
 
 FAssetLoadStatistics FDelveDeepAssetLoadTracker::GetAssetLoadStatistics(FName AssetType) const
 {
+	FScopeLock Lock(&CriticalSection);
+
 	const FAssetLoadStatistics* Stats = TypeStatistics.Find(AssetType);
 	if (Stats)
 	{
@@ -72,11 +126,9 @@ FAssetLoadStatistics FDelveDeepAssetLoadTracker::GetAssetLoadStatistics(FName As
 TArray<FAssetLoadStatistics> FDelveDeepAssetLoadTracker::GetAllAssetLoadStatistics() const
 {
 	TArray<FAssetLoadStatistics> AllStats;
-	AllStats.Reserve(TypeStatistics.Num());
-
-	for (const auto& Pair : TypeStatistics)
 	{
-		AllStats.Add(Pair.Value);
+		FScopeLock Lock(&CriticalSection);
+		TypeStatistics.GenerateValueArray(AllStats);
 	}
 
 	// Sort by total loads (descending)
@@ -90,16 +142,18 @@ TArray<FAssetLoadStatistics> FDelveDeepAssetLoadTracker::GetAllAssetLoadStatisti
 
 TArray<FAssetLoadRecord> FDelveDeepAssetLoadTracker::GetRecentAssetLoads(int32 Count) const
 {
-	TArray<FAssetLoadRecord> RecentLoads;
+	FScopeLock Lock(&CriticalSection);
 
-	const int32 StartIndex = FMath::Max(0, LoadHistory.Num() - Count);
-	const int32 NumToReturn = FMath::Min(Count, LoadHistory.Num());
+	TArray<FAssetLoadRecord> RecentLoads;
 
+	const int32 NumToReturn = FMath::Clamp(Count, 0, LoadHistory.Num());
 	RecentLoads.Reserve(NumToReturn);
 
-	for (int32 i = StartIndex; i < LoadHistory.Num(); ++i)
+	// Oldest-to-newest order, starting NumToReturn records before the newest
+	const int32 NumRecords = LoadHistory.Num();
+	for (int32 i = NumRecords - NumToReturn; i < NumRecords; ++i)
 	{
-		RecentLoads.Add(LoadHistory[i]);
+		RecentLoads.Add(LoadHistory[(HistoryHead + i) % NumRecords]);
 	}
 
 	return RecentLoads;
@@ -107,23 +161,27 @@ TArray<FAssetLoadRecord> FDelveDeepAssetLoadTracker::GetRecentAssetLoads(int32 C
 
 TArray<FAssetLoadRecord> FDelveDeepAssetLoadTracker::GetSlowestAssetLoads(int32 Count) const
 {
-	// Copy load history
-	TArray<FAssetLoadRecord> SortedLoads = LoadHistory;
+	// Only the bounded heap is copied and sorted, never the full history
+	TArray<FAssetLoadRecord> SlowestLoads;
+	{
+		FScopeLock Lock(&CriticalSection);
+		SlowestLoads = SlowestLoadsHeap;
+	}
 
-	// Sort by load time (descending)
-	SortedLoads.Sort([](const FAssetLoadRecord& A, const FAssetLoadRecord& B)
+	SlowestLoads.Sort([](const FAssetLoadRecord& A, const FAssetLoadRecord& B)
 	{
 		return A.LoadTimeMs > B.LoadTimeMs;
 	});
 
-	// Return top N
-	const int32 NumToReturn = FMath::Min(Count, SortedLoads.Num());
-	TArray<FAssetLoadRecord> SlowestLoads;
-	SlowestLoads.Reserve(NumToReturn);
+	if (SlowestLoads.Num() > Count)
+	{
+		SlowestLoads.SetNum(FMath::Max(0, Count));
+	}
 
-	for (int32 i = 0; i < NumToReturn; ++i)
+	if (Count > MaxSlowestLoads)
 	{
-		SlowestLoads.Add(SortedLoads[i]);
+		UE_LOG(LogDelveDeepTelemetry, Verbose,
+			TEXT("GetSlowestAssetLoads: requested %d, only the slowest %d are retained"), Count, MaxSlowestLoads);
 	}
 
 	return SlowestLoads;
@@ -131,6 +189,8 @@ TArray<FAssetLoadRecord> FDelveDeepAssetLoadTracker::GetSlowestAssetLoads(int32
 
 int32 FDelveDeepAssetLoadTracker::GetTotalSlowLoads() const
 {
+	FScopeLock Lock(&CriticalSection);
+
 	int32 TotalSlowLoads = 0;
 
 	for (const auto& Pair : TypeStatistics)
@@ -143,12 +203,235 @@ int32 FDelveDeepAssetLoadTracker::GetTotalSlowLoads() const
 
 void FDelveDeepAssetLoadTracker::ResetStatistics()
 {
-	LoadHistory.Empty();
-	TypeStatistics.Empty();
+	{
+		FScopeLock Lock(&CriticalSection);
+		LoadHistory.Empty(MaxHistorySize);
+		HistoryHead = 0;
+		SlowestLoadsHeap.Empty(MaxSlowestLoads);
+		GameplaySyncLoads.Empty();
+		TypeStatistics.Empty();
+		TotalRecordedLoads = 0;
+		TotalGameplaySyncLoads = 0;
+	}
 
 	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Asset load tracker statistics reset"));
 }
 
+bool FDelveDeepAssetLoadTracker::AddRecordLocked(FAssetLoadRecord& Record)
+{
+	Record.FrameNumber = static_cast<int64>(GFrameCounter);
+	Record.bDuringGameplay = bGameplayActive;
+
+	FDelveDeepTraceRecorder::Get().RecordSpanEndingNow(Record.AssetType,
+		Record.bSynchronous ? TEXT("AssetLoad.Sync") : TEXT("AssetLoad.Async"), Record.LoadTimeMs, Record.AssetPath);
+
+	// Add to history, overwriting the oldest record once full
+	if (LoadHistory.Num() < MaxHistorySize)
+	{
+		LoadHistory.Add(Record);
+	}
+	else
+	{
+		LoadHistory[HistoryHead] = Record;
+		HistoryHead = (HistoryHead + 1) % MaxHistorySize;
+	}
+
+	TotalRecordedLoads++;
+	PushSlowestLoad(Record);
+
+	// Update statistics
+	UpdateStatistics(Record.AssetType, Record.LoadTimeMs, Record.AssetSize, Record.bSynchronous);
+
+	// Check for slow loads
+	CheckSlowLoad(Record.AssetPath, Record.LoadTimeMs);
+
+	UE_LOG(LogDelveDeepTelemetry, Verbose,
+		TEXT("Recorded asset load: %s (Type: %s, Time: %.2fms, Size: %lld bytes, %s, %d deps)"),
+		*Record.AssetPath,
+		*Record.AssetType.ToString(),
+		Record.LoadTimeMs,
+		Record.AssetSize,
+		Record.bSynchronous ? TEXT("Sync") : TEXT("Async"),
+		Record.DependencyCount);
+
+	// A synchronous load during gameplay stalls the game thread: flag it as a budget violation
+	if (!Record.bSynchronous || !Record.bDuringGameplay)
+	{
+		return false;
+	}
+
+	TotalGameplaySyncLoads++;
+	GameplaySyncLoads.Add(Record);
+	if (GameplaySyncLoads.Num() > MaxGameplaySyncLoads)
+	{
+		GameplaySyncLoads.RemoveAt(0, GameplaySyncLoads.Num() - MaxGameplaySyncLoads);
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Warning,
+		TEXT("Synchronous asset load during gameplay: %s (%.2fms, frame %lld%s%s)"),
+		*Record.AssetPath,
+		Record.LoadTimeMs,
+		Record.FrameNumber,
+		Record.RequestingPackage.IsNone() ? TEXT("") : TEXT(", requested by "),
+		Record.RequestingPackage.IsNone() ? TEXT("") : *Record.RequestingPackage.ToString());
+
+	return true;
+}
+
+void FDelveDeepAssetLoadTracker::PushSlowestLoad(const FAssetLoadRecord& Record)
+{
+	using DelveDeepAssetLoadTracker::FFasterLoad;
+
+	if (SlowestLoadsHeap.Num() < MaxSlowestLoads)
+	{
+		SlowestLoadsHeap.HeapPush(Record, FFasterLoad());
+		return;
+	}
+
+	// Heap top is the fastest of the retained loads; replace it only if this one is slower
+	if (Record.LoadTimeMs > SlowestLoadsHeap.HeapTop().LoadTimeMs)
+	{
+		SlowestLoadsHeap.HeapPopDiscard(FFasterLoad(), EAllowShrinking::No);
+		SlowestLoadsHeap.HeapPush(Record, FFasterLoad());
+	}
+}
+
+void FDelveDeepAssetLoadTracker::BeginPackageLoad(const FString& PackageName, bool bSynchronous)
+{
+	const FName Name(*PackageName);
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&CriticalSection);
+
+	// Requests for packages that are already resident never reach end-load; drop stale ones
+	if (PendingLoads.Num() > PendingLoadPruneThreshold)
+	{
+		for (auto It = PendingLoads.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().StartTime > PendingLoadTimeoutSeconds)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		// Sync requests dropped above will never pop themselves off the stack
+		SyncLoadStack.RemoveAll([this](const FName& StackName)
+		{
+			return !PendingLoads.Contains(StackName);
+		});
+	}
+
+	// Keep the earliest start if the package was already requested (async followed by a sync flush)
+	FPendingPackageLoad* Existing = PendingLoads.Find(Name);
+	if (Existing)
+	{
+		Existing->bSynchronous |= bSynchronous;
+	}
+	else
+	{
+		FPendingPackageLoad& Pending = PendingLoads.Add(Name);
+		Pending.StartTime = Now;
+		Pending.bSynchronous = bSynchronous;
+		Pending.RequestingPackage = SyncLoadStack.Num() > 0 ? SyncLoadStack.Last() : NAME_None;
+	}
+
+	// One stack entry per pending package, so a single end-load always clears it
+	if (bSynchronous)
+	{
+		SyncLoadStack.AddUnique(Name);
+	}
+}
+
+void FDelveDeepAssetLoadTracker::HandleSyncLoadPackage(const FString& PackageName)
+{
+	BeginPackageLoad(PackageName, true);
+}
+
+void FDelveDeepAssetLoadTracker::HandleAsyncLoadPackage(const FString& PackageName)
+{
+	BeginPackageLoad(PackageName, false);
+}
+
+void FDelveDeepAssetLoadTracker::HandleEndLoadPackage(const FEndLoadPackageContext& Context)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<FAssetLoadRecord, TInlineAllocator<4>> Completed;
+	TArray<FName, TInlineAllocator<16>> DependencyNames;
+	TArray<FAssetLoadRecord, TInlineAllocator<4>> Violations;
+
+	FScopeLock Lock(&CriticalSection);
+
+	for (UPackage* Package : Context.LoadedPackages)
+	{
+		if (!Package)
+		{
+			continue;
+		}
+
+		const FName PackageName = Package->GetFName();
+		FPendingPackageLoad Pending;
+		if (!PendingLoads.RemoveAndCopyValue(PackageName, Pending))
+		{
+			// Loaded without a request of its own: an import of a requested package
+			DependencyNames.Add(PackageName);
+			continue;
+		}
+
+		SyncLoadStack.RemoveSingle(PackageName);
+
+		// Prefer the class of the package's primary asset over path heuristics
+		const UObject* Asset = Package->FindAssetInPackage();
+		const FString PackagePath = PackageName.ToString();
+		const FName AssetType = Asset ? Asset->GetClass()->GetFName() : DetermineAssetType(PackagePath);
+
+		// Size is not cheaply available for IoStore packages; manual reports still supply it
+		FAssetLoadRecord& Record = Completed.Emplace_GetRef(PackagePath, AssetType,
+			static_cast<float>((Now - Pending.StartTime) * 1000.0), 0, Pending.bSynchronous);
+		Record.RequestingPackage = Pending.RequestingPackage;
+	}
+
+	if (Completed.Num() == 0)
+	{
+		return;
+	}
+
+	// Attribute unrequested packages to the longest-running request in this batch
+	int32 OwnerIndex = 0;
+	for (int32 i = 1; i < Completed.Num(); ++i)
+	{
+		if (Completed[i].LoadTimeMs > Completed[OwnerIndex].LoadTimeMs)
+		{
+			OwnerIndex = i;
+		}
+	}
+
+	FAssetLoadRecord& Owner = Completed[OwnerIndex];
+	Owner.DependencyCount = DependencyNames.Num();
+	Owner.Dependencies.Append(DependencyNames.GetData(), FMath::Min(DependencyNames.Num(), FAssetLoadRecord::MaxRecordedDependencies));
+
+	for (FAssetLoadRecord& Record : Completed)
+	{
+		if (AddRecordLocked(Record))
+		{
+			Violations.Add(Record);
+		}
+	}
+
+	// Broadcast outside the lock so listeners can query the tracker
+	Lock.Unlock();
+	for (const FAssetLoadRecord& Violation : Violations)
+	{
+		OnGameplaySyncLoad.ExecuteIfBound(Violation);
+	}
+}
+
+void FDelveDeepAssetLoadTracker::HandlePreLoadMap(const FString& MapName)
+{
+	// Map loads are expected to be synchronous; gameplay resumes once the new world begins play
+	bGameplayActive = false;
+}
+
 FName FDelveDeepAssetLoadTracker::DetermineAssetType(const FString& AssetPath) const
 {
 	// Extract file extension
@@ -221,7 +504,7 @@ FName FDelveDeepAssetLoadTracker::DetermineAssetType(const FString& AssetPath) c
 	}
 }
 
-void FDelveDeepAssetLoadTracker::UpdateStatistics(FName AssetType, float LoadTimeMs, uint64 AssetSize, bool bSynchronous)
+void FDelveDeepAssetLoadTracker::UpdateStatistics(FName AssetType, float LoadTimeMs, int64 AssetSize, bool bSynchronous)
 {
 	FAssetLoadStatistics& Stats = TypeStatistics.FindOrAdd(AssetType);
 
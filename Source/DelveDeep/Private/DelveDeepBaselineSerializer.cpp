@@ -0,0 +1,682 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepBaselineSerializer.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	/** Fixed-size file header (written field by field, 24 bytes) */
+	struct FBaselineFileHeader
+	{
+		uint32 Magic = 0;
+		uint16 SchemaVersion = 0;
+		uint16 Flags = 0;
+		uint32 SectionCount = 0;
+		uint32 RawSize = 0;
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+
+		void Serialize(FArchive& Ar)
+		{
+			Ar << Magic << SchemaVersion << Flags << SectionCount << RawSize << PayloadSize << PayloadCrc;
+		}
+
+		static constexpr int32 SerializedSize = 24;
+	};
+
+	/** Section table entry; Offset is relative to the start of the uncompressed payload */
+	struct FBaselineSectionEntry
+	{
+		uint32 Id = 0;
+		uint32 Offset = 0;
+		uint32 Size = 0;
+
+		static constexpr int32 SerializedSize = 12;
+	};
+
+	/** Write a numeric column as one contiguous block */
+	template <typename T>
+	void WriteColumn(FArchive& Ar, const TArray<T>& Column)
+	{
+		Ar.Serialize(const_cast<T*>(Column.GetData()), Column.Num() * sizeof(T));
+	}
+
+	/** Read a numeric column, refusing counts the remaining data cannot hold */
+	template <typename T>
+	bool ReadColumn(FArchive& Ar, int32 Count, TArray<T>& OutColumn)
+	{
+		if (Count < 0 || static_cast<int64>(Count) * sizeof(T) > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		OutColumn.SetNumUninitialized(Count);
+		Ar.Serialize(OutColumn.GetData(), Count * sizeof(T));
+		return !Ar.IsError();
+	}
+
+	/** Read a count that is followed by at least MinBytesPerEntry bytes per entry */
+	bool ReadCount(FArchive& Ar, int32 MinBytesPerEntry, int32& OutCount)
+	{
+		Ar << OutCount;
+		if (Ar.IsError() || OutCount < 0 || static_cast<int64>(OutCount) * MinBytesPerEntry > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return false;
+		}
+		return true;
+	}
+
+	void WriteMetaSection(FArchive& Ar, const FPerformanceBaseline& Baseline)
+	{
+		FString Name = Baseline.BaselineName.ToString();
+		FString BuildVersion = Baseline.BuildVersion;
+		FString MapName = Baseline.MapName;
+		int64 CaptureTicks = Baseline.CaptureTime.GetTicks();
+		float AverageFPS = Baseline.AverageFPS;
+		float OnePercentLowFPS = Baseline.OnePercentLowFPS;
+		int32 TotalFrames = Baseline.TotalFramesCaptured;
+		float FrameTimeMs = Baseline.AverageFrameData.FrameTimeMs;
+		float GameThreadTimeMs = Baseline.AverageFrameData.GameThreadTimeMs;
+		float RenderThreadTimeMs = Baseline.AverageFrameData.RenderThreadTimeMs;
+
+		Ar << Name << BuildVersion << MapName << CaptureTicks;
+		Ar << AverageFPS << OnePercentLowFPS << TotalFrames;
+		Ar << FrameTimeMs << GameThreadTimeMs << RenderThreadTimeMs;
+	}
+
+	bool ReadMetaSection(FArchive& Ar, FPerformanceBaseline& Baseline)
+	{
+		FString Name;
+		int64 CaptureTicks = 0;
+
+		Ar << Name << Baseline.BuildVersion << Baseline.MapName << CaptureTicks;
+		Ar << Baseline.AverageFPS << Baseline.OnePercentLowFPS << Baseline.TotalFramesCaptured;
+		Ar << Baseline.AverageFrameData.FrameTimeMs << Baseline.AverageFrameData.GameThreadTimeMs << Baseline.AverageFrameData.RenderThreadTimeMs;
+
+		if (Ar.IsError() || CaptureTicks < 0 || CaptureTicks > FDateTime::MaxValue().GetTicks())
+		{
+			return false;
+		}
+
+		Baseline.BaselineName = Name.IsEmpty() ? NAME_None : FName(*Name);
+		Baseline.CaptureTime = FDateTime(CaptureTicks);
+		return true;
+	}
+
+	void WriteSystemsSection(FArchive& Ar, const FPerformanceBaseline& Baseline)
+	{
+		int32 Count = Baseline.SystemData.Num();
+		Ar << Count;
+
+		TArray<double> CycleTimes, Budgets, Averages, Peaks;
+		TArray<int32> CallCounts;
+		CycleTimes.Reserve(Count);
+		Budgets.Reserve(Count);
+		Averages.Reserve(Count);
+		Peaks.Reserve(Count);
+		CallCounts.Reserve(Count);
+
+		for (const auto& Pair : Baseline.SystemData)
+		{
+			FString Name = Pair.Key.ToString();
+			Ar << Name;
+
+			CycleTimes.Add(Pair.Value.CycleTimeMs);
+			Budgets.Add(Pair.Value.BudgetTimeMs);
+			Averages.Add(Pair.Value.AverageTimeMs);
+			Peaks.Add(Pair.Value.PeakTimeMs);
+			CallCounts.Add(Pair.Value.CallCount);
+		}
+
+		WriteColumn(Ar, CycleTimes);
+		WriteColumn(Ar, Budgets);
+		WriteColumn(Ar, Averages);
+		WriteColumn(Ar, Peaks);
+		WriteColumn(Ar, CallCounts);
+	}
+
+	bool ReadSystemsSection(FArchive& Ar, FPerformanceBaseline& Baseline)
+	{
+		int32 Count = 0;
+		if (!ReadCount(Ar, sizeof(int32), Count))
+		{
+			return false;
+		}
+
+		TArray<FName> Names;
+		Names.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FString Name;
+			Ar << Name;
+			Names.Add(FName(*Name));
+		}
+
+		TArray<double> CycleTimes, Budgets, Averages, Peaks;
+		TArray<int32> CallCounts;
+		if (Ar.IsError()
+			|| !ReadColumn(Ar, Count, CycleTimes)
+			|| !ReadColumn(Ar, Count, Budgets)
+			|| !ReadColumn(Ar, Count, Averages)
+			|| !ReadColumn(Ar, Count, Peaks)
+			|| !ReadColumn(Ar, Count, CallCounts))
+		{
+			return false;
+		}
+
+		Baseline.SystemData.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FSystemPerformanceData& System = Baseline.SystemData.Add(Names[i]);
+			System.SystemName = Names[i];
+			System.CycleTimeMs = CycleTimes[i];
+			System.BudgetTimeMs = Budgets[i];
+			System.AverageTimeMs = Averages[i];
+			System.PeakTimeMs = Peaks[i];
+			System.CallCount = CallCounts[i];
+		}
+
+		return true;
+	}
+
+	void WriteMemorySection(FArchive& Ar, const FPerformanceBaseline& Baseline)
+	{
+		const FMemorySnapshot& Memory = Baseline.MemoryData;
+		int64 Total = Memory.TotalMemory;
+		int64 Native = Memory.NativeMemory;
+		int64 Managed = Memory.ManagedMemory;
+		int64 TimestampTicks = Memory.Timestamp.GetTicks();
+		int32 Count = Memory.PerSystemMemory.Num();
+
+		Ar << Total << Native << Managed << TimestampTicks << Count;
+
+		TArray<int64> Bytes;
+		Bytes.Reserve(Count);
+		for (const auto& Pair : Memory.PerSystemMemory)
+		{
+			FString Name = Pair.Key.ToString();
+			Ar << Name;
+			Bytes.Add(Pair.Value);
+		}
+
+		WriteColumn(Ar, Bytes);
+	}
+
+	bool ReadMemorySection(FArchive& Ar, FPerformanceBaseline& Baseline)
+	{
+		FMemorySnapshot& Memory = Baseline.MemoryData;
+		int64 TimestampTicks = 0;
+
+		Ar << Memory.TotalMemory << Memory.NativeMemory << Memory.ManagedMemory << TimestampTicks;
+
+		int32 Count = 0;
+		if (Ar.IsError() || !ReadCount(Ar, sizeof(int32), Count))
+		{
+			return false;
+		}
+
+		TArray<FName> Names;
+		Names.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FString Name;
+			Ar << Name;
+			Names.Add(FName(*Name));
+		}
+
+		TArray<int64> Bytes;
+		if (Ar.IsError() || !ReadColumn(Ar, Count, Bytes))
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Memory.PerSystemMemory.Add(Names[i], Bytes[i]);
+		}
+
+		if (TimestampTicks >= 0 && TimestampTicks <= FDateTime::MaxValue().GetTicks())
+		{
+			Memory.Timestamp = FDateTime(TimestampTicks);
+		}
+
+		return true;
+	}
+
+	void WriteFrameTimesSection(FArchive& Ar, const FPerformanceBaseline& Baseline)
+	{
+		int32 Count = Baseline.FrameTimeSamples.Num();
+		Ar << Count;
+		WriteColumn(Ar, Baseline.FrameTimeSamples);
+	}
+
+	bool ReadFrameTimesSection(FArchive& Ar, FPerformanceBaseline& Baseline)
+	{
+		int32 Count = 0;
+		Ar << Count;
+		return !Ar.IsError() && ReadColumn(Ar, Count, Baseline.FrameTimeSamples);
+	}
+
+	void WriteGarbageCollectionSection(FArchive& Ar, const FPerformanceBaseline& Baseline)
+	{
+		FDelveDeepGCStats GC = Baseline.GCData;
+		Ar << GC.CollectionCount << GC.AverageGCTimeMs << GC.PeakGCTimeMs << GC.SpikeCount;
+		Ar << GC.UObjectCount << GC.PeakUObjectCount;
+	}
+
+	bool ReadGarbageCollectionSection(FArchive& Ar, FPerformanceBaseline& Baseline)
+	{
+		FDelveDeepGCStats& GC = Baseline.GCData;
+		Ar << GC.CollectionCount << GC.AverageGCTimeMs << GC.PeakGCTimeMs << GC.SpikeCount;
+		Ar << GC.UObjectCount << GC.PeakUObjectCount;
+		return !Ar.IsError();
+	}
+
+	/** Serialize one section into its own buffer */
+	template <typename FWriteFunc>
+	TArray<uint8> BuildSection(const FPerformanceBaseline& Baseline, FWriteFunc WriteFunc)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes, true);
+		WriteFunc(Writer, Baseline);
+		return Bytes;
+	}
+}
+
+void FDelveDeepBaselineSerializer::SaveToBytes(const FPerformanceBaseline& Baseline, TArray<uint8>& OutBytes, bool bAllowCompression)
+{
+	using namespace DelveDeepBaselineFormat;
+
+	const TPair<uint32, TArray<uint8>> Sections[] =
+	{
+		{ SectionMeta, BuildSection(Baseline, WriteMetaSection) },
+		{ SectionSystems, BuildSection(Baseline, WriteSystemsSection) },
+		{ SectionMemory, BuildSection(Baseline, WriteMemorySection) },
+		{ SectionFrameTimes, BuildSection(Baseline, WriteFrameTimesSection) },
+		{ SectionGarbageCollection, BuildSection(Baseline, WriteGarbageCollectionSection) },
+	};
+	const uint32 SectionCount = UE_ARRAY_COUNT(Sections);
+
+	// Section table followed by the section bodies
+	TArray<uint8> Raw;
+	{
+		FMemoryWriter Writer(Raw, true);
+
+		uint32 Offset = SectionCount * FBaselineSectionEntry::SerializedSize;
+		for (const TPair<uint32, TArray<uint8>>& Section : Sections)
+		{
+			uint32 Id = Section.Key;
+			uint32 Size = Section.Value.Num();
+			Writer << Id << Offset << Size;
+			Offset += Size;
+		}
+
+		for (const TPair<uint32, TArray<uint8>>& Section : Sections)
+		{
+			Writer.Serialize(const_cast<uint8*>(Section.Value.GetData()), Section.Value.Num());
+		}
+	}
+
+	FBaselineFileHeader Header;
+	Header.Magic = Magic;
+	Header.SchemaVersion = SchemaVersion;
+	Header.SectionCount = SectionCount;
+	Header.RawSize = Raw.Num();
+
+	TArray<uint8> Payload;
+	if (bAllowCompression && Raw.Num() >= CompressionThresholdBytes)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Raw.Num());
+		Payload.SetNumUninitialized(CompressedSize);
+
+		if (FCompression::CompressMemory(NAME_Zlib, Payload.GetData(), CompressedSize, Raw.GetData(), Raw.Num())
+			&& CompressedSize < Raw.Num())
+		{
+			Payload.SetNum(CompressedSize, EAllowShrinking::No);
+			Header.Flags |= FlagCompressed;
+		}
+		else
+		{
+			Payload.Reset();
+		}
+	}
+
+	const TArray<uint8>& Stored = (Header.Flags & FlagCompressed) ? Payload : Raw;
+	Header.PayloadSize = Stored.Num();
+	Header.PayloadCrc = FCrc::MemCrc32(Stored.GetData(), Stored.Num());
+
+	OutBytes.Reset(FBaselineFileHeader::SerializedSize + Stored.Num());
+	FMemoryWriter Writer(OutBytes, true);
+	Header.Serialize(Writer);
+	Writer.Serialize(const_cast<uint8*>(Stored.GetData()), Stored.Num());
+}
+
+bool FDelveDeepBaselineSerializer::LoadFromBytes(const TArray<uint8>& Bytes, FPerformanceBaseline& OutBaseline, FString& OutError)
+{
+	using namespace DelveDeepBaselineFormat;
+
+	if (Bytes.Num() < FBaselineFileHeader::SerializedSize)
+	{
+		OutError = TEXT("File is too small to be a baseline");
+		return false;
+	}
+
+	FBaselineFileHeader Header;
+	FMemoryReader HeaderReader(Bytes, true);
+	Header.Serialize(HeaderReader);
+
+	if (Header.Magic != Magic)
+	{
+		OutError = TEXT("Not a binary baseline (bad magic)");
+		return false;
+	}
+
+	if (Header.SchemaVersion == 0 || Header.SchemaVersion > SchemaVersion)
+	{
+		OutError = FString::Printf(TEXT("Unsupported baseline schema version %u (this build reads up to %u)"),
+			Header.SchemaVersion, SchemaVersion);
+		return false;
+	}
+
+	if (static_cast<int64>(Header.PayloadSize) != Bytes.Num() - FBaselineFileHeader::SerializedSize)
+	{
+		OutError = FString::Printf(TEXT("Payload size mismatch (header %u, file %d)"),
+			Header.PayloadSize, Bytes.Num() - FBaselineFileHeader::SerializedSize);
+		return false;
+	}
+
+	const uint8* Stored = Bytes.GetData() + FBaselineFileHeader::SerializedSize;
+	if (FCrc::MemCrc32(Stored, Header.PayloadSize) != Header.PayloadCrc)
+	{
+		OutError = TEXT("Payload checksum mismatch (file is corrupt or truncated)");
+		return false;
+	}
+
+	TArray<uint8> Decompressed;
+	const uint8* Raw = Stored;
+	if (Header.Flags & FlagCompressed)
+	{
+		Decompressed.SetNumUninitialized(Header.RawSize);
+		if (!FCompression::UncompressMemory(NAME_Zlib, Decompressed.GetData(), Header.RawSize, Stored, Header.PayloadSize))
+		{
+			OutError = TEXT("Failed to decompress baseline payload");
+			return false;
+		}
+		Raw = Decompressed.GetData();
+	}
+	else if (Header.RawSize != Header.PayloadSize)
+	{
+		OutError = TEXT("Uncompressed payload size mismatch");
+		return false;
+	}
+
+	const uint64 TableSize = static_cast<uint64>(Header.SectionCount) * FBaselineSectionEntry::SerializedSize;
+	if (TableSize > Header.RawSize)
+	{
+		OutError = TEXT("Section table exceeds payload");
+		return false;
+	}
+
+	FMemoryReaderView TableReader(TArrayView<const uint8>(Raw, Header.RawSize), true);
+	OutBaseline = FPerformanceBaseline();
+
+	bool bHasMeta = false;
+	for (uint32 SectionIndex = 0; SectionIndex < Header.SectionCount; ++SectionIndex)
+	{
+		FBaselineSectionEntry Entry;
+		TableReader << Entry.Id << Entry.Offset << Entry.Size;
+
+		if (static_cast<uint64>(Entry.Offset) + Entry.Size > Header.RawSize || Entry.Offset < TableSize)
+		{
+			OutError = FString::Printf(TEXT("Section %u lies outside the payload"), SectionIndex);
+			return false;
+		}
+
+		FMemoryReaderView SectionReader(TArrayView<const uint8>(Raw + Entry.Offset, Entry.Size), true);
+		bool bSectionOk = true;
+
+		switch (Entry.Id)
+		{
+		case SectionMeta:
+			bSectionOk = ReadMetaSection(SectionReader, OutBaseline);
+			bHasMeta = bSectionOk;
+			break;
+		case SectionSystems:
+			bSectionOk = ReadSystemsSection(SectionReader, OutBaseline);
+			break;
+		case SectionMemory:
+			bSectionOk = ReadMemorySection(SectionReader, OutBaseline);
+			break;
+		case SectionFrameTimes:
+			bSectionOk = ReadFrameTimesSection(SectionReader, OutBaseline);
+			break;
+		case SectionGarbageCollection:
+			bSectionOk = ReadGarbageCollectionSection(SectionReader, OutBaseline);
+			break;
+		default:
+			// Written by a newer build; safe to ignore
+			break;
+		}
+
+		if (!bSectionOk || SectionReader.IsError())
+		{
+			OutError = FString::Printf(TEXT("Section %u (id %08x) is malformed"), SectionIndex, Entry.Id);
+			return false;
+		}
+	}
+
+	if (!bHasMeta)
+	{
+		OutError = TEXT("Baseline has no metadata section");
+		return false;
+	}
+
+	return true;
+}
+
+bool FDelveDeepBaselineSerializer::IsBinaryBaseline(const TArray<uint8>& Bytes)
+{
+	if (Bytes.Num() < static_cast<int32>(sizeof(uint32)))
+	{
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	FMemory::Memcpy(&FileMagic, Bytes.GetData(), sizeof(uint32));
+	return FileMagic == DelveDeepBaselineFormat::Magic;
+}
+
+bool FDelveDeepBaselineSerializer::ExportToJson(const FPerformanceBaseline& Baseline, FString& OutJson)
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+
+	JsonObject->SetStringField(TEXT("BaselineName"), Baseline.BaselineName.ToString());
+	JsonObject->SetStringField(TEXT("CaptureTime"), Baseline.CaptureTime.ToString());
+	JsonObject->SetStringField(TEXT("BuildVersion"), Baseline.BuildVersion);
+	JsonObject->SetStringField(TEXT("MapName"), Baseline.MapName);
+	JsonObject->SetNumberField(TEXT("AverageFPS"), Baseline.AverageFPS);
+	JsonObject->SetNumberField(TEXT("OnePercentLowFPS"), Baseline.OnePercentLowFPS);
+	JsonObject->SetNumberField(TEXT("TotalFramesCaptured"), Baseline.TotalFramesCaptured);
+
+	// Frame data
+	TSharedPtr<FJsonObject> FrameDataObj = MakeShareable(new FJsonObject());
+	FrameDataObj->SetNumberField(TEXT("FrameTimeMs"), Baseline.AverageFrameData.FrameTimeMs);
+	FrameDataObj->SetNumberField(TEXT("GameThreadTimeMs"), Baseline.AverageFrameData.GameThreadTimeMs);
+	FrameDataObj->SetNumberField(TEXT("RenderThreadTimeMs"), Baseline.AverageFrameData.RenderThreadTimeMs);
+	JsonObject->SetObjectField(TEXT("FrameData"), FrameDataObj);
+
+	// System data
+	TArray<TSharedPtr<FJsonValue>> SystemDataArray;
+	for (const auto& Pair : Baseline.SystemData)
+	{
+		TSharedPtr<FJsonObject> SystemObj = MakeShareable(new FJsonObject());
+		SystemObj->SetStringField(TEXT("SystemName"), Pair.Key.ToString());
+		SystemObj->SetNumberField(TEXT("CycleTimeMs"), Pair.Value.CycleTimeMs);
+		SystemObj->SetNumberField(TEXT("BudgetTimeMs"), Pair.Value.BudgetTimeMs);
+		SystemObj->SetNumberField(TEXT("AverageTimeMs"), Pair.Value.AverageTimeMs);
+		SystemObj->SetNumberField(TEXT("PeakTimeMs"), Pair.Value.PeakTimeMs);
+		SystemObj->SetNumberField(TEXT("CallCount"), Pair.Value.CallCount);
+		SystemDataArray.Add(MakeShareable(new FJsonValueObject(SystemObj)));
+	}
+	JsonObject->SetArrayField(TEXT("SystemData"), SystemDataArray);
+
+	// Memory data
+	TSharedPtr<FJsonObject> MemoryObj = MakeShareable(new FJsonObject());
+	MemoryObj->SetNumberField(TEXT("TotalMemory"), static_cast<double>(Baseline.MemoryData.TotalMemory));
+	MemoryObj->SetNumberField(TEXT("NativeMemory"), static_cast<double>(Baseline.MemoryData.NativeMemory));
+	MemoryObj->SetNumberField(TEXT("ManagedMemory"), static_cast<double>(Baseline.MemoryData.ManagedMemory));
+	JsonObject->SetObjectField(TEXT("MemoryData"), MemoryObj);
+
+	// Frame time distribution
+	TArray<TSharedPtr<FJsonValue>> FrameTimeArray;
+	FrameTimeArray.Reserve(Baseline.FrameTimeSamples.Num());
+	for (float Sample : Baseline.FrameTimeSamples)
+	{
+		FrameTimeArray.Add(MakeShareable(new FJsonValueNumber(Sample)));
+	}
+	JsonObject->SetArrayField(TEXT("FrameTimeSamples"), FrameTimeArray);
+
+	// Garbage collection
+	TSharedPtr<FJsonObject> GCObj = MakeShareable(new FJsonObject());
+	GCObj->SetNumberField(TEXT("CollectionCount"), Baseline.GCData.CollectionCount);
+	GCObj->SetNumberField(TEXT("AverageGCTimeMs"), Baseline.GCData.AverageGCTimeMs);
+	GCObj->SetNumberField(TEXT("PeakGCTimeMs"), Baseline.GCData.PeakGCTimeMs);
+	GCObj->SetNumberField(TEXT("SpikeCount"), Baseline.GCData.SpikeCount);
+	GCObj->SetNumberField(TEXT("UObjectCount"), Baseline.GCData.UObjectCount);
+	GCObj->SetNumberField(TEXT("PeakUObjectCount"), Baseline.GCData.PeakUObjectCount);
+	JsonObject->SetObjectField(TEXT("GCData"), GCObj);
+
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutJson);
+	return FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
+}
+
+bool FDelveDeepBaselineSerializer::ImportFromJson(const FString& Json, FPerformanceBaseline& OutBaseline, FString& OutError)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		OutError = TEXT("Failed to parse baseline JSON");
+		return false;
+	}
+
+	OutBaseline = FPerformanceBaseline();
+
+	FString BaselineNameStr;
+	if (JsonObject->TryGetStringField(TEXT("BaselineName"), BaselineNameStr) && !BaselineNameStr.IsEmpty())
+	{
+		OutBaseline.BaselineName = FName(*BaselineNameStr);
+	}
+
+	FString CaptureTimeStr;
+	if (JsonObject->TryGetStringField(TEXT("CaptureTime"), CaptureTimeStr))
+	{
+		FDateTime::Parse(CaptureTimeStr, OutBaseline.CaptureTime);
+	}
+
+	JsonObject->TryGetStringField(TEXT("BuildVersion"), OutBaseline.BuildVersion);
+	JsonObject->TryGetStringField(TEXT("MapName"), OutBaseline.MapName);
+	JsonObject->TryGetNumberField(TEXT("AverageFPS"), OutBaseline.AverageFPS);
+	JsonObject->TryGetNumberField(TEXT("OnePercentLowFPS"), OutBaseline.OnePercentLowFPS);
+	JsonObject->TryGetNumberField(TEXT("TotalFramesCaptured"), OutBaseline.TotalFramesCaptured);
+
+	// Frame data
+	const TSharedPtr<FJsonObject>* FrameDataObj;
+	if (JsonObject->TryGetObjectField(TEXT("FrameData"), FrameDataObj))
+	{
+		(*FrameDataObj)->TryGetNumberField(TEXT("FrameTimeMs"), OutBaseline.AverageFrameData.FrameTimeMs);
+		(*FrameDataObj)->TryGetNumberField(TEXT("GameThreadTimeMs"), OutBaseline.AverageFrameData.GameThreadTimeMs);
+		(*FrameDataObj)->TryGetNumberField(TEXT("RenderThreadTimeMs"), OutBaseline.AverageFrameData.RenderThreadTimeMs);
+	}
+
+	// System data
+	const TArray<TSharedPtr<FJsonValue>>* SystemDataArray;
+	if (JsonObject->TryGetArrayField(TEXT("SystemData"), SystemDataArray))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *SystemDataArray)
+		{
+			const TSharedPtr<FJsonObject>* SystemObj;
+			if (Value->TryGetObject(SystemObj))
+			{
+				FSystemPerformanceData SystemData;
+				FString SystemNameStr;
+				if ((*SystemObj)->TryGetStringField(TEXT("SystemName"), SystemNameStr))
+				{
+					SystemData.SystemName = FName(*SystemNameStr);
+					(*SystemObj)->TryGetNumberField(TEXT("CycleTimeMs"), SystemData.CycleTimeMs);
+					(*SystemObj)->TryGetNumberField(TEXT("BudgetTimeMs"), SystemData.BudgetTimeMs);
+					(*SystemObj)->TryGetNumberField(TEXT("AverageTimeMs"), SystemData.AverageTimeMs);
+					(*SystemObj)->TryGetNumberField(TEXT("PeakTimeMs"), SystemData.PeakTimeMs);
+					(*SystemObj)->TryGetNumberField(TEXT("CallCount"), SystemData.CallCount);
+					OutBaseline.SystemData.Add(SystemData.SystemName, SystemData);
+				}
+			}
+		}
+	}
+
+	// Memory data
+	const TSharedPtr<FJsonObject>* MemoryObj;
+	if (JsonObject->TryGetObjectField(TEXT("MemoryData"), MemoryObj))
+	{
+		double TotalMem, NativeMem, ManagedMem;
+		if ((*MemoryObj)->TryGetNumberField(TEXT("TotalMemory"), TotalMem))
+		{
+			OutBaseline.MemoryData.TotalMemory = static_cast<int64>(TotalMem);
+		}
+		if ((*MemoryObj)->TryGetNumberField(TEXT("NativeMemory"), NativeMem))
+		{
+			OutBaseline.MemoryData.NativeMemory = static_cast<int64>(NativeMem);
+		}
+		if ((*MemoryObj)->TryGetNumberField(TEXT("ManagedMemory"), ManagedMem))
+		{
+			OutBaseline.MemoryData.ManagedMemory = static_cast<int64>(ManagedMem);
+		}
+	}
+
+	// Frame time distribution (absent in baselines saved before it was captured)
+	const TArray<TSharedPtr<FJsonValue>>* FrameTimeArray;
+	if (JsonObject->TryGetArrayField(TEXT("FrameTimeSamples"), FrameTimeArray))
+	{
+		OutBaseline.FrameTimeSamples.Reserve(FrameTimeArray->Num());
+		for (const TSharedPtr<FJsonValue>& Value : *FrameTimeArray)
+		{
+			OutBaseline.FrameTimeSamples.Add(static_cast<float>(Value->AsNumber()));
+		}
+	}
+
+	// Garbage collection (absent in baselines saved before it was tracked)
+	const TSharedPtr<FJsonObject>* GCObj;
+	if (JsonObject->TryGetObjectField(TEXT("GCData"), GCObj))
+	{
+		(*GCObj)->TryGetNumberField(TEXT("CollectionCount"), OutBaseline.GCData.CollectionCount);
+		(*GCObj)->TryGetNumberField(TEXT("AverageGCTimeMs"), OutBaseline.GCData.AverageGCTimeMs);
+		(*GCObj)->TryGetNumberField(TEXT("PeakGCTimeMs"), OutBaseline.GCData.PeakGCTimeMs);
+		(*GCObj)->TryGetNumberField(TEXT("SpikeCount"), OutBaseline.GCData.SpikeCount);
+		(*GCObj)->TryGetNumberField(TEXT("UObjectCount"), OutBaseline.GCData.UObjectCount);
+		(*GCObj)->TryGetNumberField(TEXT("PeakUObjectCount"), OutBaseline.GCData.PeakUObjectCount);
+	}
+
+	return true;
+}
+
+bool FDelveDeepBaselineSerializer::LoadFromFileBytes(const TArray<uint8>& Bytes, FPerformanceBaseline& OutBaseline, FString& OutError)
+{
+	if (IsBinaryBaseline(Bytes))
+	{
+		return LoadFromBytes(Bytes, OutBaseline, OutError);
+	}
+
+	// Anything else is treated as a JSON baseline
+	FString Json;
+	FFileHelper::BufferToString(Json, Bytes.GetData(), Bytes.Num());
+	return ImportFromJson(Json, OutBaseline, OutError);
+}
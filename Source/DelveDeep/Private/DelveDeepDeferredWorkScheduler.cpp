@@ -0,0 +1,377 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepDeferredWorkScheduler.h"
+#include "DelveDeepSystemProfiler.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "DelveDeepTraceRecorder.h"
+#include "HAL/PlatformTime.h"
+
+FDelveDeepDeferredWorkScheduler::FDelveDeepDeferredWorkScheduler()
+	: NextHandle(1)
+	, FrameIndex(0)
+	, LastFrameSpentMs(0.0f)
+	, bExecuting(false)
+{
+}
+
+void FDelveDeepDeferredWorkScheduler::SetSystemBudget(FName SystemName, float BudgetMs)
+{
+	if (SystemName.IsNone() || BudgetMs <= 0.0f)
+	{
+		return;
+	}
+
+	GetOrAddQueue(SystemName).BudgetMs = BudgetMs;
+}
+
+uint64 FDelveDeepDeferredWorkScheduler::SubmitWork(FName SystemName, FName WorkName, EDelveDeepWorkPriority Priority, FWorkFunction Work)
+{
+	if (SystemName.IsNone() || !Work)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning,
+			TEXT("Rejected deferred work '%s': system name and callback are required"), *WorkName.ToString());
+		return 0;
+	}
+
+	FWorkItem Item;
+	Item.Work = MoveTemp(Work);
+	Item.WorkName = WorkName;
+	Item.Handle = NextHandle++;
+	Item.SubmitFrame = FrameIndex;
+	Item.Priority = Priority;
+
+	const uint64 Handle = Item.Handle;
+
+	// Queues must not be reshaped while a queue is being drained
+	if (bExecuting)
+	{
+		IncomingItems.Emplace(SystemName, MoveTemp(Item));
+	}
+	else
+	{
+		GetOrAddQueue(SystemName).Heap.HeapPush(MoveTemp(Item), FWorkItemOrder());
+	}
+
+	return Handle;
+}
+
+bool FDelveDeepDeferredWorkScheduler::CancelWork(uint64 Handle)
+{
+	for (auto& Pair : Queues)
+	{
+		TArray<FWorkItem>& Heap = Pair.Value.Heap;
+		const int32 Index = Heap.IndexOfByPredicate([Handle](const FWorkItem& Item) { return Item.Handle == Handle; });
+		if (Index != INDEX_NONE)
+		{
+			Heap.HeapRemoveAt(Index, FWorkItemOrder(), EAllowShrinking::No);
+			return true;
+		}
+	}
+
+	const int32 IncomingIndex = IncomingItems.IndexOfByPredicate(
+		[Handle](const TPair<FName, FWorkItem>& Pair) { return Pair.Value.Handle == Handle; });
+	if (IncomingIndex != INDEX_NONE)
+	{
+		IncomingItems.RemoveAt(IncomingIndex);
+		return true;
+	}
+
+	return false;
+}
+
+void FDelveDeepDeferredWorkScheduler::ExecuteFrame(const FSystemProfiler* Profiler)
+{
+	FrameIndex++;
+
+	double TotalSpentMs = 0.0;
+	bExecuting = true;
+
+	for (auto& Pair : Queues)
+	{
+		FSystemQueue& Queue = Pair.Value;
+		FDeferredWorkSystemStats& Stats = Queue.Stats;
+		Stats.LastFrameSpentMs = 0.0f;
+		Stats.LastFrameAllowanceMs = 0.0f;
+
+		if (Queue.Heap.Num() == 0)
+		{
+			Stats.CarriedOverItems = 0;
+			Stats.OldestPendingFrames = 0;
+			continue;
+		}
+
+		// Headroom is what the system left unused of its own budget this frame
+		const double MeasuredMs = Profiler ? Profiler->GetSystemData(Pair.Key).CycleTimeMs : 0.0;
+		double AllowanceMs = FMath::Max(0.0, Queue.BudgetMs - MeasuredMs);
+		AllowanceMs = FMath::Min(AllowanceMs, FMath::Max(0.0, MaxFrameSpendMs - TotalSpentMs));
+
+		if (AllowanceMs <= 0.0)
+		{
+			Stats.StarvedFrames++;
+		}
+
+		const double SpentMs = ExecuteQueue(Queue, AllowanceMs);
+		TotalSpentMs += SpentMs;
+
+		Stats.LastFrameSpentMs = static_cast<float>(SpentMs);
+		Stats.LastFrameAllowanceMs = static_cast<float>(AllowanceMs);
+		Stats.CarriedOverItems = Queue.Heap.Num();
+	}
+
+	bExecuting = false;
+	MergeIncomingItems();
+
+	LastFrameSpentMs = static_cast<float>(TotalSpentMs);
+}
+
+double FDelveDeepDeferredWorkScheduler::ExecuteQueue(FSystemQueue& Queue, double AllowanceMs)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	auto ElapsedMs = [StartCycles]()
+	{
+		return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	};
+
+	FDeferredWorkSystemStats& Stats = Queue.Stats;
+
+	// Oldest item decides starvation; priority order alone could leave low-priority work waiting forever
+	int32 OldestIndex = 0;
+	for (int32 i = 1; i < Queue.Heap.Num(); ++i)
+	{
+		if (Queue.Heap[i].SubmitFrame < Queue.Heap[OldestIndex].SubmitFrame)
+		{
+			OldestIndex = i;
+		}
+	}
+
+	const int32 OldestWait = static_cast<int32>(FrameIndex - Queue.Heap[OldestIndex].SubmitFrame);
+	Stats.OldestPendingFrames = OldestWait;
+
+	if (OldestWait >= StarvationFrames)
+	{
+		FWorkItem Item;
+		Item = MoveTemp(Queue.Heap[OldestIndex]);
+		Queue.Heap.HeapRemoveAt(OldestIndex, FWorkItemOrder(), EAllowShrinking::No);
+
+		if (!Item.bCountedStarved)
+		{
+			Item.bCountedStarved = true;
+			Stats.StarvedItems++;
+			UE_LOG(LogDelveDeepTelemetry, Verbose,
+				TEXT("Deferred work '%s' starved for %d frames in system '%s'; forcing a slice"),
+				*Item.WorkName.ToString(), OldestWait, *Stats.SystemName.ToString());
+		}
+
+		Stats.ExecutedSlices++;
+		if (ExecuteSlice(Item))
+		{
+			RecordCompletion(Queue, Item);
+		}
+		else
+		{
+			Queue.Heap.HeapPush(MoveTemp(Item), FWorkItemOrder());
+		}
+	}
+
+	while (Queue.Heap.Num() > 0 && ElapsedMs() < AllowanceMs)
+	{
+		FWorkItem Item;
+		Queue.Heap.HeapPop(Item, FWorkItemOrder(), EAllowShrinking::No);
+
+		Stats.ExecutedSlices++;
+		if (ExecuteSlice(Item))
+		{
+			RecordCompletion(Queue, Item);
+		}
+		else
+		{
+			Queue.Heap.HeapPush(MoveTemp(Item), FWorkItemOrder());
+		}
+	}
+
+	Stats.PendingItems = Queue.Heap.Num();
+	return ElapsedMs();
+}
+
+bool FDelveDeepDeferredWorkScheduler::ExecuteSlice(FWorkItem& Item)
+{
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	if (!Recorder.IsCapturing())
+	{
+		return Item.Work();
+	}
+
+	const uint64 SliceStart = FPlatformTime::Cycles64();
+	const bool bDone = Item.Work();
+	Recorder.RecordSpan(Item.WorkName, TEXT("DeferredWork"), SliceStart, FPlatformTime::Cycles64());
+	return bDone;
+}
+
+void FDelveDeepDeferredWorkScheduler::RecordCompletion(FSystemQueue& Queue, const FWorkItem& Item)
+{
+	FDeferredWorkSystemStats& Stats = Queue.Stats;
+	const int32 WaitFrames = static_cast<int32>(FrameIndex - Item.SubmitFrame);
+
+	Stats.CompletedItems++;
+	Stats.MaxWaitFrames = FMath::Max(Stats.MaxWaitFrames, WaitFrames);
+	Queue.TotalWaitFrames += WaitFrames;
+	Stats.AverageWaitFrames = static_cast<float>(Queue.TotalWaitFrames) / Stats.CompletedItems;
+}
+
+int32 FDelveDeepDeferredWorkScheduler::Flush()
+{
+	// Guard against incremental items that never report completion
+	constexpr int32 MaxSlicesPerItem = 10000;
+
+	int32 Completed = 0;
+	bExecuting = true;
+
+	for (auto& Pair : Queues)
+	{
+		FSystemQueue& Queue = Pair.Value;
+		while (Queue.Heap.Num() > 0)
+		{
+			FWorkItem Item;
+			Queue.Heap.HeapPop(Item, FWorkItemOrder(), EAllowShrinking::No);
+
+			int32 Slices = 0;
+			while (!Item.Work())
+			{
+				if (++Slices >= MaxSlicesPerItem)
+				{
+					UE_LOG(LogDelveDeepTelemetry, Warning,
+						TEXT("Deferred work '%s' did not finish after %d slices during flush; dropping it"),
+						*Item.WorkName.ToString(), MaxSlicesPerItem);
+					break;
+				}
+			}
+
+			Queue.Stats.ExecutedSlices += Slices + 1;
+			RecordCompletion(Queue, Item);
+			Completed++;
+		}
+
+		Queue.Stats.PendingItems = 0;
+		Queue.Stats.CarriedOverItems = 0;
+		Queue.Stats.OldestPendingFrames = 0;
+	}
+
+	bExecuting = false;
+
+	// Work spawned by flushed work is flushed too
+	if (IncomingItems.Num() > 0)
+	{
+		MergeIncomingItems();
+		Completed += Flush();
+	}
+
+	return Completed;
+}
+
+void FDelveDeepDeferredWorkScheduler::Reset()
+{
+	for (auto& Pair : Queues)
+	{
+		Pair.Value.Heap.Empty();
+		Pair.Value.Stats.PendingItems = 0;
+		Pair.Value.Stats.CarriedOverItems = 0;
+		Pair.Value.Stats.OldestPendingFrames = 0;
+	}
+
+	IncomingItems.Empty();
+}
+
+int32 FDelveDeepDeferredWorkScheduler::GetPendingCount(FName SystemName) const
+{
+	int32 Count = 0;
+	for (const auto& Pair : Queues)
+	{
+		if (SystemName.IsNone() || Pair.Key == SystemName)
+		{
+			Count += Pair.Value.Heap.Num();
+		}
+	}
+
+	for (const TPair<FName, FWorkItem>& Pair : IncomingItems)
+	{
+		if (SystemName.IsNone() || Pair.Key == SystemName)
+		{
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+FDeferredWorkSystemStats FDelveDeepDeferredWorkScheduler::GetSystemStats(FName SystemName) const
+{
+	const FSystemQueue* Queue = Queues.Find(SystemName);
+	if (!Queue)
+	{
+		FDeferredWorkSystemStats Empty;
+		Empty.SystemName = SystemName;
+		return Empty;
+	}
+
+	FDeferredWorkSystemStats Stats = Queue->Stats;
+	Stats.PendingItems = Queue->Heap.Num();
+	return Stats;
+}
+
+TArray<FDeferredWorkSystemStats> FDelveDeepDeferredWorkScheduler::GetAllSystemStats() const
+{
+	TArray<FDeferredWorkSystemStats> AllStats;
+	AllStats.Reserve(Queues.Num());
+
+	for (const auto& Pair : Queues)
+	{
+		// Systems with a budget but no work ever submitted are not interesting
+		if (Pair.Value.Heap.Num() == 0 && Pair.Value.Stats.ExecutedSlices == 0)
+		{
+			continue;
+		}
+
+		FDeferredWorkSystemStats& Stats = AllStats.Add_GetRef(Pair.Value.Stats);
+		Stats.PendingItems = Pair.Value.Heap.Num();
+	}
+
+	AllStats.Sort([](const FDeferredWorkSystemStats& A, const FDeferredWorkSystemStats& B)
+	{
+		return A.PendingItems > B.PendingItems;
+	});
+
+	return AllStats;
+}
+
+void FDelveDeepDeferredWorkScheduler::ResetStatistics()
+{
+	for (auto& Pair : Queues)
+	{
+		FSystemQueue& Queue = Pair.Value;
+		const FName SystemName = Queue.Stats.SystemName;
+		Queue.Stats = FDeferredWorkSystemStats();
+		Queue.Stats.SystemName = SystemName;
+		Queue.Stats.PendingItems = Queue.Heap.Num();
+		Queue.TotalWaitFrames = 0;
+	}
+
+	LastFrameSpentMs = 0.0f;
+}
+
+FDelveDeepDeferredWorkScheduler::FSystemQueue& FDelveDeepDeferredWorkScheduler::GetOrAddQueue(FName SystemName)
+{
+	FSystemQueue& Queue = Queues.FindOrAdd(SystemName);
+	Queue.Stats.SystemName = SystemName;
+	return Queue;
+}
+
+void FDelveDeepDeferredWorkScheduler::MergeIncomingItems()
+{
+	TArray<TPair<FName, FWorkItem>> Items = MoveTemp(IncomingItems);
+	IncomingItems.Reset();
+
+	for (TPair<FName, FWorkItem>& Pair : Items)
+	{
+		GetOrAddQueue(Pair.Key).Heap.HeapPush(MoveTemp(Pair.Value), FWorkItemOrder());
+	}
+}
@@ -0,0 +1,223 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepEntityLimitController.h"
+#include "DelveDeepSystemProfiler.h"
+#include "DelveDeepGameplayMetrics.h"
+#include "DelveDeepTelemetrySubsystem.h"
+
+FDelveDeepEntityLimitController::FDelveDeepEntityLimitController()
+	: TargetFrameTimeMs(16.67f)
+	, SmoothedFrameTimeMs(0.0f)
+	, FrameCounter(0)
+{
+	InitializeDefaultTypes();
+}
+
+void FDelveDeepEntityLimitController::ConfigureEntityType(FName EntityType, FName CostSystem, int32 MinLimit, int32 MaxLimit)
+{
+	if (EntityType.IsNone())
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Attempted to configure adaptive limit with empty entity type"));
+		return;
+	}
+
+	if (MinLimit < 0 || MaxLimit <= 0 || MinLimit > MaxLimit)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning,
+			TEXT("Invalid adaptive limit range for '%s': %d-%d (need 0 <= Min <= Max, Max > 0)"),
+			*EntityType.ToString(), MinLimit, MaxLimit);
+		return;
+	}
+
+	FAdaptiveEntityLimit& Limit = Limits.FindOrAdd(EntityType);
+	Limit.EntityType = EntityType;
+	Limit.CostSystem = CostSystem;
+	Limit.MinLimit = MinLimit;
+	Limit.MaxLimit = MaxLimit;
+	Limit.CurrentLimit = MaxLimit;
+	Limit.CostPerEntityMs = 0.0f;
+
+	UE_LOG(LogDelveDeepTelemetry, Verbose,
+		TEXT("Configured adaptive limit '%s': %d-%d (cost system '%s')"),
+		*EntityType.ToString(), MinLimit, MaxLimit, *CostSystem.ToString());
+}
+
+void FDelveDeepEntityLimitController::SetTargetFrameTime(float BudgetMs)
+{
+	if (BudgetMs <= 0.0f)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning,
+			TEXT("Invalid target frame time for adaptive limits: %.2fms (must be positive)"), BudgetMs);
+		return;
+	}
+
+	TargetFrameTimeMs = BudgetMs;
+}
+
+void FDelveDeepEntityLimitController::Update(float DeltaTime, const FSystemProfiler& Profiler, const FDelveDeepGameplayMetrics& Metrics)
+{
+	const float FrameTimeMs = FMath::Min(DeltaTime * 1000.0f, MaxSampledFrameTimeMs);
+	SmoothedFrameTimeMs = SmoothedFrameTimeMs > 0.0f
+		? FMath::Lerp(SmoothedFrameTimeMs, FrameTimeMs, FrameTimeSmoothing)
+		: FrameTimeMs;
+
+	FrameCounter++;
+
+	// Only adjust every UpdateInterval frames so a cap change has time to show up in frame time
+	if (FrameCounter % UpdateInterval != 0)
+	{
+		return;
+	}
+
+	UpdateCostEstimates(Profiler, Metrics);
+
+	const float HysteresisMs = TargetFrameTimeMs * HysteresisFraction;
+	if (SmoothedFrameTimeMs > TargetFrameTimeMs)
+	{
+		ShrinkLimits(SmoothedFrameTimeMs - TargetFrameTimeMs, Metrics);
+	}
+	else if (SmoothedFrameTimeMs < TargetFrameTimeMs - HysteresisMs)
+	{
+		GrowLimits(TargetFrameTimeMs - HysteresisMs - SmoothedFrameTimeMs);
+	}
+}
+
+bool FDelveDeepEntityLimitController::CanSpawn(FName EntityType, int32 CurrentCount, int32 Count) const
+{
+	const FAdaptiveEntityLimit* Limit = Limits.Find(EntityType);
+	if (!Limit)
+	{
+		return true;
+	}
+
+	return CurrentCount + Count <= Limit->CurrentLimit;
+}
+
+void FDelveDeepEntityLimitController::RecordDeniedSpawn(FName EntityType)
+{
+	if (FAdaptiveEntityLimit* Limit = Limits.Find(EntityType))
+	{
+		Limit->DeniedSpawns++;
+	}
+}
+
+int32 FDelveDeepEntityLimitController::GetLimit(FName EntityType) const
+{
+	const FAdaptiveEntityLimit* Limit = Limits.Find(EntityType);
+	return Limit ? Limit->CurrentLimit : 0;
+}
+
+void FDelveDeepEntityLimitController::Reset()
+{
+	for (auto& Pair : Limits)
+	{
+		Pair.Value.CurrentLimit = Pair.Value.MaxLimit;
+		Pair.Value.CostPerEntityMs = 0.0f;
+		Pair.Value.DeniedSpawns = 0;
+	}
+
+	SmoothedFrameTimeMs = 0.0f;
+	FrameCounter = 0;
+}
+
+void FDelveDeepEntityLimitController::UpdateCostEstimates(const FSystemProfiler& Profiler, const FDelveDeepGameplayMetrics& Metrics)
+{
+	for (auto& Pair : Limits)
+	{
+		FAdaptiveEntityLimit& Limit = Pair.Value;
+		const int32 Count = Metrics.GetEntityCount(Limit.EntityType);
+		if (Count <= 0 || Limit.CostSystem.IsNone())
+		{
+			continue;
+		}
+
+		const double SystemTimeMs = Profiler.GetSystemData(Limit.CostSystem).AverageTimeMs;
+		if (SystemTimeMs <= 0.0)
+		{
+			continue;
+		}
+
+		const float Sample = static_cast<float>(SystemTimeMs / Count);
+		Limit.CostPerEntityMs = Limit.CostPerEntityMs > 0.0f
+			? FMath::Lerp(Limit.CostPerEntityMs, Sample, CostSmoothing)
+			: Sample;
+	}
+}
+
+void FDelveDeepEntityLimitController::ShrinkLimits(float OverageMs, const FDelveDeepGameplayMetrics& Metrics)
+{
+	// Split the overage by each type's share of measured cost
+	float TotalCostMs = 0.0f;
+	for (const auto& Pair : Limits)
+	{
+		TotalCostMs += Pair.Value.CostPerEntityMs * Metrics.GetEntityCount(Pair.Key);
+	}
+
+	for (auto& Pair : Limits)
+	{
+		FAdaptiveEntityLimit& Limit = Pair.Value;
+		const int32 Count = Metrics.GetEntityCount(Limit.EntityType);
+
+		// Cut from the live population when it is below the cap, so new spawns stop immediately
+		const int32 Base = Count > 0 ? FMath::Min(Limit.CurrentLimit, Count) : Limit.CurrentLimit;
+
+		int32 NewLimit;
+		if (Limit.CostPerEntityMs > 0.0f && TotalCostMs > 0.0f)
+		{
+			const float ShareMs = OverageMs * (Limit.CostPerEntityMs * Count) / TotalCostMs;
+			NewLimit = Base - FMath::CeilToInt(ShareMs / Limit.CostPerEntityMs);
+		}
+		else
+		{
+			NewLimit = FMath::FloorToInt(Base * FallbackDecreaseFactor);
+		}
+
+		NewLimit = FMath::Clamp(NewLimit, Limit.MinLimit, Limit.MaxLimit);
+		if (NewLimit < Limit.CurrentLimit)
+		{
+			UE_LOG(LogDelveDeepTelemetry, Verbose,
+				TEXT("Adaptive limit '%s' lowered %d -> %d (frame %.2fms / target %.2fms)"),
+				*Limit.EntityType.ToString(), Limit.CurrentLimit, NewLimit, SmoothedFrameTimeMs, TargetFrameTimeMs);
+			Limit.CurrentLimit = NewLimit;
+		}
+	}
+}
+
+void FDelveDeepEntityLimitController::GrowLimits(float HeadroomMs)
+{
+	if (Limits.Num() == 0)
+	{
+		return;
+	}
+
+	const float HeadroomPerTypeMs = (HeadroomMs * GrowthHeadroomFraction) / Limits.Num();
+
+	for (auto& Pair : Limits)
+	{
+		FAdaptiveEntityLimit& Limit = Pair.Value;
+		if (Limit.CurrentLimit >= Limit.MaxLimit)
+		{
+			continue;
+		}
+
+		int32 Growth = FMath::Max(1, FMath::CeilToInt(Limit.MaxLimit * MaxGrowthStepFraction));
+		if (Limit.CostPerEntityMs > 0.0f)
+		{
+			Growth = FMath::Min(Growth, FMath::FloorToInt(HeadroomPerTypeMs / Limit.CostPerEntityMs));
+		}
+
+		if (Growth > 0)
+		{
+			Limit.CurrentLimit = FMath::Min(Limit.CurrentLimit + Growth, Limit.MaxLimit);
+		}
+	}
+}
+
+void FDelveDeepEntityLimitController::InitializeDefaultTypes()
+{
+	// Ceilings match FDelveDeepGameplayMetrics recommended limits; floors keep waves playable
+	ConfigureEntityType(TEXT("Monsters"), TEXT("AI"), 20, 100);
+	ConfigureEntityType(TEXT("Projectiles"), TEXT("CollisionDetection"), 50, 200);
+	ConfigureEntityType(TEXT("Particles"), TEXT("World"), 100, 500);
+	ConfigureEntityType(TEXT("Characters"), TEXT("Combat"), 4, 64);
+}
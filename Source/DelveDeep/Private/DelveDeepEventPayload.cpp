@@ -208,6 +208,32 @@ bool FDelveDeepEventPayload::ValidateRange(float Value, float MinValue, float Ma
 	return true;
 }
 
+bool FDelveDeepDamageBatchEventPayload::Validate(FDelveDeepValidationContext& Context) const
+{
+	bool bIsValid = FDelveDeepEventPayload::Validate(Context);
+
+	if (Victims.Num() != DamageAmounts.Num())
+	{
+		Context.AddError(FString::Printf(
+			TEXT("Victims (%d) and DamageAmounts (%d) differ in length"), Victims.Num(), DamageAmounts.Num()));
+		bIsValid = false;
+	}
+
+	if (TotalDamage < 0.0f)
+	{
+		Context.AddError(FString::Printf(TEXT("Total damage is negative: %.2f"), TotalDamage));
+		bIsValid = false;
+	}
+
+	if (Killed.Num() > Victims.Num())
+	{
+		Context.AddWarning(FString::Printf(
+			TEXT("More kills (%d) than victims (%d)"), Killed.Num(), Victims.Num()));
+	}
+
+	return bIsValid;
+}
+
 bool FDelveDeepCharacterDeathEventPayload::Validate(FDelveDeepValidationContext& Context) const
 {
 	bool bIsValid = Super::Validate(Context);
@@ -2,6 +2,8 @@
 
 #include "DelveDeepEventSubsystem.h"
 #include "DelveDeepEventCommands.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "Engine/GameInstance.h"
 #include "Stats/Stats.h"
 
 DEFINE_LOG_CATEGORY(LogDelveDeepEvents);
@@ -316,6 +318,36 @@ void UDelveDeepEventSubsystem::CleanupStaleListeners()
 	}
 }
 
+void UDelveDeepEventSubsystem::QueueStaleListenerCleanup()
+{
+	if (bStaleListenerCleanupQueued)
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = GetGameInstance();
+	UDelveDeepTelemetrySubsystem* Telemetry = GameInstance ? GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>() : nullptr;
+	if (!Telemetry)
+	{
+		CleanupStaleListeners();
+		return;
+	}
+
+	TWeakObjectPtr<UDelveDeepEventSubsystem> WeakThis(this);
+	const uint64 Handle = Telemetry->SubmitDeferredWork(TEXT("Events"), TEXT("StaleListenerCleanup"), EDelveDeepWorkPriority::Low,
+		[WeakThis]()
+		{
+			if (UDelveDeepEventSubsystem* EventSubsystem = WeakThis.Get())
+			{
+				EventSubsystem->CleanupStaleListeners();
+				EventSubsystem->bStaleListenerCleanupQueued = false;
+			}
+			return true;
+		});
+
+	bStaleListenerCleanupQueued = Handle != 0;
+}
+
 void UDelveDeepEventSubsystem::RemoveListenerFromArray(
 	TArray<FDelveDeepEventListener>& ListenerArray,
 	int32 Index,
@@ -399,6 +431,7 @@ void UDelveDeepEventSubsystem::DisableDeferredMode()
 void UDelveDeepEventSubsystem::ProcessDeferredEvents()
 {
 	SCOPE_CYCLE_COUNTER(STAT_ProcessDeferred);
+	TRACE_DELVEDEEP_EVENT_PROCESS();
 
 	if (DeferredEventQueue.Num() == 0)
 	{
@@ -447,6 +480,7 @@ void UDelveDeepEventSubsystem::ProcessDeferredEvents()
 void UDelveDeepEventSubsystem::BroadcastEventImmediate(const FDelveDeepEventPayload& Payload)
 {
 	SCOPE_CYCLE_COUNTER(STAT_BroadcastEvent);
+	TRACE_DELVEDEEP_EVENT_BROADCAST();
 	INC_DWORD_STAT(STAT_EventsPerFrame);
 
 	const double BroadcastStartTime = FPlatformTime::Seconds();
@@ -494,6 +528,7 @@ void UDelveDeepEventSubsystem::BroadcastEventImmediate(const FDelveDeepEventPayl
 	}
 
 	int32 TotalListenersInvoked = 0;
+	bool bFoundStaleListener = false;
 
 	// Broadcast to all matching tags
 	for (const FGameplayTag& Tag : MatchingTags)
@@ -523,6 +558,7 @@ void UDelveDeepEventSubsystem::BroadcastEventImmediate(const FDelveDeepEventPayl
 				// Check if owner is still valid
 				if (!Listener.IsOwnerValid())
 				{
+					bFoundStaleListener = true;
 					continue;
 				}
 
@@ -577,6 +613,12 @@ void UDelveDeepEventSubsystem::BroadcastEventImmediate(const FDelveDeepEventPayl
 		}
 	}
 
+	// Stale listeners are removed later, inside the Events budget, instead of mid-broadcast
+	if (bFoundStaleListener)
+	{
+		QueueStaleListenerCleanup();
+	}
+
 	// Record broadcast metrics
 	const double BroadcastEndTime = FPlatformTime::Seconds();
 	const double BroadcastDuration = BroadcastEndTime - BroadcastStartTime;
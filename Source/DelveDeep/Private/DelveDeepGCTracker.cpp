@@ -0,0 +1,409 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepGCTracker.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "DelveDeepTraceRecorder.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace DelveDeepGCTracker
+{
+	/** Package native DelveDeep classes live in */
+	const FName ModulePackageName(TEXT("/Script/DelveDeep"));
+
+	int32 GetLiveObjectCount()
+	{
+		return GUObjectArray.GetObjectArrayNumMinusAvailable();
+	}
+}
+
+FDelveDeepGCTracker::FDelveDeepGCTracker()
+	: TotalDestroyed(0)
+{
+	RecentEvents.Reserve(MaxRecentEvents);
+}
+
+FDelveDeepGCTracker::~FDelveDeepGCTracker()
+{
+	StopTracking();
+}
+
+void FDelveDeepGCTracker::StartTracking()
+{
+	if (bTracking)
+	{
+		return;
+	}
+
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FDelveDeepGCTracker::HandlePreGarbageCollect);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FDelveDeepGCTracker::HandlePostGarbageCollect);
+	PostPurgeHandle = FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().AddRaw(this, &FDelveDeepGCTracker::HandlePostPurgeGarbage);
+	GUObjectArray.AddUObjectCreateListener(this);
+	GUObjectArray.AddUObjectDeleteListener(this);
+
+	TrackingStartSeconds = FPlatformTime::Seconds();
+	LastFrameDestroyed = TotalDestroyed.Load();
+	bTracking = true;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("GC and UObject churn tracking started (%d live objects)"),
+		DelveDeepGCTracker::GetLiveObjectCount());
+}
+
+void FDelveDeepGCTracker::StopTracking()
+{
+	if (!bTracking)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+	FCoreUObjectDelegates::GetPostPurgeGarbageDelegate().Remove(PostPurgeHandle);
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+
+	// A collection still purging is recorded with what it has destroyed so far
+	if (CollectStartCycles != 0)
+	{
+		SettleCollection();
+	}
+
+	{
+		FScopeLock Lock(&CriticalSection);
+		TrackedObjects.Empty();
+		ClassFilterCache.Empty();
+	}
+
+	bTracking = false;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("GC and UObject churn tracking stopped"));
+}
+
+void FDelveDeepGCTracker::SetTrackAllClasses(bool bTrackAll)
+{
+	FScopeLock Lock(&CriticalSection);
+	bTrackAllClasses = bTrackAll;
+	ClassFilterCache.Reset();
+}
+
+void FDelveDeepGCTracker::UpdateFrame()
+{
+	const int32 Destroyed = TotalDestroyed.Load();
+
+	FScopeLock Lock(&CriticalSection);
+
+	Stats.FrameGCTimeMs = PendingFrameGCTimeMs;
+	Stats.FrameObjectsDestroyed = Destroyed - LastFrameDestroyed;
+	Stats.UObjectCount = DelveDeepGCTracker::GetLiveObjectCount();
+	Stats.PeakUObjectCount = FMath::Max(Stats.PeakUObjectCount, Stats.UObjectCount);
+
+	PendingFrameGCTimeMs = 0.0f;
+	LastFrameDestroyed = Destroyed;
+}
+
+FDelveDeepGCStats FDelveDeepGCTracker::GetStats() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return Stats;
+}
+
+TArray<FDelveDeepGCEvent> FDelveDeepGCTracker::GetRecentCollections() const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	TArray<FDelveDeepGCEvent> Events;
+	Events.Reserve(RecentEvents.Num());
+	for (int32 i = 0; i < RecentEvents.Num(); ++i)
+	{
+		Events.Add(RecentEvents[(RecentEventsHead + i) % RecentEvents.Num()]);
+	}
+	return Events;
+}
+
+TArray<FDelveDeepClassChurn> FDelveDeepGCTracker::GetClassChurn(int32 MaxClasses) const
+{
+	TArray<FDelveDeepClassChurn> Churn;
+	{
+		FScopeLock Lock(&CriticalSection);
+		Churn.Reserve(ClassCounters.Num());
+		for (const auto& Pair : ClassCounters)
+		{
+			FDelveDeepClassChurn& Entry = Churn.AddDefaulted_GetRef();
+			Entry.ClassName = Pair.Key;
+			Entry.Spawned = Pair.Value.Spawned;
+			Entry.Destroyed = Pair.Value.Destroyed;
+			Entry.Live = Pair.Value.Live;
+			Entry.PeakLive = Pair.Value.PeakLive;
+		}
+	}
+
+	Churn.Sort([](const FDelveDeepClassChurn& A, const FDelveDeepClassChurn& B)
+	{
+		return A.Destroyed != B.Destroyed ? A.Destroyed > B.Destroyed : A.Spawned > B.Spawned;
+	});
+
+	if (MaxClasses > 0 && Churn.Num() > MaxClasses)
+	{
+		Churn.SetNum(MaxClasses);
+	}
+
+	return Churn;
+}
+
+TArray<FDelveDeepPoolingRecommendation> FDelveDeepGCTracker::GetPoolingRecommendations(float MinDestroysPerMinute) const
+{
+	// Rates over less than a few seconds are noise
+	const double Minutes = FMath::Max((FPlatformTime::Seconds() - TrackingStartSeconds) / 60.0, 0.1);
+
+	TArray<FDelveDeepPoolingRecommendation> Recommendations;
+	for (const FDelveDeepClassChurn& Churn : GetClassChurn())
+	{
+		const float DestroysPerMinute = static_cast<float>(Churn.Destroyed / Minutes);
+		if (DestroysPerMinute < MinDestroysPerMinute || Churn.PeakLive <= 0)
+		{
+			continue;
+		}
+
+		FDelveDeepPoolingRecommendation& Recommendation = Recommendations.AddDefaulted_GetRef();
+		Recommendation.ClassName = Churn.ClassName;
+		Recommendation.DestroysPerMinute = DestroysPerMinute;
+		Recommendation.SuggestedPoolSize = Churn.PeakLive;
+		Recommendation.Reason = FString::Printf(
+			TEXT("%d spawned, %d destroyed (%.0f/min); at most %d alive at once, so a pool of %d would avoid %.0f%% of allocations"),
+			Churn.Spawned, Churn.Destroyed, DestroysPerMinute, Churn.PeakLive, Churn.PeakLive,
+			Churn.Spawned > 0 ? 100.0f * (Churn.Spawned - FMath::Min(Churn.Spawned, Churn.PeakLive)) / Churn.Spawned : 0.0f);
+	}
+
+	Recommendations.Sort([](const FDelveDeepPoolingRecommendation& A, const FDelveDeepPoolingRecommendation& B)
+	{
+		return A.DestroysPerMinute > B.DestroysPerMinute;
+	});
+
+	return Recommendations;
+}
+
+void FDelveDeepGCTracker::ResetStatistics()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	Stats = FDelveDeepGCStats();
+	TotalGCTimeMs = 0.0;
+	PendingFrameGCTimeMs = 0.0f;
+	RecentEvents.Reset();
+	RecentEventsHead = 0;
+	LastFrameDestroyed = TotalDestroyed.Load();
+	TrackingStartSeconds = FPlatformTime::Seconds();
+
+	// Objects still alive stay tracked; their counters restart from the live count
+	for (auto& Pair : ClassCounters)
+	{
+		Pair.Value.Spawned = 0;
+		Pair.Value.Destroyed = 0;
+		Pair.Value.PeakLive = Pair.Value.Live;
+	}
+}
+
+void FDelveDeepGCTracker::RecordCollection(float DurationMs, int32 ObjectsBefore, int32 ObjectsPurged)
+{
+	FDelveDeepGCEvent Event;
+	Event.FrameNumber = static_cast<int64>(GFrameCounter);
+	Event.DurationMs = DurationMs;
+	Event.ObjectsBefore = ObjectsBefore;
+	Event.ObjectsPurged = ObjectsPurged;
+	Event.Timestamp = FDateTime::Now();
+
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		if (RecentEvents.Num() < MaxRecentEvents)
+		{
+			RecentEvents.Add(Event);
+		}
+		else
+		{
+			RecentEvents[RecentEventsHead] = Event;
+			RecentEventsHead = (RecentEventsHead + 1) % MaxRecentEvents;
+		}
+
+		Stats.CollectionCount++;
+		TotalGCTimeMs += DurationMs;
+		Stats.AverageGCTimeMs = static_cast<float>(TotalGCTimeMs / Stats.CollectionCount);
+		Stats.PeakGCTimeMs = FMath::Max(Stats.PeakGCTimeMs, DurationMs);
+		Stats.LastGCTimeMs = DurationMs;
+		Stats.LastObjectsPurged = ObjectsPurged;
+		PendingFrameGCTimeMs += DurationMs;
+
+		if (DurationMs > SpikeThresholdMs)
+		{
+			Stats.SpikeCount++;
+		}
+	}
+
+	if (DurationMs > SpikeThresholdMs)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning,
+			TEXT("GC spike: %.2fms, %d of %d objects purged (frame %lld)"),
+			DurationMs, ObjectsPurged, ObjectsBefore, Event.FrameNumber);
+	}
+}
+
+void FDelveDeepGCTracker::RecordSpawn(int32 ObjectIndex, FName ClassName)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	TrackedObjects.Add(ObjectIndex, ClassName);
+
+	FClassCounters& Counters = ClassCounters.FindOrAdd(ClassName);
+	Counters.Spawned++;
+	Counters.Live++;
+	Counters.PeakLive = FMath::Max(Counters.PeakLive, Counters.Live);
+}
+
+void FDelveDeepGCTracker::RecordDestroy(int32 ObjectIndex)
+{
+	TotalDestroyed.IncrementExchange();
+
+	FScopeLock Lock(&CriticalSection);
+
+	// Looked up by index: the object's class may already be gone during purge
+	FName ClassName;
+	if (TrackedObjects.RemoveAndCopyValue(ObjectIndex, ClassName))
+	{
+		if (FClassCounters* Counters = ClassCounters.Find(ClassName))
+		{
+			Counters->Destroyed++;
+			Counters->Live = FMath::Max(0, Counters->Live - 1);
+		}
+	}
+}
+
+void FDelveDeepGCTracker::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	const UClass* Class = Object ? Object->GetClass() : nullptr;
+	if (!Class)
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (!ShouldTrackClassLocked(Class))
+		{
+			return;
+		}
+	}
+
+	RecordSpawn(Index, Class->GetFName());
+}
+
+void FDelveDeepGCTracker::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	RecordDestroy(Index);
+}
+
+void FDelveDeepGCTracker::OnUObjectArrayShutdown()
+{
+	GUObjectArray.RemoveUObjectCreateListener(this);
+	GUObjectArray.RemoveUObjectDeleteListener(this);
+}
+
+bool FDelveDeepGCTracker::ShouldTrackClassLocked(const UClass* Class)
+{
+	if (bTrackAllClasses)
+	{
+		return true;
+	}
+
+	if (const bool* Cached = ClassFilterCache.Find(Class))
+	{
+		return *Cached;
+	}
+
+	// Blueprint classes count when a native ancestor belongs to DelveDeep
+	bool bTrack = false;
+	for (const UClass* Current = Class; Current; Current = Current->GetSuperClass())
+	{
+		if (Current->HasAnyClassFlags(CLASS_Native))
+		{
+			bTrack = Current->GetOutermost()->GetFName() == DelveDeepGCTracker::ModulePackageName;
+			break;
+		}
+	}
+
+	ClassFilterCache.Add(Class, bTrack);
+	return bTrack;
+}
+
+void FDelveDeepGCTracker::HandlePreGarbageCollect()
+{
+	// The engine finishes a pending purge before collecting again; settle defensively if it did not report it
+	if (CollectStartCycles != 0)
+	{
+		SettleCollection();
+	}
+
+	CollectStartCycles = FPlatformTime::Cycles64();
+	CollectEndCycles = 0;
+	bCollectPurged = false;
+	CollectObjectsBefore = DelveDeepGCTracker::GetLiveObjectCount();
+	CollectDestroyedBefore = TotalDestroyed.Load();
+}
+
+void FDelveDeepGCTracker::HandlePostGarbageCollect()
+{
+	if (CollectStartCycles == 0)
+	{
+		return;
+	}
+
+	CollectEndCycles = FPlatformTime::Cycles64();
+
+	// A full purge has already run; an incremental one destroys objects over the next frames
+	if (bCollectPurged)
+	{
+		SettleCollection();
+	}
+}
+
+void FDelveDeepGCTracker::HandlePostPurgeGarbage()
+{
+	if (CollectStartCycles == 0)
+	{
+		return;
+	}
+
+	bCollectPurged = true;
+	if (CollectEndCycles != 0)
+	{
+		SettleCollection();
+	}
+}
+
+void FDelveDeepGCTracker::SettleCollection()
+{
+	const uint64 EndCycles = CollectEndCycles != 0 ? CollectEndCycles : FPlatformTime::Cycles64();
+	const float DurationMs = static_cast<float>(FPlatformTime::ToMilliseconds64(EndCycles - CollectStartCycles));
+	const int32 Purged = TotalDestroyed.Load() - CollectDestroyedBefore;
+
+	RecordCollection(DurationMs, CollectObjectsBefore, Purged);
+
+	// Classes may have been unloaded; their addresses can be reused
+	{
+		FScopeLock Lock(&CriticalSection);
+		ClassFilterCache.Reset();
+	}
+
+	// GC pauses show on the timeline next to the frame they stalled
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	if (Recorder.IsCapturing())
+	{
+		static const FName GCSpanName(TEXT("GarbageCollect"));
+		Recorder.RecordSpan(GCSpanName, TEXT("GC"), CollectStartCycles, EndCycles, FString::Printf(TEXT("%d purged"), Purged));
+	}
+
+	CollectStartCycles = 0;
+	CollectEndCycles = 0;
+	bCollectPurged = false;
+}
@@ -55,6 +55,41 @@ int32 FDelveDeepGameplayMetrics::GetRecommendedLimit(FName EntityType) const
 	return Limit ? *Limit : 0;
 }
 
+void FDelveDeepGameplayMetrics::RecordPoolAcquire(FName PoolName, bool bHit, int32 AvailableCount)
+{
+	FDelveDeepActorPoolStats& Stats = PoolStats.FindOrAdd(PoolName);
+	Stats.PoolName = PoolName;
+	Stats.AvailableCount = AvailableCount;
+
+	if (bHit)
+	{
+		++Stats.Hits;
+	}
+	else
+	{
+		++Stats.Misses;
+	}
+}
+
+void FDelveDeepGameplayMetrics::RecordPoolRelease(FName PoolName, int32 AvailableCount)
+{
+	FDelveDeepActorPoolStats& Stats = PoolStats.FindOrAdd(PoolName);
+	Stats.PoolName = PoolName;
+	Stats.AvailableCount = AvailableCount;
+}
+
+FDelveDeepActorPoolStats FDelveDeepGameplayMetrics::GetPoolStats(FName PoolName) const
+{
+	if (const FDelveDeepActorPoolStats* Stats = PoolStats.Find(PoolName))
+	{
+		return *Stats;
+	}
+
+	FDelveDeepActorPoolStats Empty;
+	Empty.PoolName = PoolName;
+	return Empty;
+}
+
 void FDelveDeepGameplayMetrics::ResetStatistics()
 {
 	for (auto& Pair : EntityCounts)
@@ -62,6 +97,13 @@ void FDelveDeepGameplayMetrics::ResetStatistics()
 		Pair.Value.Reset();
 	}
 
+	// Keep the available counts; they describe pools that still exist
+	for (auto& Pair : PoolStats)
+	{
+		Pair.Value.Hits = 0;
+		Pair.Value.Misses = 0;
+	}
+
 	FrameCounter = 0;
 
 	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Gameplay metrics statistics reset"));
@@ -91,6 +133,7 @@ void FDelveDeepGameplayMetrics::InitializeRecommendedLimits()
 	RecommendedLimits.Add(TEXT("Pickups"), 100);
 	RecommendedLimits.Add(TEXT("Traps"), 50);
 	RecommendedLimits.Add(TEXT("Hazards"), 50);
+	RecommendedLimits.Add(TEXT("Characters"), 64);
 
 	UE_LOG(LogDelveDeepTelemetry, Verbose,
 		TEXT("Initialized %d entity type recommended limits"), RecommendedLimits.Num());
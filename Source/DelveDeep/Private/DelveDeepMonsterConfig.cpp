@@ -129,6 +129,19 @@ bool FDelveDeepMonsterConfig::Validate(FDelveDeepValidationContext& Context) con
 		bIsValid = false;
 	}
 	
+	// Validate pool size
+	if (PoolSize < 0)
+	{
+		Context.AddError(FString::Printf(
+			TEXT("PoolSize cannot be negative (current value: %d)"), PoolSize));
+		bIsValid = false;
+	}
+	else if (PoolSize > 256)
+	{
+		Context.AddWarning(FString::Printf(
+			TEXT("PoolSize is unusually large (current value: %d, expected 0-256)"), PoolSize));
+	}
+	
 	// Validate display information
 	if (MonsterName.IsEmpty())
 	{
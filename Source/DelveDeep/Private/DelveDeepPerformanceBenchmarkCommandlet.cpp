@@ -0,0 +1,387 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepPerformanceBenchmarkCommandlet.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "DelveDeepEventSubsystem.h"
+#include "DelveDeepEventPayload.h"
+#include "Character/DelveDeepCharacter.h"
+#include "Character/DelveDeepWarrior.h"
+#include "Character/DelveDeepRanger.h"
+#include "Character/DelveDeepMage.h"
+#include "Character/DelveDeepNecromancer.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepBenchmark, Log, All);
+
+UDelveDeepPerformanceBenchmarkCommandlet::UDelveDeepPerformanceBenchmarkCommandlet()
+	: GameInstance(nullptr)
+	, Telemetry(nullptr)
+	, EventSubsystem(nullptr)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UDelveDeepPerformanceBenchmarkCommandlet::Main(const FString& Params)
+{
+	ParseSettings(Params, Settings);
+	RandomStream.Initialize(Settings.Seed);
+
+	UE_LOG(LogDelveDeepBenchmark, Display,
+		TEXT("Starting headless benchmark '%s': Map=%s, Characters=%d, Monsters=%d, Frames=%d (+%d warmup)"),
+		*Settings.BaselineName.ToString(),
+		Settings.MapName.IsEmpty() ? TEXT("<blank>") : *Settings.MapName,
+		Settings.NumCharacters, Settings.NumMonsters, Settings.CaptureFrames, Settings.WarmupFrames);
+
+	UWorld* World = CreateBenchmarkWorld();
+	if (!World || !Telemetry)
+	{
+		UE_LOG(LogDelveDeepBenchmark, Error, TEXT("Failed to create benchmark world or telemetry subsystem"));
+		Shutdown();
+		return ExitSetupFailure;
+	}
+
+	if (!SpawnScenario(World))
+	{
+		UE_LOG(LogDelveDeepBenchmark, Error, TEXT("Failed to spawn benchmark scenario"));
+		Shutdown();
+		return ExitSetupFailure;
+	}
+
+	// The subsystem is ticked only below, once per captured frame with its measured cost;
+	// the world tick would otherwise sample every frame again with the fixed step
+	Telemetry->SetManualTick(true);
+
+	// Warm-up frames run the scenario without recording so that first-use costs
+	// (asset loads, listener registration, allocator growth) stay out of the baseline
+	for (int32 Frame = 0; Frame < Settings.WarmupFrames; ++Frame)
+	{
+		RunScenarioFrame(World);
+	}
+
+	// Drop the system times recorded during warm-up
+	Telemetry->ResetFrameStatistics();
+
+	// Capture frames: the telemetry subsystem is ticked with the measured wall-clock
+	// cost of each frame, while gameplay advances with a fixed step for determinism
+	for (int32 Frame = 0; Frame < Settings.CaptureFrames; ++Frame)
+	{
+		const double FrameStart = FPlatformTime::Seconds();
+		RunScenarioFrame(World);
+		const double FrameSeconds = FPlatformTime::Seconds() - FrameStart;
+
+		Telemetry->TrackEntityCount(TEXT("Characters"), Characters.Num());
+		Telemetry->TrackEntityCount(TEXT("Monsters"), Monsters.Num());
+		Telemetry->Tick(static_cast<float>(FrameSeconds));
+	}
+
+	// Capture and save through the standard telemetry baseline path
+	if (!Telemetry->CaptureBaseline(Settings.BaselineName))
+	{
+		Shutdown();
+		return ExitSetupFailure;
+	}
+
+	if (!Telemetry->SaveBaseline(Settings.BaselineName, Settings.OutputBaselinePath))
+	{
+		Shutdown();
+		return ExitSetupFailure;
+	}
+
+	int32 ExitCode = ExitSuccess;
+
+	if (!Settings.ReferenceBaselinePath.IsEmpty())
+	{
+		const FName ReferenceName(*(Settings.BaselineName.ToString() + TEXT("_Reference")));
+
+		if (!Telemetry->LoadBaseline(ReferenceName, Settings.ReferenceBaselinePath))
+		{
+			UE_LOG(LogDelveDeepBenchmark, Error,
+				TEXT("Failed to load reference baseline: %s"), *Settings.ReferenceBaselinePath);
+			Shutdown();
+			return ExitSetupFailure;
+		}
+
+		FPerformanceComparison Comparison;
+		if (!Telemetry->CompareToBaseline(ReferenceName, Comparison))
+		{
+			Shutdown();
+			return ExitSetupFailure;
+		}
+
+		if (Comparison.bIsRegression)
+		{
+			UE_LOG(LogDelveDeepBenchmark, Error,
+				TEXT("Benchmark regression against '%s' (FPS %+.2f%%, frame time %+.2f%%, memory %+.2f%%)"),
+				*Settings.ReferenceBaselinePath,
+				Comparison.FPSChangePercent,
+				Comparison.FrameTimeChangePercent,
+				Comparison.MemoryChangePercent);
+			ExitCode = ExitRegression;
+		}
+		else
+		{
+			UE_LOG(LogDelveDeepBenchmark, Display,
+				TEXT("Benchmark within tolerance of '%s' (FPS %+.2f%%, frame time %+.2f%%)"),
+				*Settings.ReferenceBaselinePath,
+				Comparison.FPSChangePercent,
+				Comparison.FrameTimeChangePercent);
+		}
+	}
+	else
+	{
+		UE_LOG(LogDelveDeepBenchmark, Warning,
+			TEXT("No reference baseline supplied (-Reference=); captured baseline only"));
+	}
+
+	Shutdown();
+	return ExitCode;
+}
+
+void UDelveDeepPerformanceBenchmarkCommandlet::ParseSettings(const FString& Params, FDelveDeepBenchmarkSettings& OutSettings)
+{
+	FParse::Value(*Params, TEXT("Map="), OutSettings.MapName);
+	FParse::Value(*Params, TEXT("Characters="), OutSettings.NumCharacters);
+	FParse::Value(*Params, TEXT("Monsters="), OutSettings.NumMonsters);
+	FParse::Value(*Params, TEXT("Frames="), OutSettings.CaptureFrames);
+	FParse::Value(*Params, TEXT("WarmupFrames="), OutSettings.WarmupFrames);
+	FParse::Value(*Params, TEXT("DamagePerFrame="), OutSettings.DamageHitsPerFrame);
+	FParse::Value(*Params, TEXT("EventsPerFrame="), OutSettings.EventsPerFrame);
+	FParse::Value(*Params, TEXT("Seed="), OutSettings.Seed);
+	FParse::Value(*Params, TEXT("Reference="), OutSettings.ReferenceBaselinePath);
+	FParse::Value(*Params, TEXT("Output="), OutSettings.OutputBaselinePath);
+	FParse::Value(*Params, TEXT("MonsterClass="), OutSettings.MonsterClassPath);
+
+	FString BaselineNameStr;
+	if (FParse::Value(*Params, TEXT("BaselineName="), BaselineNameStr) && !BaselineNameStr.IsEmpty())
+	{
+		OutSettings.BaselineName = FName(*BaselineNameStr);
+	}
+
+	// Clamp to sane ranges so a typo cannot hang CI
+	OutSettings.NumCharacters = FMath::Clamp(OutSettings.NumCharacters, 0, 64);
+	OutSettings.NumMonsters = FMath::Clamp(OutSettings.NumMonsters, 0, 5000);
+	OutSettings.CaptureFrames = FMath::Clamp(OutSettings.CaptureFrames, 60, 36000);
+	OutSettings.WarmupFrames = FMath::Clamp(OutSettings.WarmupFrames, 0, 3600);
+	OutSettings.DamageHitsPerFrame = FMath::Max(0, OutSettings.DamageHitsPerFrame);
+	OutSettings.EventsPerFrame = FMath::Max(0, OutSettings.EventsPerFrame);
+
+	if (!OutSettings.ReferenceBaselinePath.IsEmpty() && FPaths::IsRelative(OutSettings.ReferenceBaselinePath))
+	{
+		OutSettings.ReferenceBaselinePath = FPaths::ProjectDir() / OutSettings.ReferenceBaselinePath;
+	}
+}
+
+UWorld* UDelveDeepPerformanceBenchmarkCommandlet::CreateBenchmarkWorld()
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone(TEXT("DelveDeepBenchmarkWorld"));
+
+	FWorldContext* WorldContext = GameInstance->GetWorldContext();
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	if (!Settings.MapName.IsEmpty())
+	{
+		FString Error;
+		if (!GEngine->LoadMap(*WorldContext, FURL(*Settings.MapName), nullptr, Error))
+		{
+			UE_LOG(LogDelveDeepBenchmark, Error, TEXT("Failed to load map '%s': %s"), *Settings.MapName, *Error);
+			return nullptr;
+		}
+	}
+
+	UWorld* World = WorldContext->World();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// LoadMap begins play itself; the blank standalone world has to be started manually
+	if (!World->HasBegunPlay())
+	{
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	Telemetry = GameInstance->GetSubsystem<UDelveDeepTelemetrySubsystem>();
+	EventSubsystem = GameInstance->GetSubsystem<UDelveDeepEventSubsystem>();
+
+	return World;
+}
+
+bool UDelveDeepPerformanceBenchmarkCommandlet::SpawnScenario(UWorld* World)
+{
+	const TArray<UClass*> CharacterClasses = {
+		ADelveDeepWarrior::StaticClass(),
+		ADelveDeepRanger::StaticClass(),
+		ADelveDeepMage::StaticClass(),
+		ADelveDeepNecromancer::StaticClass()
+	};
+
+	// No dedicated monster actor exists yet, so the Warrior stands in for a melee monster
+	UClass* MonsterClass = ADelveDeepWarrior::StaticClass();
+	if (!Settings.MonsterClassPath.IsEmpty())
+	{
+		MonsterClass = LoadClass<ADelveDeepCharacter>(nullptr, *Settings.MonsterClassPath);
+		if (!MonsterClass)
+		{
+			UE_LOG(LogDelveDeepBenchmark, Error, TEXT("Failed to load monster class: %s"), *Settings.MonsterClassPath);
+			return false;
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 Index = 0; Index < Settings.NumCharacters; ++Index)
+	{
+		const FVector Location(Index * 100.0f, 0.0f, 100.0f);
+		UClass* CharacterClass = CharacterClasses[Index % CharacterClasses.Num()];
+		if (ADelveDeepCharacter* Character = World->SpawnActor<ADelveDeepCharacter>(CharacterClass, Location, FRotator::ZeroRotator, SpawnParams))
+		{
+			Characters.Add(Character);
+		}
+	}
+
+	// Monsters are laid out on a ring around the party
+	for (int32 Index = 0; Index < Settings.NumMonsters; ++Index)
+	{
+		const float Angle = RandomStream.FRandRange(0.0f, 2.0f * PI);
+		const float Radius = RandomStream.FRandRange(500.0f, 2000.0f);
+		const FVector Location(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 100.0f);
+		if (ADelveDeepCharacter* Monster = World->SpawnActor<ADelveDeepCharacter>(MonsterClass, Location, FRotator::ZeroRotator, SpawnParams))
+		{
+			Monsters.Add(Monster);
+		}
+	}
+
+	UE_LOG(LogDelveDeepBenchmark, Display,
+		TEXT("Spawned %d/%d characters and %d/%d monsters"),
+		Characters.Num(), Settings.NumCharacters, Monsters.Num(), Settings.NumMonsters);
+
+	return Characters.Num() + Monsters.Num() > 0;
+}
+
+void UDelveDeepPerformanceBenchmarkCommandlet::RunScenarioFrame(UWorld* World)
+{
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		ApplyDamageStorm();
+		Telemetry->RecordSystemTime(TEXT("Combat"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		BroadcastEventStorm();
+		Telemetry->RecordSystemTime(TEXT("Events"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	World->Tick(LEVELTICK_All, Settings.FixedDeltaSeconds);
+}
+
+void UDelveDeepPerformanceBenchmarkCommandlet::ApplyDamageStorm()
+{
+	if (Monsters.Num() == 0 && Characters.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 Hit = 0; Hit < Settings.DamageHitsPerFrame; ++Hit)
+	{
+		// Three out of four hits land on monsters, the rest on the party
+		const bool bHitMonster = Monsters.Num() > 0 && (Characters.Num() == 0 || RandomStream.RandRange(0, 3) > 0);
+		TArray<ADelveDeepCharacter*>& Targets = bHitMonster ? Monsters : Characters;
+		TArray<ADelveDeepCharacter*>& Sources = bHitMonster ? Characters : Monsters;
+
+		ADelveDeepCharacter* Target = Targets[RandomStream.RandRange(0, Targets.Num() - 1)];
+		AActor* Source = Sources.Num() > 0 ? Sources[RandomStream.RandRange(0, Sources.Num() - 1)] : nullptr;
+
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		// Keep the population stable: dead targets respawn, low targets are topped up
+		if (Target->IsDead())
+		{
+			Target->Respawn();
+			continue;
+		}
+
+		if (Target->GetCurrentHealth() < Target->GetMaxHealth() * 0.25f)
+		{
+			Target->Heal(Target->GetMaxHealth());
+			continue;
+		}
+
+		Target->ApplySimpleDamage(RandomStream.FRandRange(1.0f, 10.0f), Source);
+	}
+}
+
+void UDelveDeepPerformanceBenchmarkCommandlet::BroadcastEventStorm()
+{
+	if (!EventSubsystem || Monsters.Num() == 0)
+	{
+		return;
+	}
+
+	static const FGameplayTag DamageDealtTag = FGameplayTag::RequestGameplayTag(FName("DelveDeep.Event.Combat.Damage.Dealt"));
+
+	for (int32 EventIndex = 0; EventIndex < Settings.EventsPerFrame; ++EventIndex)
+	{
+		FDelveDeepDamageEventPayload Payload;
+		Payload.EventTag = DamageDealtTag;
+		Payload.Victim = Monsters[RandomStream.RandRange(0, Monsters.Num() - 1)];
+		Payload.Attacker = Characters.Num() > 0 ? Characters[RandomStream.RandRange(0, Characters.Num() - 1)] : nullptr;
+		Payload.Instigator = Payload.Attacker;
+		Payload.DamageAmount = RandomStream.FRandRange(1.0f, 10.0f);
+
+		EventSubsystem->BroadcastEvent(Payload);
+	}
+}
+
+void UDelveDeepPerformanceBenchmarkCommandlet::Shutdown()
+{
+	for (ADelveDeepCharacter* Actor : Characters)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+
+	for (ADelveDeepCharacter* Actor : Monsters)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+
+	Characters.Empty();
+	Monsters.Empty();
+	Telemetry = nullptr;
+	EventSubsystem = nullptr;
+
+	if (GameInstance)
+	{
+		GameInstance->Shutdown();
+		GameInstance = nullptr;
+	}
+}
@@ -2,14 +2,49 @@
 
 #include "DelveDeepPerformanceOverlay.h"
 #include "Engine/Canvas.h"
+#include "Engine/Engine.h"
 #include "Engine/Font.h"
 #include "CanvasItem.h"
 #include "DelveDeepTelemetrySubsystem.h"
 
+bool FDelveDeepPerformanceOverlay::FOverlayTextLine::NeedsUpdate(int64 NewQuantizedValue, const FLinearColor& NewColor, FName NewKey)
+{
+	if (QuantizedValue == NewQuantizedValue && Color == NewColor && Key == NewKey)
+	{
+		return false;
+	}
+
+	QuantizedValue = NewQuantizedValue;
+	Color = NewColor;
+	Key = NewKey;
+	return true;
+}
+
 FDelveDeepPerformanceOverlay::FDelveDeepPerformanceOverlay()
 	: Mode(EOverlayMode::Standard)
+	, GraphHead(0)
+	, GraphSampleCount(0)
+	, GraphOrigin(FVector2D::ZeroVector)
+	, bGraphDirty(true)
+	, NumVisibleSystemLines(0)
+	, LastTextRefreshTime(0.0)
+	, bTextCacheDirty(true)
+	, TextRefreshCount(0)
+	, LastRenderCostMs(0.0f)
+	, AverageRenderCostMs(0.0f)
+	, bRenderCostWarningActive(false)
 {
-	FrameTimeGraph.Reserve(MaxGraphFrames);
+	FrameTimeGraph.SetNumZeroed(MaxGraphFrames);
+
+	// Background, two zone lines, one bar per sample and four border edges (two triangles each)
+	GraphTriangles.Reserve((MaxGraphFrames + 7) * 2);
+	BarTriangles.Reserve(MaxBreakdownSystems * 2);
+	SystemLines.SetNum(MaxBreakdownSystems);
+
+	SystemHeaderText = FText::FromString(FString::Printf(TEXT("System Breakdown (Top %d):"), MaxBreakdownSystems));
+	MemoryHeaderText = FText::FromString(TEXT("Memory:"));
+	GoodLabelText = FText::FromString(FString::Printf(TEXT("%.0fms"), GoodThreshold));
+	WarningLabelText = FText::FromString(FString::Printf(TEXT("%.0fms"), WarningThreshold));
 }
 
 void FDelveDeepPerformanceOverlay::Render(UCanvas* Canvas,
@@ -25,236 +60,387 @@ void FDelveDeepPerformanceOverlay::Render(UCanvas* Canvas,
 	// Measure rendering time to ensure <0.1ms overhead
 	const double StartTime = FPlatformTime::Seconds();
 
+	// Re-format text at most TextRefreshHz; in between, cached FText is drawn as-is
+	if (bTextCacheDirty || (StartTime - LastTextRefreshTime) >= (1.0 / TextRefreshHz))
+	{
+		RefreshTextCache(FrameData, SystemData, MemoryData);
+		LastTextRefreshTime = StartTime;
+		bTextCacheDirty = false;
+	}
+
+	UFont* Font = GEngine ? GEngine->GetSmallFont() : nullptr;
+
 	float X = OverlayX;
 	float Y = OverlayY;
 
 	switch (Mode)
 	{
 	case EOverlayMode::Minimal:
-		RenderMinimal(Canvas, FrameData, X, Y);
+		RenderMinimal(Canvas, Font, X, Y);
 		break;
 
 	case EOverlayMode::Standard:
-		RenderStandard(Canvas, FrameData, X, Y);
+		RenderStandard(Canvas, Font, X, Y);
 		break;
 
 	case EOverlayMode::Detailed:
-		RenderDetailed(Canvas, FrameData, SystemData, MemoryData, X, Y);
+		RenderDetailed(Canvas, Font, X, Y);
 		break;
 	}
 
 	const double EndTime = FPlatformTime::Seconds();
-	const double RenderTimeMs = (EndTime - StartTime) * 1000.0;
-
-	// Log warning if overlay rendering exceeds target
-	if (RenderTimeMs > 0.1)
-	{
-		UE_LOG(LogDelveDeepTelemetry, Warning,
-			TEXT("Performance overlay rendering exceeded target: %.3fms"), RenderTimeMs);
-	}
+	RecordRenderCost(static_cast<float>((EndTime - StartTime) * 1000.0));
 }
 
 void FDelveDeepPerformanceOverlay::SetMode(EOverlayMode NewMode)
 {
+	if (Mode != NewMode)
+	{
+		// Layout changes with the mode, so geometry and text need rebuilding
+		bGraphDirty = true;
+		bTextCacheDirty = true;
+	}
+
 	Mode = NewMode;
 }
 
 void FDelveDeepPerformanceOverlay::AddFrameTime(float FrameTimeMs)
 {
-	FrameTimeGraph.Add(FrameTimeMs);
-
-	// Keep only last MaxGraphFrames
-	if (FrameTimeGraph.Num() > MaxGraphFrames)
+	if (GraphSampleCount < MaxGraphFrames)
+	{
+		FrameTimeGraph[(GraphHead + GraphSampleCount) % MaxGraphFrames] = FrameTimeMs;
+		++GraphSampleCount;
+	}
+	else
 	{
-		FrameTimeGraph.RemoveAt(0);
+		// Buffer full: overwrite the oldest sample
+		FrameTimeGraph[GraphHead] = FrameTimeMs;
+		GraphHead = (GraphHead + 1) % MaxGraphFrames;
 	}
+
+	bGraphDirty = true;
 }
 
 void FDelveDeepPerformanceOverlay::ClearHistory()
 {
-	FrameTimeGraph.Empty();
-	FrameTimeGraph.Reserve(MaxGraphFrames);
+	GraphHead = 0;
+	GraphSampleCount = 0;
+	GraphTriangles.Reset();
+	bGraphDirty = true;
 }
 
-float FDelveDeepPerformanceOverlay::RenderMinimal(UCanvas* Canvas, const FFramePerformanceData& FrameData, float X, float Y)
+void FDelveDeepPerformanceOverlay::RefreshTextCache(const FFramePerformanceData& FrameData,
+                                                   const TArray<FSystemPerformanceData>& SystemData,
+                                                   const FMemorySnapshot& MemoryData)
 {
-	// Calculate FPS
-	const float FPS = FrameData.FrameTime > 0.0f ? 1000.0f / FrameData.FrameTime : 0.0f;
-	const FLinearColor Color = GetPerformanceZoneColor(FrameData.FrameTime);
+	++TextRefreshCount;
+
+	// FPS (0.1 precision)
+	const float FPS = FrameData.FrameTimeMs > 0.0f ? 1000.0f / FrameData.FrameTimeMs : 0.0f;
+	if (FPSLine.NeedsUpdate(FMath::RoundToInt64(FPS * 10.0f), GetPerformanceZoneColor(FrameData.FrameTimeMs)))
+	{
+		FPSLine.Text = FText::FromString(FString::Printf(TEXT("FPS: %.1f"), FPS));
+	}
+
+	if (Mode == EOverlayMode::Minimal)
+	{
+		return;
+	}
+
+	// Overlay self-cost (0.001ms precision)
+	const FLinearColor CostColor = AverageRenderCostMs > RenderCostBudgetMs ? FLinearColor::Red : FLinearColor::Gray;
+	if (SelfCostLine.NeedsUpdate(FMath::RoundToInt64(AverageRenderCostMs * 1000.0f), CostColor))
+	{
+		SelfCostLine.Text = FText::FromString(FString::Printf(TEXT("Overlay: %.3fms"), AverageRenderCostMs));
+	}
+
+	if (Mode != EOverlayMode::Detailed)
+	{
+		return;
+	}
+
+	// Select the top systems by cycle time without copying the whole array
+	TArray<const FSystemPerformanceData*, TInlineAllocator<16>> SortedSystems;
+	double TotalTime = 0.0;
+	for (const FSystemPerformanceData& System : SystemData)
+	{
+		SortedSystems.Add(&System);
+		TotalTime += System.CycleTimeMs;
+	}
+
+	SortedSystems.Sort([](const FSystemPerformanceData& A, const FSystemPerformanceData& B)
+	{
+		return A.CycleTimeMs > B.CycleTimeMs;
+	});
+
+	NumVisibleSystemLines = FMath::Min(MaxBreakdownSystems, SortedSystems.Num());
+	for (int32 i = 0; i < NumVisibleSystemLines; ++i)
+	{
+		const FSystemPerformanceData& System = *SortedSystems[i];
+		const float Percentage = TotalTime > 0.0 ? static_cast<float>((System.CycleTimeMs / TotalTime) * 100.0) : 0.0f;
+
+		// Color based on budget utilization
+		FLinearColor Color = FLinearColor::White;
+		if (System.BudgetTimeMs > 0.0)
+		{
+			const float Utilization = static_cast<float>(System.CycleTimeMs / System.BudgetTimeMs);
+			if (Utilization > 1.0f)
+			{
+				Color = FLinearColor::Red;
+			}
+			else if (Utilization > 0.8f)
+			{
+				Color = FLinearColor::Yellow;
+			}
+			else
+			{
+				Color = FLinearColor::Green;
+			}
+		}
+
+		// Time at 0.01ms and percentage at 0.1% precision packed into one key
+		const int64 Quantized = FMath::RoundToInt64(System.CycleTimeMs * 100.0) * 10000 + FMath::RoundToInt64(Percentage * 10.0f);
+
+		FOverlayTextLine& Line = SystemLines[i];
+		if (Line.NeedsUpdate(Quantized, Color, System.SystemName))
+		{
+			Line.Text = FText::FromString(FString::Printf(TEXT("%s: %.2fms (%.1f%%)"),
+				*System.SystemName.ToString(), System.CycleTimeMs, Percentage));
+			Line.BarWidth = (Percentage / 100.0f) * (GraphWidth - 20.0f);
+		}
+	}
 
-	// Draw FPS
-	const FString FPSText = FString::Printf(TEXT("FPS: %.1f"), FPS);
-	DrawTextWithShadow(Canvas, FPSText, X, Y, Color);
+	// Memory (FormatBytes precision)
+	if (TotalMemoryLine.NeedsUpdate(QuantizeBytes(MemoryData.TotalMemory), FLinearColor::White))
+	{
+		TotalMemoryLine.Text = FText::FromString(FString::Printf(TEXT("Total: %s"), *FormatBytes(MemoryData.TotalMemory)));
+	}
+
+	if (NativeMemoryLine.NeedsUpdate(QuantizeBytes(MemoryData.NativeMemory), FLinearColor::Cyan))
+	{
+		NativeMemoryLine.Text = FText::FromString(FString::Printf(TEXT("Native: %s"), *FormatBytes(MemoryData.NativeMemory)));
+	}
+
+	if (ManagedMemoryLine.NeedsUpdate(QuantizeBytes(MemoryData.ManagedMemory), FLinearColor::Cyan))
+	{
+		ManagedMemoryLine.Text = FText::FromString(FString::Printf(TEXT("Managed: %s"), *FormatBytes(MemoryData.ManagedMemory)));
+	}
+
+	// GC (0.1ms precision); a spiking last collection is shown in the critical color
+	const FLinearColor GCColor = GCStats.LastGCTimeMs > FDelveDeepGCTracker::SpikeThresholdMs ? FLinearColor::Red : FLinearColor::Cyan;
+	if (GCLine.NeedsUpdate(FMath::RoundToInt64(GCStats.LastGCTimeMs * 10.0f) * 1000000 + GCStats.LastObjectsPurged, GCColor))
+	{
+		GCLine.Text = FText::FromString(FString::Printf(TEXT("Last GC: %.1fms, %d purged (%d total)"),
+			GCStats.LastGCTimeMs, GCStats.LastObjectsPurged, GCStats.CollectionCount));
+	}
+
+	if (UObjectLine.NeedsUpdate(GCStats.UObjectCount, FLinearColor::Cyan))
+	{
+		UObjectLine.Text = FText::FromString(FString::Printf(TEXT("UObjects: %d"), GCStats.UObjectCount));
+	}
+}
+
+void FDelveDeepPerformanceOverlay::RebuildGraphGeometry(float X, float Y)
+{
+	GraphTriangles.Reset();
+	GraphOrigin = FVector2D(X, Y);
+
+	// Background
+	AppendQuad(GraphTriangles, X, Y, GraphWidth, GraphHeight, FLinearColor(0.0f, 0.0f, 0.0f, 0.5f));
+
+	// Performance zone lines
+	const float GoodLineY = Y + GraphHeight - (GoodThreshold / GraphScaleMs) * GraphHeight;
+	const float WarningLineY = Y + GraphHeight - (WarningThreshold / GraphScaleMs) * GraphHeight;
+	AppendQuad(GraphTriangles, X, GoodLineY, GraphWidth, 1.0f, FLinearColor(0.0f, 1.0f, 0.0f, 0.3f));
+	AppendQuad(GraphTriangles, X, WarningLineY, GraphWidth, 1.0f, FLinearColor(1.0f, 1.0f, 0.0f, 0.3f));
+
+	// Frame time bars, oldest to newest
+	const float BarWidth = GraphWidth / MaxGraphFrames;
+	for (int32 i = 0; i < GraphSampleCount; ++i)
+	{
+		const float FrameTime = FrameTimeGraph[(GraphHead + i) % MaxGraphFrames];
+		const float BarHeight = FMath::Min((FrameTime / GraphScaleMs) * GraphHeight, GraphHeight);
+		if (BarHeight <= 0.0f)
+		{
+			continue;
+		}
+
+		AppendQuad(GraphTriangles, X + i * BarWidth, Y + GraphHeight - BarHeight, BarWidth, BarHeight,
+			GetPerformanceZoneColor(FrameTime));
+	}
+
+	// Border
+	AppendQuad(GraphTriangles, X, Y, GraphWidth, 1.0f, FLinearColor::White);
+	AppendQuad(GraphTriangles, X, Y + GraphHeight - 1.0f, GraphWidth, 1.0f, FLinearColor::White);
+	AppendQuad(GraphTriangles, X, Y, 1.0f, GraphHeight, FLinearColor::White);
+	AppendQuad(GraphTriangles, X + GraphWidth - 1.0f, Y, 1.0f, GraphHeight, FLinearColor::White);
+
+	bGraphDirty = false;
+}
+
+void FDelveDeepPerformanceOverlay::AppendQuad(TArray<FCanvasUVTri>& Triangles, float X, float Y, float Width, float Height, const FLinearColor& Color)
+{
+	const FVector2D TopLeft(X, Y);
+	const FVector2D TopRight(X + Width, Y);
+	const FVector2D BottomLeft(X, Y + Height);
+	const FVector2D BottomRight(X + Width, Y + Height);
+
+	FCanvasUVTri& First = Triangles.AddDefaulted_GetRef();
+	First.V0_Pos = TopLeft;
+	First.V1_Pos = TopRight;
+	First.V2_Pos = BottomRight;
+	First.V0_Color = First.V1_Color = First.V2_Color = Color;
+
+	FCanvasUVTri& Second = Triangles.AddDefaulted_GetRef();
+	Second.V0_Pos = TopLeft;
+	Second.V1_Pos = BottomRight;
+	Second.V2_Pos = BottomLeft;
+	Second.V0_Color = Second.V1_Color = Second.V2_Color = Color;
+}
+
+void FDelveDeepPerformanceOverlay::RecordRenderCost(float RenderTimeMs)
+{
+	LastRenderCostMs = RenderTimeMs;
+	AverageRenderCostMs = AverageRenderCostMs > 0.0f
+		? FMath::Lerp(AverageRenderCostMs, RenderTimeMs, RenderCostSmoothing)
+		: RenderTimeMs;
+
+	// Warn once when the smoothed cost crosses the budget rather than on every slow frame
+	if (AverageRenderCostMs > RenderCostBudgetMs)
+	{
+		if (!bRenderCostWarningActive)
+		{
+			UE_LOG(LogDelveDeepTelemetry, Warning,
+				TEXT("Performance overlay rendering exceeded target: %.3fms average (budget %.3fms)"),
+				AverageRenderCostMs, RenderCostBudgetMs);
+			bRenderCostWarningActive = true;
+		}
+	}
+	else
+	{
+		bRenderCostWarningActive = false;
+	}
+}
+
+float FDelveDeepPerformanceOverlay::RenderMinimal(UCanvas* Canvas, UFont* Font, float X, float Y)
+{
+	DrawTextWithShadow(Canvas, Font, FPSLine.Text, X, Y, FPSLine.Color);
 
 	return Y + LineHeight;
 }
 
-float FDelveDeepPerformanceOverlay::RenderStandard(UCanvas* Canvas, const FFramePerformanceData& FrameData, float X, float Y)
+float FDelveDeepPerformanceOverlay::RenderStandard(UCanvas* Canvas, UFont* Font, float X, float Y)
 {
 	// Render FPS
-	Y = RenderMinimal(Canvas, FrameData, X, Y);
+	Y = RenderMinimal(Canvas, Font, X, Y);
+
+	// Render overlay self-cost
+	DrawTextWithShadow(Canvas, Font, SelfCostLine.Text, X, Y, SelfCostLine.Color);
+	Y += LineHeight;
 
 	// Add spacing
 	Y += 5.0f;
 
 	// Render frame time graph
-	Y = RenderFrameTimeGraph(Canvas, X, Y);
+	Y = RenderFrameTimeGraph(Canvas, Font, X, Y);
 
 	return Y;
 }
 
-float FDelveDeepPerformanceOverlay::RenderDetailed(UCanvas* Canvas,
-                                                  const FFramePerformanceData& FrameData,
-                                                  const TArray<FSystemPerformanceData>& SystemData,
-                                                  const FMemorySnapshot& MemoryData,
-                                                  float X, float Y)
+float FDelveDeepPerformanceOverlay::RenderDetailed(UCanvas* Canvas, UFont* Font, float X, float Y)
 {
 	// Render standard overlay (FPS + graph)
-	Y = RenderStandard(Canvas, FrameData, X, Y);
+	Y = RenderStandard(Canvas, Font, X, Y);
 
 	// Add spacing
 	Y += 10.0f;
 
 	// Render system breakdown
-	Y = RenderSystemBreakdown(Canvas, SystemData, X, Y);
+	Y = RenderSystemBreakdown(Canvas, Font, X, Y);
 
 	// Add spacing
 	Y += 10.0f;
 
 	// Render memory stats
-	Y = RenderMemoryStats(Canvas, MemoryData, X, Y);
+	Y = RenderMemoryStats(Canvas, Font, X, Y);
 
 	return Y;
 }
 
-float FDelveDeepPerformanceOverlay::RenderFrameTimeGraph(UCanvas* Canvas, float X, float Y)
+float FDelveDeepPerformanceOverlay::RenderFrameTimeGraph(UCanvas* Canvas, UFont* Font, float X, float Y)
 {
-	if (FrameTimeGraph.Num() == 0)
+	if (GraphSampleCount == 0)
 	{
 		return Y;
 	}
 
-	// Draw graph background
-	DrawFilledRect(Canvas, X, Y, GraphWidth, GraphHeight, FLinearColor(0.0f, 0.0f, 0.0f, 0.5f));
-
-	// Draw performance zone lines
-	const float GoodLineY = Y + GraphHeight - (GoodThreshold / 33.33f) * GraphHeight; // 33.33ms = 30 FPS scale
-	const float WarningLineY = Y + GraphHeight - (WarningThreshold / 33.33f) * GraphHeight;
-
-	DrawFilledRect(Canvas, X, GoodLineY, GraphWidth, 1.0f, FLinearColor(0.0f, 1.0f, 0.0f, 0.3f));
-	DrawFilledRect(Canvas, X, WarningLineY, GraphWidth, 1.0f, FLinearColor(1.0f, 1.0f, 0.0f, 0.3f));
-
-	// Draw frame time bars
-	const float BarWidth = GraphWidth / MaxGraphFrames;
-	const int32 StartIndex = FMath::Max(0, FrameTimeGraph.Num() - MaxGraphFrames);
-
-	for (int32 i = StartIndex; i < FrameTimeGraph.Num(); ++i)
+	if (bGraphDirty || GraphOrigin != FVector2D(X, Y))
 	{
-		const float FrameTime = FrameTimeGraph[i];
-		const float BarHeight = FMath::Min((FrameTime / 33.33f) * GraphHeight, GraphHeight);
-		const float BarX = X + (i - StartIndex) * BarWidth;
-		const float BarY = Y + GraphHeight - BarHeight;
-
-		const FLinearColor BarColor = GetPerformanceZoneColor(FrameTime);
-		DrawFilledRect(Canvas, BarX, BarY, BarWidth, BarHeight, BarColor);
+		RebuildGraphGeometry(X, Y);
 	}
 
-	// Draw graph border
-	Canvas->K2_DrawBox(FVector2D(X, Y), FVector2D(GraphWidth, GraphHeight), 1.0f, FLinearColor::White);
+	// Background, zone lines, bars and border in one draw
+	DrawTriangleBatch(Canvas, GraphTriangles);
 
 	// Draw scale labels
-	DrawTextWithShadow(Canvas, TEXT("16ms"), X + GraphWidth + 5.0f, GoodLineY - 8.0f, FLinearColor::Green);
-	DrawTextWithShadow(Canvas, TEXT("20ms"), X + GraphWidth + 5.0f, WarningLineY - 8.0f, FLinearColor::Yellow);
+	const float GoodLineY = Y + GraphHeight - (GoodThreshold / GraphScaleMs) * GraphHeight;
+	const float WarningLineY = Y + GraphHeight - (WarningThreshold / GraphScaleMs) * GraphHeight;
+	DrawTextWithShadow(Canvas, Font, GoodLabelText, X + GraphWidth + 5.0f, GoodLineY - 8.0f, FLinearColor::Green);
+	DrawTextWithShadow(Canvas, Font, WarningLabelText, X + GraphWidth + 5.0f, WarningLineY - 8.0f, FLinearColor::Yellow);
 
 	return Y + GraphHeight + 5.0f;
 }
 
-float FDelveDeepPerformanceOverlay::RenderSystemBreakdown(UCanvas* Canvas, const TArray<FSystemPerformanceData>& SystemData, float X, float Y)
+float FDelveDeepPerformanceOverlay::RenderSystemBreakdown(UCanvas* Canvas, UFont* Font, float X, float Y)
 {
-	if (SystemData.Num() == 0)
+	if (NumVisibleSystemLines == 0)
 	{
 		return Y;
 	}
 
 	// Draw header
-	DrawTextWithShadow(Canvas, TEXT("System Breakdown (Top 5):"), X, Y, FLinearColor::White);
+	DrawTextWithShadow(Canvas, Font, SystemHeaderText, X, Y, FLinearColor::White);
 	Y += LineHeight;
 
-	// Sort systems by cycle time (descending)
-	TArray<FSystemPerformanceData> SortedSystems = SystemData;
-	SortedSystems.Sort([](const FSystemPerformanceData& A, const FSystemPerformanceData& B)
+	BarTriangles.Reset();
+	for (int32 i = 0; i < NumVisibleSystemLines; ++i)
 	{
-		return A.CycleTime > B.CycleTime;
-	});
+		const FOverlayTextLine& Line = SystemLines[i];
+		DrawTextWithShadow(Canvas, Font, Line.Text, X + 10.0f, Y, Line.Color);
 
-	// Calculate total time for percentage
-	double TotalTime = 0.0;
-	for (const FSystemPerformanceData& System : SortedSystems)
-	{
-		TotalTime += System.CycleTime;
-	}
-
-	// Draw top 5 systems
-	const int32 MaxSystems = FMath::Min(5, SortedSystems.Num());
-	for (int32 i = 0; i < MaxSystems; ++i)
-	{
-		const FSystemPerformanceData& System = SortedSystems[i];
-		const float Percentage = TotalTime > 0.0 ? (System.CycleTime / TotalTime) * 100.0f : 0.0f;
-
-		// Draw system name and time
-		const FString SystemText = FString::Printf(TEXT("%s: %.2fms (%.1f%%)"),
-			*System.SystemName.ToString(), System.CycleTime, Percentage);
-
-		// Color based on budget utilization
-		FLinearColor Color = FLinearColor::White;
-		if (System.BudgetTime > 0.0)
+		// Percentage bar, batched with the other rows
+		if (Line.BarWidth > 0.0f)
 		{
-			const float Utilization = System.CycleTime / System.BudgetTime;
-			if (Utilization > 1.0f)
-			{
-				Color = FLinearColor::Red;
-			}
-			else if (Utilization > 0.8f)
-			{
-				Color = FLinearColor::Yellow;
-			}
-			else
-			{
-				Color = FLinearColor::Green;
-			}
+			AppendQuad(BarTriangles, X + 10.0f, Y + LineHeight - 5.0f, Line.BarWidth, 3.0f, Line.Color);
 		}
 
-		DrawTextWithShadow(Canvas, SystemText, X + 10.0f, Y, Color);
-
-		// Draw percentage bar
-		const float BarWidth = (Percentage / 100.0f) * (GraphWidth - 20.0f);
-		DrawFilledRect(Canvas, X + 10.0f, Y + LineHeight - 5.0f, BarWidth, 3.0f, Color);
-
 		Y += LineHeight;
 	}
 
+	DrawTriangleBatch(Canvas, BarTriangles);
+
 	return Y;
 }
 
-float FDelveDeepPerformanceOverlay::RenderMemoryStats(UCanvas* Canvas, const FMemorySnapshot& MemoryData, float X, float Y)
+float FDelveDeepPerformanceOverlay::RenderMemoryStats(UCanvas* Canvas, UFont* Font, float X, float Y)
 {
 	// Draw header
-	DrawTextWithShadow(Canvas, TEXT("Memory:"), X, Y, FLinearColor::White);
+	DrawTextWithShadow(Canvas, Font, MemoryHeaderText, X, Y, FLinearColor::White);
+	Y += LineHeight;
+
+	DrawTextWithShadow(Canvas, Font, TotalMemoryLine.Text, X + 10.0f, Y, TotalMemoryLine.Color);
+	Y += LineHeight;
+
+	DrawTextWithShadow(Canvas, Font, NativeMemoryLine.Text, X + 10.0f, Y, NativeMemoryLine.Color);
 	Y += LineHeight;
 
-	// Draw total memory
-	const FString TotalMemText = FString::Printf(TEXT("Total: %s"), *FormatBytes(MemoryData.TotalMemory));
-	DrawTextWithShadow(Canvas, TotalMemText, X + 10.0f, Y, FLinearColor::White);
+	DrawTextWithShadow(Canvas, Font, ManagedMemoryLine.Text, X + 10.0f, Y, ManagedMemoryLine.Color);
 	Y += LineHeight;
 
-	// Draw native memory
-	const FString NativeMemText = FString::Printf(TEXT("Native: %s"), *FormatBytes(MemoryData.NativeMemory));
-	DrawTextWithShadow(Canvas, NativeMemText, X + 10.0f, Y, FLinearColor::Cyan);
+	DrawTextWithShadow(Canvas, Font, UObjectLine.Text, X + 10.0f, Y, UObjectLine.Color);
 	Y += LineHeight;
 
-	// Draw managed memory
-	const FString ManagedMemText = FString::Printf(TEXT("Managed: %s"), *FormatBytes(MemoryData.ManagedMemory));
-	DrawTextWithShadow(Canvas, ManagedMemText, X + 10.0f, Y, FLinearColor::Cyan);
+	DrawTextWithShadow(Canvas, Font, GCLine.Text, X + 10.0f, Y, GCLine.Color);
 	Y += LineHeight;
 
 	return Y;
@@ -296,33 +482,29 @@ EPerformanceZone FDelveDeepPerformanceOverlay::GetPerformanceZone(float FrameTim
 	}
 }
 
-void FDelveDeepPerformanceOverlay::DrawTextWithShadow(UCanvas* Canvas, const FString& Text, float X, float Y, const FLinearColor& Color) const
+void FDelveDeepPerformanceOverlay::DrawTextWithShadow(UCanvas* Canvas, UFont* Font, const FText& Text, float X, float Y, const FLinearColor& Color) const
 {
-	if (!Canvas)
+	if (!Canvas || Text.IsEmpty())
 	{
 		return;
 	}
 
-	// Draw shadow
-	FCanvasTextItem ShadowTextItem(FVector2D(X + 1.0f, Y + 1.0f), FText::FromString(Text), GEngine->GetSmallFont(), FLinearColor::Black);
-	ShadowTextItem.EnableShadow(FLinearColor::Black);
-	Canvas->DrawItem(ShadowTextItem);
-
-	// Draw text
-	FCanvasTextItem TextItem(FVector2D(X, Y), FText::FromString(Text), GEngine->GetSmallFont(), Color);
+	// The text item renders its own drop shadow, so one item per line is enough
+	FCanvasTextItem TextItem(FVector2D(X, Y), Text, Font, Color);
+	TextItem.EnableShadow(FLinearColor::Black, FVector2D(1.0f, 1.0f));
 	Canvas->DrawItem(TextItem);
 }
 
-void FDelveDeepPerformanceOverlay::DrawFilledRect(UCanvas* Canvas, float X, float Y, float Width, float Height, const FLinearColor& Color) const
+void FDelveDeepPerformanceOverlay::DrawTriangleBatch(UCanvas* Canvas, const TArray<FCanvasUVTri>& Triangles) const
 {
-	if (!Canvas)
+	if (!Canvas || Triangles.Num() == 0)
 	{
 		return;
 	}
 
-	FCanvasTileItem TileItem(FVector2D(X, Y), FVector2D(Width, Height), Color);
-	TileItem.BlendMode = SE_BLEND_Translucent;
-	Canvas->DrawItem(TileItem);
+	FCanvasTriangleItem TriangleItem(Triangles, GWhiteTexture);
+	TriangleItem.BlendMode = SE_BLEND_Translucent;
+	Canvas->DrawItem(TriangleItem);
 }
 
 FString FDelveDeepPerformanceOverlay::FormatBytes(uint64 Bytes) const
@@ -344,3 +526,28 @@ FString FDelveDeepPerformanceOverlay::FormatBytes(uint64 Bytes) const
 		return FString::Printf(TEXT("%.2f GB"), Bytes / (1024.0 * 1024.0 * 1024.0));
 	}
 }
+
+int64 FDelveDeepPerformanceOverlay::QuantizeBytes(uint64 Bytes)
+{
+	// Mirror FormatBytes: exact below 1 KB, two decimals of the chosen unit above.
+	// The unit index lives in the top bits so values from different units never collide.
+	if (Bytes < 1024)
+	{
+		return static_cast<int64>(Bytes);
+	}
+
+	int64 Unit = 1;
+	double Divisor = 1024.0;
+	if (Bytes >= 1024ull * 1024 * 1024)
+	{
+		Unit = 3;
+		Divisor = 1024.0 * 1024.0 * 1024.0;
+	}
+	else if (Bytes >= 1024ull * 1024)
+	{
+		Unit = 2;
+		Divisor = 1024.0 * 1024.0;
+	}
+
+	return (Unit << 56) | FMath::RoundToInt64((Bytes / Divisor) * 100.0);
+}
@@ -0,0 +1,291 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepSampledTelemetry.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<int32> CVarDelveDeepSampledTelemetry(
+	TEXT("DelveDeep.Telemetry.Sampled"),
+#if UE_BUILD_SHIPPING
+	1,
+#else
+	0,
+#endif
+	TEXT("Enable low-overhead sampled frame telemetry (1-in-N frames plus spikes, fixed histograms)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarDelveDeepSampledInterval(
+	TEXT("DelveDeep.Telemetry.Sampled.Interval"),
+	60,
+	TEXT("Record one in this many frames into the sampled histogram."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDelveDeepSampledSpikeThreshold(
+	TEXT("DelveDeep.Telemetry.Sampled.SpikeThresholdMs"),
+	20.0f,
+	TEXT("Frames longer than this (ms) are always recorded into the spike histogram."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDelveDeepSampledSummaryInterval(
+	TEXT("DelveDeep.Telemetry.Sampled.SummaryIntervalSec"),
+	300.0f,
+	TEXT("Seconds between compact summary writes to Saved/Telemetry/Sampled (0 = only on shutdown)."),
+	ECVF_Default);
+
+const float FDelveDeepFrameTimeHistogram::BucketUpperEdgesMs[FDelveDeepFrameTimeHistogram::NumBuckets - 1] =
+{
+	4.0f, 8.0f, 12.0f, 16.67f, 20.0f, 25.0f, 33.33f, 40.0f, 50.0f, 66.67f, 100.0f, 200.0f, 500.0f, 1000.0f
+};
+
+void FDelveDeepFrameTimeHistogram::Add(float FrameTimeMs)
+{
+	int32 Bucket = 0;
+	while (Bucket < NumBuckets - 1 && FrameTimeMs > BucketUpperEdgesMs[Bucket])
+	{
+		++Bucket;
+	}
+
+	Counts[Bucket]++;
+	TotalCount++;
+	SumMs += FrameTimeMs;
+	MaxMs = FMath::Max(MaxMs, FrameTimeMs);
+}
+
+float FDelveDeepFrameTimeHistogram::GetPercentileMs(float Percentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0.0f;
+	}
+
+	const uint32 Target = FMath::Max<uint32>(1, FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * TotalCount));
+	uint32 Cumulative = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets - 1; ++Bucket)
+	{
+		Cumulative += Counts[Bucket];
+		if (Cumulative >= Target)
+		{
+			return FMath::Min(BucketUpperEdgesMs[Bucket], MaxMs);
+		}
+	}
+
+	return MaxMs;
+}
+
+void FDelveDeepFrameTimeHistogram::Reset()
+{
+	for (uint32& Count : Counts)
+	{
+		Count = 0;
+	}
+
+	TotalCount = 0;
+	SumMs = 0.0;
+	MaxMs = 0.0f;
+}
+
+FDelveDeepSampledTelemetry::FDelveDeepSampledTelemetry()
+	: FramesSeen(0)
+	, FramesUntilSample(0)
+	, IntervalSeconds(0.0)
+	, SampleInterval(60)
+	, SpikeThresholdMs(20.0f)
+	, SummaryIntervalSeconds(300.0f)
+	, SummarySequence(0)
+{
+}
+
+void FDelveDeepSampledTelemetry::Configure(int32 InSampleInterval, float InSpikeThresholdMs, float InSummaryIntervalSeconds)
+{
+	SampleInterval = FMath::Max(1, InSampleInterval);
+	SpikeThresholdMs = FMath::Max(0.0f, InSpikeThresholdMs);
+	SummaryIntervalSeconds = InSummaryIntervalSeconds;
+	FramesUntilSample = 0;
+
+	if (SummaryFilePath.IsEmpty())
+	{
+		SummaryFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Telemetry"), TEXT("Sampled"),
+			FString::Printf(TEXT("FrameSummary_%s.jsonl"), *FDateTime::Now().ToString()));
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Verbose,
+		TEXT("Sampled telemetry configured: 1-in-%d frames, spikes > %.2fms, summary every %.0fs"),
+		SampleInterval, SpikeThresholdMs, SummaryIntervalSeconds);
+}
+
+void FDelveDeepSampledTelemetry::ConfigureFromConsoleVariables()
+{
+	Configure(
+		CVarDelveDeepSampledInterval.GetValueOnGameThread(),
+		CVarDelveDeepSampledSpikeThreshold.GetValueOnGameThread(),
+		CVarDelveDeepSampledSummaryInterval.GetValueOnGameThread());
+}
+
+bool FDelveDeepSampledTelemetry::IsEnabledByConsoleVariable()
+{
+	return CVarDelveDeepSampledTelemetry.GetValueOnGameThread() != 0;
+}
+
+void FDelveDeepSampledTelemetry::RecordFrame(float DeltaTime)
+{
+	const float FrameTimeMs = DeltaTime * 1000.0f;
+
+	FramesSeen++;
+
+	if (--FramesUntilSample <= 0)
+	{
+		SampledHistogram.Add(FrameTimeMs);
+		FramesUntilSample = SampleInterval;
+	}
+
+	if (FrameTimeMs > SpikeThresholdMs)
+	{
+		SpikeHistogram.Add(FrameTimeMs);
+	}
+
+	IntervalSeconds += DeltaTime;
+	if (SummaryIntervalSeconds > 0.0f && IntervalSeconds >= SummaryIntervalSeconds)
+	{
+		FlushSummary(true);
+	}
+}
+
+bool FDelveDeepSampledTelemetry::FlushSummary(bool bAsync)
+{
+	if (FramesSeen == 0 || SummaryFilePath.IsEmpty())
+	{
+		return false;
+	}
+
+	const FString Line = BuildSummaryLine() + LINE_TERMINATOR;
+	const FString FilePath = SummaryFilePath;
+	const bool bFirstWrite = SummarySequence == 0;
+
+	auto WriteSummary = [Line, FilePath, bFirstWrite]()
+	{
+		if (bFirstWrite)
+		{
+			PruneOldSummaries(FPaths::GetPath(FilePath));
+		}
+
+		if (!FFileHelper::SaveStringToFile(Line, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+			&IFileManager::Get(), FILEWRITE_Append))
+		{
+			UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Failed to write sampled telemetry summary: %s"), *FilePath);
+		}
+	};
+
+	if (bAsync)
+	{
+		// Chain on the previous write so appends (and the first-write prune) stay in order
+		PendingWrite = Async(EAsyncExecution::ThreadPool,
+			[PreviousWrite = MoveTemp(PendingWrite), WriteSummary = MoveTemp(WriteSummary)]()
+			{
+				if (PreviousWrite.IsValid())
+				{
+					PreviousWrite.Wait();
+				}
+				WriteSummary();
+			});
+	}
+	else
+	{
+		WaitForPendingWrites();
+		WriteSummary();
+	}
+
+	SummarySequence++;
+	SampledHistogram.Reset();
+	SpikeHistogram.Reset();
+	FramesSeen = 0;
+	IntervalSeconds = 0.0;
+
+	return true;
+}
+
+void FDelveDeepSampledTelemetry::WaitForPendingWrites()
+{
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+		PendingWrite.Reset();
+	}
+}
+
+FString FDelveDeepSampledTelemetry::BuildSummaryLine() const
+{
+	auto AppendCounts = [](FString& Out, const FDelveDeepFrameTimeHistogram& Histogram)
+	{
+		Out += TEXT("[");
+		for (int32 i = 0; i < FDelveDeepFrameTimeHistogram::NumBuckets; ++i)
+		{
+			Out += FString::Printf(i == 0 ? TEXT("%u") : TEXT(",%u"), Histogram.Counts[i]);
+		}
+		Out += TEXT("]");
+	};
+
+	FString Line;
+	Line.Reserve(512);
+
+	Line += FString::Printf(TEXT("{\"v\":1,\"seq\":%d,\"time\":\"%s\",\"build\":\"%s\",\"platform\":\"%s\",\"cpu\":\"%s\",\"gpu\":\"%s\""),
+		SummarySequence,
+		*FDateTime::UtcNow().ToIso8601(),
+		FApp::GetBuildVersion(),
+		ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()),
+		*FPlatformMisc::GetCPUBrand().TrimStartAndEnd().ReplaceCharWithEscapedChar(),
+		*FPlatformMisc::GetPrimaryGPUBrand().TrimStartAndEnd().ReplaceCharWithEscapedChar());
+
+	Line += FString::Printf(TEXT(",\"seconds\":%.1f,\"frames\":%u,\"interval\":%d,\"spikeMs\":%.2f"),
+		IntervalSeconds, FramesSeen, SampleInterval, SpikeThresholdMs);
+
+	Line += FString::Printf(TEXT(",\"sampled\":{\"n\":%u,\"mean\":%.2f,\"p50\":%.2f,\"p95\":%.2f,\"p99\":%.2f,\"max\":%.2f,\"hist\":"),
+		SampledHistogram.TotalCount,
+		SampledHistogram.GetMeanMs(),
+		SampledHistogram.GetPercentileMs(0.5f),
+		SampledHistogram.GetPercentileMs(0.95f),
+		SampledHistogram.GetPercentileMs(0.99f),
+		SampledHistogram.MaxMs);
+	AppendCounts(Line, SampledHistogram);
+
+	Line += FString::Printf(TEXT("},\"spikes\":{\"n\":%u,\"mean\":%.2f,\"max\":%.2f,\"hist\":"),
+		SpikeHistogram.TotalCount,
+		SpikeHistogram.GetMeanMs(),
+		SpikeHistogram.MaxMs);
+	AppendCounts(Line, SpikeHistogram);
+
+	Line += TEXT("},\"edges\":[");
+	for (int32 i = 0; i < FDelveDeepFrameTimeHistogram::NumBuckets - 1; ++i)
+	{
+		Line += FString::Printf(i == 0 ? TEXT("%.2f") : TEXT(",%.2f"), FDelveDeepFrameTimeHistogram::BucketUpperEdgesMs[i]);
+	}
+	Line += TEXT("]}");
+
+	return Line;
+}
+
+void FDelveDeepSampledTelemetry::PruneOldSummaries(const FString& Directory)
+{
+	IFileManager& FileManager = IFileManager::Get();
+
+	TArray<FString> Files;
+	FileManager.FindFiles(Files, *FPaths::Combine(Directory, TEXT("FrameSummary_*.jsonl")), true, false);
+
+	// Leave room for the file about to be created
+	if (Files.Num() < MaxSummaryFiles)
+	{
+		return;
+	}
+
+	// Session timestamps in the names sort chronologically
+	Files.Sort();
+	const int32 NumToDelete = Files.Num() - MaxSummaryFiles + 1;
+	for (int32 i = 0; i < NumToDelete; ++i)
+	{
+		FileManager.Delete(*FPaths::Combine(Directory, Files[i]));
+	}
+}
@@ -5,21 +5,29 @@
 // Define cycle stats - Main
 DEFINE_STAT(STAT_DelveDeep_FrameTotal);
 DEFINE_STAT(STAT_DelveDeep_TelemetrySystem);
+DEFINE_STAT(STAT_DelveDeep_ResourceRegen);
+DEFINE_STAT(STAT_DelveDeep_CharacterInitialization);
 
 // Define cycle stats - Combat
 DEFINE_STAT(STAT_DelveDeep_CombatSystem);
 DEFINE_STAT(STAT_DelveDeep_DamageCalculation);
 DEFINE_STAT(STAT_DelveDeep_TargetingSystem);
+DEFINE_STAT(STAT_DelveDeep_ModifierExpiry);
+DEFINE_STAT(STAT_DelveDeep_Cooldowns);
+DEFINE_STAT(STAT_DelveDeep_ProjectileSimulation);
+DEFINE_STAT(STAT_DelveDeep_AoEQueries);
 
 // Define cycle stats - AI
 DEFINE_STAT(STAT_DelveDeep_AISystem);
 DEFINE_STAT(STAT_DelveDeep_BehaviorTree);
 DEFINE_STAT(STAT_DelveDeep_Pathfinding);
+DEFINE_STAT(STAT_DelveDeep_MonsterSimulation);
 
 // Define cycle stats - World
 DEFINE_STAT(STAT_DelveDeep_WorldSystem);
 DEFINE_STAT(STAT_DelveDeep_ProceduralGeneration);
 DEFINE_STAT(STAT_DelveDeep_CollisionDetection);
+DEFINE_STAT(STAT_DelveDeep_SpriteBatching);
 
 // Define cycle stats - UI
 DEFINE_STAT(STAT_DelveDeep_UISystem);
@@ -93,6 +93,18 @@ static FAutoConsoleCommand LoadBaselineCmd(
 	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::LoadBaseline)
 );
 
+static FAutoConsoleCommand LoadBaselinesCmd(
+	TEXT("DelveDeep.Telemetry.LoadBaselines"),
+	TEXT("Load every baseline in a directory. Usage: DelveDeep.Telemetry.LoadBaselines [Directory]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::LoadBaselines)
+);
+
+static FAutoConsoleCommand ExportBaselineJSONCmd(
+	TEXT("DelveDeep.Telemetry.ExportBaselineJSON"),
+	TEXT("Export a baseline as readable JSON. Usage: DelveDeep.Telemetry.ExportBaselineJSON <BaselineName> [FilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ExportBaselineJSON)
+);
+
 static FAutoConsoleCommand DeleteBaselineCmd(
 	TEXT("DelveDeep.Telemetry.DeleteBaseline"),
 	TEXT("Delete a baseline. Usage: DelveDeep.Telemetry.DeleteBaseline <BaselineName>"),
@@ -147,6 +159,30 @@ static FAutoConsoleCommand DisableOverlayCmd(
 	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::DisableOverlay)
 );
 
+static FAutoConsoleCommand StartFeedCmd(
+	TEXT("DelveDeep.Telemetry.StartFeed"),
+	TEXT("Publish per-frame telemetry to shared memory for an external reader. Usage: DelveDeep.Telemetry.StartFeed [RegionName]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::StartFeed)
+);
+
+static FAutoConsoleCommand StopFeedCmd(
+	TEXT("DelveDeep.Telemetry.StopFeed"),
+	TEXT("Stop publishing the shared-memory telemetry feed"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::StopFeed)
+);
+
+static FAutoConsoleCommand StartTraceCmd(
+	TEXT("DelveDeep.Telemetry.StartTrace"),
+	TEXT("Record a timeline trace (frames, systems, memory, asset loads). Usage: DelveDeep.Telemetry.StartTrace [Seconds]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::StartTrace)
+);
+
+static FAutoConsoleCommand StopTraceCmd(
+	TEXT("DelveDeep.Telemetry.StopTrace"),
+	TEXT("Stop the timeline trace and export Chrome trace JSON. Usage: DelveDeep.Telemetry.StopTrace [FilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::StopTrace)
+);
+
 static FAutoConsoleCommand SetOverlayModeCmd(
 	TEXT("DelveDeep.Telemetry.SetOverlayMode"),
 	TEXT("Set overlay mode. Usage: DelveDeep.Telemetry.SetOverlayMode <Minimal|Standard|Detailed>"),
@@ -165,6 +201,36 @@ static FAutoConsoleCommand ShowAssetLoadsCmd(
 	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowAssetLoads)
 );
 
+static FAutoConsoleCommand ShowGCStatsCmd(
+	TEXT("DelveDeep.Telemetry.ShowGCStats"),
+	TEXT("Display garbage collection pauses and per-class UObject churn. Usage: DelveDeep.Telemetry.ShowGCStats [MaxClasses]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowGCStats)
+);
+
+static FAutoConsoleCommand ShowPoolingRecommendationsCmd(
+	TEXT("DelveDeep.Telemetry.ShowPoolingRecommendations"),
+	TEXT("List classes churned often enough to pool. Usage: DelveDeep.Telemetry.ShowPoolingRecommendations [MinDestroysPerMinute]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowPoolingRecommendations)
+);
+
+static FAutoConsoleCommand ShowEntityLimitsCmd(
+	TEXT("DelveDeep.Telemetry.ShowEntityLimits"),
+	TEXT("Display adaptive entity spawn caps"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowEntityLimits)
+);
+
+static FAutoConsoleCommand ShowSampledTelemetryCmd(
+	TEXT("DelveDeep.Telemetry.ShowSampledTelemetry"),
+	TEXT("Display the current sampled frame telemetry interval. Usage: DelveDeep.Telemetry.ShowSampledTelemetry [write]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowSampledTelemetry)
+);
+
+static FAutoConsoleCommand ShowDeferredWorkCmd(
+	TEXT("DelveDeep.Telemetry.ShowDeferredWork"),
+	TEXT("Display deferred work queues, budgets spent and starvation per system"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&FDelveDeepTelemetryCommands::ShowDeferredWork)
+);
+
 // Implementation
 
 void FDelveDeepTelemetryCommands::RegisterCommands()
@@ -532,6 +598,50 @@ void FDelveDeepTelemetryCommands::LoadBaseline(const TArray<FString>& Args)
 	}
 }
 
+void FDelveDeepTelemetryCommands::LoadBaselines(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const FString Directory = Args.Num() > 0 ? Args[0] : TEXT("");
+	const int32 NumLoaded = Telemetry->LoadAllBaselinesInDirectory(Directory);
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Loaded %d baselines (%d available)"),
+		NumLoaded, Telemetry->GetAvailableBaselines().Num());
+}
+
+void FDelveDeepTelemetryCommands::ExportBaselineJSON(const TArray<FString>& Args)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Usage: DelveDeep.Telemetry.ExportBaselineJSON <BaselineName> [FilePath]"));
+		return;
+	}
+
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const FName BaselineName = FName(*Args[0]);
+	const FString FilePath = Args.Num() > 1 ? Args[1] : TEXT("");
+
+	if (Telemetry->ExportBaselineJSON(BaselineName, FilePath))
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Exported baseline '%s' as JSON"), *BaselineName.ToString());
+	}
+	else
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Failed to export baseline '%s'"), *BaselineName.ToString());
+	}
+}
+
 void FDelveDeepTelemetryCommands::DeleteBaseline(const TArray<FString>& Args)
 {
 	if (Args.Num() < 1)
@@ -772,6 +882,84 @@ void FDelveDeepTelemetryCommands::DisableOverlay(const TArray<FString>& Args)
 	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Performance overlay disabled"));
 }
 
+void FDelveDeepTelemetryCommands::StartFeed(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const FString RegionName = Args.Num() > 0 ? Args[0] : FString();
+	if (Telemetry->StartTelemetryFeed(RegionName))
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display,
+			TEXT("Telemetry feed started on '%s'; read it with -run=DelveDeepTelemetryFeedReader"),
+			*Telemetry->GetTelemetryFeed().GetRegionName());
+	}
+	else
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Failed to start telemetry feed"));
+	}
+}
+
+void FDelveDeepTelemetryCommands::StopFeed(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	Telemetry->StopTelemetryFeed();
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Telemetry feed stopped"));
+}
+
+void FDelveDeepTelemetryCommands::StartTrace(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const float DurationSeconds = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.0f;
+	if (Telemetry->StartTraceCapture(DurationSeconds))
+	{
+		if (DurationSeconds > 0.0f)
+		{
+			UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Trace capture started for %.1f seconds"), DurationSeconds);
+		}
+		else
+		{
+			UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Trace capture started; stop it with DelveDeep.Telemetry.StopTrace"));
+		}
+	}
+	else
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Failed to start trace capture"));
+	}
+}
+
+void FDelveDeepTelemetryCommands::StopTrace(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const FString FilePath = Args.Num() > 0 ? Args[0] : FString();
+	if (!Telemetry->StopTraceCapture(FilePath))
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Failed to stop trace capture"));
+	}
+}
+
 void FDelveDeepTelemetryCommands::SetOverlayMode(const TArray<FString>& Args)
 {
 	if (Args.Num() < 1)
@@ -856,6 +1044,105 @@ void FDelveDeepTelemetryCommands::ShowGameplayMetrics(const TArray<FString>& Arg
 	}
 }
 
+void FDelveDeepTelemetryCommands::ShowEntityLimits(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Adaptive Entity Limits (%s) ==="),
+		Telemetry->AreAdaptiveEntityLimitsEnabled() ? TEXT("enabled") : TEXT("disabled"));
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-15s %10s %10s %10s %10s %12s %10s"),
+		TEXT("Entity Type"), TEXT("Current"), TEXT("Cap"), TEXT("Min"), TEXT("Max"), TEXT("Cost/Entity"), TEXT("Denied"));
+
+	for (const FAdaptiveEntityLimit& Limit : Telemetry->GetAllAdaptiveEntityLimits())
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-15s %10d %10d %10d %10d %10.4fms %10d"),
+			*Limit.EntityType.ToString(),
+			Telemetry->GetEntityCount(Limit.EntityType),
+			Limit.CurrentLimit,
+			Limit.MinLimit,
+			Limit.MaxLimit,
+			Limit.CostPerEntityMs,
+			Limit.DeniedSpawns);
+	}
+}
+
+void FDelveDeepTelemetryCommands::ShowSampledTelemetry(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const FDelveDeepSampledTelemetry& Sampled = Telemetry->GetSampledTelemetry();
+	const FDelveDeepFrameTimeHistogram& Histogram = Sampled.GetSampledHistogram();
+	const FDelveDeepFrameTimeHistogram& Spikes = Sampled.GetSpikeHistogram();
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Sampled Telemetry (%s) ==="),
+		Telemetry->IsSampledTelemetryEnabled() ? TEXT("enabled") : TEXT("disabled"));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Frames Seen: %u (sampled %u, spikes %u)"),
+		Sampled.GetFramesSeen(), Histogram.TotalCount, Spikes.TotalCount);
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Sampled: mean %s, p50 %s, p95 %s, p99 %s, max %s"),
+		*FormatTime(Histogram.GetMeanMs()),
+		*FormatTime(Histogram.GetPercentileMs(0.5f)),
+		*FormatTime(Histogram.GetPercentileMs(0.95f)),
+		*FormatTime(Histogram.GetPercentileMs(0.99f)),
+		*FormatTime(Histogram.MaxMs));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Spikes: mean %s, max %s"),
+		*FormatTime(Spikes.GetMeanMs()), *FormatTime(Spikes.MaxMs));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Summary File: %s"), *Sampled.GetSummaryFilePath());
+
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("write"), ESearchCase::IgnoreCase))
+	{
+		Telemetry->WriteSampledTelemetrySummary();
+	}
+}
+
+void FDelveDeepTelemetryCommands::ShowDeferredWork(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const TArray<FDeferredWorkSystemStats> AllStats = Telemetry->GetAllDeferredWorkStats();
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Deferred Work (%s last frame) ==="),
+		*FormatTime(Telemetry->GetDeferredWorkScheduler().GetLastFrameSpentMs()));
+
+	if (AllStats.Num() == 0)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("No deferred work submitted"));
+		return;
+	}
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-20s %8s %10s %12s %10s %10s %10s %10s"),
+		TEXT("System"), TEXT("Pending"), TEXT("Completed"), TEXT("Spent/Allow"), TEXT("Oldest"), TEXT("AvgWait"), TEXT("Starved"), TEXT("NoBudget"));
+
+	for (const FDeferredWorkSystemStats& Stats : AllStats)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-20s %8d %10d %5.2f/%5.2f %10d %10.1f %10d %10d"),
+			*Stats.SystemName.ToString(),
+			Stats.PendingItems,
+			Stats.CompletedItems,
+			Stats.LastFrameSpentMs,
+			Stats.LastFrameAllowanceMs,
+			Stats.OldestPendingFrames,
+			Stats.AverageWaitFrames,
+			Stats.StarvedItems,
+			Stats.StarvedFrames);
+	}
+}
+
 void FDelveDeepTelemetryCommands::ShowAssetLoads(const TArray<FString>& Args)
 {
 	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
@@ -872,6 +1159,7 @@ void FDelveDeepTelemetryCommands::ShowAssetLoads(const TArray<FString>& Args)
 	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Asset Loading Statistics ==="));
 	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Total Loads: %d"), TotalLoads);
 	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Slow Loads (>100ms): %d"), SlowLoads);
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Sync Loads During Gameplay: %d"), Telemetry->GetGameplaySyncLoadCount());
 	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT(""));
 
 	if (AllStats.Num() > 0)
@@ -897,10 +1185,12 @@ void FDelveDeepTelemetryCommands::ShowAssetLoads(const TArray<FString>& Args)
 			UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("\nSlowest Asset Loads:"));
 			for (const FAssetLoadRecord& Record : SlowestLoads)
 			{
-				UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("  %s: %s (%s)"),
+				UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("  %s: %s (%s, %s, %d deps)"),
 					*FormatTime(Record.LoadTimeMs),
 					*Record.AssetPath,
-					*Record.AssetType.ToString());
+					*Record.AssetType.ToString(),
+					Record.bSynchronous ? TEXT("Sync") : TEXT("Async"),
+					Record.DependencyCount);
 			}
 		}
 	}
@@ -909,3 +1199,72 @@ void FDelveDeepTelemetryCommands::ShowAssetLoads(const TArray<FString>& Args)
 		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("No asset loads recorded"));
 	}
 }
+
+void FDelveDeepTelemetryCommands::ShowGCStats(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const int32 MaxClasses = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+	const FDelveDeepGCStats Stats = Telemetry->GetGCStats();
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Garbage Collection ==="));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Collections: %d (%d over %s)"),
+		Stats.CollectionCount, Stats.SpikeCount, *FormatTime(FDelveDeepGCTracker::SpikeThresholdMs));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Average Pause: %s"), *FormatTime(Stats.AverageGCTimeMs));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Peak Pause: %s"), *FormatTime(Stats.PeakGCTimeMs));
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("Last Pause: %s (%d objects purged)"),
+		*FormatTime(Stats.LastGCTimeMs), Stats.LastObjectsPurged);
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("UObjects: %d (peak %d)"), Stats.UObjectCount, Stats.PeakUObjectCount);
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT(""));
+
+	const TArray<FDelveDeepClassChurn> Churn = Telemetry->GetClassChurn(MaxClasses);
+	if (Churn.Num() > 0)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-40s %10s %10s %10s %10s"),
+			TEXT("Class"), TEXT("Spawned"), TEXT("Destroyed"), TEXT("Live"), TEXT("Peak"));
+
+		for (const FDelveDeepClassChurn& Entry : Churn)
+		{
+			UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%-40s %10d %10d %10d %10d"),
+				*Entry.ClassName.ToString(), Entry.Spawned, Entry.Destroyed, Entry.Live, Entry.PeakLive);
+		}
+	}
+	else
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("No DelveDeep class churn recorded"));
+	}
+}
+
+void FDelveDeepTelemetryCommands::ShowPoolingRecommendations(const TArray<FString>& Args)
+{
+	UDelveDeepTelemetrySubsystem* Telemetry = GetTelemetrySubsystem();
+	if (!Telemetry)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Error, TEXT("Telemetry subsystem not available"));
+		return;
+	}
+
+	const float MinDestroysPerMinute = Args.Num() > 0
+		? FMath::Max(0.0f, FCString::Atof(*Args[0]))
+		: FDelveDeepGCTracker::DefaultPoolingThresholdPerMinute;
+
+	const TArray<FDelveDeepPoolingRecommendation> Recommendations = Telemetry->GetPoolingRecommendations(MinDestroysPerMinute);
+
+	UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("=== Pooling Recommendations (>= %.0f destroys/min) ==="), MinDestroysPerMinute);
+	if (Recommendations.Num() == 0)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("No class churns enough to need pooling"));
+		return;
+	}
+
+	for (const FDelveDeepPoolingRecommendation& Recommendation : Recommendations)
+	{
+		UE_LOG(LogDelveDeepTelemetryCommands, Display, TEXT("%s: pool %d - %s"),
+			*Recommendation.ClassName.ToString(), Recommendation.SuggestedPoolSize, *Recommendation.Reason);
+	}
+}
@@ -0,0 +1,310 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepTelemetryFeed.h"
+#include "DelveDeepFramePerformanceTracker.h"
+#include "DelveDeepSystemProfiler.h"
+#include "DelveDeepMemoryTracker.h"
+#include "DelveDeepGameplayMetrics.h"
+#include "DelveDeepEntityLimitController.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Copy an FName into a fixed ANSI buffer without allocating */
+	void CopyFeedName(FName Name, ANSICHAR (&Out)[DelveDeepTelemetryFeed::NameLength])
+	{
+		TCHAR Wide[NAME_SIZE];
+		Name.ToString(Wide, NAME_SIZE);
+
+		int32 Index = 0;
+		for (; Index < DelveDeepTelemetryFeed::NameLength - 1 && Wide[Index] != 0; ++Index)
+		{
+			Out[Index] = Wide[Index] < 128 ? static_cast<ANSICHAR>(Wide[Index]) : '?';
+		}
+		Out[Index] = 0;
+	}
+}
+
+FDelveDeepTelemetryFeedWriter::FDelveDeepTelemetryFeedWriter()
+	: Region(nullptr)
+	, Header(nullptr)
+	, Frames(nullptr)
+	, NextSequence(1)
+{
+	FMemory::Memzero(Scratch);
+}
+
+FDelveDeepTelemetryFeedWriter::~FDelveDeepTelemetryFeedWriter()
+{
+	Close();
+}
+
+SIZE_T FDelveDeepTelemetryFeedWriter::GetRegionSize()
+{
+	return sizeof(FDelveDeepFeedHeader) + sizeof(FDelveDeepFeedFrame) * DelveDeepTelemetryFeed::Capacity;
+}
+
+bool FDelveDeepTelemetryFeedWriter::Open(const FString& InRegionName)
+{
+	Close();
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(InRegionName, true,
+		FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, GetRegionSize());
+
+	if (!Region)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("Failed to create telemetry feed region '%s' (%llu bytes)"),
+			*InRegionName, static_cast<uint64>(GetRegionSize()));
+		return false;
+	}
+
+	uint8* Base = static_cast<uint8*>(Region->GetAddress());
+	Header = reinterpret_cast<FDelveDeepFeedHeader*>(Base);
+	Frames = reinterpret_cast<FDelveDeepFeedFrame*>(Base + sizeof(FDelveDeepFeedHeader));
+	RegionName = InRegionName;
+	NextSequence = 1;
+
+	// Invalidate the header first so a reader attached to a previous session resynchronizes
+	FPlatformAtomics::AtomicStore(&Header->PublishedSequence, 0);
+	FMemory::Memzero(Frames, sizeof(FDelveDeepFeedFrame) * DelveDeepTelemetryFeed::Capacity);
+
+	Header->Version = DelveDeepTelemetryFeed::Version;
+	Header->FrameSize = sizeof(FDelveDeepFeedFrame);
+	Header->Capacity = DelveDeepTelemetryFeed::Capacity;
+	Header->WriterProcessId = FPlatformProcess::GetCurrentProcessId();
+	Header->Padding = 0;
+	Header->WriterStartSeconds = FPlatformTime::Seconds();
+	FPlatformMisc::MemoryBarrier();
+	Header->Magic = DelveDeepTelemetryFeed::Magic;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Telemetry feed publishing to shared memory '%s' (%d frames, %llu bytes)"),
+		*RegionName, DelveDeepTelemetryFeed::Capacity, static_cast<uint64>(GetRegionSize()));
+
+	return true;
+}
+
+void FDelveDeepTelemetryFeedWriter::Close()
+{
+	if (!Region)
+	{
+		return;
+	}
+
+	// Readers treat a cleared magic as "writer gone"
+	Header->Magic = 0;
+	FPlatformMisc::MemoryBarrier();
+
+	FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	Region = nullptr;
+	Header = nullptr;
+	Frames = nullptr;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Telemetry feed '%s' closed after %lld frames"),
+		*RegionName, NextSequence - 1);
+}
+
+void FDelveDeepTelemetryFeedWriter::PublishFrame(float DeltaTime,
+	const FFramePerformanceTracker& FrameTracker,
+	const FSystemProfiler& Profiler,
+	const FMemoryTracker& MemoryTracker,
+	const FDelveDeepGameplayMetrics& Metrics,
+	const FDelveDeepEntityLimitController* LimitController,
+	const FDelveDeepFeedCounters& Counters)
+{
+	if (!Region)
+	{
+		return;
+	}
+
+	FDelveDeepFeedFrame& Frame = Scratch;
+	Frame.FrameNumber = GFrameCounter;
+	Frame.TimeSeconds = FPlatformTime::Seconds();
+	Frame.FrameTimeMs = DeltaTime * 1000.0f;
+	Frame.AverageFPS = FrameTracker.GetAverageFPS();
+
+	const FMemorySnapshot Snapshot = MemoryTracker.GetCurrentSnapshot();
+	Frame.TotalMemoryBytes = Snapshot.TotalMemory;
+	Frame.NativeMemoryBytes = Snapshot.NativeMemory;
+
+	Frame.TotalEventsBroadcast = Counters.TotalEventsBroadcast;
+	Frame.TotalBudgetViolations = Counters.TotalBudgetViolations;
+	Frame.TotalGameplaySyncLoads = Counters.TotalGameplaySyncLoads;
+
+	Frame.NumSystems = 0;
+	for (const FSystemPerformanceData& System : Profiler.GetAllSystemData())
+	{
+		if (Frame.NumSystems >= DelveDeepTelemetryFeed::MaxSystems)
+		{
+			break;
+		}
+
+		FDelveDeepFeedSystemSample& Sample = Frame.Systems[Frame.NumSystems++];
+		CopyFeedName(System.SystemName, Sample.Name);
+		Sample.TimeMs = static_cast<float>(System.CycleTimeMs);
+		Sample.BudgetMs = static_cast<float>(System.BudgetTimeMs);
+	}
+
+	Frame.NumEntityTypes = 0;
+	for (const auto& Pair : Metrics.GetAllEntityCounts())
+	{
+		if (Frame.NumEntityTypes >= DelveDeepTelemetryFeed::MaxEntityTypes)
+		{
+			break;
+		}
+
+		FDelveDeepFeedEntitySample& Sample = Frame.Entities[Frame.NumEntityTypes++];
+		CopyFeedName(Pair.Key, Sample.Name);
+		Sample.Count = Pair.Value.CurrentCount;
+		Sample.Limit = LimitController ? LimitController->GetLimit(Pair.Key) : 0;
+	}
+
+	PublishFrame(Frame);
+}
+
+void FDelveDeepTelemetryFeedWriter::PublishFrame(const FDelveDeepFeedFrame& Frame)
+{
+	if (!Region)
+	{
+		return;
+	}
+
+	const int64 Sequence = NextSequence++;
+	FDelveDeepFeedFrame& Slot = Frames[Sequence % DelveDeepTelemetryFeed::Capacity];
+
+	// Mark the slot as in-flight, copy the payload, then publish slot and header in order
+	FPlatformAtomics::AtomicStore(&Slot.Sequence, 0);
+	FPlatformMisc::MemoryBarrier();
+	FMemory::Memcpy(reinterpret_cast<uint8*>(&Slot) + sizeof(int64),
+		reinterpret_cast<const uint8*>(&Frame) + sizeof(int64),
+		sizeof(FDelveDeepFeedFrame) - sizeof(int64));
+	FPlatformMisc::MemoryBarrier();
+	FPlatformAtomics::AtomicStore(&Slot.Sequence, Sequence);
+	FPlatformAtomics::AtomicStore(&Header->PublishedSequence, Sequence);
+}
+
+FDelveDeepTelemetryFeedReader::FDelveDeepTelemetryFeedReader()
+	: Region(nullptr)
+	, Header(nullptr)
+	, Frames(nullptr)
+	, NextSequence(1)
+	, DroppedFrames(0)
+{
+}
+
+FDelveDeepTelemetryFeedReader::~FDelveDeepTelemetryFeedReader()
+{
+	Close();
+}
+
+bool FDelveDeepTelemetryFeedReader::Open(const FString& RegionName)
+{
+	Close();
+
+	Region = FPlatformMemory::MapNamedSharedMemoryRegion(RegionName, false,
+		FPlatformMemory::ESharedMemoryAccess::Read, FDelveDeepTelemetryFeedWriter::GetRegionSize());
+
+	if (!Region)
+	{
+		return false;
+	}
+
+	const uint8* Base = static_cast<const uint8*>(Region->GetAddress());
+	Header = reinterpret_cast<const FDelveDeepFeedHeader*>(Base);
+	Frames = reinterpret_cast<const FDelveDeepFeedFrame*>(Base + sizeof(FDelveDeepFeedHeader));
+
+	if (Header->Magic != DelveDeepTelemetryFeed::Magic
+		|| Header->Version != DelveDeepTelemetryFeed::Version
+		|| Header->FrameSize != sizeof(FDelveDeepFeedFrame)
+		|| Header->Capacity != DelveDeepTelemetryFeed::Capacity)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning,
+			TEXT("Telemetry feed '%s' has an incompatible layout (magic %08x, version %u, frame %u bytes, capacity %u)"),
+			*RegionName, Header->Magic, Header->Version, Header->FrameSize, Header->Capacity);
+		Close();
+		return false;
+	}
+
+	// Start from the live edge rather than replaying the whole ring
+	NextSequence = GetPublishedSequence() + 1;
+	DroppedFrames = 0;
+
+	return true;
+}
+
+void FDelveDeepTelemetryFeedReader::Close()
+{
+	if (Region)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+	}
+
+	Region = nullptr;
+	Header = nullptr;
+	Frames = nullptr;
+}
+
+int64 FDelveDeepTelemetryFeedReader::GetPublishedSequence() const
+{
+	return Header ? FPlatformAtomics::AtomicRead(&Header->PublishedSequence) : 0;
+}
+
+int32 FDelveDeepTelemetryFeedReader::ReadNewFrames(TArray<FDelveDeepFeedFrame>& OutFrames, int32 MaxFrames)
+{
+	if (!IsWriterActive())
+	{
+		return 0;
+	}
+
+	const int64 Published = GetPublishedSequence();
+
+	// Writer restarted the feed
+	if (Published < NextSequence - 1)
+	{
+		NextSequence = 1;
+	}
+
+	// Skip frames the writer has already lapped
+	const int64 Oldest = FMath::Max<int64>(1, Published - DelveDeepTelemetryFeed::Capacity + 1);
+	if (NextSequence < Oldest)
+	{
+		DroppedFrames += Oldest - NextSequence;
+		NextSequence = Oldest;
+	}
+
+	int32 NumRead = 0;
+	while (NextSequence <= Published && NumRead < MaxFrames)
+	{
+		const FDelveDeepFeedFrame& Slot = Frames[NextSequence % DelveDeepTelemetryFeed::Capacity];
+
+		const int64 Before = FPlatformAtomics::AtomicRead(&Slot.Sequence);
+		if (Before == NextSequence)
+		{
+			FDelveDeepFeedFrame& Copy = OutFrames.AddUninitialized_GetRef();
+			FMemory::Memcpy(&Copy, &Slot, sizeof(FDelveDeepFeedFrame));
+			FPlatformMisc::MemoryBarrier();
+
+			// Writer wrapped onto this slot during the copy
+			if (FPlatformAtomics::AtomicRead(&Slot.Sequence) != Before)
+			{
+				OutFrames.Pop(EAllowShrinking::No);
+				DroppedFrames++;
+			}
+			else
+			{
+				Copy.Sequence = Before;
+				NumRead++;
+			}
+		}
+		else
+		{
+			DroppedFrames++;
+		}
+
+		NextSequence++;
+	}
+
+	return NumRead;
+}
@@ -0,0 +1,208 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepTelemetryFeedReaderCommandlet.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDelveDeepTelemetryFeed, Log, All);
+
+namespace
+{
+	/** Seconds to wait for the game to create the feed */
+	constexpr double AttachTimeoutSeconds = 30.0;
+
+	/** Seconds without new frames before the writer is considered stalled */
+	constexpr double StallWarningSeconds = 2.0;
+}
+
+UDelveDeepTelemetryFeedReaderCommandlet::UDelveDeepTelemetryFeedReaderCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UDelveDeepTelemetryFeedReaderCommandlet::Main(const FString& Params)
+{
+	FString FeedName = DelveDeepTelemetryFeed::DefaultRegionName();
+	FString Mode = TEXT("Summary");
+	float IntervalSeconds = 1.0f;
+	float DurationSeconds = 0.0f;
+	int32 PollHz = 240;
+
+	FParse::Value(*Params, TEXT("Feed="), FeedName);
+	FParse::Value(*Params, TEXT("Mode="), Mode);
+	FParse::Value(*Params, TEXT("Interval="), IntervalSeconds);
+	FParse::Value(*Params, TEXT("Duration="), DurationSeconds);
+	FParse::Value(*Params, TEXT("PollHz="), PollHz);
+
+	const bool bLogFrames = Mode.Equals(TEXT("Frames"), ESearchCase::IgnoreCase);
+	IntervalSeconds = FMath::Max(0.1f, IntervalSeconds);
+	const float PollSeconds = 1.0f / FMath::Clamp(PollHz, 1, 1000);
+
+	FDelveDeepTelemetryFeedReader Reader;
+
+	UE_LOG(LogDelveDeepTelemetryFeed, Display, TEXT("Waiting for telemetry feed '%s'..."), *FeedName);
+	const double AttachStart = FPlatformTime::Seconds();
+	while (!Reader.Open(FeedName))
+	{
+		if (FPlatformTime::Seconds() - AttachStart > AttachTimeoutSeconds)
+		{
+			UE_LOG(LogDelveDeepTelemetryFeed, Error,
+				TEXT("Telemetry feed '%s' not found; start the game with -TelemetryFeed"), *FeedName);
+			return 2;
+		}
+		FPlatformProcess::Sleep(0.25f);
+	}
+
+	UE_LOG(LogDelveDeepTelemetryFeed, Display, TEXT("Attached to '%s' (writer pid %u)"),
+		*FeedName, Reader.GetWriterProcessId());
+
+	TArray<FDelveDeepFeedFrame> Incoming;
+	TArray<FDelveDeepFeedFrame> Window;
+	Incoming.Reserve(DelveDeepTelemetryFeed::Capacity);
+
+	const double StartTime = FPlatformTime::Seconds();
+	double LastSummaryTime = StartTime;
+	double LastFrameTime = StartTime;
+	bool bStallReported = false;
+
+	while (!IsEngineExitRequested())
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (DurationSeconds > 0.0f && Now - StartTime >= DurationSeconds)
+		{
+			break;
+		}
+
+		if (!Reader.IsWriterActive())
+		{
+			UE_LOG(LogDelveDeepTelemetryFeed, Display, TEXT("Writer closed the feed"));
+			break;
+		}
+
+		Incoming.Reset();
+		if (Reader.ReadNewFrames(Incoming) > 0)
+		{
+			LastFrameTime = Now;
+			bStallReported = false;
+
+			for (const FDelveDeepFeedFrame& Frame : Incoming)
+			{
+				if (bLogFrames)
+				{
+					LogFrame(Frame);
+				}
+			}
+
+			if (!bLogFrames)
+			{
+				Window.Append(Incoming);
+			}
+		}
+		else if (!bStallReported && Now - LastFrameTime > StallWarningSeconds)
+		{
+			UE_LOG(LogDelveDeepTelemetryFeed, Warning, TEXT("No frames for %.1fs (game paused, hitching or closed)"),
+				Now - LastFrameTime);
+			bStallReported = true;
+		}
+
+		if (!bLogFrames && Now - LastSummaryTime >= IntervalSeconds)
+		{
+			LogSummary(Window, Reader.GetDroppedFrames());
+			Window.Reset();
+			LastSummaryTime = Now;
+		}
+
+		FPlatformProcess::Sleep(PollSeconds);
+	}
+
+	UE_LOG(LogDelveDeepTelemetryFeed, Display, TEXT("Reader finished (last sequence %lld, dropped %lld)"),
+		Reader.GetPublishedSequence(), Reader.GetDroppedFrames());
+	return 0;
+}
+
+void UDelveDeepTelemetryFeedReaderCommandlet::LogFrame(const FDelveDeepFeedFrame& Frame)
+{
+	FString Systems;
+	for (int32 i = 0; i < Frame.NumSystems; ++i)
+	{
+		const FDelveDeepFeedSystemSample& System = Frame.Systems[i];
+		if (System.TimeMs > 0.0f)
+		{
+			Systems += FString::Printf(TEXT(" %s=%.2f"), ANSI_TO_TCHAR(System.Name), System.TimeMs);
+		}
+	}
+
+	FString Entities;
+	for (int32 i = 0; i < Frame.NumEntityTypes; ++i)
+	{
+		Entities += FString::Printf(TEXT(" %s=%d"), ANSI_TO_TCHAR(Frame.Entities[i].Name), Frame.Entities[i].Count);
+	}
+
+	UE_LOG(LogDelveDeepTelemetryFeed, Display, TEXT("#%lld frame %llu: %.2fms mem %.1fMB |%s |%s"),
+		Frame.Sequence, Frame.FrameNumber, Frame.FrameTimeMs,
+		Frame.TotalMemoryBytes / (1024.0 * 1024.0), *Systems, *Entities);
+}
+
+void UDelveDeepTelemetryFeedReaderCommandlet::LogSummary(const TArray<FDelveDeepFeedFrame>& Window, int64 DroppedFrames)
+{
+	if (Window.Num() == 0)
+	{
+		return;
+	}
+
+	const FDelveDeepFeedFrame& First = Window[0];
+	const FDelveDeepFeedFrame& Last = Window.Last();
+
+	float SumMs = 0.0f;
+	float MaxMs = 0.0f;
+	TMap<FString, float> SystemPeaks;
+	for (const FDelveDeepFeedFrame& Frame : Window)
+	{
+		SumMs += Frame.FrameTimeMs;
+		MaxMs = FMath::Max(MaxMs, Frame.FrameTimeMs);
+
+		for (int32 i = 0; i < Frame.NumSystems; ++i)
+		{
+			float& Peak = SystemPeaks.FindOrAdd(ANSI_TO_TCHAR(Frame.Systems[i].Name));
+			Peak = FMath::Max(Peak, Frame.Systems[i].TimeMs);
+		}
+	}
+
+	// Heaviest three systems by peak in the window
+	SystemPeaks.ValueSort([](float A, float B) { return A > B; });
+	FString TopSystems;
+	int32 Listed = 0;
+	for (const auto& Pair : SystemPeaks)
+	{
+		if (Listed++ >= 3 || Pair.Value <= 0.0f)
+		{
+			break;
+		}
+		TopSystems += FString::Printf(TEXT(" %s=%.2f"), *Pair.Key, Pair.Value);
+	}
+
+	FString Entities;
+	for (int32 i = 0; i < Last.NumEntityTypes; ++i)
+	{
+		Entities += FString::Printf(TEXT(" %s=%d/%d"),
+			ANSI_TO_TCHAR(Last.Entities[i].Name), Last.Entities[i].Count, Last.Entities[i].Limit);
+	}
+
+	UE_LOG(LogDelveDeepTelemetryFeed, Display,
+		TEXT("%d frames | avg %.2fms max %.2fms (%.1f FPS) | mem %.1fMB | events +%d violations +%d syncloads +%d | peak:%s | entities:%s | dropped %lld"),
+		Window.Num(),
+		SumMs / Window.Num(),
+		MaxMs,
+		Last.AverageFPS,
+		Last.TotalMemoryBytes / (1024.0 * 1024.0),
+		Last.TotalEventsBroadcast - First.TotalEventsBroadcast,
+		Last.TotalBudgetViolations - First.TotalBudgetViolations,
+		Last.TotalGameplaySyncLoads - First.TotalGameplaySyncLoads,
+		*TopSystems,
+		*Entities,
+		DroppedFrames);
+}
@@ -2,11 +2,14 @@
 
 #include "DelveDeepTelemetrySubsystem.h"
 #include "DelveDeepAssetLoadTracker.h"
+#include "DelveDeepEventSubsystem.h"
 #include "DelveDeepValidation.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "HAL/PlatformFileManager.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -25,6 +28,9 @@ void UDelveDeepTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collecti
 {
 	Super::Initialize(Collection);
 
+	// Sampled telemetry is independent of bTelemetryEnabled so shipping gets field data cheaply
+	SampledTelemetry.ConfigureFromConsoleVariables();
+
 #if UE_BUILD_SHIPPING
 	// In shipping builds, telemetry is minimal to reduce overhead
 	UE_LOG(LogDelveDeepTelemetry, Verbose, TEXT("Telemetry Subsystem initializing (Shipping - Minimal Mode)..."));
@@ -52,6 +58,31 @@ void UDelveDeepTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collecti
 	// Register default system budgets
 	RegisterDefaultBudgets();
 
+	// Capture package loads from engine delegates; gameplay sync loads become budget violations
+	AssetLoadTracker.OnGameplaySyncLoad.BindUObject(this, &UDelveDeepTelemetrySubsystem::HandleGameplaySyncAssetLoad);
+	AssetLoadTracker.StartAutomaticCapture();
+
+	// Time collections and count per-class UObject churn
+	GCTracker.StartTracking();
+
+	// -TelemetryFeed or -TelemetryFeed=<RegionName> publishes frames for an external reader
+	FString FeedRegionName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("TelemetryFeed="), FeedRegionName))
+	{
+		StartTelemetryFeed(FeedRegionName);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("TelemetryFeed")))
+	{
+		StartTelemetryFeed();
+	}
+
+	// -TelemetryTrace=<Seconds> records a timeline trace from startup
+	float TraceSeconds = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("TelemetryTrace="), TraceSeconds))
+	{
+		StartTraceCapture(TraceSeconds);
+	}
+
 	bInitialized = true;
 	bTelemetryEnabled = true;
 
@@ -63,6 +94,33 @@ void UDelveDeepTelemetrySubsystem::Deinitialize()
 {
 	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Telemetry Subsystem shutting down..."));
 
+	AssetLoadTracker.StopAutomaticCapture();
+	AssetLoadTracker.OnGameplaySyncLoad.Unbind();
+
+	GCTracker.StopTracking();
+
+	TelemetryFeed.Close();
+
+	if (IsTraceCaptureActive())
+	{
+		StopTraceCapture();
+	}
+
+	// Deferred work is optional by contract; owners may already be gone
+	const int32 DroppedWork = DeferredWorkScheduler.GetPendingCount();
+	if (DroppedWork > 0)
+	{
+		UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Dropping %d pending deferred work items"), DroppedWork);
+	}
+	DeferredWorkScheduler.Reset();
+
+	// Write the final partial interval synchronously; the process may exit right after
+	if (FDelveDeepSampledTelemetry::IsEnabledByConsoleVariable())
+	{
+		SampledTelemetry.FlushSummary(false);
+	}
+	SampledTelemetry.WaitForPendingWrites();
+
 	bInitialized = false;
 	bTelemetryEnabled = false;
 
@@ -78,6 +136,24 @@ void UDelveDeepTelemetrySubsystem::Tick(float DeltaTime)
 		return;
 	}
 
+	// Frame spans run from one subsystem tick to the next
+	FDelveDeepTraceRecorder::Get().MarkFrameBoundary(GFrameCounter);
+	TRACE_DELVEDEEP_TELEMETRY();
+
+	// Spawn caps must adapt even when telemetry collection is off (e.g. shipping)
+	if (bAdaptiveEntityLimitsEnabled)
+	{
+		EntityLimitController.Update(DeltaTime, SystemProfiler, GameplayMetrics);
+	}
+
+	// Spend what is left of each system's budget on its deferred work
+	DeferredWorkScheduler.ExecuteFrame(&SystemProfiler);
+
+	if (FDelveDeepSampledTelemetry::IsEnabledByConsoleVariable())
+	{
+		SampledTelemetry.RecordFrame(DeltaTime);
+	}
+
 #if UE_BUILD_SHIPPING
 	// In shipping builds, only track basic frame performance if enabled
 	if (bTelemetryEnabled)
@@ -94,15 +170,43 @@ void UDelveDeepTelemetrySubsystem::Tick(float DeltaTime)
 	// Record frame performance
 	FrameTracker.RecordFrame(DeltaTime);
 
+	if (DeferredWorkScheduler.GetLastFrameSpentMs() > 0.0f)
+	{
+		SystemProfiler.RecordSystemTime(TEXT("DeferredWork"), DeferredWorkScheduler.GetLastFrameSpentMs());
+	}
+
+	// Publish before the profiler rolls over so the feed carries this frame's system times
+	if (TelemetryFeed.IsOpen())
+	{
+		PublishTelemetryFeedFrame(DeltaTime);
+	}
+
 	// Update system profiler frame
 	SystemProfiler.UpdateFrame();
 
 	// Update memory tracking
 	MemoryTracker.UpdateMemorySnapshot();
 
+	// Close this frame's GC time, destroyed objects and UObject count
+	GCTracker.UpdateFrame();
+
+	if (IsTraceCaptureActive())
+	{
+		RecordTraceCounters();
+
+		if (TraceCaptureStopTime > 0.0 && FPlatformTime::Seconds() >= TraceCaptureStopTime)
+		{
+			StopTraceCapture();
+		}
+	}
+
 	// Update gameplay metrics
 	GameplayMetrics.UpdateFrame();
 
+	// Sync loads only count as violations once the game world is running
+	const UWorld* World = GetTickableGameObjectWorld();
+	AssetLoadTracker.SetGameplayActive(World && World->HasBegunPlay());
+
 	// Update overlay frame history if enabled
 	if (bOverlayEnabled && PerformanceOverlay.IsValid())
 	{
@@ -190,6 +294,12 @@ TArray<float> UDelveDeepTelemetrySubsystem::GetFrameTimeHistory(int32 NumFrames)
 
 // System Profiling
 
+void UDelveDeepTelemetrySubsystem::ResetFrameStatistics()
+{
+	FrameTracker.ResetStatistics();
+	SystemProfiler.ResetStatistics();
+}
+
 void UDelveDeepTelemetrySubsystem::RegisterSystemBudget(FName SystemName, float BudgetMs)
 {
 	FDelveDeepValidationContext Context;
@@ -223,6 +333,7 @@ void UDelveDeepTelemetrySubsystem::RegisterSystemBudget(FName SystemName, float
 	}
 
 	SystemProfiler.RegisterSystem(SystemName, BudgetMs);
+	DeferredWorkScheduler.SetSystemBudget(SystemName, BudgetMs);
 }
 
 void UDelveDeepTelemetrySubsystem::LoadBudgetsFromAsset(UDelveDeepPerformanceBudget* BudgetAsset)
@@ -254,6 +365,7 @@ void UDelveDeepTelemetrySubsystem::LoadBudgetsFromAsset(UDelveDeepPerformanceBud
 
 	// Store reference to current budget asset
 	CurrentBudgetAsset = BudgetAsset;
+	EntityLimitController.SetTargetFrameTime(BudgetAsset->TotalFrameBudgetMs);
 
 	UE_LOG(LogDelveDeepTelemetry, Display,
 		TEXT("Loaded %d system budgets from asset '%s'"),
@@ -264,6 +376,9 @@ void UDelveDeepTelemetrySubsystem::LoadBudgetsFromAsset(UDelveDeepPerformanceBud
 void UDelveDeepTelemetrySubsystem::RecordSystemTime(FName SystemName, double CycleTimeMs)
 {
 	SystemProfiler.RecordSystemTime(SystemName, CycleTimeMs);
+
+	// Reported after the system ran, so the span ends at the report
+	FDelveDeepTraceRecorder::Get().RecordSpanEndingNow(SystemName, TEXT("System"), CycleTimeMs);
 }
 
 FSystemPerformanceData UDelveDeepTelemetrySubsystem::GetSystemPerformance(FName SystemName) const
@@ -309,6 +424,8 @@ void UDelveDeepTelemetrySubsystem::RegisterDefaultBudgets()
 	RegisterSystemBudget(TEXT("DamageCalculation"), 0.5f);
 	RegisterSystemBudget(TEXT("TargetingSystem"), 0.5f);
 	RegisterSystemBudget(TEXT("BehaviorTree"), 1.0f);
+	RegisterSystemBudget(TEXT("AILodFull"), 1.0f);
+	RegisterSystemBudget(TEXT("AILodReduced"), 0.5f);
 	RegisterSystemBudget(TEXT("Pathfinding"), 1.0f);
 	RegisterSystemBudget(TEXT("ProceduralGeneration"), 1.0f);
 	RegisterSystemBudget(TEXT("CollisionDetection"), 0.5f);
@@ -318,6 +435,8 @@ void UDelveDeepTelemetrySubsystem::RegisterDefaultBudgets()
 	RegisterSystemBudget(TEXT("EventProcessing"), 0.2f);
 	RegisterSystemBudget(TEXT("DataAssetQuery"), 0.1f);
 	RegisterSystemBudget(TEXT("Validation"), 0.2f);
+	RegisterSystemBudget(TEXT("SyncAssetLoad"), 0.1f);    // Any gameplay-frame sync load is a violation
+	RegisterSystemBudget(TEXT("DeferredWork"), FDelveDeepDeferredWorkScheduler::MaxFrameSpendMs);
 
 	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Registered default system budgets"));
 }
@@ -399,6 +518,104 @@ bool UDelveDeepTelemetrySubsystem::IsOverlayEnabled() const
 	return bOverlayEnabled;
 }
 
+bool UDelveDeepTelemetrySubsystem::StartTelemetryFeed(const FString& RegionName)
+{
+#if UE_BUILD_SHIPPING
+	// Most feed data is compiled out of shipping builds
+	UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Live telemetry feed is not available in shipping builds"));
+	return false;
+#else
+	return TelemetryFeed.Open(RegionName.IsEmpty() ? FString(DelveDeepTelemetryFeed::DefaultRegionName()) : RegionName);
+#endif
+}
+
+void UDelveDeepTelemetrySubsystem::StopTelemetryFeed()
+{
+	TelemetryFeed.Close();
+}
+
+bool UDelveDeepTelemetrySubsystem::StartTraceCapture(float DurationSeconds)
+{
+#if UE_BUILD_SHIPPING
+	// Trace spans are compiled out of shipping builds
+	UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Trace capture is not available in shipping builds"));
+	return false;
+#else
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	if (Recorder.IsCapturing())
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Trace capture already running (%.1fs)"), Recorder.GetCaptureSeconds());
+		return false;
+	}
+
+	Recorder.StartCapture();
+	TraceCaptureStopTime = DurationSeconds > 0.0f ? FPlatformTime::Seconds() + DurationSeconds : 0.0;
+	return true;
+#endif
+}
+
+bool UDelveDeepTelemetrySubsystem::StopTraceCapture(const FString& FilePath)
+{
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	if (!Recorder.IsCapturing())
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("No trace capture is running"));
+		return false;
+	}
+
+	Recorder.StopCapture();
+	TraceCaptureStopTime = 0.0;
+
+	FString SavePath = FilePath;
+	if (SavePath.IsEmpty())
+	{
+		SavePath = FPaths::ProjectSavedDir() / TEXT("Telemetry") / TEXT("Traces") /
+			FString::Printf(TEXT("Trace_%s.json"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(SavePath));
+
+	return Recorder.ExportChromeTrace(SavePath);
+}
+
+void UDelveDeepTelemetrySubsystem::RecordTraceCounters()
+{
+	static const FName TotalMemoryName(TEXT("TotalMemoryMB"));
+	static const FName NativeMemoryName(TEXT("NativeMemoryMB"));
+
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	const FMemorySnapshot Snapshot = MemoryTracker.GetCurrentSnapshot();
+	Recorder.RecordCounter(TotalMemoryName, Snapshot.TotalMemory / (1024.0 * 1024.0));
+	Recorder.RecordCounter(NativeMemoryName, Snapshot.NativeMemory / (1024.0 * 1024.0));
+
+	static const FName UObjectCountName(TEXT("UObjectCount"));
+	Recorder.RecordCounter(UObjectCountName, GCTracker.GetStats().UObjectCount);
+
+	for (const auto& Pair : GameplayMetrics.GetAllEntityCounts())
+	{
+		Recorder.RecordCounter(Pair.Key, Pair.Value.CurrentCount);
+	}
+}
+
+void UDelveDeepTelemetrySubsystem::PublishTelemetryFeedFrame(float DeltaTime)
+{
+	FDelveDeepFeedCounters Counters;
+	Counters.TotalBudgetViolations = SystemProfiler.GetTotalViolationCount();
+	Counters.TotalGameplaySyncLoads = AssetLoadTracker.GetGameplaySyncLoadCount();
+
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (const UDelveDeepEventSubsystem* EventSubsystem = GameInstance->GetSubsystem<UDelveDeepEventSubsystem>())
+		{
+			Counters.TotalEventsBroadcast = EventSubsystem->GetPerformanceMetrics().TotalEventsBroadcast;
+		}
+	}
+
+	TelemetryFeed.PublishFrame(DeltaTime, FrameTracker, SystemProfiler, MemoryTracker, GameplayMetrics,
+		bAdaptiveEntityLimitsEnabled ? &EntityLimitController : nullptr, Counters);
+}
+
 void UDelveDeepTelemetrySubsystem::SetOverlayMode(EOverlayMode Mode)
 {
 	if (PerformanceOverlay.IsValid())
@@ -422,6 +639,16 @@ EOverlayMode UDelveDeepTelemetrySubsystem::GetOverlayMode() const
 	return EOverlayMode::Standard;
 }
 
+float UDelveDeepTelemetrySubsystem::GetOverlayRenderCostMs() const
+{
+	if (PerformanceOverlay.IsValid())
+	{
+		return PerformanceOverlay->GetAverageRenderCostMs();
+	}
+
+	return 0.0f;
+}
+
 void UDelveDeepTelemetrySubsystem::RenderPerformanceOverlay(UCanvas* Canvas)
 {
 	if (!bOverlayEnabled || !PerformanceOverlay.IsValid())
@@ -446,6 +673,7 @@ void UDelveDeepTelemetrySubsystem::RenderPerformanceOverlay(UCanvas* Canvas)
 		const FMemorySnapshot MemoryData = GetCurrentMemorySnapshot();
 
 		// Render overlay
+		PerformanceOverlay->SetGCStats(GCTracker.GetStats());
 		PerformanceOverlay->Render(Canvas, FrameData, SystemData, MemoryData);
 	}
 	catch (const std::exception& e)
@@ -819,6 +1047,88 @@ int32 UDelveDeepTelemetrySubsystem::GetRecommendedEntityLimit(FName EntityType)
 	return GameplayMetrics.GetRecommendedLimit(EntityType);
 }
 
+void UDelveDeepTelemetrySubsystem::RecordActorPoolAcquire(FName PoolName, bool bHit, int32 AvailableCount)
+{
+	GameplayMetrics.RecordPoolAcquire(PoolName, bHit, AvailableCount);
+}
+
+void UDelveDeepTelemetrySubsystem::RecordActorPoolRelease(FName PoolName, int32 AvailableCount)
+{
+	GameplayMetrics.RecordPoolRelease(PoolName, AvailableCount);
+}
+
+float UDelveDeepTelemetrySubsystem::GetActorPoolHitRate(FName PoolName) const
+{
+	return GameplayMetrics.GetPoolStats(PoolName).GetHitRate();
+}
+
+TArray<FDelveDeepActorPoolStats> UDelveDeepTelemetrySubsystem::GetAllActorPoolStats() const
+{
+	TArray<FDelveDeepActorPoolStats> Result;
+	GameplayMetrics.GetAllPoolStats().GenerateValueArray(Result);
+	return Result;
+}
+
+// Adaptive Entity Limits
+
+bool UDelveDeepTelemetrySubsystem::CanSpawnEntity(FName EntityType, int32 Count)
+{
+	if (GetSpawnAllowance(EntityType) >= Count)
+	{
+		return true;
+	}
+
+	EntityLimitController.RecordDeniedSpawn(EntityType);
+	return false;
+}
+
+int32 UDelveDeepTelemetrySubsystem::GetSpawnAllowance(FName EntityType) const
+{
+	const int32 Limit = bAdaptiveEntityLimitsEnabled
+		? EntityLimitController.GetLimit(EntityType)
+		: GameplayMetrics.GetRecommendedLimit(EntityType);
+
+	if (Limit <= 0)
+	{
+		return MAX_int32;
+	}
+
+	return FMath::Max(0, Limit - GameplayMetrics.GetEntityCount(EntityType));
+}
+
+int32 UDelveDeepTelemetrySubsystem::GetAdaptiveEntityLimit(FName EntityType) const
+{
+	return EntityLimitController.GetLimit(EntityType);
+}
+
+TArray<FAdaptiveEntityLimit> UDelveDeepTelemetrySubsystem::GetAllAdaptiveEntityLimits() const
+{
+	TArray<FAdaptiveEntityLimit> Result;
+	EntityLimitController.GetAllLimits().GenerateValueArray(Result);
+	return Result;
+}
+
+void UDelveDeepTelemetrySubsystem::ConfigureAdaptiveEntityLimit(FName EntityType, FName CostSystem, int32 MinLimit, int32 MaxLimit)
+{
+	EntityLimitController.ConfigureEntityType(EntityType, CostSystem, MinLimit, MaxLimit);
+}
+
+void UDelveDeepTelemetrySubsystem::SetAdaptiveEntityLimitsEnabled(bool bEnabled)
+{
+	if (bAdaptiveEntityLimitsEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bAdaptiveEntityLimitsEnabled = bEnabled;
+
+	// Start from full caps when re-enabled so stale overload cuts do not linger
+	EntityLimitController.Reset();
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Adaptive entity limits %s"),
+		bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
 // Asset Loading Tracking
 
 void UDelveDeepTelemetrySubsystem::RecordAssetLoad(const FString& AssetPath, float LoadTimeMs, int64 AssetSize, bool bSynchronous)
@@ -831,7 +1141,7 @@ void UDelveDeepTelemetrySubsystem::RecordAssetLoad(const FString& AssetPath, flo
 		return;
 	}
 
-	AssetLoadTracker.RecordAssetLoad(AssetPath, LoadTimeMs, static_cast<uint64>(AssetSize), bSynchronous);
+	AssetLoadTracker.RecordAssetLoad(AssetPath, LoadTimeMs, AssetSize, bSynchronous);
 }
 
 FAssetLoadStatistics UDelveDeepTelemetrySubsystem::GetAssetLoadStatistics(FName AssetType) const
@@ -859,6 +1169,80 @@ int32 UDelveDeepTelemetrySubsystem::GetTotalAssetLoads() const
 	return AssetLoadTracker.GetTotalAssetLoads();
 }
 
+int32 UDelveDeepTelemetrySubsystem::GetGameplaySyncLoadCount() const
+{
+	return AssetLoadTracker.GetGameplaySyncLoadCount();
+}
+
+TArray<FAssetLoadRecord> UDelveDeepTelemetrySubsystem::GetGameplaySyncLoads() const
+{
+	return AssetLoadTracker.GetGameplaySyncLoads();
+}
+
+uint64 UDelveDeepTelemetrySubsystem::SubmitDeferredWork(FName SystemName, FName WorkName, EDelveDeepWorkPriority Priority,
+	FDelveDeepDeferredWorkScheduler::FWorkFunction Work)
+{
+	return DeferredWorkScheduler.SubmitWork(SystemName, WorkName, Priority, MoveTemp(Work));
+}
+
+bool UDelveDeepTelemetrySubsystem::CancelDeferredWork(uint64 Handle)
+{
+	return DeferredWorkScheduler.CancelWork(Handle);
+}
+
+FDeferredWorkSystemStats UDelveDeepTelemetrySubsystem::GetDeferredWorkStats(FName SystemName) const
+{
+	return DeferredWorkScheduler.GetSystemStats(SystemName);
+}
+
+TArray<FDeferredWorkSystemStats> UDelveDeepTelemetrySubsystem::GetAllDeferredWorkStats() const
+{
+	return DeferredWorkScheduler.GetAllSystemStats();
+}
+
+bool UDelveDeepTelemetrySubsystem::IsSampledTelemetryEnabled() const
+{
+	return FDelveDeepSampledTelemetry::IsEnabledByConsoleVariable();
+}
+
+bool UDelveDeepTelemetrySubsystem::WriteSampledTelemetrySummary()
+{
+	if (!SampledTelemetry.FlushSummary(true))
+	{
+		UE_LOG(LogDelveDeepTelemetry, Verbose, TEXT("No sampled frames to write"));
+		return false;
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Sampled telemetry summary written to: %s"),
+		*SampledTelemetry.GetSummaryFilePath());
+	return true;
+}
+
+FDelveDeepGCStats UDelveDeepTelemetrySubsystem::GetGCStats() const
+{
+	return GCTracker.GetStats();
+}
+
+TArray<FDelveDeepGCEvent> UDelveDeepTelemetrySubsystem::GetRecentGarbageCollections() const
+{
+	return GCTracker.GetRecentCollections();
+}
+
+TArray<FDelveDeepClassChurn> UDelveDeepTelemetrySubsystem::GetClassChurn(int32 MaxClasses) const
+{
+	return GCTracker.GetClassChurn(MaxClasses);
+}
+
+TArray<FDelveDeepPoolingRecommendation> UDelveDeepTelemetrySubsystem::GetPoolingRecommendations(float MinDestroysPerMinute) const
+{
+	return GCTracker.GetPoolingRecommendations(MinDestroysPerMinute);
+}
+
+void UDelveDeepTelemetrySubsystem::HandleGameplaySyncAssetLoad(const FAssetLoadRecord& Record)
+{
+	SystemProfiler.RecordSystemTime(TEXT("SyncAssetLoad"), Record.LoadTimeMs);
+}
+
 int32 UDelveDeepTelemetrySubsystem::GetTotalSlowLoads() const
 {
 	return AssetLoadTracker.GetTotalSlowLoads();
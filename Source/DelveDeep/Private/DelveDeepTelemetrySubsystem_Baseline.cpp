@@ -6,10 +6,29 @@
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFileManager.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
-#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Async/ParallelFor.h"
 #include "Misc/App.h"
+#include "DelveDeepBaselineSerializer.h"
+
+namespace
+{
+	/** Create the directory a baseline file will be written to */
+	bool EnsureBaselineDirectory(const FString& FilePath, FDelveDeepValidationContext& Context)
+	{
+		const FString Directory = FPaths::GetPath(FilePath);
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (!PlatformFile.DirectoryExists(*Directory) && !PlatformFile.CreateDirectoryTree(*Directory))
+		{
+			Context.AddError(FString::Printf(
+				TEXT("Failed to create directory: %s"),
+				*Directory));
+			UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
+			return false;
+		}
+		return true;
+	}
+}
 
 // Baseline Management Implementation
 
@@ -52,7 +71,8 @@ bool UDelveDeepTelemetrySubsystem::CaptureBaseline(FName BaselineName)
 	Baseline.AverageFrameData = FrameTracker.GetCurrentFrameData();
 	Baseline.AverageFPS = FrameTracker.GetAverageFPS();
 	Baseline.OnePercentLowFPS = FrameTracker.GetOnePercentLowFPS();
-	Baseline.TotalFramesCaptured = FrameTracker.GetFrameTimeHistory(3600).Num();
+	Baseline.FrameTimeSamples = FrameTracker.GetFrameTimeHistory(3600);
+	Baseline.TotalFramesCaptured = Baseline.FrameTimeSamples.Num();
 
 	// Capture system performance data
 	TArray<FSystemPerformanceData> AllSystemData = SystemProfiler.GetAllSystemData();
@@ -64,6 +84,9 @@ bool UDelveDeepTelemetrySubsystem::CaptureBaseline(FName BaselineName)
 	// Capture memory snapshot
 	Baseline.MemoryData = MemoryTracker.GetCurrentSnapshot();
 
+	// Capture garbage collection pauses and UObject count
+	Baseline.GCData = GCTracker.GetStats();
+
 	// Store baseline
 	Baselines.Add(BaselineName, Baseline);
 
@@ -113,6 +136,7 @@ bool UDelveDeepTelemetrySubsystem::CompareToBaseline(FName BaselineName, FPerfor
 	float CurrentFrameTime = FrameTracker.GetCurrentFrameData().FrameTimeMs;
 	float CurrentOnePercentLow = FrameTracker.GetOnePercentLowFPS();
 	FMemorySnapshot CurrentMemory = MemoryTracker.GetCurrentSnapshot();
+	const FDelveDeepGCStats CurrentGC = GCTracker.GetStats();
 
 	// Calculate FPS change (positive = improvement)
 	if (Baseline->AverageFPS > 0.0f)
@@ -142,6 +166,13 @@ bool UDelveDeepTelemetrySubsystem::CompareToBaseline(FName BaselineName, FPerfor
 			 static_cast<float>(Baseline->MemoryData.TotalMemory)) * 100.0f;
 	}
 
+	// Calculate GC pause change (only when both sides saw collections)
+	if (Baseline->GCData.AverageGCTimeMs > 0.0f && CurrentGC.CollectionCount > 0)
+	{
+		OutComparison.GCTimeChangePercent =
+			((CurrentGC.AverageGCTimeMs - Baseline->GCData.AverageGCTimeMs) / Baseline->GCData.AverageGCTimeMs) * 100.0f;
+	}
+
 	// Compare system performance
 	TArray<FSystemPerformanceData> CurrentSystemData = SystemProfiler.GetAllSystemData();
 	for (const FSystemPerformanceData& CurrentSystem : CurrentSystemData)
@@ -164,7 +195,8 @@ bool UDelveDeepTelemetrySubsystem::CompareToBaseline(FName BaselineName, FPerfor
 	OutComparison.bIsRegression = 
 		(OutComparison.FPSChangePercent < -RegressionThreshold) ||
 		(OutComparison.FrameTimeChangePercent > RegressionThreshold) ||
-		(OutComparison.MemoryChangePercent > RegressionThreshold * 2.0f); // More lenient for memory
+		(OutComparison.MemoryChangePercent > RegressionThreshold * 2.0f) || // More lenient for memory
+		(OutComparison.GCTimeChangePercent > RegressionThreshold * 2.0f); // GC pause times are noisy too
 
 	OutComparison.bIsImprovement = 
 		(OutComparison.FPSChangePercent > ImprovementThreshold) ||
@@ -189,6 +221,14 @@ bool UDelveDeepTelemetrySubsystem::CompareToBaseline(FName BaselineName, FPerfor
 		Baseline->MemoryData.TotalMemory / (1024.0 * 1024.0),
 		CurrentMemory.TotalMemory / (1024.0 * 1024.0),
 		OutComparison.MemoryChangePercent);
+
+	Report += TEXT("Garbage Collection:\n");
+	Report += FString::Printf(TEXT("  Average Pause: %.2f ms -> %.2f ms (%+.2f%%)\n"),
+		Baseline->GCData.AverageGCTimeMs, CurrentGC.AverageGCTimeMs, OutComparison.GCTimeChangePercent);
+	Report += FString::Printf(TEXT("  Peak Pause: %.2f ms -> %.2f ms\n"),
+		Baseline->GCData.PeakGCTimeMs, CurrentGC.PeakGCTimeMs);
+	Report += FString::Printf(TEXT("  UObjects: %d -> %d\n\n"),
+		Baseline->GCData.UObjectCount, CurrentGC.UObjectCount);
 	
 	if (OutComparison.SystemTimeChanges.Num() > 0)
 	{
@@ -251,6 +291,63 @@ bool UDelveDeepTelemetrySubsystem::SaveBaseline(FName BaselineName, const FStrin
 	Context.SystemName = TEXT("Telemetry");
 	Context.OperationName = TEXT("SaveBaseline");
 
+	// JSON paths are routed to the human-readable exporter
+	if (FPaths::GetExtension(FilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+	{
+		return ExportBaselineJSON(BaselineName, FilePath);
+	}
+
+	// Find baseline
+	const FPerformanceBaseline* Baseline = Baselines.Find(BaselineName);
+	if (!Baseline)
+	{
+		Context.AddError(FString::Printf(
+			TEXT("Baseline '%s' not found"),
+			*BaselineName.ToString()));
+		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
+		return false;
+	}
+
+	// Determine save path
+	FString SavePath = FilePath;
+	if (SavePath.IsEmpty())
+	{
+		SavePath = GetDefaultBaselineDirectory() / (BaselineName.ToString() + DelveDeepBaselineFormat::FileExtension());
+	}
+
+	if (!EnsureBaselineDirectory(SavePath, Context))
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	FDelveDeepBaselineSerializer::SaveToBytes(*Baseline, Bytes);
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *SavePath))
+	{
+		Context.AddError(FString::Printf(
+			TEXT("Failed to write baseline to file: %s"),
+			*SavePath));
+		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
+		return false;
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Display,
+		TEXT("Saved baseline '%s' to: %s (%.2f KB, %d frame samples)"),
+		*BaselineName.ToString(),
+		*SavePath,
+		Bytes.Num() / 1024.0f,
+		Baseline->FrameTimeSamples.Num());
+
+	return true;
+}
+
+bool UDelveDeepTelemetrySubsystem::ExportBaselineJSON(FName BaselineName, const FString& FilePath)
+{
+	FDelveDeepValidationContext Context;
+	Context.SystemName = TEXT("Telemetry");
+	Context.OperationName = TEXT("ExportBaselineJSON");
+
 	// Find baseline
 	const FPerformanceBaseline* Baseline = Baselines.Find(BaselineName);
 	if (!Baseline)
@@ -269,65 +366,13 @@ bool UDelveDeepTelemetrySubsystem::SaveBaseline(FName BaselineName, const FStrin
 		SavePath = GetDefaultBaselineDirectory() / (BaselineName.ToString() + TEXT(".json"));
 	}
 
-	// Validate directory exists
-	FString Directory = FPaths::GetPath(SavePath);
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	if (!PlatformFile.DirectoryExists(*Directory))
+	if (!EnsureBaselineDirectory(SavePath, Context))
 	{
-		if (!PlatformFile.CreateDirectoryTree(*Directory))
-		{
-			Context.AddError(FString::Printf(
-				TEXT("Failed to create directory: %s"),
-				*Directory));
-			UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
-			return false;
-		}
+		return false;
 	}
 
-	// Create JSON object
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
-	
-	// Serialize baseline data
-	JsonObject->SetStringField(TEXT("BaselineName"), Baseline->BaselineName.ToString());
-	JsonObject->SetStringField(TEXT("CaptureTime"), Baseline->CaptureTime.ToString());
-	JsonObject->SetStringField(TEXT("BuildVersion"), Baseline->BuildVersion);
-	JsonObject->SetStringField(TEXT("MapName"), Baseline->MapName);
-	JsonObject->SetNumberField(TEXT("AverageFPS"), Baseline->AverageFPS);
-	JsonObject->SetNumberField(TEXT("OnePercentLowFPS"), Baseline->OnePercentLowFPS);
-	JsonObject->SetNumberField(TEXT("TotalFramesCaptured"), Baseline->TotalFramesCaptured);
-	
-	// Frame data
-	TSharedPtr<FJsonObject> FrameDataObj = MakeShareable(new FJsonObject());
-	FrameDataObj->SetNumberField(TEXT("FrameTimeMs"), Baseline->AverageFrameData.FrameTimeMs);
-	FrameDataObj->SetNumberField(TEXT("GameThreadTimeMs"), Baseline->AverageFrameData.GameThreadTimeMs);
-	FrameDataObj->SetNumberField(TEXT("RenderThreadTimeMs"), Baseline->AverageFrameData.RenderThreadTimeMs);
-	JsonObject->SetObjectField(TEXT("FrameData"), FrameDataObj);
-	
-	// System data
-	TArray<TSharedPtr<FJsonValue>> SystemDataArray;
-	for (const auto& Pair : Baseline->SystemData)
-	{
-		TSharedPtr<FJsonObject> SystemObj = MakeShareable(new FJsonObject());
-		SystemObj->SetStringField(TEXT("SystemName"), Pair.Key.ToString());
-		SystemObj->SetNumberField(TEXT("CycleTimeMs"), Pair.Value.CycleTimeMs);
-		SystemObj->SetNumberField(TEXT("BudgetTimeMs"), Pair.Value.BudgetTimeMs);
-		SystemObj->SetNumberField(TEXT("AverageTimeMs"), Pair.Value.AverageTimeMs);
-		SystemObj->SetNumberField(TEXT("PeakTimeMs"), Pair.Value.PeakTimeMs);
-		SystemDataArray.Add(MakeShareable(new FJsonValueObject(SystemObj)));
-	}
-	JsonObject->SetArrayField(TEXT("SystemData"), SystemDataArray);
-	
-	// Memory data
-	TSharedPtr<FJsonObject> MemoryObj = MakeShareable(new FJsonObject());
-	MemoryObj->SetNumberField(TEXT("TotalMemory"), static_cast<double>(Baseline->MemoryData.TotalMemory));
-	MemoryObj->SetNumberField(TEXT("NativeMemory"), static_cast<double>(Baseline->MemoryData.NativeMemory));
-	MemoryObj->SetNumberField(TEXT("ManagedMemory"), static_cast<double>(Baseline->MemoryData.ManagedMemory));
-	JsonObject->SetObjectField(TEXT("MemoryData"), MemoryObj);
-
-	// Write to file
 	FString JsonString;
-	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
-	if (!FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter))
+	if (!FDelveDeepBaselineSerializer::ExportToJson(*Baseline, JsonString))
 	{
 		Context.AddError(TEXT("Failed to serialize baseline to JSON"));
 		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
@@ -344,7 +389,7 @@ bool UDelveDeepTelemetrySubsystem::SaveBaseline(FName BaselineName, const FStrin
 	}
 
 	UE_LOG(LogDelveDeepTelemetry, Display,
-		TEXT("Saved baseline '%s' to: %s (%.2f KB)"),
+		TEXT("Exported baseline '%s' as JSON to: %s (%.2f KB)"),
 		*BaselineName.ToString(),
 		*SavePath,
 		JsonString.Len() / 1024.0f);
@@ -378,8 +423,8 @@ bool UDelveDeepTelemetrySubsystem::LoadBaseline(FName BaselineName, const FStrin
 	}
 
 	// Load file
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
 	{
 		Context.AddError(FString::Printf(
 			TEXT("Failed to read baseline file: %s"),
@@ -388,83 +433,20 @@ bool UDelveDeepTelemetrySubsystem::LoadBaseline(FName BaselineName, const FStrin
 		return false;
 	}
 
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	// Binary or legacy JSON
+	FPerformanceBaseline Baseline;
+	FString Error;
+	if (!FDelveDeepBaselineSerializer::LoadFromFileBytes(Bytes, Baseline, Error))
 	{
-		Context.AddError(TEXT("Failed to parse baseline JSON"));
+		Context.AddError(FString::Printf(
+			TEXT("Failed to parse baseline file %s: %s"),
+			*FilePath,
+			*Error));
 		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("%s"), *Context.GetReport());
 		return false;
 	}
 
-	// Deserialize baseline
-	FPerformanceBaseline Baseline;
 	Baseline.BaselineName = BaselineName;
-	
-	FString CaptureTimeStr;
-	if (JsonObject->TryGetStringField(TEXT("CaptureTime"), CaptureTimeStr))
-	{
-		FDateTime::Parse(CaptureTimeStr, Baseline.CaptureTime);
-	}
-	
-	JsonObject->TryGetStringField(TEXT("BuildVersion"), Baseline.BuildVersion);
-	JsonObject->TryGetStringField(TEXT("MapName"), Baseline.MapName);
-	JsonObject->TryGetNumberField(TEXT("AverageFPS"), Baseline.AverageFPS);
-	JsonObject->TryGetNumberField(TEXT("OnePercentLowFPS"), Baseline.OnePercentLowFPS);
-	JsonObject->TryGetNumberField(TEXT("TotalFramesCaptured"), Baseline.TotalFramesCaptured);
-	
-	// Frame data
-	const TSharedPtr<FJsonObject>* FrameDataObj;
-	if (JsonObject->TryGetObjectField(TEXT("FrameData"), FrameDataObj))
-	{
-		(*FrameDataObj)->TryGetNumberField(TEXT("FrameTimeMs"), Baseline.AverageFrameData.FrameTimeMs);
-		(*FrameDataObj)->TryGetNumberField(TEXT("GameThreadTimeMs"), Baseline.AverageFrameData.GameThreadTimeMs);
-		(*FrameDataObj)->TryGetNumberField(TEXT("RenderThreadTimeMs"), Baseline.AverageFrameData.RenderThreadTimeMs);
-	}
-	
-	// System data
-	const TArray<TSharedPtr<FJsonValue>>* SystemDataArray;
-	if (JsonObject->TryGetArrayField(TEXT("SystemData"), SystemDataArray))
-	{
-		for (const TSharedPtr<FJsonValue>& Value : *SystemDataArray)
-		{
-			const TSharedPtr<FJsonObject>* SystemObj;
-			if (Value->TryGetObject(SystemObj))
-			{
-				FSystemPerformanceData SystemData;
-				FString SystemNameStr;
-				if ((*SystemObj)->TryGetStringField(TEXT("SystemName"), SystemNameStr))
-				{
-					SystemData.SystemName = FName(*SystemNameStr);
-					(*SystemObj)->TryGetNumberField(TEXT("CycleTimeMs"), SystemData.CycleTimeMs);
-					(*SystemObj)->TryGetNumberField(TEXT("BudgetTimeMs"), SystemData.BudgetTimeMs);
-					(*SystemObj)->TryGetNumberField(TEXT("AverageTimeMs"), SystemData.AverageTimeMs);
-					(*SystemObj)->TryGetNumberField(TEXT("PeakTimeMs"), SystemData.PeakTimeMs);
-					Baseline.SystemData.Add(SystemData.SystemName, SystemData);
-				}
-			}
-		}
-	}
-	
-	// Memory data
-	const TSharedPtr<FJsonObject>* MemoryObj;
-	if (JsonObject->TryGetObjectField(TEXT("MemoryData"), MemoryObj))
-	{
-		double TotalMem, NativeMem, ManagedMem;
-		if ((*MemoryObj)->TryGetNumberField(TEXT("TotalMemory"), TotalMem))
-		{
-			Baseline.MemoryData.TotalMemory = static_cast<uint64>(TotalMem);
-		}
-		if ((*MemoryObj)->TryGetNumberField(TEXT("NativeMemory"), NativeMem))
-		{
-			Baseline.MemoryData.NativeMemory = static_cast<uint64>(NativeMem);
-		}
-		if ((*MemoryObj)->TryGetNumberField(TEXT("ManagedMemory"), ManagedMem))
-		{
-			Baseline.MemoryData.ManagedMemory = static_cast<uint64>(ManagedMem);
-		}
-	}
 
 	// Validate loaded baseline
 	if (!ValidateBaseline(Baseline, Context))
@@ -474,9 +456,6 @@ bool UDelveDeepTelemetrySubsystem::LoadBaseline(FName BaselineName, const FStrin
 			*Context.GetReport());
 	}
 
-	// Store baseline
-	Baselines.Add(BaselineName, Baseline);
-
 	UE_LOG(LogDelveDeepTelemetry, Display,
 		TEXT("Loaded baseline '%s' from: %s (%.2f FPS, %d systems)"),
 		*BaselineName.ToString(),
@@ -484,9 +463,114 @@ bool UDelveDeepTelemetrySubsystem::LoadBaseline(FName BaselineName, const FStrin
 		Baseline.AverageFPS,
 		Baseline.SystemData.Num());
 
+	// Store baseline
+	Baselines.Add(BaselineName, MoveTemp(Baseline));
+
 	return true;
 }
 
+int32 UDelveDeepTelemetrySubsystem::LoadAllBaselinesInDirectory(const FString& Directory)
+{
+	const FString ScanDirectory = Directory.IsEmpty() ? GetDefaultBaselineDirectory() : Directory;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.DirectoryExists(*ScanDirectory))
+	{
+		UE_LOG(LogDelveDeepTelemetry, Warning, TEXT("Baseline directory not found: %s"), *ScanDirectory);
+		return 0;
+	}
+
+	// One file per baseline name, preferring the binary form
+	TArray<FString> BinaryFiles;
+	TArray<FString> JsonFiles;
+	IFileManager::Get().FindFiles(BinaryFiles, *(ScanDirectory / (FString(TEXT("*")) + DelveDeepBaselineFormat::FileExtension())), true, false);
+	IFileManager::Get().FindFiles(JsonFiles, *(ScanDirectory / TEXT("*.json")), true, false);
+
+	TMap<FString, FString> FilesByName;
+	for (const FString& File : JsonFiles)
+	{
+		FilesByName.Add(FPaths::GetBaseFilename(File), ScanDirectory / File);
+	}
+	for (const FString& File : BinaryFiles)
+	{
+		FilesByName.Add(FPaths::GetBaseFilename(File), ScanDirectory / File);
+	}
+
+	struct FPendingBaseline
+	{
+		FString Path;
+		FName Name;
+		FPerformanceBaseline Baseline;
+		FString Error;
+		int64 FileSize = 0;
+		bool bLoaded = false;
+	};
+
+	TArray<FPendingBaseline> Pending;
+	Pending.Reserve(FilesByName.Num());
+	for (const auto& Pair : FilesByName)
+	{
+		FPendingBaseline& Entry = Pending.AddDefaulted_GetRef();
+		Entry.Name = FName(*Pair.Key);
+		Entry.Path = Pair.Value;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// File reads and parsing run on worker threads; nothing shared is touched until the join
+	ParallelFor(Pending.Num(), [&Pending](int32 Index)
+	{
+		FPendingBaseline& Entry = Pending[Index];
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Entry.Path))
+		{
+			Entry.Error = TEXT("Failed to read file");
+			return;
+		}
+
+		Entry.FileSize = Bytes.Num();
+		Entry.bLoaded = FDelveDeepBaselineSerializer::LoadFromFileBytes(Bytes, Entry.Baseline, Entry.Error);
+	});
+
+	int32 NumLoaded = 0;
+	int64 TotalBytes = 0;
+	for (FPendingBaseline& Entry : Pending)
+	{
+		if (!Entry.bLoaded)
+		{
+			UE_LOG(LogDelveDeepTelemetry, Error, TEXT("Failed to load baseline %s: %s"), *Entry.Path, *Entry.Error);
+			continue;
+		}
+
+		Entry.Baseline.BaselineName = Entry.Name;
+
+		FDelveDeepValidationContext Context;
+		Context.SystemName = TEXT("Telemetry");
+		Context.OperationName = TEXT("LoadAllBaselinesInDirectory");
+		if (!ValidateBaseline(Entry.Baseline, Context))
+		{
+			UE_LOG(LogDelveDeepTelemetry, Warning,
+				TEXT("Baseline validation warnings: %s"),
+				*Context.GetReport());
+		}
+
+		Baselines.Add(Entry.Name, MoveTemp(Entry.Baseline));
+		TotalBytes += Entry.FileSize;
+		NumLoaded++;
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Display,
+		TEXT("Loaded %d/%d baselines from %s (%.2f KB) in %.2f ms"),
+		NumLoaded,
+		Pending.Num(),
+		*ScanDirectory,
+		TotalBytes / 1024.0,
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return NumLoaded;
+}
+
 bool UDelveDeepTelemetrySubsystem::DeleteBaseline(FName BaselineName)
 {
 	if (Baselines.Remove(BaselineName) > 0)
@@ -0,0 +1,359 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DelveDeepTraceRecorder.h"
+#include "DelveDeepTelemetrySubsystem.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	/** Append a JSON string literal with escaping */
+	void AppendJsonString(FString& Out, const FString& Value)
+	{
+		Out += TEXT('"');
+		for (const TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('"'):  Out += TEXT("\\\""); break;
+			case TEXT('\\'): Out += TEXT("\\\\"); break;
+			case TEXT('\n'): Out += TEXT("\\n"); break;
+			case TEXT('\r'): Out += TEXT("\\r"); break;
+			case TEXT('\t'): Out += TEXT("\\t"); break;
+			default:
+				if (Char < 0x20)
+				{
+					Out += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Out += Char;
+				}
+				break;
+			}
+		}
+		Out += TEXT('"');
+	}
+
+	/** Display name for a thread track */
+	FString GetTraceThreadName(uint32 ThreadId)
+	{
+		if (ThreadId == GGameThreadId)
+		{
+			return TEXT("GameThread");
+		}
+
+		const FString& Name = FThreadManager::GetThreadName(ThreadId);
+		return Name.IsEmpty() ? FString::Printf(TEXT("Thread %u"), ThreadId) : Name;
+	}
+}
+
+FDelveDeepTraceRecorder& FDelveDeepTraceRecorder::Get()
+{
+	static FDelveDeepTraceRecorder Instance;
+	return Instance;
+}
+
+FDelveDeepTraceRecorder::FDelveDeepTraceRecorder()
+	: bCapturing(false)
+	, MaxEventsPerThread(DefaultMaxEventsPerThread)
+	, CaptureStartCycles(0)
+	, CaptureEndCycles(0)
+	, FrameStartCycles(0)
+{
+}
+
+void FDelveDeepTraceRecorder::StartCapture(int32 InMaxEventsPerThread)
+{
+	bCapturing = false;
+
+	{
+		FScopeLock BuffersScope(&BuffersLock);
+		for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+		{
+			FScopeLock BufferScope(&Buffer->Lock);
+			Buffer->Events.Reset();
+			Buffer->DroppedEvents = 0;
+		}
+	}
+
+	MaxEventsPerThread = FMath::Max(1, InMaxEventsPerThread);
+	CaptureStartCycles = FPlatformTime::Cycles64();
+	CaptureEndCycles = 0;
+	FrameStartCycles = 0;
+	bCapturing = true;
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Trace capture started (%d events per thread)"), MaxEventsPerThread);
+}
+
+void FDelveDeepTraceRecorder::StopCapture()
+{
+	if (!bCapturing)
+	{
+		return;
+	}
+
+	bCapturing = false;
+	CaptureEndCycles = FPlatformTime::Cycles64();
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Trace capture stopped: %.2fs, %d events, %lld dropped"),
+		GetCaptureSeconds(), GetEventCount(), GetDroppedEventCount());
+}
+
+void FDelveDeepTraceRecorder::RecordSpan(FName Name, const TCHAR* Category, uint64 StartCycles, uint64 EndCycles, const FString& Detail)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FDelveDeepTraceEvent Event;
+	Event.Name = Name;
+	Event.Category = Category;
+	Event.Detail = Detail;
+	Event.StartCycles = StartCycles;
+	Event.EndCycles = FMath::Max(StartCycles, EndCycles);
+	Event.Phase = EDelveDeepTracePhase::Complete;
+	AddEvent(MoveTemp(Event));
+}
+
+void FDelveDeepTraceRecorder::RecordSpanEndingNow(FName Name, const TCHAR* Category, double DurationMs, const FString& Detail)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	const uint64 DurationCycles = static_cast<uint64>(FMath::Max(0.0, DurationMs) / 1000.0 / FPlatformTime::GetSecondsPerCycle64());
+	RecordSpan(Name, Category, EndCycles - FMath::Min(EndCycles, DurationCycles), EndCycles, Detail);
+}
+
+void FDelveDeepTraceRecorder::RecordInstant(FName Name, const TCHAR* Category, const FString& Detail)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FDelveDeepTraceEvent Event;
+	Event.Name = Name;
+	Event.Category = Category;
+	Event.Detail = Detail;
+	Event.StartCycles = FPlatformTime::Cycles64();
+	Event.Phase = EDelveDeepTracePhase::Instant;
+	AddEvent(MoveTemp(Event));
+}
+
+void FDelveDeepTraceRecorder::RecordCounter(FName Name, double Value)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FDelveDeepTraceEvent Event;
+	Event.Name = Name;
+	Event.Category = TEXT("Counter");
+	Event.StartCycles = FPlatformTime::Cycles64();
+	Event.Value = Value;
+	Event.Phase = EDelveDeepTracePhase::Counter;
+	AddEvent(MoveTemp(Event));
+}
+
+void FDelveDeepTraceRecorder::MarkFrameBoundary(uint64 FrameNumber)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	static const FName FrameName(TEXT("Frame"));
+	const uint64 Now = FPlatformTime::Cycles64();
+
+	if (FrameStartCycles != 0)
+	{
+		RecordSpan(FrameName, TEXT("Frame"), FrameStartCycles, Now, FString::Printf(TEXT("%llu"), FrameNumber));
+	}
+
+	FrameStartCycles = Now;
+}
+
+void FDelveDeepTraceRecorder::AddEvent(FDelveDeepTraceEvent&& Event)
+{
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	FScopeLock BufferScope(&Buffer.Lock);
+
+	if (Buffer.Events.Num() >= MaxEventsPerThread)
+	{
+		Buffer.DroppedEvents++;
+		return;
+	}
+
+	Buffer.Events.Add(MoveTemp(Event));
+}
+
+FDelveDeepTraceRecorder::FThreadBuffer& FDelveDeepTraceRecorder::GetThreadBuffer()
+{
+	static thread_local FThreadBuffer* LocalBuffer = nullptr;
+
+	if (!LocalBuffer)
+	{
+		TUniquePtr<FThreadBuffer> NewBuffer = MakeUnique<FThreadBuffer>();
+		NewBuffer->ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		FScopeLock BuffersScope(&BuffersLock);
+		LocalBuffer = NewBuffer.Get();
+		Buffers.Add(MoveTemp(NewBuffer));
+	}
+
+	return *LocalBuffer;
+}
+
+bool FDelveDeepTraceRecorder::ExportChromeTrace(const FString& FilePath) const
+{
+	const FString Json = BuildChromeTraceJson();
+
+	if (!FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogDelveDeepTelemetry, Error, TEXT("Failed to write trace to: %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogDelveDeepTelemetry, Display, TEXT("Exported trace (%d events, %.2f MB) to: %s"),
+		GetEventCount(), Json.Len() / (1024.0 * 1024.0), *FilePath);
+	return true;
+}
+
+FString FDelveDeepTraceRecorder::BuildChromeTraceJson() const
+{
+	// Copy each buffer out under its own lock so recording threads are held only briefly
+	TArray<TPair<uint32, TArray<FDelveDeepTraceEvent>>> Snapshots;
+	int64 DroppedEvents = 0;
+	{
+		FScopeLock BuffersScope(&BuffersLock);
+		for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+		{
+			FScopeLock BufferScope(&Buffer->Lock);
+			if (Buffer->Events.Num() > 0)
+			{
+				Snapshots.Emplace(Buffer->ThreadId, Buffer->Events);
+			}
+			DroppedEvents += Buffer->DroppedEvents;
+		}
+	}
+
+	int32 TotalEvents = 0;
+	for (const TPair<uint32, TArray<FDelveDeepTraceEvent>>& Snapshot : Snapshots)
+	{
+		TotalEvents += Snapshot.Value.Num();
+	}
+
+	FString Out;
+	Out.Reserve(TotalEvents * 128 + 1024);
+	Out += TEXT("{\"displayTimeUnit\":\"ms\",\"otherData\":{");
+	Out += FString::Printf(TEXT("\"captureSeconds\":%.3f,\"droppedEvents\":%lld,\"build\":"), GetCaptureSeconds(), DroppedEvents);
+	AppendJsonString(Out, FApp::GetBuildVersion());
+	Out += TEXT("},\"traceEvents\":[");
+
+	// Process and thread names, game thread first
+	Out += TEXT("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"DelveDeep\"}}");
+
+	for (const TPair<uint32, TArray<FDelveDeepTraceEvent>>& Snapshot : Snapshots)
+	{
+		Out += FString::Printf(TEXT(",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":"), Snapshot.Key);
+		AppendJsonString(Out, GetTraceThreadName(Snapshot.Key));
+		Out += FString::Printf(TEXT("}},{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%d}}"),
+			Snapshot.Key, Snapshot.Key == GGameThreadId ? -1 : 0);
+	}
+
+	for (const TPair<uint32, TArray<FDelveDeepTraceEvent>>& Snapshot : Snapshots)
+	{
+		AppendThreadEvents(Out, Snapshot.Key, Snapshot.Value);
+	}
+
+	Out += TEXT("]}");
+	return Out;
+}
+
+void FDelveDeepTraceRecorder::AppendThreadEvents(FString& Out, uint32 ThreadId, const TArray<FDelveDeepTraceEvent>& Events) const
+{
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+	auto ToTraceTime = [this, MicrosecondsPerCycle](uint64 Cycles)
+	{
+		return Cycles > CaptureStartCycles ? (Cycles - CaptureStartCycles) * MicrosecondsPerCycle : 0.0;
+	};
+
+	for (const FDelveDeepTraceEvent& Event : Events)
+	{
+		Out += TEXT(",{\"name\":");
+		AppendJsonString(Out, Event.Name.ToString());
+
+		switch (Event.Phase)
+		{
+		case EDelveDeepTracePhase::Complete:
+		{
+			// Spans that began before the capture are clipped to its start
+			const double Start = ToTraceTime(Event.StartCycles);
+			Out += FString::Printf(TEXT(",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u"),
+				Event.Category, Start, FMath::Max(0.0, ToTraceTime(Event.EndCycles) - Start), ThreadId);
+			break;
+		}
+		case EDelveDeepTracePhase::Instant:
+			Out += FString::Printf(TEXT(",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%u"),
+				Event.Category, ToTraceTime(Event.StartCycles), ThreadId);
+			break;
+		case EDelveDeepTracePhase::Counter:
+			Out += FString::Printf(TEXT(",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"value\":%.3f}}"),
+				ToTraceTime(Event.StartCycles), Event.Value);
+			continue;
+		}
+
+		if (!Event.Detail.IsEmpty())
+		{
+			Out += TEXT(",\"args\":{\"detail\":");
+			AppendJsonString(Out, Event.Detail);
+			Out += TEXT('}');
+		}
+
+		Out += TEXT('}');
+	}
+}
+
+int32 FDelveDeepTraceRecorder::GetEventCount() const
+{
+	int32 Count = 0;
+	FScopeLock BuffersScope(&BuffersLock);
+	for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+	{
+		FScopeLock BufferScope(&Buffer->Lock);
+		Count += Buffer->Events.Num();
+	}
+	return Count;
+}
+
+int64 FDelveDeepTraceRecorder::GetDroppedEventCount() const
+{
+	int64 Count = 0;
+	FScopeLock BuffersScope(&BuffersLock);
+	for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+	{
+		FScopeLock BufferScope(&Buffer->Lock);
+		Count += Buffer->DroppedEvents;
+	}
+	return Count;
+}
+
+double FDelveDeepTraceRecorder::GetCaptureSeconds() const
+{
+	if (CaptureStartCycles == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 End = CaptureEndCycles != 0 ? CaptureEndCycles : FPlatformTime::Cycles64();
+	return FPlatformTime::ToSeconds64(End - CaptureStartCycles);
+}
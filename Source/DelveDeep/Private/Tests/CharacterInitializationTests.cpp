@@ -9,11 +9,32 @@
 #include "Character/DelveDeepMage.h"
 #include "Character/DelveDeepNecromancer.h"
 #include "Character/DelveDeepStatsComponent.h"
+#include "Character/DelveDeepModifierExpirySubsystem.h"
+#include "Character/DelveDeepResourceRegenSubsystem.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepMonsterSimulationSubsystem.h"
+#include "Character/DelveDeepCooldownSubsystem.h"
+#include "Character/DelveDeepCharacterInitSubsystem.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "Character/DelveDeepProjectileSubsystem.h"
+#include "Character/DelveDeepAoESubsystem.h"
+#include "Character/DelveDeepAILodSubsystem.h"
+#include "Character/DelveDeepFlowFieldSubsystem.h"
+#include "Character/DelveDeepMinionSubsystem.h"
+#include "Character/DelveDeepSpriteBatchSubsystem.h"
 #include "Character/DelveDeepAbilitiesComponent.h"
 #include "Character/DelveDeepEquipmentComponent.h"
 #include "DelveDeepConfigurationManager.h"
 #include "DelveDeepCharacterData.h"
+#include "DelveDeepWeaponData.h"
+#include "DelveDeepAbilityData.h"
+#include "DelveDeepMonsterConfig.h"
 #include "DelveDeepValidation.h"
+#include "PaperFlipbook.h"
+#include "PaperFlipbookComponent.h"
+#include "ConvexVolume.h"
+#include "Engine/Engine.h"
+#include "Misc/ScopeExit.h"
 #include "Misc/AutomationTest.h"
 
 /**
@@ -455,3 +476,1026 @@ bool FCharacterInitialStateIsValidTest::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ========================================
+// Test: Stat Modifiers Stack Per Stat
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterStatModifiersStackTest,
+	"DelveDeep.Character.Stats.ModifiersStack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterStatModifiersStackTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepStatsComponent* StatsComponent = NewObject<UDelveDeepStatsComponent>();
+	ASSERT_NOT_NULL(StatsComponent);
+
+	const float BaseDamage = StatsComponent->BaseDamage;
+	EXPECT_NEAR(StatsComponent->GetStatValue(EDelveDeepStat::Damage), BaseDamage, 0.001f);
+
+	// Two modifiers on the same stat stack instead of replacing each other
+	const int32 FlatHandle = StatsComponent->AddStatModifierById(EDelveDeepStat::Damage, 5.0f, 0.0f);
+	const int32 SecondFlatHandle = StatsComponent->AddStatModifierById(EDelveDeepStat::Damage, 3.0f, 0.0f);
+	const int32 PercentHandle = StatsComponent->AddStatModifierById(EDelveDeepStat::Damage, 0.5f, 0.0f, EDelveDeepModifierOp::Multiplicative);
+	EXPECT_NE(FlatHandle, INDEX_NONE);
+	EXPECT_NE(SecondFlatHandle, INDEX_NONE);
+	EXPECT_NE(PercentHandle, INDEX_NONE);
+	EXPECT_EQ(StatsComponent->GetModifierCount(EDelveDeepStat::Damage), 3);
+	EXPECT_NEAR(StatsComponent->GetStatValue(EDelveDeepStat::Damage), (BaseDamage + 8.0f) * 1.5f, 0.001f);
+
+	// Other stats are untouched
+	EXPECT_EQ(StatsComponent->GetModifierCount(EDelveDeepStat::MaxHealth), 0);
+	EXPECT_NEAR(StatsComponent->GetMaxHealth(), StatsComponent->BaseHealth, 0.001f);
+
+	// Removing by handle takes out only that modifier
+	EXPECT_TRUE(StatsComponent->RemoveStatModifierByHandle(FlatHandle));
+	EXPECT_FALSE(StatsComponent->RemoveStatModifierByHandle(FlatHandle));
+	EXPECT_NEAR(StatsComponent->GetStatValue(EDelveDeepStat::Damage), (BaseDamage + 3.0f) * 1.5f, 0.001f);
+
+	// The name-based API maps onto the same stacks
+	StatsComponent->AddStatModifier(FName("MaxHealth"), 25.0f, 0.0f);
+	EXPECT_NEAR(StatsComponent->GetModifiedStat(FName("MaxHealth")), StatsComponent->BaseHealth + 25.0f, 0.001f);
+	EXPECT_NEAR(StatsComponent->GetMaxHealth(), StatsComponent->BaseHealth + 25.0f, 0.001f);
+	StatsComponent->RemoveStatModifier(FName("Damage"));
+	EXPECT_EQ(StatsComponent->GetModifierCount(EDelveDeepStat::Damage), 0);
+	EXPECT_NEAR(StatsComponent->GetStatValue(EDelveDeepStat::Damage), BaseDamage, 0.001f);
+
+	// A full stack rejects further modifiers
+	for (int32 Index = 0; Index < UDelveDeepStatsComponent::MaxModifiersPerStat; ++Index)
+	{
+		EXPECT_NE(StatsComponent->AddStatModifierById(EDelveDeepStat::MoveSpeed, 1.0f, 0.0f), INDEX_NONE);
+	}
+	EXPECT_EQ(StatsComponent->AddStatModifierById(EDelveDeepStat::MoveSpeed, 1.0f, 0.0f), INDEX_NONE);
+	EXPECT_NEAR(StatsComponent->GetStatValue(EDelveDeepStat::MoveSpeed),
+		StatsComponent->BaseMoveSpeed + UDelveDeepStatsComponent::MaxModifiersPerStat, 0.001f);
+
+	StatsComponent->ClearAllModifiers();
+	EXPECT_EQ(StatsComponent->GetModifierCount(EDelveDeepStat::MoveSpeed), 0);
+	EXPECT_NEAR(StatsComponent->GetMaxHealth(), StatsComponent->BaseHealth, 0.001f);
+
+	return true;
+}
+
+// ========================================
+// Test: Modifier Expiry Timing Wheel
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterModifierExpiryWheelTest,
+	"DelveDeep.Character.Stats.ModifierExpiryWheel",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterModifierExpiryWheelTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepTimingWheel Wheel;
+
+	// Expiries spread across every level, including one past the wheel's range
+	const double ExpireTimes[] = { 0.005, 0.25, 0.2501, 1.5, 70.0, 5000.0, 400000.0 };
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(ExpireTimes); ++Index)
+	{
+		FDelveDeepModifierExpiry Expiry;
+		Expiry.Handle = Index;
+		Expiry.ExpireTime = ExpireTimes[Index];
+		Wheel.Schedule(Expiry);
+	}
+	EXPECT_EQ(Wheel.Num(), static_cast<int32>(UE_ARRAY_COUNT(ExpireTimes)));
+
+	TArray<FDelveDeepModifierExpiry> Expired;
+
+	// Same slot as 0.25 but not yet due
+	Wheel.Advance(0.25, Expired);
+	ASSERT_EQ(Expired.Num(), 2);
+	EXPECT_EQ(Expired[0].Handle, 0);
+	EXPECT_EQ(Expired[1].Handle, 1);
+
+	Expired.Reset();
+	Wheel.Advance(0.2501, Expired);
+	ASSERT_EQ(Expired.Num(), 1);
+	EXPECT_EQ(Expired[0].Handle, 2);
+
+	// Never early, never late: each entry fires on the first advance at or past its time
+	const int32 LaterHandles[] = { 3, 4, 5, 6 };
+	for (const int32 Handle : LaterHandles)
+	{
+		Expired.Reset();
+		Wheel.Advance(ExpireTimes[Handle] - 0.001, Expired);
+		EXPECT_EQ(Expired.Num(), 0);
+
+		Wheel.Advance(ExpireTimes[Handle], Expired);
+		ASSERT_EQ(Expired.Num(), 1);
+		EXPECT_EQ(Expired[0].Handle, Handle);
+	}
+
+	EXPECT_EQ(Wheel.Num(), 0);
+
+	// Entries scheduled in the past fire on the next advance
+	FDelveDeepModifierExpiry Overdue;
+	Overdue.Handle = 42;
+	Overdue.ExpireTime = 1.0;
+	Wheel.Schedule(Overdue);
+
+	Expired.Reset();
+	Wheel.Advance(400000.0, Expired);
+	ASSERT_EQ(Expired.Num(), 1);
+	EXPECT_EQ(Expired[0].Handle, 42);
+
+	return true;
+}
+
+// ========================================
+// Test: Batched Resource Regeneration
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterResourceRegenBatchTest,
+	"DelveDeep.Character.Stats.ResourceRegenBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterResourceRegenBatchTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepResourceRegenSubsystem* RegenSubsystem = NewObject<UDelveDeepResourceRegenSubsystem>();
+	ASSERT_NOT_NULL(RegenSubsystem);
+
+	UDelveDeepStatsComponent* Empty = NewObject<UDelveDeepStatsComponent>();
+	UDelveDeepStatsComponent* Full = NewObject<UDelveDeepStatsComponent>();
+	UDelveDeepStatsComponent* Slow = NewObject<UDelveDeepStatsComponent>();
+
+	RegenSubsystem->Register(Empty, 0.0f, 100.0f, 10.0f);
+	RegenSubsystem->Register(Full, 50.0f, 50.0f, 5.0f);
+	RegenSubsystem->Register(Slow, 0.5f, 10.0f, 1.0f);
+	EXPECT_EQ(RegenSubsystem->GetRegisteredCount(), 3);
+
+	// Fractional progress is not reported
+	RegenSubsystem->Advance(0.05f);
+	EXPECT_EQ(RegenSubsystem->GetLastNotificationCount(), 0);
+	EXPECT_NEAR(RegenSubsystem->GetCurrent(0), 0.5f, 0.001f);
+
+	// Crossing a whole number notifies only that component
+	RegenSubsystem->Advance(0.05f);
+	EXPECT_EQ(RegenSubsystem->GetLastNotificationCount(), 1);
+	EXPECT_NEAR(Empty->GetCurrentResource(), 1.0f, 0.001f);
+
+	// Regeneration clamps at the maximum; resources already full stay quiet
+	RegenSubsystem->Advance(10.0f);
+	EXPECT_EQ(RegenSubsystem->GetLastNotificationCount(), 2);
+	EXPECT_NEAR(RegenSubsystem->GetCurrent(0), 100.0f, 0.001f);
+	EXPECT_NEAR(RegenSubsystem->GetCurrent(1), 50.0f, 0.001f);
+	EXPECT_NEAR(RegenSubsystem->GetCurrent(2), 10.0f, 0.001f);
+	EXPECT_NEAR(Slow->GetCurrentResource(), 10.0f, 0.001f);
+
+	// Unregistering moves the last slot into the gap
+	RegenSubsystem->Unregister(0);
+	EXPECT_EQ(RegenSubsystem->GetRegisteredCount(), 2);
+	EXPECT_NEAR(RegenSubsystem->GetCurrent(0), 10.0f, 0.001f);
+
+	return true;
+}
+
+// ========================================
+// Test: Damage Queue Resolves Hits In One Batch
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterDamageQueueBatchTest,
+	"DelveDeep.Character.Damage.QueueBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterDamageQueueBatchTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepDamageQueueSubsystem* DamageQueue = NewObject<UDelveDeepDamageQueueSubsystem>();
+	ASSERT_NOT_NULL(DamageQueue);
+
+	ADelveDeepWarrior* First = NewObject<ADelveDeepWarrior>();
+	ADelveDeepWarrior* Second = NewObject<ADelveDeepWarrior>();
+	ASSERT_NOT_NULL(First);
+	ASSERT_NOT_NULL(Second);
+
+	const float StartHealth = First->GetCurrentHealth();
+	DamageQueue->SetDamageTypeMultiplier(FName("Fire"), 2.0f);
+
+	// The expected damage of a queued hit matches what its batch will apply
+	const float ArmorMultiplier = UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(Second->GetArmor());
+	EXPECT_NEAR(DamageQueue->GetExpectedDamage(Second, 10.0f, FName("Fire")), 20.0f * ArmorMultiplier, 0.001f);
+	EXPECT_NEAR(DamageQueue->GetExpectedDamage(Second, 0.0f), 0.0f, 0.001f);
+
+	// Hits are only queued until the batch resolves
+	DamageQueue->EnqueueHit(First, 10.0f);
+	DamageQueue->EnqueueHit(First, 20.0f);
+	DamageQueue->EnqueueHit(Second, 10.0f, FName("Fire"));
+	DamageQueue->EnqueueHit(Second, 0.0f);
+	EXPECT_EQ(DamageQueue->GetPendingHitCount(), 3);
+	EXPECT_NEAR(First->GetCurrentHealth(), StartHealth, 0.001f);
+
+	// Hits on the same target are summed; damage types scale their hits
+	EXPECT_EQ(DamageQueue->ResolvePendingHits(), 3);
+	EXPECT_EQ(DamageQueue->GetPendingHitCount(), 0);
+	EXPECT_EQ(DamageQueue->GetLastResolvedTargetCount(), 2);
+	EXPECT_EQ(DamageQueue->GetLastDeaths().Num(), 0);
+	EXPECT_NEAR(First->GetCurrentHealth(), StartHealth - 30.0f, 0.001f);
+	EXPECT_NEAR(Second->GetCurrentHealth(), StartHealth - 20.0f, 0.001f);
+
+	// Armor mitigation: 100 armor halves damage, negative armor does nothing
+	EXPECT_NEAR(UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(0.0f), 1.0f, 0.001f);
+	EXPECT_NEAR(UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(100.0f), 0.5f, 0.001f);
+	EXPECT_NEAR(UDelveDeepDamageQueueSubsystem::GetArmorMultiplier(-50.0f), 1.0f, 0.001f);
+
+	// An empty queue resolves to nothing
+	EXPECT_EQ(DamageQueue->ResolvePendingHits(), 0);
+	EXPECT_EQ(DamageQueue->GetLastResolvedTargetCount(), 0);
+
+	return true;
+}
+
+// ========================================
+// Test: Monster Simulation Batch Update
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterMonsterSimulationTest,
+	"DelveDeep.Character.Monsters.SimulationUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterMonsterSimulationTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepMonsterSimulationSubsystem* Simulation = NewObject<UDelveDeepMonsterSimulationSubsystem>();
+	ASSERT_NOT_NULL(Simulation);
+
+	// 100 speed, 500 detection, 50 attack range
+	FDelveDeepMonsterConfig Config = DelveDeepTestUtils::CreateTestMonsterConfig(TEXT("Goblin"), 100.0f);
+	Config.MoveSpeed = 100.0f;
+	Config.AttackRange = 50.0f;
+	Simulation->RegisterMonsterTypeFromConfig(FName("Goblin"), Config);
+
+	EXPECT_EQ(Simulation->SpawnMonster(FName("Unknown"), FVector::ZeroVector), INDEX_NONE);
+
+	const int32 Far = Simulation->SpawnMonster(FName("Goblin"), FVector(1000.0f, 0.0f, 0.0f));
+	const int32 Near = Simulation->SpawnMonster(FName("Goblin"), FVector(300.0f, 0.0f, 0.0f));
+	const int32 Adjacent = Simulation->SpawnMonster(FName("Goblin"), FVector(20.0f, 0.0f, 0.0f));
+	EXPECT_EQ(Simulation->GetMonsterCount(), 3);
+
+	// Out of range idles, in range chases, within attack range stops
+	Simulation->Simulate(1.0f, FVector::ZeroVector);
+	EXPECT_TRUE(Simulation->GetMonsterState(Far) == EDelveDeepMonsterState::Idle);
+	EXPECT_TRUE(Simulation->GetMonsterState(Near) == EDelveDeepMonsterState::Chasing);
+	EXPECT_TRUE(Simulation->GetMonsterState(Adjacent) == EDelveDeepMonsterState::Attacking);
+	EXPECT_NEAR(Simulation->GetMonsterLocation(Far).X, 1000.0f, 0.01f);
+	EXPECT_NEAR(Simulation->GetMonsterLocation(Near).X, 200.0f, 0.01f);
+	EXPECT_NEAR(Simulation->GetMonsterLocation(Adjacent).X, 20.0f, 0.01f);
+
+	// Damage puts a monster in combat, so it chases from outside detection range
+	EXPECT_FALSE(Simulation->DamageMonster(Far, 30.0f));
+	EXPECT_NEAR(Simulation->GetMonsterHealth(Far), 70.0f, 0.01f);
+
+	// Killing removes the monster without disturbing the others' handles
+	EXPECT_TRUE(Simulation->DamageMonster(Adjacent, 200.0f));
+	Simulation->Simulate(1.0f, FVector::ZeroVector);
+	EXPECT_EQ(Simulation->GetMonsterCount(), 2);
+	EXPECT_FALSE(Simulation->IsMonsterAlive(Adjacent));
+	EXPECT_TRUE(Simulation->GetMonsterState(Far) == EDelveDeepMonsterState::Chasing);
+	EXPECT_NEAR(Simulation->GetMonsterLocation(Far).X, 900.0f, 0.01f);
+	EXPECT_NEAR(Simulation->GetMonsterLocation(Near).X, 100.0f, 0.01f);
+
+	return true;
+}
+
+// ========================================
+// Test: Timestamp Cooldowns
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterCooldownTimestampTest,
+	"DelveDeep.Character.Abilities.CooldownTimestamps",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterCooldownTimestampTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepCooldownTable Cooldowns;
+
+	const int32 Fireball = Cooldowns.Allocate(nullptr);
+	const int32 Dash = Cooldowns.Allocate(nullptr);
+	const int32 Heal = Cooldowns.Allocate(nullptr);
+	EXPECT_EQ(Cooldowns.GetAllocatedCount(), 3);
+	EXPECT_TRUE(Cooldowns.IsReady(Fireball, 0.0));
+
+	Cooldowns.Start(Fireball, 10.0, 5.0f);
+	Cooldowns.Start(Dash, 10.0, 1.0f);
+	Cooldowns.Start(Heal, 10.0, 3.0f);
+	EXPECT_FALSE(Cooldowns.IsReady(Fireball, 12.0));
+	EXPECT_NEAR(Cooldowns.GetRemaining(Fireball, 12.0), 3.0f, 0.001f);
+
+	// Only what finished by now is popped, earliest first
+	TArray<int32> Ready;
+	Cooldowns.PopReady(13.5, Ready);
+	EXPECT_EQ(Ready.Num(), 2);
+	if (Ready.Num() == 2)
+	{
+		EXPECT_EQ(Ready[0], Dash);
+		EXPECT_EQ(Ready[1], Heal);
+	}
+	EXPECT_TRUE(Cooldowns.IsReady(Dash, 13.5));
+
+	// Restarting supersedes the earlier entry; released slots are never reported
+	Cooldowns.Start(Fireball, 13.5, 5.0f);
+	Cooldowns.Start(Dash, 13.5, 1.0f);
+	Cooldowns.Release(Dash);
+	Ready.Reset();
+	Cooldowns.PopReady(16.0, Ready);
+	EXPECT_EQ(Ready.Num(), 0);
+	EXPECT_FALSE(Cooldowns.IsReady(Fireball, 16.0));
+
+	Ready.Reset();
+	Cooldowns.PopReady(18.5, Ready);
+	EXPECT_EQ(Ready.Num(), 1);
+	EXPECT_EQ(Cooldowns.GetPendingCount(), 0);
+
+	// Released slots are reused
+	EXPECT_EQ(Cooldowns.Allocate(nullptr), Dash);
+
+	return true;
+}
+
+// ========================================
+// Test: Asynchronous Initialization
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterAsyncInitializationTest,
+	"DelveDeep.Character.Initialization.Async",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterAsyncInitializationTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepCharacterInitSubsystem* InitSubsystem = NewObject<UDelveDeepCharacterInitSubsystem>();
+	ASSERT_NOT_NULL(InitSubsystem);
+
+	// Weapon and abilities are streamed; null and duplicate references are skipped
+	UDelveDeepCharacterData* Data = DelveDeepTestUtils::CreateTestCharacterData();
+	ASSERT_NOT_NULL(Data);
+	Data->StartingWeapon = TSoftObjectPtr<UDelveDeepWeaponData>(FSoftObjectPath(TEXT("/Game/Data/Weapons/DA_Sword.DA_Sword")));
+	const TSoftObjectPtr<UDelveDeepAbilityData> Cleave(FSoftObjectPath(TEXT("/Game/Data/Abilities/DA_Cleave.DA_Cleave")));
+	Data->StartingAbilities = { Cleave, TSoftObjectPtr<UDelveDeepAbilityData>(), Cleave };
+
+	TArray<FSoftObjectPath> Paths;
+	UDelveDeepCharacterInitSubsystem::GatherInitializationAssets(Data, Paths);
+	EXPECT_EQ(Paths.Num(), 2);
+
+	// A character without resolved data cannot be queued
+	ADelveDeepWarrior* Warrior = NewObject<ADelveDeepWarrior>();
+	ASSERT_NOT_NULL(Warrior);
+	EXPECT_FALSE(InitSubsystem->RequestInitialization(Warrior));
+	EXPECT_FALSE(Warrior->IsInitializationPending());
+	EXPECT_EQ(InitSubsystem->GetLoadingCount(), 0);
+	EXPECT_EQ(InitSubsystem->GetReadyCount(), 0);
+	EXPECT_EQ(InitSubsystem->ProcessReadyCharacters(0.0), 0);
+
+	InitSubsystem->SetFrameBudget(-1.0f);
+	EXPECT_NEAR(InitSubsystem->GetFrameBudget(), 0.0f, 0.001f);
+
+	return true;
+}
+
+// ========================================
+// Test: Deferred Initialization Keeps Pending Damage
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterDeferredInitializationStateTest,
+	"DelveDeep.Character.Initialization.DeferredKeepsState",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterDeferredInitializationStateTest::RunTest(const FString& Parameters)
+{
+	ADelveDeepWarrior* Warrior = NewObject<ADelveDeepWarrior>();
+	ASSERT_NOT_NULL(Warrior);
+	UDelveDeepStatsComponent* Stats = Warrior->GetStatsComponent();
+	ASSERT_NOT_NULL(Stats);
+
+	// Put the character in the state BeginPlay leaves it in while its assets stream
+	UDelveDeepCharacterData* Data = DelveDeepTestUtils::CreateTestCharacterData(TEXT("PendingWarrior"), 200.0f, 10.0f);
+	ASSERT_NOT_NULL(Data);
+	const FObjectProperty* DataProperty = FindFProperty<FObjectProperty>(ADelveDeepCharacter::StaticClass(), TEXT("CharacterData"));
+	const FBoolProperty* PendingProperty = FindFProperty<FBoolProperty>(ADelveDeepCharacter::StaticClass(), TEXT("bInitializationPending"));
+	ASSERT_NOT_NULL(DataProperty);
+	ASSERT_NOT_NULL(PendingProperty);
+	DataProperty->SetObjectPropertyValue_InContainer(Warrior, Data);
+	PendingProperty->SetPropertyValue_InContainer(Warrior, true);
+	ASSERT_TRUE(Warrior->IsInitializationPending());
+
+	// Pending characters are already targetable: a quarter of their health goes, and a buff lands
+	Stats->ModifyHealth(-0.25f * Stats->GetMaxHealth());
+	Stats->AddStatModifierById(EDelveDeepStat::Damage, 5.0f, 0.0f, EDelveDeepModifierOp::Additive);
+
+	Warrior->FinishInitialization();
+	EXPECT_FALSE(Warrior->IsInitializationPending());
+
+	// Base stats come from the data; the damage and modifier survive
+	EXPECT_NEAR(Stats->GetMaxHealth(), 200.0f, 0.001f);
+	EXPECT_NEAR(Stats->GetCurrentHealth(), 150.0f, 0.001f);
+	EXPECT_EQ(Stats->GetModifierCount(EDelveDeepStat::Damage), 1);
+	EXPECT_NEAR(Stats->GetStatValue(EDelveDeepStat::Damage), 15.0f, 0.001f);
+
+	// A second finish is a no-op
+	Warrior->FinishInitialization();
+	EXPECT_NEAR(Stats->GetCurrentHealth(), 150.0f, 0.001f);
+
+	return true;
+}
+
+// ========================================
+// Test: Targeting Spatial Hash
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterTargetingSpatialHashTest,
+	"DelveDeep.Character.Targeting.SpatialHash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterTargetingSpatialHashTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepTargetingSubsystem* Targeting = NewObject<UDelveDeepTargetingSubsystem>();
+	ASSERT_NOT_NULL(Targeting);
+	Targeting->SetCellSize(100.0f);
+
+	const int32 Player = Targeting->RegisterCombatant(nullptr, FVector::ZeroVector, DelveDeepTeam::Players);
+	const int32 Close = Targeting->RegisterCombatant(nullptr, FVector(50.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Middle = Targeting->RegisterCombatant(nullptr, FVector(0.0f, -180.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Far = Targeting->RegisterCombatant(nullptr, FVector(450.0f, 300.0f, 0.0f), DelveDeepTeam::Monsters);
+	EXPECT_EQ(Targeting->GetCombatantCount(), 4);
+
+	// Radius queries span cells and filter by team
+	TArray<int32> Found;
+	Targeting->QueryRadius(FVector::ZeroVector, 200.0f, DelveDeepTeam::Opposing(DelveDeepTeam::Players), Found);
+	EXPECT_EQ(Found.Num(), 2);
+	EXPECT_TRUE(Found.Contains(Close));
+	EXPECT_TRUE(Found.Contains(Middle));
+	EXPECT_FALSE(Found.Contains(Player));
+
+	// K-nearest returns nearest first
+	Found.Reset();
+	Targeting->QueryKNearest(FVector::ZeroVector, 2, 1000.0f, DelveDeepTeam::Bit(DelveDeepTeam::Monsters), Found);
+	EXPECT_EQ(Found.Num(), 2);
+	if (Found.Num() == 2)
+	{
+		EXPECT_EQ(Found[0], Close);
+		EXPECT_EQ(Found[1], Middle);
+	}
+
+	// Priorities and custom scoring
+	const uint32 Monsters = DelveDeepTeam::Bit(DelveDeepTeam::Monsters);
+	EXPECT_EQ(Targeting->FindBestTarget(FVector::ZeroVector, 1000.0f, Monsters, EDelveDeepTargetPriority::Nearest), Close);
+	Targeting->AddThreat(Far, 50.0f);
+	EXPECT_EQ(Targeting->FindBestTarget(FVector::ZeroVector, 1000.0f, Monsters, EDelveDeepTargetPriority::HighestThreat), Far);
+	EXPECT_EQ(Targeting->FindBestTarget(FVector::ZeroVector, 1000.0f, Monsters,
+		[](const FDelveDeepTargetCandidate& Candidate) { return Candidate.DistanceSq; }), Far);
+
+	// Moving across cells and unregistering keep the hash consistent
+	Targeting->UpdateCombatantLocation(Far, FVector(-30.0f, 10.0f, 0.0f));
+	Targeting->UnregisterCombatant(Close);
+	EXPECT_EQ(Targeting->FindBestTarget(FVector::ZeroVector, 1000.0f, Monsters, EDelveDeepTargetPriority::Nearest), Far);
+	Found.Reset();
+	Targeting->QueryRadius(FVector(450.0f, 300.0f, 0.0f), 100.0f, DelveDeepTeam::All, Found);
+	EXPECT_EQ(Found.Num(), 0);
+
+	// Rebucketing keeps every combatant
+	Targeting->SetCellSize(32.0f);
+	Found.Reset();
+	Targeting->QueryRadius(FVector::ZeroVector, 500.0f, DelveDeepTeam::All, Found);
+	EXPECT_EQ(Found.Num(), 3);
+
+	return true;
+}
+
+// ========================================
+// Test: Batched Projectile Simulation
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterProjectileSimulationTest,
+	"DelveDeep.Character.Projectiles.BatchSimulation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterProjectileSimulationTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepTargetingSubsystem* Targeting = NewObject<UDelveDeepTargetingSubsystem>();
+	UDelveDeepProjectileSubsystem* Projectiles = NewObject<UDelveDeepProjectileSubsystem>();
+	ASSERT_NOT_NULL(Targeting);
+	ASSERT_NOT_NULL(Projectiles);
+	Projectiles->SetHitRadius(20.0f);
+
+	// Three monsters in a line, one off the line, and an ally in the way
+	const int32 First = Targeting->RegisterCombatant(nullptr, FVector(100.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Second = Targeting->RegisterCombatant(nullptr, FVector(200.0f, 10.0f, 0.0f), DelveDeepTeam::Monsters);
+	Targeting->RegisterCombatant(nullptr, FVector(300.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	Targeting->RegisterCombatant(nullptr, FVector(150.0f, 100.0f, 0.0f), DelveDeepTeam::Monsters);
+	Targeting->RegisterCombatant(nullptr, FVector(50.0f, 0.0f, 0.0f), DelveDeepTeam::Players);
+
+	// Piercing arrow: hits the first two in order along its path, then stops
+	FDelveDeepProjectileParams Arrow;
+	Arrow.Speed = 1000.0f;
+	Arrow.Range = 1000.0f;
+	Arrow.Damage = 15.0f;
+	Arrow.MaxHits = 2;
+	Arrow.Team = DelveDeepTeam::Players;
+	EXPECT_TRUE(Projectiles->FireProjectile(Arrow));
+
+	// Non-piercing bolt that runs out of range before reaching anything
+	FDelveDeepProjectileParams Bolt = Arrow;
+	Bolt.Direction = FVector(-1.0f, 0.0f, 0.0f);
+	Bolt.Range = 150.0f;
+	Bolt.MaxHits = 1;
+	EXPECT_TRUE(Projectiles->FireProjectile(Bolt));
+
+	// Degenerate shots are rejected
+	FDelveDeepProjectileParams Invalid = Arrow;
+	Invalid.Direction = FVector::UpVector;
+	EXPECT_FALSE(Projectiles->FireProjectile(Invalid));
+	EXPECT_EQ(Projectiles->GetProjectileCount(), 2);
+
+	EXPECT_EQ(Projectiles->Simulate(0.25f, Targeting), 2);
+	const TArray<FDelveDeepProjectileHit>& Hits = Projectiles->GetLastHits();
+	if (Hits.Num() == 2)
+	{
+		EXPECT_EQ(Hits[0].TargetHandle, First);
+		EXPECT_EQ(Hits[1].TargetHandle, Second);
+		EXPECT_NEAR(Hits[0].Damage, 15.0f, 0.001f);
+	}
+
+	// Both projectiles are done: the arrow spent its pierce, the bolt its range
+	EXPECT_EQ(Projectiles->GetProjectileCount(), 0);
+	EXPECT_EQ(Projectiles->Simulate(0.25f, Targeting), 0);
+	EXPECT_EQ(Projectiles->GetLastExplosions().Num(), 0);
+
+	// Exploding shot: stops at the first monster and blasts instead of hitting it
+	FDelveDeepProjectileParams Fireball = Arrow;
+	Fireball.MaxHits = 1;
+	Fireball.ExplosionRadius = 120.0f;
+	EXPECT_TRUE(Projectiles->FireProjectile(Fireball));
+	EXPECT_EQ(Projectiles->Simulate(0.25f, Targeting), 0);
+	EXPECT_EQ(Projectiles->GetProjectileCount(), 0);
+
+	const TArray<FDelveDeepProjectileExplosion>& Explosions = Projectiles->GetLastExplosions();
+	ASSERT_EQ(Explosions.Num(), 1);
+	EXPECT_NEAR(Explosions[0].Location.X, 100.0f, 0.001f);
+	EXPECT_NEAR(Explosions[0].Radius, 120.0f, 0.001f);
+	EXPECT_NEAR(Explosions[0].Damage, 15.0f, 0.001f);
+
+	return true;
+}
+
+// ========================================
+// Test: AoE Shape Queries
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterAoEQueryTest,
+	"DelveDeep.Character.AoE.ShapeQueries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterAoEQueryTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepTargetingSubsystem* Targeting = NewObject<UDelveDeepTargetingSubsystem>();
+	ASSERT_NOT_NULL(Targeting);
+
+	// Seven combatants so the vector loop and the scalar tail both run
+	const int32 Caster = Targeting->RegisterCombatant(nullptr, FVector::ZeroVector, DelveDeepTeam::Players);
+	const int32 Ahead = Targeting->RegisterCombatant(nullptr, FVector(150.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Flank = Targeting->RegisterCombatant(nullptr, FVector(100.0f, 120.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Behind = Targeting->RegisterCombatant(nullptr, FVector(-100.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Ally = Targeting->RegisterCombatant(nullptr, FVector(50.0f, 10.0f, 0.0f), DelveDeepTeam::Players);
+	const int32 Distant = Targeting->RegisterCombatant(nullptr, FVector(600.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	const int32 Removed = Targeting->RegisterCombatant(nullptr, FVector(20.0f, 0.0f, 0.0f), DelveDeepTeam::Monsters);
+	Targeting->UnregisterCombatant(Removed);
+
+	const FDelveDeepCombatantView View = Targeting->GetPackedCombatants();
+	const uint32 Enemies = UDelveDeepAoESubsystem::GetAbilityTeamMask(DelveDeepTeam::Players, false);
+	const uint32 Everyone = UDelveDeepAoESubsystem::GetAbilityTeamMask(DelveDeepTeam::Players, true);
+	EXPECT_EQ(Everyone, DelveDeepTeam::All);
+
+	// Circle filters by team and skips released handles
+	TArray<int32> Found;
+	EXPECT_EQ(FDelveDeepAoEQuery::Circle(View, FVector::ZeroVector, 200.0f, Enemies, Found), 3);
+	EXPECT_TRUE(Found.Contains(Ahead));
+	EXPECT_TRUE(Found.Contains(Flank));
+	EXPECT_TRUE(Found.Contains(Behind));
+	EXPECT_FALSE(Found.Contains(Removed));
+
+	Found.Reset();
+	EXPECT_EQ(FDelveDeepAoEQuery::Circle(View, FVector::ZeroVector, 200.0f, Everyone, Found), 5);
+	EXPECT_TRUE(Found.Contains(Caster));
+	EXPECT_TRUE(Found.Contains(Ally));
+
+	// 60 degree half-angle cone forward: Flank is at ~50 degrees, Behind is outside
+	Found.Reset();
+	EXPECT_EQ(FDelveDeepAoEQuery::Cone(View, FVector::ZeroVector, FVector::ForwardVector, 200.0f, 60.0f, Enemies, Found), 2);
+	EXPECT_TRUE(Found.Contains(Ahead));
+	EXPECT_TRUE(Found.Contains(Flank));
+
+	Found.Reset();
+	EXPECT_EQ(FDelveDeepAoEQuery::Cone(View, FVector::ZeroVector, FVector::ForwardVector, 200.0f, 30.0f, Enemies, Found), 1);
+	EXPECT_TRUE(Found.Contains(Ahead));
+
+	// Line is a capsule: the end cap reaches Distant, the width excludes Flank
+	Found.Reset();
+	EXPECT_EQ(FDelveDeepAoEQuery::Line(View, FVector::ZeroVector, FVector(560.0f, 0.0f, 0.0f), 50.0f, Enemies, Found), 2);
+	EXPECT_TRUE(Found.Contains(Ahead));
+	EXPECT_TRUE(Found.Contains(Distant));
+
+	// Without a world there is nothing to query or damage
+	UDelveDeepAoESubsystem* AoE = NewObject<UDelveDeepAoESubsystem>();
+	ASSERT_NOT_NULL(AoE);
+	Found.Reset();
+	EXPECT_EQ(AoE->QueryCircle(FVector::ZeroVector, 1000.0f, Everyone, Found), 0);
+	EXPECT_EQ(AoE->DamageCircle(FVector::ZeroVector, 1000.0f, Everyone, 10.0f, NAME_None, nullptr), 0);
+
+	return true;
+}
+
+// ========================================
+// Test: AI LOD Buckets
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterAILodTest,
+	"DelveDeep.Character.AI.LodBuckets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterAILodTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepAILodSubsystem* AILod = NewObject<UDelveDeepAILodSubsystem>();
+	ASSERT_NOT_NULL(AILod);
+	AILod->SetLodDistances(1000.0f, 3000.0f);
+	AILod->SetReducedInterval(4);
+
+	// Near is full regardless of visibility; on screen is never frozen; far and off screen is
+	EXPECT_EQ(AILod->ClassifyAgent(FMath::Square(500.0f), false), EDelveDeepAILod::Full);
+	EXPECT_EQ(AILod->ClassifyAgent(FMath::Square(2000.0f), true), EDelveDeepAILod::Reduced);
+	EXPECT_EQ(AILod->ClassifyAgent(FMath::Square(2000.0f), false), EDelveDeepAILod::Reduced);
+	EXPECT_EQ(AILod->ClassifyAgent(FMath::Square(4000.0f), true), EDelveDeepAILod::Reduced);
+	EXPECT_EQ(AILod->ClassifyAgent(FMath::Square(4000.0f), false), EDelveDeepAILod::Frozen);
+
+	// Eight agents at the origin counting their updates
+	const int32 NumAgents = 8;
+	TArray<int32> UpdateCounts;
+	UpdateCounts.SetNumZeroed(NumAgents);
+	TArray<int32> Handles;
+	for (int32 Index = 0; Index < NumAgents; ++Index)
+	{
+		Handles.Add(AILod->RegisterAgent(NewObject<ADelveDeepWarrior>(),
+			FDelveDeepAIUpdate::CreateLambda([&UpdateCounts, Index](float) { ++UpdateCounts[Index]; })));
+	}
+	EXPECT_EQ(AILod->GetAgentCount(), NumAgents);
+	EXPECT_EQ(AILod->RegisterAgent(nullptr, FDelveDeepAIUpdate()), INDEX_NONE);
+
+	// Viewer on top of them: everyone updates every frame
+	const float DeltaTime = 1.0f / 60.0f;
+	EXPECT_EQ(AILod->Update(DeltaTime, FVector::ZeroVector), NumAgents);
+	EXPECT_EQ(AILod->GetBucketCount(EDelveDeepAILod::Full), NumAgents);
+
+	// Viewer far away and nothing rendered: a full reclassification freezes everyone
+	for (int32 Frame = 0; Frame < UDelveDeepAILodSubsystem::ClassifyFrames; ++Frame)
+	{
+		AILod->Update(DeltaTime, FVector(5000.0f, 0.0f, 0.0f));
+	}
+	EXPECT_EQ(AILod->GetBucketCount(EDelveDeepAILod::Frozen), NumAgents);
+	EXPECT_EQ(AILod->Update(DeltaTime, FVector(5000.0f, 0.0f, 0.0f)), 0);
+
+	// Reduced agents are spread over the interval: two per frame, each once per four frames
+	for (const int32 Handle : Handles)
+	{
+		AILod->PinAgentLod(Handle, EDelveDeepAILod::Reduced);
+	}
+	for (int32& Count : UpdateCounts)
+	{
+		Count = 0;
+	}
+	for (int32 Frame = 0; Frame < 4; ++Frame)
+	{
+		EXPECT_EQ(AILod->Update(DeltaTime, FVector(5000.0f, 0.0f, 0.0f)), NumAgents / 4);
+	}
+	for (const int32 Count : UpdateCounts)
+	{
+		EXPECT_EQ(Count, 1);
+	}
+
+	AILod->UnregisterAgent(Handles[0]);
+	EXPECT_EQ(AILod->GetAgentCount(), NumAgents - 1);
+	EXPECT_EQ(AILod->GetBucketCount(EDelveDeepAILod::Reduced), NumAgents - 1);
+
+	return true;
+}
+
+// ========================================
+// Test: Flow Field Steering
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterFlowFieldTest,
+	"DelveDeep.Character.AI.FlowField",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterFlowFieldTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepFlowFieldSubsystem* FlowFields = NewObject<UDelveDeepFlowFieldSubsystem>();
+	ASSERT_NOT_NULL(FlowFields);
+
+	// 10x10 cells of 100 units with a wall at X = 5, open only at the top row
+	FlowFields->InitializeGrid(FVector::ZeroVector, FIntPoint(10, 10), 100.0f);
+	for (int32 Y = 0; Y < 9; ++Y)
+	{
+		FlowFields->SetCellCost(FIntPoint(5, Y), UDelveDeepFlowFieldSubsystem::BlockedCost);
+	}
+
+	const auto CellCenter = [](int32 X, int32 Y) { return FVector(X * 100.0f + 50.0f, Y * 100.0f + 50.0f, 0.0f); };
+
+	const int32 Goal = FlowFields->AddGoal(CellCenter(8, 1));
+	FlowFields->FlushBuilds();
+	EXPECT_EQ(FlowFields->GetGoalCount(), 1);
+	EXPECT_EQ(FlowFields->GetBuildsInFlight(), 0);
+
+	// Behind the wall the path goes around through the gap, not straight through
+	FVector Steering;
+	EXPECT_TRUE(FlowFields->SampleDirection(CellCenter(2, 1), Steering));
+	EXPECT_TRUE(Steering.Y > 0.0f);
+	EXPECT_TRUE(FlowFields->GetPathCost(Goal, CellCenter(2, 1)) > 10.0f);
+	EXPECT_TRUE(FlowFields->GetPathCost(Goal, CellCenter(2, 1)) < MAX_flt);
+
+	// Walls and cells off the grid have no flow
+	EXPECT_FALSE(FlowFields->SampleDirection(CellCenter(5, 3), Steering));
+	EXPECT_FALSE(FlowFields->SampleDirection(FVector(-500.0f, 0.0f, 0.0f), Steering));
+
+	// Opening a door rebuilds the field
+	FlowFields->SetCellCost(FIntPoint(5, 1), 1);
+	FlowFields->FlushBuilds();
+	EXPECT_TRUE(FlowFields->SampleDirection(CellCenter(4, 1), Steering));
+	EXPECT_NEAR(Steering.X, 1.0f, KINDA_SMALL_NUMBER);
+	EXPECT_NEAR(FlowFields->GetPathCost(Goal, CellCenter(2, 1)), 6.0f, KINDA_SMALL_NUMBER);
+
+	// A goal moving within its cell keeps its field; the goal's own cell points at the goal
+	FlowFields->SetGoalLocation(Goal, CellCenter(8, 1) + FVector(20.0f, 0.0f, 0.0f));
+	EXPECT_EQ(FlowFields->GetBuildsInFlight(), 0);
+	EXPECT_TRUE(FlowFields->SampleDirection(CellCenter(8, 1), Steering));
+	EXPECT_NEAR(Steering.X, 1.0f, KINDA_SMALL_NUMBER);
+
+	FlowFields->RemoveGoal(Goal);
+	EXPECT_FALSE(FlowFields->SampleDirection(CellCenter(2, 1), Steering));
+
+	return true;
+}
+
+// ========================================
+// Test: Minion Steering
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterMinionSteeringTest,
+	"DelveDeep.Character.Necromancer.MinionSteering",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterMinionSteeringTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepMinionSteering Steering;
+	const FVector2D Origin = FVector2D::ZeroVector;
+
+	// Far from the goal with no neighbours: full speed straight at it
+	FVector2D Direction = Steering.ComputeSteering(Origin, FVector2D(1000.0f, 0.0f), 100.0f, Origin, {});
+	EXPECT_NEAR(Direction.X, 1.0f, KINDA_SMALL_NUMBER);
+	EXPECT_NEAR(Direction.Y, 0.0f, KINDA_SMALL_NUMBER);
+
+	// Within the stop distance of the goal and the group: settled
+	Direction = Steering.ComputeSteering(Origin, FVector2D(50.0f, 0.0f), 100.0f, Origin, {});
+	EXPECT_TRUE(Direction.IsNearlyZero());
+
+	// A neighbour closer than the separation radius pushes the minion away
+	const FVector2D Neighbours[] = { FVector2D(20.0f, 0.0f) };
+	Direction = Steering.ComputeSteering(Origin, Origin, 100.0f, Origin, Neighbours);
+	EXPECT_TRUE(Direction.X < 0.0f);
+	EXPECT_TRUE(Direction.Size() <= 1.0f + KINDA_SMALL_NUMBER);
+
+	// Neighbours beyond the separation radius are ignored; a distant group center pulls
+	const FVector2D FarNeighbours[] = { FVector2D(Steering.SeparationRadius * 2.0f, 0.0f) };
+	Direction = Steering.ComputeSteering(Origin, Origin, 100.0f, FVector2D(0.0f, 500.0f), FarNeighbours);
+	EXPECT_NEAR(Direction.X, 0.0f, KINDA_SMALL_NUMBER);
+	EXPECT_NEAR(Direction.Y, Steering.CohesionWeight, KINDA_SMALL_NUMBER);
+
+	// Without a world the Necromancer has no minions and summoning is refused
+	ADelveDeepNecromancer* Necromancer = NewObject<ADelveDeepNecromancer>();
+	ASSERT_NOT_NULL(Necromancer);
+	EXPECT_EQ(Necromancer->GetActiveMinionCount(), 0);
+	Necromancer->SummonMinion();
+	EXPECT_EQ(Necromancer->GetActiveMinionCount(), 0);
+
+	// Upgrades raise the minion limit
+	Necromancer->SetMaxMinions(8);
+	EXPECT_EQ(Necromancer->GetMaxMinions(), 8);
+
+	return true;
+}
+
+// ========================================
+// Test: Sprite Batch Animation
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterSpriteBatchTest,
+	"DelveDeep.Character.Rendering.SpriteBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterSpriteBatchTest::RunTest(const FString& Parameters)
+{
+	// Frame lookup wraps when looping and holds the last frame otherwise
+	EXPECT_EQ(UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(0.0f, 10.0f, 4, true), 0);
+	EXPECT_EQ(UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(0.25f, 10.0f, 4, true), 2);
+	EXPECT_EQ(UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(0.45f, 10.0f, 4, true), 0);
+	EXPECT_EQ(UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(5.0f, 10.0f, 4, false), 3);
+	EXPECT_EQ(UDelveDeepSpriteBatchSubsystem::GetFrameAtTime(1.0f, 10.0f, 0, true), INDEX_NONE);
+
+	// Four key frames at 10 fps, the last held for two frames
+	UPaperFlipbook* Flipbook = NewObject<UPaperFlipbook>();
+	ASSERT_NOT_NULL(Flipbook);
+	{
+		FScopedFlipbookMutator Mutator(Flipbook);
+		Mutator.FramesPerSecond = 10.0f;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			FPaperFlipbookKeyFrame& KeyFrame = Mutator.KeyFrames.AddDefaulted_GetRef();
+			KeyFrame.FrameRun = Index == 3 ? 2 : 1;
+		}
+	}
+
+	UDelveDeepSpriteBatchSubsystem* SpriteBatch = NewObject<UDelveDeepSpriteBatchSubsystem>();
+	ASSERT_NOT_NULL(SpriteBatch);
+
+	const int32 NumCharacters = 3;
+	TArray<ADelveDeepCharacter*> Characters;
+	TArray<int32> Handles;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		ADelveDeepCharacter* Character = NewObject<ADelveDeepCharacter>();
+		ASSERT_NOT_NULL(Character);
+
+		const int32 Handle = SpriteBatch->RegisterCharacter(Character);
+		EXPECT_NE(Handle, INDEX_NONE);
+		EXPECT_FALSE(Character->GetSprite()->IsVisible());
+		Characters.Add(Character);
+		Handles.Add(Handle);
+	}
+	EXPECT_EQ(SpriteBatch->GetInstanceCount(), NumCharacters);
+
+	// Every instance advances in the same update, each from its own start time
+	SpriteBatch->PlayFlipbook(Handles[0], Flipbook, true);
+	SpriteBatch->PlayFlipbook(Handles[1], Flipbook, false);
+	SpriteBatch->UpdateInstances(0.25f);
+	SpriteBatch->PlayFlipbook(Handles[2], Flipbook, true);
+	SpriteBatch->UpdateInstances(0.3f);
+
+	EXPECT_EQ(SpriteBatch->GetInstanceFrame(Handles[0]), 0);
+	EXPECT_EQ(SpriteBatch->GetInstanceFrame(Handles[1]), 4);
+	EXPECT_EQ(SpriteBatch->GetInstanceFrame(Handles[2]), 3);
+	EXPECT_FALSE(SpriteBatch->IsInstanceFacingLeft(Handles[0]));
+
+	// Without a world there is nothing to draw into
+	EXPECT_EQ(SpriteBatch->GetBatchCount(), 0);
+
+	// Leaving the batch restores the character's own sprite
+	SpriteBatch->UnregisterCharacter(Handles[0]);
+	EXPECT_EQ(SpriteBatch->GetInstanceCount(), NumCharacters - 1);
+	EXPECT_EQ(SpriteBatch->GetInstanceFrame(Handles[0]), INDEX_NONE);
+	EXPECT_TRUE(Characters[0]->GetSprite()->IsVisible());
+	EXPECT_TRUE(Characters[0]->GetSprite()->GetFlipbook() == Flipbook);
+
+	return true;
+}
+
+// ========================================
+// Test: Spawned Characters Join The Sprite Batch
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterSpriteBatchSpawnTest,
+	"DelveDeep.Character.Rendering.SpriteBatchOnSpawn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterSpriteBatchSpawnTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	ASSERT_NOT_NULL(World);
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	ON_SCOPE_EXIT
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	};
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UDelveDeepSpriteBatchSubsystem* SpriteBatch = World->GetSubsystem<UDelveDeepSpriteBatchSubsystem>();
+	ASSERT_NOT_NULL(SpriteBatch);
+
+	// The test world has no game instance, so characters cannot load their data
+	AddExpectedMessage(TEXT("Failed to get game instance"), ELogVerbosity::Error, EAutomationExpectedMessageFlags::Contains, 0);
+
+	// Opted in before BeginPlay, as a placed or pooled-miss monster would be
+	ADelveDeepWarrior* Batched = World->SpawnActorDeferred<ADelveDeepWarrior>(ADelveDeepWarrior::StaticClass(), FTransform::Identity);
+	ASSERT_NOT_NULL(Batched);
+	const FBoolProperty* BatchingProperty = FindFProperty<FBoolProperty>(ADelveDeepCharacter::StaticClass(), TEXT("bUseSpriteBatching"));
+	ASSERT_NOT_NULL(BatchingProperty);
+	BatchingProperty->SetPropertyValue_InContainer(Batched, true);
+	Batched->FinishSpawning(FTransform::Identity);
+
+	ADelveDeepWarrior* Unbatched = World->SpawnActor<ADelveDeepWarrior>();
+	ASSERT_NOT_NULL(Unbatched);
+
+	// Only the opted-in character is drawn by the batch; its own component is hidden
+	EXPECT_EQ(SpriteBatch->GetInstanceCount(), 1);
+	EXPECT_FALSE(Batched->GetSprite()->IsVisible());
+	EXPECT_TRUE(Unbatched->GetSprite()->IsVisible());
+
+	// Leaving play gives the instance back
+	Batched->Destroy();
+	EXPECT_EQ(SpriteBatch->GetInstanceCount(), 0);
+
+	return true;
+}
+
+// ========================================
+// Test: Batched Characters Count As Visible For AI LOD
+// ========================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FCharacterSpriteBatchAILodTest,
+	"DelveDeep.Character.Rendering.SpriteBatchVisibleToAILod",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCharacterSpriteBatchAILodTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	ASSERT_NOT_NULL(World);
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	ON_SCOPE_EXIT
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	};
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UDelveDeepSpriteBatchSubsystem* SpriteBatch = World->GetSubsystem<UDelveDeepSpriteBatchSubsystem>();
+	UDelveDeepAILodSubsystem* AILod = World->GetSubsystem<UDelveDeepAILodSubsystem>();
+	ASSERT_NOT_NULL(SpriteBatch);
+	ASSERT_NOT_NULL(AILod);
+	AILod->SetLodDistances(1000.0f, 3000.0f);
+
+	// The test world has no game instance, so characters cannot load their data
+	AddExpectedMessage(TEXT("Failed to get game instance"), ELogVerbosity::Error, EAutomationExpectedMessageFlags::Contains, 0);
+
+	// A batched monster beyond the reduced radius, so only visibility keeps it from freezing
+	const FTransform SpawnTransform(FVector(5000.0f, 0.0f, 0.0f));
+	ADelveDeepWarrior* Batched = World->SpawnActorDeferred<ADelveDeepWarrior>(ADelveDeepWarrior::StaticClass(), SpawnTransform);
+	ASSERT_NOT_NULL(Batched);
+	const FBoolProperty* BatchingProperty = FindFProperty<FBoolProperty>(ADelveDeepCharacter::StaticClass(), TEXT("bUseSpriteBatching"));
+	ASSERT_NOT_NULL(BatchingProperty);
+	BatchingProperty->SetPropertyValue_InContainer(Batched, true);
+	Batched->FinishSpawning(SpawnTransform);
+	ASSERT_EQ(SpriteBatch->GetInstanceCount(), 1);
+
+	int32 UpdateCount = 0;
+	const int32 Handle = AILod->RegisterAgent(Batched, FDelveDeepAIUpdate::CreateLambda([&UpdateCount](float) { ++UpdateCount; }));
+	ASSERT_NE(Handle, INDEX_NONE);
+
+	// Off screen: frozen
+	for (int32 Frame = 0; Frame < UDelveDeepAILodSubsystem::ClassifyFrames; ++Frame)
+	{
+		AILod->Update(1.0f / 60.0f, FVector::ZeroVector);
+	}
+	EXPECT_FALSE(Batched->WasSpriteRecentlyRendered(UDelveDeepAILodSubsystem::VisibilityTolerance));
+	EXPECT_EQ(AILod->GetAgentLod(Handle), EDelveDeepAILod::Frozen);
+
+	// A view covering the monster: its hidden flipbook component never renders, but the batch instance is on screen
+	FConvexVolume::FPlaneArray Planes;
+	Planes.Add(FPlane(FVector(1.0f, 0.0f, 0.0f), 6000.0f));
+	Planes.Add(FPlane(FVector(-1.0f, 0.0f, 0.0f), -4000.0f));
+	SpriteBatch->UpdateInstanceVisibility(FConvexVolume(Planes));
+	EXPECT_FALSE(Batched->WasRecentlyRendered(UDelveDeepAILodSubsystem::VisibilityTolerance));
+	EXPECT_TRUE(Batched->WasSpriteRecentlyRendered(UDelveDeepAILodSubsystem::VisibilityTolerance));
+
+	// Visible agents are never frozen, however far away
+	UpdateCount = 0;
+	for (int32 Frame = 0; Frame < UDelveDeepAILodSubsystem::ClassifyFrames; ++Frame)
+	{
+		AILod->Update(1.0f / 60.0f, FVector::ZeroVector);
+	}
+	EXPECT_EQ(AILod->GetAgentLod(Handle), EDelveDeepAILod::Reduced);
+	EXPECT_GT(UpdateCount, 0);
+
+	AILod->UnregisterAgent(Handle);
+	Batched->Destroy();
+
+	return true;
+}
@@ -416,12 +416,8 @@ namespace DelveDeepTestUtils
 			return false;
 		}
 
-		// Note: This would require access to cooldown management in AbilitiesComponent
-		// For now, we just verify the component exists
-		// In a real implementation, we would manipulate the cooldown timer
-
-		UE_LOG(LogTemp, Warning, TEXT("SimulateAbilityCooldownComplete: Cooldown simulation not fully implemented"));
-		return true;
+		AbilitiesComponent->ResetAbilityCooldown(AbilityIndex);
+		return AbilitiesComponent->GetAbilityCooldownRemaining(AbilityIndex) <= 0.0f;
 	}
 
 	// ========================================
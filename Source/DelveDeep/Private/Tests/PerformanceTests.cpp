@@ -8,6 +8,11 @@
 #include "DelveDeepWeaponData.h"
 #include "DelveDeepAbilityData.h"
 #include "DelveDeepMonsterConfig.h"
+#include "Character/DelveDeepWarrior.h"
+#include "Character/DelveDeepDamageQueueSubsystem.h"
+#include "Character/DelveDeepMonsterSimulationSubsystem.h"
+#include "Character/DelveDeepTargetingSubsystem.h"
+#include "Character/DelveDeepAoESubsystem.h"
 #include "Engine/GameInstance.h"
 #include "HAL/PlatformTime.h"
 
@@ -470,3 +475,170 @@ bool FDelveDeepConfigValidationPerformanceTest::RunTest(const FString& Parameter
 
 	return true;
 }
+
+/**
+ * Performance test: Damage queue resolution at 1, 100 and 1000 hits per frame
+ * Target: < 1ms per frame at 1000 hits
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepDamageQueuePerformanceTest, 
+	"DelveDeep.Performance.Combat.DamageQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepDamageQueuePerformanceTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepDamageQueueSubsystem* DamageQueue = NewObject<UDelveDeepDamageQueueSubsystem>();
+	DamageQueue->SetDamageTypeMultiplier(FName("Fire"), 1.5f);
+
+	// 80 targets, roughly an AoE-heavy room
+	const int32 NumTargets = 80;
+	TArray<ADelveDeepWarrior*> Targets;
+	for (int32 Index = 0; Index < NumTargets; ++Index)
+	{
+		Targets.Add(NewObject<ADelveDeepWarrior>());
+	}
+
+	const int32 HitCounts[] = { 1, 100, 1000 };
+	const int32 Frames = 50;
+
+	UE_LOG(LogTemp, Display, TEXT("Damage queue performance:"));
+
+	for (const int32 HitsPerFrame : HitCounts)
+	{
+		double TotalTime = 0.0;
+
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			// Damage stays below what kills anyone across all frames
+			for (int32 Hit = 0; Hit < HitsPerFrame; ++Hit)
+			{
+				DamageQueue->EnqueueHit(Targets[Hit % NumTargets], 0.001f, (Hit & 1) ? FName("Fire") : NAME_None);
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			DamageQueue->ResolvePendingHits();
+			TotalTime += FPlatformTime::Seconds() - StartTime;
+		}
+
+		const double AverageMs = (TotalTime / Frames) * 1000.0;
+		UE_LOG(LogTemp, Display, TEXT("  %4d hits/frame: %.4f ms per resolve"), HitsPerFrame, AverageMs);
+
+		TestTrue(FString::Printf(TEXT("%d hits resolve in < 1ms (actual: %.4f ms)"), HitsPerFrame, AverageMs), 
+			AverageMs < 1.0);
+	}
+
+	TestTrue(TEXT("No target died during the benchmark"), !Targets[0]->IsDead());
+
+	return true;
+}
+
+/**
+ * Performance test: Simulated monster wave update
+ * Target: 2000 monsters in < 1ms per frame (leaves the rest of a 16.6ms frame)
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepMonsterSimulationPerformanceTest, 
+	"DelveDeep.Performance.AI.MonsterSimulation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepMonsterSimulationPerformanceTest::RunTest(const FString& Parameters)
+{
+	UDelveDeepMonsterSimulationSubsystem* Simulation = NewObject<UDelveDeepMonsterSimulationSubsystem>();
+
+	FDelveDeepMonsterConfig Config;
+	Config.MoveSpeed = 150.0f;
+	Config.DetectionRange = 1500.0f;
+	Config.AttackRange = 60.0f;
+	Simulation->RegisterMonsterTypeFromConfig(FName("BenchmarkMonster"), Config);
+
+	// Rings from 100 to 4000 units so every state is exercised
+	const int32 NumMonsters = 2000;
+	for (int32 Index = 0; Index < NumMonsters; ++Index)
+	{
+		const float Angle = Index * 0.618f * UE_TWO_PI;
+		const float Radius = 100.0f + (Index % 40) * 100.0f;
+		Simulation->SpawnMonster(FName("BenchmarkMonster"), FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f));
+	}
+
+	const int32 Frames = 120;
+	const float DeltaTime = 1.0f / 60.0f;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		Simulation->Simulate(DeltaTime, FVector::ZeroVector);
+	}
+	const double AverageMs = ((FPlatformTime::Seconds() - StartTime) / Frames) * 1000.0;
+
+	UE_LOG(LogTemp, Display, TEXT("Monster simulation performance:"));
+	UE_LOG(LogTemp, Display, TEXT("  %d monsters: %.4f ms per frame"), NumMonsters, AverageMs);
+
+	TestEqual(TEXT("All monsters still simulated"), Simulation->GetMonsterCount(), NumMonsters);
+	TestTrue(FString::Printf(TEXT("%d monsters update in < 1ms (actual: %.4f ms)"), NumMonsters, AverageMs), 
+		AverageMs < 1.0);
+
+	return true;
+}
+
+/**
+ * Performance test: AoE circle, cone and line queries at 100, 1000 and 5000 combatants
+ * Target: < 0.1ms per query at 5000 combatants
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepAoEQueryPerformanceTest, 
+	"DelveDeep.Performance.Combat.AoEQueries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepAoEQueryPerformanceTest::RunTest(const FString& Parameters)
+{
+	const int32 CombatantCounts[] = { 100, 1000, 5000 };
+	const int32 Queries = 200;
+	const uint32 Enemies = DelveDeepTeam::Opposing(DelveDeepTeam::Players);
+
+	UE_LOG(LogTemp, Display, TEXT("AoE query performance:"));
+
+	for (const int32 NumCombatants : CombatantCounts)
+	{
+		// Combatants spread over a 4000 unit square, one in eight on the player team
+		UDelveDeepTargetingSubsystem* Targeting = NewObject<UDelveDeepTargetingSubsystem>();
+		FRandomStream Random(NumCombatants);
+		for (int32 Index = 0; Index < NumCombatants; ++Index)
+		{
+			const FVector Location(Random.FRandRange(-2000.0f, 2000.0f), Random.FRandRange(-2000.0f, 2000.0f), 0.0f);
+			Targeting->RegisterCombatant(nullptr, Location, (Index % 8 == 0) ? DelveDeepTeam::Players : DelveDeepTeam::Monsters);
+		}
+
+		const FDelveDeepCombatantView View = Targeting->GetPackedCombatants();
+		TArray<int32> Found;
+		Found.Reserve(NumCombatants);
+		int32 TotalFound = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Query = 0; Query < Queries; ++Query)
+		{
+			const FVector Center(Random.FRandRange(-1500.0f, 1500.0f), Random.FRandRange(-1500.0f, 1500.0f), 0.0f);
+			const FVector Direction(Random.FRandRange(-1.0f, 1.0f), Random.FRandRange(-1.0f, 1.0f), 0.0f);
+
+			Found.Reset();
+			switch (Query % 3)
+			{
+			case 0:
+				FDelveDeepAoEQuery::Circle(View, Center, 300.0f, Enemies, Found);
+				break;
+			case 1:
+				FDelveDeepAoEQuery::Cone(View, Center, Direction, 250.0f, 60.0f, Enemies, Found);
+				break;
+			default:
+				FDelveDeepAoEQuery::Line(View, Center, Center + Direction * 800.0f, 40.0f, Enemies, Found);
+				break;
+			}
+			TotalFound += Found.Num();
+		}
+		const double AverageMs = ((FPlatformTime::Seconds() - StartTime) / Queries) * 1000.0;
+
+		UE_LOG(LogTemp, Display, TEXT("  %4d combatants: %.4f ms per query (%.1f hits on average)"), 
+			NumCombatants, AverageMs, static_cast<float>(TotalFound) / Queries);
+
+		TestTrue(FString::Printf(TEXT("%d combatants query in < 0.1ms (actual: %.4f ms)"), NumCombatants, AverageMs), 
+			AverageMs < 0.1);
+	}
+
+	return true;
+}
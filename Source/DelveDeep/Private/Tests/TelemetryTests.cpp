@@ -8,8 +8,19 @@
 #include "DelveDeepMemoryTracker.h"
 #include "DelveDeepPerformanceBaseline.h"
 #include "DelveDeepPerformanceReport.h"
+#include "DelveDeepEntityLimitController.h"
+#include "DelveDeepAssetLoadTracker.h"
+#include "DelveDeepSampledTelemetry.h"
+#include "DelveDeepTelemetryFeed.h"
+#include "DelveDeepDeferredWorkScheduler.h"
+#include "DelveDeepBaselineSerializer.h"
+#include "DelveDeepTraceRecorder.h"
+#include "DelveDeepGCTracker.h"
 #include "Engine/GameInstance.h"
+#include "HAL/PlatformProcess.h"
 #include "HAL/PlatformTime.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 /**
  * Unit test: FPS calculation accuracy with known frame times
@@ -235,6 +246,44 @@ bool FDelveDeepTelemetryOverlayOverheadTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+/**
+ * Unit test: Overlay frame time graph ring buffer
+ * Verifies the graph keeps at most MaxGraphFrames samples and clears cleanly
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryOverlayGraphBufferTest,
+	"DelveDeep.Telemetry.Overlay.GraphRingBuffer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryOverlayGraphBufferTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepPerformanceOverlay Overlay;
+
+	TestEqual(TEXT("Graph starts empty"), Overlay.GetGraphSampleCount(), 0);
+
+	for (int32 i = 0; i < 50; ++i)
+	{
+		Overlay.AddFrameTime(16.0f);
+	}
+	TestEqual(TEXT("Graph holds every sample while not full"), Overlay.GetGraphSampleCount(), 50);
+
+	for (int32 i = 0; i < FDelveDeepPerformanceOverlay::MaxGraphFrames * 3; ++i)
+	{
+		Overlay.AddFrameTime(static_cast<float>(i % 40));
+	}
+	TestEqual(TEXT("Graph is capped at MaxGraphFrames"),
+		Overlay.GetGraphSampleCount(), FDelveDeepPerformanceOverlay::MaxGraphFrames);
+
+	Overlay.ClearHistory();
+	TestEqual(TEXT("ClearHistory empties the graph"), Overlay.GetGraphSampleCount(), 0);
+
+	// Rendering without a canvas must not touch the text cache or the cost readout
+	Overlay.Render(nullptr, FFramePerformanceData(), TArray<FSystemPerformanceData>(), FMemorySnapshot());
+	TestEqual(TEXT("Null canvas skips text refresh"), Overlay.GetTextRefreshCount(), 0);
+	TestEqual(TEXT("Null canvas records no render cost"), Overlay.GetLastRenderCostMs(), 0.0f);
+
+	return true;
+}
+
 /**
  * Performance test: Memory snapshot capture time
  * Target: <1ms per capture
@@ -1520,3 +1569,553 @@ bool FDelveDeepTelemetryBaselineComparisonTest::RunTest(const FString& Parameter
 
 	return true;
 }
+
+/**
+ * Unit test: Adaptive entity limits follow frame time
+ * Verifies caps shrink under sustained overload, respect their floor,
+ * and recover to the static ceiling once frame time drops
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryAdaptiveEntityLimitTest,
+	"DelveDeep.Telemetry.Metrics.AdaptiveEntityLimits",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryAdaptiveEntityLimitTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepEntityLimitController Controller;
+	FSystemProfiler Profiler;
+	FDelveDeepGameplayMetrics Metrics;
+
+	Controller.SetTargetFrameTime(16.67f);
+	Metrics.TrackEntityCount(TEXT("Monsters"), 100);
+
+	const int32 StartLimit = Controller.GetLimit(TEXT("Monsters"));
+	TestEqual(TEXT("Monsters start at their ceiling"), StartLimit, 100);
+	TestFalse(TEXT("Spawning past the ceiling is denied"), Controller.CanSpawn(TEXT("Monsters"), 100));
+	TestTrue(TEXT("Unregistered types are never throttled"), Controller.CanSpawn(TEXT("Unknown"), 10000));
+
+	// Sustained 30 FPS with AI dominating the frame
+	for (int32 i = 0; i < 300; ++i)
+	{
+		Profiler.RecordSystemTime(TEXT("AI"), 12.0);
+		Profiler.UpdateFrame();
+		Controller.Update(1.0f / 30.0f, Profiler, Metrics);
+	}
+
+	const int32 LoadedLimit = Controller.GetLimit(TEXT("Monsters"));
+	TestTrue(FString::Printf(TEXT("Monster cap shrinks under overload (%d)"), LoadedLimit), LoadedLimit < StartLimit);
+	TestTrue(TEXT("Monster cap respects its floor"), LoadedLimit >= 20);
+
+	// Sustained 120 FPS with the wave cleared
+	Metrics.TrackEntityCount(TEXT("Monsters"), 10);
+	for (int32 i = 0; i < 1200; ++i)
+	{
+		Profiler.RecordSystemTime(TEXT("AI"), 0.5);
+		Profiler.UpdateFrame();
+		Controller.Update(1.0f / 120.0f, Profiler, Metrics);
+	}
+
+	TestEqual(TEXT("Monster cap recovers to its ceiling"), Controller.GetLimit(TEXT("Monsters")), 100);
+
+	return true;
+}
+
+/**
+ * Unit test: Asset load tracker top-K heap and gameplay sync-load flagging
+ * Verifies slowest loads are kept incrementally past the history size and that
+ * synchronous loads during gameplay are counted and broadcast
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryAssetLoadTopKTest,
+	"DelveDeep.Telemetry.AssetLoads.TopKAndGameplaySyncLoads",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryAssetLoadTopKTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepAssetLoadTracker Tracker;
+
+	// Slowest loads arrive early and must survive the history wrapping
+	const int32 NumLoads = 1500;
+	for (int32 i = 0; i < NumLoads; ++i)
+	{
+		const float LoadTimeMs = i < 10 ? 500.0f - i : static_cast<float>(i % 50);
+		Tracker.RecordAssetLoad(FString::Printf(TEXT("/Game/Data/DA_Test_%d.uasset"), i), LoadTimeMs, 1024, false);
+	}
+
+	TestEqual(TEXT("Total loads counts past the history size"), Tracker.GetTotalAssetLoads(), NumLoads);
+
+	const TArray<FAssetLoadRecord> Slowest = Tracker.GetSlowestAssetLoads(5);
+	TestEqual(TEXT("Requested number of slowest loads returned"), Slowest.Num(), 5);
+	if (Slowest.Num() == 5)
+	{
+		TestEqual(TEXT("Slowest load is first"), Slowest[0].LoadTimeMs, 500.0f);
+		TestEqual(TEXT("Fifth slowest load is kept"), Slowest[4].LoadTimeMs, 496.0f);
+	}
+
+	const TArray<FAssetLoadRecord> Recent = Tracker.GetRecentAssetLoads(3);
+	TestEqual(TEXT("Recent loads returned"), Recent.Num(), 3);
+	if (Recent.Num() == 3)
+	{
+		TestEqual(TEXT("Newest record is last"), Recent[2].AssetPath,
+			FString::Printf(TEXT("/Game/Data/DA_Test_%d.uasset"), NumLoads - 1));
+	}
+
+	// Gameplay sync loads
+	int32 Broadcasts = 0;
+	Tracker.OnGameplaySyncLoad.BindLambda([&Broadcasts](const FAssetLoadRecord&) { ++Broadcasts; });
+
+	Tracker.RecordAssetLoad(TEXT("/Game/Data/DA_Loading.uasset"), 5.0f, 0, true);
+	TestEqual(TEXT("Sync load outside gameplay is not flagged"), Tracker.GetGameplaySyncLoadCount(), 0);
+
+	Tracker.SetGameplayActive(true);
+	Tracker.RecordAssetLoad(TEXT("/Game/Data/DA_Hitch.uasset"), 5.0f, 0, true);
+	Tracker.RecordAssetLoad(TEXT("/Game/Data/DA_Streamed.uasset"), 5.0f, 0, false);
+
+	TestEqual(TEXT("Sync load during gameplay is flagged"), Tracker.GetGameplaySyncLoadCount(), 1);
+	TestEqual(TEXT("Gameplay sync load is broadcast"), Broadcasts, 1);
+	TestEqual(TEXT("Gameplay sync load is retained"), Tracker.GetGameplaySyncLoads().Num(), 1);
+
+	Tracker.OnGameplaySyncLoad.Unbind();
+
+	return true;
+}
+
+/**
+ * Unit test: Sampled telemetry histograms
+ * Verifies 1-in-N sampling, that every spike frame is kept, and that
+ * bucket percentiles and the summary line reflect the recorded frames
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetrySampledHistogramTest,
+	"DelveDeep.Telemetry.Sampled.HistogramAndSpikes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetrySampledHistogramTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepSampledTelemetry Sampled;
+
+	// Periodic writes off so the test never touches disk
+	Sampled.Configure(10, 20.0f, 0.0f);
+
+	// 1000 frames at 60 FPS with a 50ms hitch every 100 frames
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		Sampled.RecordFrame(i % 100 == 99 ? 0.050f : 0.016f);
+	}
+
+	const FDelveDeepFrameTimeHistogram& Histogram = Sampled.GetSampledHistogram();
+	const FDelveDeepFrameTimeHistogram& Spikes = Sampled.GetSpikeHistogram();
+
+	TestEqual(TEXT("All frames are counted"), Sampled.GetFramesSeen(), 1000u);
+	TestEqual(TEXT("One in ten frames is sampled"), Histogram.TotalCount, 100u);
+	TestEqual(TEXT("Every spike is recorded"), Spikes.TotalCount, 10u);
+	TestTrue(TEXT("Spike max is the hitch"), FMath::IsNearlyEqual(Spikes.MaxMs, 50.0f, 0.01f));
+	TestTrue(TEXT("Median lands in the 60 FPS bucket"), FMath::IsNearlyEqual(Histogram.GetPercentileMs(0.5f), 16.0f, 0.01f));
+
+	const FString Line = Sampled.BuildSummaryLine();
+	TestTrue(TEXT("Summary is a single line"), !Line.Contains(TEXT("\n")));
+	TestTrue(TEXT("Summary contains spike histogram"), Line.Contains(TEXT("\"spikes\":{\"n\":10")));
+
+	// Histogram percentiles clamp to observed values and handle the open bucket
+	FDelveDeepFrameTimeHistogram Manual;
+	TestEqual(TEXT("Empty histogram percentile"), Manual.GetPercentileMs(0.99f), 0.0f);
+	Manual.Add(5.0f);
+	Manual.Add(2000.0f);
+	TestEqual(TEXT("Open bucket reports the max"), Manual.GetPercentileMs(1.0f), 2000.0f);
+	TestEqual(TEXT("Last bucket holds the outlier"), Manual.Counts[FDelveDeepFrameTimeHistogram::NumBuckets - 1], 1u);
+
+	return true;
+}
+
+/**
+ * Unit test: Live telemetry feed ring
+ * Verifies frames published to shared memory are read back in order, and that
+ * a reader lapped by the writer skips to the oldest intact frame and counts drops
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryFeedRingTest,
+	"DelveDeep.Telemetry.Feed.SharedMemoryRing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryFeedRingTest::RunTest(const FString& Parameters)
+{
+	// Unique name so a running game's feed is not disturbed
+	const FString RegionName = FString::Printf(TEXT("DelveDeepTelemetryFeedTest_%u"), FPlatformProcess::GetCurrentProcessId());
+
+	FDelveDeepTelemetryFeedWriter Writer;
+	if (!TestTrue(TEXT("Writer maps shared memory"), Writer.Open(RegionName)))
+	{
+		return false;
+	}
+
+	FDelveDeepTelemetryFeedReader Reader;
+	if (!TestTrue(TEXT("Reader attaches to the feed"), Reader.Open(RegionName)))
+	{
+		return false;
+	}
+
+	FDelveDeepFeedFrame Frame;
+	FMemory::Memzero(Frame);
+
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Frame.FrameTimeMs = 16.0f + i;
+		Writer.PublishFrame(Frame);
+	}
+
+	TArray<FDelveDeepFeedFrame> Frames;
+	TestEqual(TEXT("All published frames are read"), Reader.ReadNewFrames(Frames), 10);
+	TestEqual(TEXT("Frames arrive in order"), Frames.Last().Sequence, static_cast<int64>(10));
+	TestEqual(TEXT("Payload survives the copy"), Frames.Last().FrameTimeMs, 25.0f);
+	TestEqual(TEXT("No frames dropped"), Reader.GetDroppedFrames(), static_cast<int64>(0));
+
+	// Lap the reader
+	const int32 Overrun = 20;
+	for (int32 i = 0; i < DelveDeepTelemetryFeed::Capacity + Overrun; ++i)
+	{
+		Writer.PublishFrame(Frame);
+	}
+
+	Frames.Reset();
+	TestEqual(TEXT("Reader gets one full ring"), Reader.ReadNewFrames(Frames), DelveDeepTelemetryFeed::Capacity);
+	TestEqual(TEXT("Lapped frames are counted as dropped"), Reader.GetDroppedFrames(), static_cast<int64>(Overrun));
+	TestEqual(TEXT("Reader is at the live edge"), Frames.Last().Sequence, Writer.GetPublishedSequence());
+
+	Writer.Close();
+	TestFalse(TEXT("Reader sees the writer close"), Reader.IsWriterActive());
+
+	return true;
+}
+
+/**
+ * Unit test: Deferred work scheduler budgets, priority and starvation
+ * Verifies work runs in priority order within a system's unused budget, carries
+ * over when the system has no headroom, and is forced through once starved
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryDeferredWorkTest,
+	"DelveDeep.Telemetry.DeferredWork.BudgetPriorityStarvation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryDeferredWorkTest::RunTest(const FString& Parameters)
+{
+	FSystemProfiler Profiler;
+	Profiler.RegisterSystem(TEXT("AI"), 2.0f);
+
+	FDelveDeepDeferredWorkScheduler Scheduler;
+	Scheduler.SetSystemBudget(TEXT("AI"), 2.0f);
+
+	TArray<FName> Order;
+	Scheduler.SubmitWork(TEXT("AI"), TEXT("Low"), EDelveDeepWorkPriority::Low, [&Order]() { Order.Add(TEXT("Low")); return true; });
+	Scheduler.SubmitWork(TEXT("AI"), TEXT("High"), EDelveDeepWorkPriority::High, [&Order]() { Order.Add(TEXT("High")); return true; });
+	Scheduler.SubmitWork(TEXT("AI"), TEXT("Normal"), EDelveDeepWorkPriority::Normal, [&Order]() { Order.Add(TEXT("Normal")); return true; });
+
+	// AI used its whole budget this frame: nothing runs, everything carries over
+	Profiler.RecordSystemTime(TEXT("AI"), 2.5);
+	Scheduler.ExecuteFrame(&Profiler);
+	TestEqual(TEXT("No work without headroom"), Order.Num(), 0);
+	TestEqual(TEXT("Work carried over"), Scheduler.GetSystemStats(TEXT("AI")).CarriedOverItems, 3);
+	TestEqual(TEXT("Frame counted as starved"), Scheduler.GetSystemStats(TEXT("AI")).StarvedFrames, 1);
+	Profiler.UpdateFrame();
+
+	// Headroom available: priority order
+	Profiler.RecordSystemTime(TEXT("AI"), 0.5);
+	Scheduler.ExecuteFrame(&Profiler);
+	Profiler.UpdateFrame();
+
+	if (TestEqual(TEXT("All items ran"), Order.Num(), 3))
+	{
+		TestEqual(TEXT("High first"), Order[0], FName(TEXT("High")));
+		TestEqual(TEXT("Normal second"), Order[1], FName(TEXT("Normal")));
+		TestEqual(TEXT("Low last"), Order[2], FName(TEXT("Low")));
+	}
+
+	// Incremental item under permanent overload is still forced through after starving
+	int32 Slices = 0;
+	Scheduler.SubmitWork(TEXT("AI"), TEXT("Replan"), EDelveDeepWorkPriority::Low, [&Slices]() { return ++Slices >= 2; });
+
+	for (int32 Frame = 0; Frame < FDelveDeepDeferredWorkScheduler::StarvationFrames + 2; ++Frame)
+	{
+		Profiler.RecordSystemTime(TEXT("AI"), 5.0);
+		Scheduler.ExecuteFrame(&Profiler);
+		Profiler.UpdateFrame();
+	}
+
+	const FDeferredWorkSystemStats Stats = Scheduler.GetSystemStats(TEXT("AI"));
+	TestEqual(TEXT("Starved item completed"), Scheduler.GetPendingCount(TEXT("AI")), 0);
+	TestEqual(TEXT("Starved item counted once"), Stats.StarvedItems, 1);
+	TestTrue(TEXT("Wait reflects starvation"), Stats.MaxWaitFrames >= FDelveDeepDeferredWorkScheduler::StarvationFrames);
+
+	// Cancellation
+	const uint64 Handle = Scheduler.SubmitWork(TEXT("AI"), TEXT("Cancelled"), EDelveDeepWorkPriority::Normal, []() { return true; });
+	TestTrue(TEXT("Pending work can be cancelled"), Scheduler.CancelWork(Handle));
+	TestFalse(TEXT("Cancelled work is gone"), Scheduler.CancelWork(Handle));
+
+	return true;
+}
+
+/**
+ * Unit test: Binary baseline round trip, corruption handling and legacy JSON
+ * Verifies columnar sections survive compression and that damaged files are rejected
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryBaselineBinaryFormatTest,
+	"DelveDeep.Telemetry.Baseline.BinaryFormat",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryBaselineBinaryFormatTest::RunTest(const FString& Parameters)
+{
+	FPerformanceBaseline Source;
+	Source.BaselineName = TEXT("BinaryRoundTrip");
+	Source.BuildVersion = TEXT("1.2.3");
+	Source.MapName = TEXT("TestMap");
+	Source.AverageFPS = 59.5f;
+	Source.OnePercentLowFPS = 41.0f;
+	Source.AverageFrameData.FrameTimeMs = 16.8f;
+	Source.MemoryData.TotalMemory = 512ll * 1024 * 1024;
+	Source.MemoryData.PerSystemMemory.Add(TEXT("Combat"), 4096);
+
+	for (int32 i = 0; i < 3600; ++i)
+	{
+		Source.FrameTimeSamples.Add(16.0f + (i % 7) * 0.25f);
+	}
+	Source.TotalFramesCaptured = Source.FrameTimeSamples.Num();
+
+	for (const TCHAR* SystemName : { TEXT("Combat"), TEXT("AI"), TEXT("Events") })
+	{
+		FSystemPerformanceData& System = Source.SystemData.Add(SystemName);
+		System.SystemName = SystemName;
+		System.BudgetTimeMs = 2.0;
+		System.AverageTimeMs = 1.25;
+		System.PeakTimeMs = 3.5;
+		System.CallCount = 7;
+	}
+
+	TArray<uint8> Bytes;
+	FDelveDeepBaselineSerializer::SaveToBytes(Source, Bytes);
+	TestTrue(TEXT("Output carries the binary magic"), FDelveDeepBaselineSerializer::IsBinaryBaseline(Bytes));
+	TestTrue(TEXT("Frame distribution compresses below raw size"), Bytes.Num() < Source.FrameTimeSamples.Num() * static_cast<int32>(sizeof(float)));
+
+	FPerformanceBaseline Loaded;
+	FString Error;
+	TestTrue(TEXT("Binary baseline loads"), FDelveDeepBaselineSerializer::LoadFromBytes(Bytes, Loaded, Error));
+	TestEqual(TEXT("Name preserved"), Loaded.BaselineName, Source.BaselineName);
+	TestEqual(TEXT("Capture time preserved"), Loaded.CaptureTime, Source.CaptureTime);
+	TestEqual(TEXT("Build preserved"), Loaded.BuildVersion, Source.BuildVersion);
+	TestEqual(TEXT("FPS preserved"), Loaded.AverageFPS, Source.AverageFPS);
+	TestEqual(TEXT("Memory preserved"), Loaded.MemoryData.TotalMemory, Source.MemoryData.TotalMemory);
+	TestEqual(TEXT("Per-system memory preserved"), Loaded.MemoryData.PerSystemMemory.FindRef(TEXT("Combat")), 4096ll);
+	TestEqual(TEXT("Distribution preserved"), Loaded.FrameTimeSamples, Source.FrameTimeSamples);
+	TestEqual(TEXT("Systems preserved"), Loaded.SystemData.Num(), 3);
+	if (const FSystemPerformanceData* AI = Loaded.SystemData.Find(TEXT("AI")))
+	{
+		TestEqual(TEXT("System column values preserved"), AI->PeakTimeMs, 3.5);
+		TestEqual(TEXT("System call count preserved"), AI->CallCount, 7);
+	}
+
+	// Flipped payload byte and truncation are both caught
+	TArray<uint8> Corrupt = Bytes;
+	Corrupt.Last() ^= 0xFF;
+	TestFalse(TEXT("Corrupt payload is rejected"), FDelveDeepBaselineSerializer::LoadFromBytes(Corrupt, Loaded, Error));
+
+	TArray<uint8> Truncated = Bytes;
+	Truncated.SetNum(Bytes.Num() / 2);
+	TestFalse(TEXT("Truncated file is rejected"), FDelveDeepBaselineSerializer::LoadFromBytes(Truncated, Loaded, Error));
+
+	// JSON export remains readable by the format-sniffing loader
+	FString Json;
+	TestTrue(TEXT("JSON export succeeds"), FDelveDeepBaselineSerializer::ExportToJson(Source, Json));
+
+	FTCHARToUTF8 Utf8(*Json);
+	TArray<uint8> JsonBytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	FPerformanceBaseline FromJson;
+	TestTrue(TEXT("JSON baseline loads"), FDelveDeepBaselineSerializer::LoadFromFileBytes(JsonBytes, FromJson, Error));
+	TestEqual(TEXT("JSON keeps systems"), FromJson.SystemData.Num(), 3);
+	TestEqual(TEXT("JSON keeps distribution"), FromJson.FrameTimeSamples.Num(), Source.FrameTimeSamples.Num());
+
+	return true;
+}
+
+/**
+ * Unit test: trace capture records spans, counters and frames and exports Chrome trace JSON
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryTraceChromeExportTest,
+	"DelveDeep.Telemetry.Trace.ChromeExport",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryTraceChromeExportTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepTraceRecorder& Recorder = FDelveDeepTraceRecorder::Get();
+	if (Recorder.IsCapturing())
+	{
+		AddWarning(TEXT("A trace capture is already running; skipping"));
+		return true;
+	}
+
+	// Nothing is recorded outside a capture
+	Recorder.StartCapture(8);
+	Recorder.StopCapture();
+	Recorder.RecordInstant(TEXT("Ignored"), TEXT("Test"));
+	TestEqual(TEXT("Events outside a capture are ignored"), Recorder.GetEventCount(), 0);
+
+	Recorder.StartCapture(8);
+	Recorder.MarkFrameBoundary(1);
+	{
+		DELVEDEEP_TRACE_SPAN(TEXT("TraceTestSpan"), TEXT("Test"));
+		FPlatformProcess::Sleep(0.001f);
+	}
+	Recorder.RecordSpanEndingNow(TEXT("TraceTestReported"), TEXT("System"), 0.5, TEXT("Path \"quoted\"\\dir"));
+	Recorder.RecordCounter(TEXT("TraceTestCounter"), 42.0);
+	Recorder.MarkFrameBoundary(2);
+
+	// Spans, reported span, counter and one closed frame
+	TestEqual(TEXT("All events recorded"), Recorder.GetEventCount(), 4);
+
+	// Overflow past the per-thread bound is counted, not stored
+	for (int32 i = 0; i < 10; ++i)
+	{
+		Recorder.RecordInstant(TEXT("TraceTestOverflow"), TEXT("Test"));
+	}
+	TestEqual(TEXT("Buffer bounded"), Recorder.GetEventCount(), 8);
+	TestEqual(TEXT("Overflow counted"), Recorder.GetDroppedEventCount(), 6ll);
+
+	Recorder.StopCapture();
+	const FString Json = Recorder.BuildChromeTraceJson();
+
+	TestTrue(TEXT("Has trace events array"), Json.Contains(TEXT("\"traceEvents\"")));
+	TestTrue(TEXT("Has complete spans"), Json.Contains(TEXT("\"ph\":\"X\"")));
+	TestTrue(TEXT("Has counters"), Json.Contains(TEXT("\"ph\":\"C\"")));
+	TestTrue(TEXT("Has instants"), Json.Contains(TEXT("\"ph\":\"i\"")));
+	TestTrue(TEXT("Names threads"), Json.Contains(TEXT("thread_name")));
+	TestTrue(TEXT("Records scoped span"), Json.Contains(TEXT("TraceTestSpan")));
+	TestTrue(TEXT("Records frame span"), Json.Contains(TEXT("\"Frame\"")));
+	TestTrue(TEXT("Escapes detail strings"), Json.Contains(TEXT("Path \\\"quoted\\\"\\\\dir")));
+
+	// Output must parse as JSON for trace viewers
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	TestTrue(TEXT("Export is valid JSON"), FJsonSerializer::Deserialize(Reader, Root) && Root.IsValid());
+
+	return true;
+}
+
+/**
+ * Unit test: GC tracker aggregates collections, per-class churn and pooling recommendations
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryGCChurnTest,
+	"DelveDeep.Telemetry.GC.ClassChurn",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryGCChurnTest::RunTest(const FString& Parameters)
+{
+	// Not started: only the explicit Record* calls below are counted
+	FDelveDeepGCTracker Tracker;
+
+	Tracker.RecordCollection(2.0f, 1000, 100);
+	Tracker.RecordCollection(8.0f, 1200, 300);
+	Tracker.UpdateFrame();
+
+	FDelveDeepGCStats Stats = Tracker.GetStats();
+	TestEqual(TEXT("Collections counted"), Stats.CollectionCount, 2);
+	TestEqual(TEXT("Average pause"), Stats.AverageGCTimeMs, 5.0f);
+	TestEqual(TEXT("Peak pause"), Stats.PeakGCTimeMs, 8.0f);
+	TestEqual(TEXT("Last purge"), Stats.LastObjectsPurged, 300);
+	TestEqual(TEXT("Pauses above threshold are spikes"), Stats.SpikeCount, 1);
+	TestEqual(TEXT("Frame GC time sums this frame's collections"), Stats.FrameGCTimeMs, 10.0f);
+	TestEqual(TEXT("Recent collections kept in order"), Tracker.GetRecentCollections().Num(), 2);
+
+	Tracker.UpdateFrame();
+	TestEqual(TEXT("Frame GC time resets next frame"), Tracker.GetStats().FrameGCTimeMs, 0.0f);
+
+	// Projectiles churn (at most 3 alive); the character lives on
+	const FName ProjectileClass(TEXT("DelveDeepProjectile"));
+	const FName CharacterClass(TEXT("DelveDeepCharacter"));
+	Tracker.RecordSpawn(1, CharacterClass);
+
+	int32 NextIndex = 100;
+	for (int32 Wave = 0; Wave < 20; ++Wave)
+	{
+		const int32 First = NextIndex;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			Tracker.RecordSpawn(NextIndex++, ProjectileClass);
+		}
+		for (int32 Index = First; Index < NextIndex; ++Index)
+		{
+			Tracker.RecordDestroy(Index);
+		}
+	}
+
+	// Untracked indices do not affect per-class counts
+	Tracker.RecordDestroy(99999);
+
+	const TArray<FDelveDeepClassChurn> Churn = Tracker.GetClassChurn();
+	TestEqual(TEXT("Two classes tracked"), Churn.Num(), 2);
+	if (Churn.Num() == 2)
+	{
+		TestEqual(TEXT("Highest churn first"), Churn[0].ClassName, ProjectileClass);
+		TestEqual(TEXT("Spawns counted"), Churn[0].Spawned, 60);
+		TestEqual(TEXT("Destroys counted"), Churn[0].Destroyed, 60);
+		TestEqual(TEXT("Nothing left alive"), Churn[0].Live, 0);
+		TestEqual(TEXT("Peak live"), Churn[0].PeakLive, 3);
+		TestEqual(TEXT("Long-lived class still live"), Churn[1].Live, 1);
+	}
+
+	// Tracking time is clamped to at least 0.1 min, so 60 destroys is >= 30/min
+	const TArray<FDelveDeepPoolingRecommendation> Recommendations = Tracker.GetPoolingRecommendations(30.0f);
+	TestEqual(TEXT("Only the churning class is recommended"), Recommendations.Num(), 1);
+	if (Recommendations.Num() == 1)
+	{
+		TestEqual(TEXT("Recommended class"), Recommendations[0].ClassName, ProjectileClass);
+		TestEqual(TEXT("Pool covers peak live"), Recommendations[0].SuggestedPoolSize, 3);
+	}
+
+	// GC statistics survive the binary baseline format
+	FPerformanceBaseline Baseline;
+	Baseline.BaselineName = TEXT("GCBaseline");
+	Baseline.GCData = Tracker.GetStats();
+
+	TArray<uint8> Bytes;
+	FDelveDeepBaselineSerializer::SaveToBytes(Baseline, Bytes);
+
+	FPerformanceBaseline Loaded;
+	FString Error;
+	TestTrue(TEXT("Baseline loads"), FDelveDeepBaselineSerializer::LoadFromBytes(Bytes, Loaded, Error));
+	TestEqual(TEXT("GC count preserved"), Loaded.GCData.CollectionCount, 2);
+	TestEqual(TEXT("GC peak preserved"), Loaded.GCData.PeakGCTimeMs, 8.0f);
+
+	return true;
+}
+
+/**
+ * Unit test: Actor pool acquires roll up into per-pool hit rates
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDelveDeepTelemetryActorPoolHitRateTest,
+	"DelveDeep.Telemetry.GameplayMetrics.ActorPoolHitRate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FDelveDeepTelemetryActorPoolHitRateTest::RunTest(const FString& Parameters)
+{
+	FDelveDeepGameplayMetrics Metrics;
+	const FName GoblinPool(TEXT("Goblin"));
+	const FName SkeletonPool(TEXT("Skeleton"));
+
+	TestEqual(TEXT("Unused pool has no hit rate"), Metrics.GetPoolStats(GoblinPool).GetHitRate(), 0.0f);
+
+	// First wave misses, later waves reuse
+	Metrics.RecordPoolAcquire(GoblinPool, false, 0);
+	Metrics.RecordPoolAcquire(GoblinPool, true, 2);
+	Metrics.RecordPoolAcquire(GoblinPool, true, 1);
+	Metrics.RecordPoolAcquire(GoblinPool, true, 0);
+	Metrics.RecordPoolRelease(GoblinPool, 1);
+	Metrics.RecordPoolAcquire(SkeletonPool, false, 0);
+
+	const FDelveDeepActorPoolStats Goblins = Metrics.GetPoolStats(GoblinPool);
+	TestEqual(TEXT("Hits counted"), Goblins.Hits, 3);
+	TestEqual(TEXT("Misses counted"), Goblins.Misses, 1);
+	TestEqual(TEXT("Available count follows releases"), Goblins.AvailableCount, 1);
+	TestEqual(TEXT("Hit rate"), Goblins.GetHitRate(), 0.75f);
+	TestEqual(TEXT("Pools tracked separately"), Metrics.GetAllPoolStats().Num(), 2);
+	TestEqual(TEXT("All misses"), Metrics.GetPoolStats(SkeletonPool).GetHitRate(), 0.0f);
+
+	// Resetting clears counts but keeps what is parked
+	Metrics.ResetStatistics();
+	TestEqual(TEXT("Hits reset"), Metrics.GetPoolStats(GoblinPool).Hits, 0);
+	TestEqual(TEXT("Available count kept"), Metrics.GetPoolStats(GoblinPool).AvailableCount, 1);
+
+	return true;
+}
@@ -0,0 +1,194 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepAILodSubsystem.generated.h"
+
+class AAIController;
+
+/**
+ * How often an AI agent is updated
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepAILod : uint8
+{
+	/** Near the player: updated every frame */
+	Full,
+	/** On screen, or off screen within ReducedRadius: updated every ReducedInterval frames */
+	Reduced,
+	/** Off screen and not near the player: not updated */
+	Frozen
+};
+
+/** Runs one AI update; receives the time since the agent's last update */
+DECLARE_DELEGATE_OneParam(FDelveDeepAIUpdate, float /*DeltaTime*/);
+
+/**
+ * AI LOD Subsystem
+ *
+ * Drives AI updates (behavior trees and other per-agent thinking) at a rate
+ * that depends on distance to the player and screen visibility, instead of
+ * every agent thinking every frame. Agents are reclassified a slice at a time
+ * and reduced-rate agents are spread over phases, so the number of updates
+ * per frame stays roughly flat as waves grow.
+ *
+ * The time spent in each bucket is reported to telemetry as "AILodFull" and
+ * "AILodReduced".
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepAILodSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return GetAgentCount() > 0; }
+
+	/**
+	 * Add an agent updated through a delegate
+	 * @param Actor Actor whose distance and visibility pick the bucket
+	 * @param Update Called when the agent is due
+	 * @return Agent handle, or INDEX_NONE if the actor or delegate is invalid
+	 */
+	int32 RegisterAgent(AActor* Actor, FDelveDeepAIUpdate Update);
+
+	/**
+	 * Take over ticking of an AI controller's brain component (behavior tree).
+	 * The brain may be created after registration (e.g. by RunBehaviorTree).
+	 * @param Controller Controller possessing the agent's pawn
+	 * @return Agent handle, or INDEX_NONE if the controller has no pawn
+	 */
+	int32 RegisterAIController(AAIController* Controller);
+
+	/**
+	 * Remove an agent (a managed brain component gets its own tick back)
+	 */
+	void UnregisterAgent(int32 Handle);
+
+	/**
+	 * Keep an agent in one bucket regardless of distance (e.g. bosses always Full)
+	 */
+	void PinAgentLod(int32 Handle, EDelveDeepAILod Lod);
+
+	/**
+	 * Let an agent's bucket follow distance and visibility again
+	 */
+	void UnpinAgentLod(int32 Handle);
+
+	/**
+	 * Reclassify a slice of agents and run every due update (called from Tick; public for tests)
+	 * @param DeltaTime Frame time
+	 * @param ViewerLocation Player location distances are measured from
+	 * @return Number of agents updated
+	 */
+	int32 Update(float DeltaTime, const FVector& ViewerLocation);
+
+	/**
+	 * Pick a bucket from distance and visibility
+	 * @param DistanceSq Squared 2D distance to the viewer
+	 * @param bVisible Whether the agent was rendered recently
+	 */
+	EDelveDeepAILod ClassifyAgent(float DistanceSq, bool bVisible) const;
+
+	/**
+	 * Set the bucket distances
+	 * @param InFullRadius Agents this close update every frame, on screen or not
+	 * @param InReducedRadius Off-screen agents this close update at the reduced rate; beyond it they are
+	 *        frozen. Visible agents never drop below the reduced rate.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|AI")
+	void SetLodDistances(float InFullRadius, float InReducedRadius);
+
+	/**
+	 * Set how many frames apart reduced-rate agents update
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|AI")
+	void SetReducedInterval(int32 Frames);
+
+	EDelveDeepAILod GetAgentLod(int32 Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|AI")
+	int32 GetAgentCount() const { return Actors.Num() - FreeSlots.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|AI")
+	int32 GetBucketCount(EDelveDeepAILod Lod) const;
+
+	/** Frames it takes to reclassify every agent */
+	static constexpr int32 ClassifyFrames = 4;
+
+	/** Seconds since last render that still count as on screen */
+	static constexpr float VisibilityTolerance = 0.25f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Take a free agent slot and fill it
+	 */
+	int32 AllocateAgent(AActor* Actor, FDelveDeepAIUpdate&& Update, AAIController* Controller);
+
+	/**
+	 * Reclassify the next slice of agents
+	 */
+	void ClassifySlice(const FVector& ViewerLocation);
+
+	/**
+	 * Move an agent to a bucket
+	 */
+	void SetLod(int32 Slot, EDelveDeepAILod Lod);
+
+	/**
+	 * Run an agent's update and clear its pending time
+	 */
+	void RunAgent(int32 Slot);
+
+	/**
+	 * Switch a managed brain's own tick back off for an agent that is not due this frame
+	 */
+	void HoldBrainTick(int32 Slot);
+
+	bool IsAgentValid(int32 Handle) const { return Active.IsValidIndex(Handle) && Active[Handle]; }
+
+	/** Per-agent state, indexed by handle */
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FDelveDeepAIUpdate> Updates;
+	TArray<TWeakObjectPtr<AAIController>> Controllers;
+	TArray<EDelveDeepAILod> Lods;
+	TArray<float> PendingTime;
+	TArray<uint8> Phases;
+	TArray<bool> Pinned;
+	TArray<bool> Active;
+
+	/** Released handles */
+	TArray<int32> FreeSlots;
+
+	/** Agents in each bucket */
+	int32 BucketCounts[3] = { 0, 0, 0 };
+
+	/** Agents due this frame, reused between updates */
+	TArray<int32> FullDue;
+	TArray<int32> ReducedDue;
+
+	float FullRadius = 1000.0f;
+	float ReducedRadius = 3000.0f;
+	int32 ReducedInterval = 4;
+
+	/** Next agent to reclassify */
+	int32 ClassifyCursor = 0;
+
+	/** Next phase handed to a new agent */
+	uint8 NextPhase = 0;
+
+	uint32 FrameCounter = 0;
+
+	/** Last known player location (kept when there is no pawn) */
+	FVector LastViewerLocation = FVector::ZeroVector;
+};
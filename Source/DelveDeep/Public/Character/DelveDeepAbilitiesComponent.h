@@ -8,11 +8,15 @@
 
 class UDelveDeepCharacterData;
 class UDelveDeepAbilityData;
+class UDelveDeepCooldownSubsystem;
 struct FDelveDeepValidationContext;
 
 /**
  * Abilities component managing character abilities and cooldowns.
  * Placeholder implementation for character system foundation.
+ *
+ * Cooldowns live in the world's UDelveDeepCooldownSubsystem as "ready at"
+ * timestamps; the component only keeps each ability's cooldown slot.
  */
 UCLASS(BlueprintType, ClassGroup = (DelveDeep), meta = (BlueprintSpawnableComponent))
 class DELVEDEEP_API UDelveDeepAbilitiesComponent : public UDelveDeepCharacterComponent
@@ -23,6 +27,7 @@ public:
 	UDelveDeepAbilitiesComponent();
 
 	// Component lifecycle
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitializeFromCharacterData(const UDelveDeepCharacterData* Data) override;
 	virtual bool ValidateComponent(FDelveDeepValidationContext& Context) const override;
 
@@ -43,12 +48,49 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Abilities")
 	bool CanUseAbility(int32 AbilityIndex) const;
 
+	/**
+	 * Get the seconds left on an ability's cooldown
+	 * @param AbilityIndex Ability index
+	 * @return Remaining cooldown (0 when ready)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Abilities")
+	float GetAbilityCooldownRemaining(int32 AbilityIndex) const;
+
+	/**
+	 * Make an ability ready immediately
+	 * @param AbilityIndex Ability index
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Abilities")
+	void ResetAbilityCooldown(int32 AbilityIndex);
+
+	/**
+	 * Get the cooldown slot of an ability in the cooldown subsystem
+	 * @return Slot, or INDEX_NONE if the ability has not been on cooldown yet
+	 */
+	int32 GetAbilityCooldownSlot(int32 AbilityIndex) const { return CooldownSlots.IsValidIndex(AbilityIndex) ? CooldownSlots[AbilityIndex] : INDEX_NONE; }
+
+	/**
+	 * Free every allocated cooldown slot (abilities become ready; slots are allocated again on next use)
+	 */
+	void ReleaseCooldownSlots();
+
 protected:
 	/** Array of ability references loaded from character data */
 	UPROPERTY(BlueprintReadOnly, Category = "DelveDeep|Character|Abilities")
 	TArray<const UDelveDeepAbilityData*> Abilities;
 
-	/** Map tracking ability cooldowns */
-	UPROPERTY()
-	TMap<const UDelveDeepAbilityData*, float> AbilityCooldowns;
+	/** Cooldown slot of each ability, parallel to Abilities (allocated on first use) */
+	TArray<int32> CooldownSlots;
+
+private:
+	/**
+	 * Get the world's cooldown subsystem
+	 */
+	UDelveDeepCooldownSubsystem* GetCooldownSubsystem() const;
+
+	/**
+	 * Damage everything the ability affects within its AoE radius of the owner
+	 * @return Number of characters damaged
+	 */
+	int32 ApplyAreaDamage(const UDelveDeepAbilityData* Ability);
 };
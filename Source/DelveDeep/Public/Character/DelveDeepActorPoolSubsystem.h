@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "DelveDeepActorPoolSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+
+/**
+ * Actor Pool Subsystem
+ *
+ * Keeps dead characters of pooled classes parked (hidden, no collision, no
+ * movement) instead of destroying them, and hands them back out on the next
+ * spawn of the same class. A reused character skips actor and component
+ * construction, BeginPlay and InitializeFromData; it only gets the same state
+ * reset as Respawn().
+ *
+ * Classes are not pooled until they are given a capacity, either directly or
+ * from the PoolSize of their monster configuration. Acquires of pooled classes
+ * are reported to telemetry so the hit rate can be tuned per class.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get a character of a class, reusing a pooled one when available
+	 * @param CharacterClass Class of character to get
+	 * @param Location Spawn location
+	 * @param Rotation Spawn rotation
+	 * @return Active character, or nullptr if spawning failed
+	 */
+	ADelveDeepCharacter* AcquireCharacter(TSubclassOf<ADelveDeepCharacter> CharacterClass, const FVector& Location, const FRotator& Rotation);
+
+	/**
+	 * Park a character for reuse
+	 * @param Character Character to park
+	 * @return True if pooled; false if its class is not pooled or its pool is full (caller destroys it)
+	 */
+	bool ReleaseCharacter(ADelveDeepCharacter* Character);
+
+	/**
+	 * Set how many parked characters a class keeps (0 disables pooling for it)
+	 * @param CharacterClass Class to configure
+	 * @param Capacity Maximum parked characters
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
+	void SetPoolCapacity(TSubclassOf<ADelveDeepCharacter> CharacterClass, int32 Capacity);
+
+	/**
+	 * Spawn and park characters ahead of time, raising the capacity if needed
+	 * @param CharacterClass Class to pre-warm
+	 * @param Count Parked characters wanted
+	 * @return Number of characters spawned
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
+	int32 PrewarmPool(TSubclassOf<ADelveDeepCharacter> CharacterClass, int32 Count);
+
+	/**
+	 * Size and pre-warm a class's pool from a monster configuration's PoolSize
+	 * @param MonsterName Monster configuration row
+	 * @param CharacterClass Class that spawns for this monster
+	 * @return Number of characters spawned
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
+	int32 PrewarmFromMonsterConfig(FName MonsterName, TSubclassOf<ADelveDeepCharacter> CharacterClass);
+
+	/**
+	 * Get the configured capacity of a class's pool
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	int32 GetPoolCapacity(TSubclassOf<ADelveDeepCharacter> CharacterClass) const;
+
+	/**
+	 * Get the number of parked characters of a class
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	int32 GetAvailableCount(TSubclassOf<ADelveDeepCharacter> CharacterClass) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FCharacterPool
+	{
+		/** Parked characters (the world owns them) */
+		TArray<TWeakObjectPtr<ADelveDeepCharacter>> Available;
+
+		/** Maximum parked characters */
+		int32 Capacity = 0;
+	};
+
+	/**
+	 * Spawn a new character
+	 */
+	ADelveDeepCharacter* SpawnNewCharacter(UClass* CharacterClass, const FVector& Location, const FRotator& Rotation) const;
+
+	/**
+	 * Report an acquire to telemetry
+	 */
+	void RecordAcquire(const UClass* CharacterClass, bool bHit, int32 AvailableCount) const;
+
+	/** Pools by class */
+	TMap<TObjectKey<UClass>, FCharacterPool> Pools;
+};
@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepAoESubsystem.generated.h"
+
+struct FDelveDeepCombatantView;
+class UDelveDeepTargetingSubsystem;
+
+/**
+ * Area-of-effect shape tests over packed combatant positions.
+ *
+ * Each query scans the X/Y/team arrays four combatants at a time with vector
+ * distance tests and a team bitmask filter, appending matching handles in
+ * handle order. All shapes are tested in 2D.
+ */
+struct DELVEDEEP_API FDelveDeepAoEQuery
+{
+	/**
+	 * Collect combatants inside a circle
+	 * @param View Packed combatants
+	 * @param Center Circle center (Z ignored)
+	 * @param Radius Circle radius
+	 * @param TeamMask Teams to include
+	 * @param OutHandles Receives matching handles (appended)
+	 * @return Number of handles added
+	 */
+	static int32 Circle(const FDelveDeepCombatantView& View, const FVector& Center, float Radius, uint32 TeamMask, TArray<int32>& OutHandles);
+
+	/**
+	 * Collect combatants inside a cone
+	 * @param Apex Cone apex (Z ignored)
+	 * @param Direction Cone axis (flattened to XY)
+	 * @param Range Cone length
+	 * @param HalfAngleDegrees Angle between the axis and the cone edge
+	 * @return Number of handles added
+	 */
+	static int32 Cone(const FDelveDeepCombatantView& View, const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, TArray<int32>& OutHandles);
+
+	/**
+	 * Collect combatants within a distance of a segment (a capsule)
+	 * @param Start Segment start (Z ignored)
+	 * @param End Segment end (Z ignored)
+	 * @param HalfWidth Distance from the segment that still counts as inside
+	 * @return Number of handles added
+	 */
+	static int32 Line(const FDelveDeepCombatantView& View, const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, TArray<int32>& OutHandles);
+};
+
+/**
+ * AoE Subsystem
+ *
+ * Answers circle, cone and line queries for abilities against the combatants
+ * registered with the targeting subsystem, and sends the results to the
+ * damage queue in one batch instead of a physics overlap and a TakeDamage
+ * call per target.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepAoESubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Collect combatants inside a circle
+	 * @param OutHandles Receives targeting handles (appended)
+	 * @return Number of handles added
+	 */
+	int32 QueryCircle(const FVector& Center, float Radius, uint32 TeamMask, TArray<int32>& OutHandles) const;
+
+	/**
+	 * Collect combatants inside a cone
+	 * @param OutHandles Receives targeting handles (appended)
+	 * @return Number of handles added
+	 */
+	int32 QueryCone(const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, TArray<int32>& OutHandles) const;
+
+	/**
+	 * Collect combatants within a distance of a segment
+	 * @param OutHandles Receives targeting handles (appended)
+	 * @return Number of handles added
+	 */
+	int32 QueryLine(const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, TArray<int32>& OutHandles) const;
+
+	/**
+	 * Queue damage against combatants
+	 * @param Handles Targeting handles (non-character combatants are skipped)
+	 * @param Damage Damage per target
+	 * @param DamageType Damage type passed to the damage queue
+	 * @param Instigator Source of the damage (never damaged by its own AoE)
+	 * @return Number of characters damaged
+	 */
+	int32 ApplyDamage(TConstArrayView<int32> Handles, float Damage, FName DamageType, AActor* Instigator);
+
+	/**
+	 * Damage every matching combatant inside a circle
+	 * @return Number of characters damaged
+	 */
+	int32 DamageCircle(const FVector& Center, float Radius, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator);
+
+	/**
+	 * Damage every matching combatant inside a cone
+	 * @return Number of characters damaged
+	 */
+	int32 DamageCone(const FVector& Apex, const FVector& Direction, float Range, float HalfAngleDegrees, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator);
+
+	/**
+	 * Damage every matching combatant within a distance of a segment
+	 * @return Number of characters damaged
+	 */
+	int32 DamageLine(const FVector& Start, const FVector& End, float HalfWidth, uint32 TeamMask, float Damage, FName DamageType, AActor* Instigator);
+
+	/**
+	 * Team mask an ability cast by a team affects
+	 * @param Team Caster's team
+	 * @param bAffectsAllies Whether the ability also hits the caster's team
+	 */
+	static uint32 GetAbilityTeamMask(uint8 Team, bool bAffectsAllies);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UDelveDeepTargetingSubsystem* GetTargeting() const;
+
+	/** Query scratch for the Damage* helpers */
+	TArray<int32> Scratch;
+};
@@ -12,6 +12,7 @@ class UDelveDeepEquipmentComponent;
 class UDelveDeepCharacterData;
 class UDelveDeepAbilityData;
 class UDelveDeepWeaponData;
+class UPaperFlipbook;
 struct FDelveDeepValidationContext;
 
 /**
@@ -30,6 +31,8 @@ public:
 	// Character data loading
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PossessedBy(AController* NewController) override;
+	virtual void UnPossessed() override;
 
 	/**
 	 * Initialize character from configuration data.
@@ -38,6 +41,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
 	void InitializeFromData();
 
+	/**
+	 * Finish a pending asynchronous initialization once the character's assets are loaded.
+	 * Called by UDelveDeepCharacterInitSubsystem within its frame budget.
+	 */
+	void FinishInitialization();
+
+	/**
+	 * Check if the character is waiting for its assets to stream in.
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	bool IsInitializationPending() const { return bInitializationPending; }
+
+	/**
+	 * Get the character data resolved from CharacterClassName.
+	 */
+	const UDelveDeepCharacterData* GetCharacterData() const { return CharacterData; }
+
 	/**
 	 * Validate character data using FDelveDeepValidationContext.
 	 * @param Context Validation context for error/warning tracking
@@ -52,7 +72,8 @@ public:
 	 * @param DamageEvent Damage event information
 	 * @param EventInstigator Controller that instigated the damage
 	 * @param DamageCauser Actor that caused the damage
-	 * @return Actual damage applied
+	 * @return Damage after mitigation. In game worlds the hit is queued and this is the
+	 *         damage it is expected to deal once this frame's batch resolves.
 	 */
 	virtual float TakeDamage(float Damage, const FDamageEvent& DamageEvent, AController* EventInstigator, AActor* DamageCauser) override;
 
@@ -64,6 +85,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
 	void ApplySimpleDamage(float DamageAmount, AActor* DamageSource);
 
+	/**
+	 * Apply damage already mitigated and summed by the damage queue.
+	 * Does not broadcast damage events, flash the sprite or kill the character;
+	 * the queue does that after applying the whole batch.
+	 * @param Damage Total damage after armor and damage type
+	 * @param DamageSource Actor credited with the damage
+	 * @return True if the damage left the character at zero health
+	 */
+	bool ApplyResolvedDamage(float Damage, AActor* DamageSource);
+
+	/**
+	 * Broadcast damage event through event subsystem.
+	 */
+	void BroadcastDamageEvent(float DamageAmount, AActor* DamageSource);
+
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
 	void Heal(float HealAmount);
 
@@ -77,6 +113,40 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
 	bool IsDead() const { return bIsDead; }
 
+	// Pooling
+	/**
+	 * Bring a pooled character back into play at a new location.
+	 * Resets state the same way Respawn() does; data is not reloaded.
+	 * @param Location Spawn location
+	 * @param Rotation Spawn rotation
+	 */
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
+
+	/**
+	 * Park the character in a pool: hidden, no collision, no movement and not
+	 * counted as a live character.
+	 */
+	void DeactivateForPool();
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	bool IsPooled() const { return bIsPooled; }
+
+	// Targeting
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Combat")
+	uint8 GetTeamId() const { return TeamId; }
+
+	/**
+	 * Change the character's team (also updates its targeting entry).
+	 * @param NewTeamId Team id (see DelveDeepTeam)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Combat")
+	void SetTeamId(uint8 NewTeamId);
+
+	/**
+	 * Get the character's handle in the targeting subsystem (INDEX_NONE while not targetable).
+	 */
+	int32 GetTargetingHandle() const { return TargetingHandle; }
+
 	// Component accessors
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
 	UDelveDeepStatsComponent* GetStatsComponent() const { return StatsComponent; }
@@ -100,6 +170,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Stats")
 	float GetMaxResource() const;
 
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Stats")
+	float GetArmor() const;
+
 	// Movement
 	/**
 	 * Update sprite facing direction based on movement velocity.
@@ -132,11 +205,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Animation")
 	void PlayDeathAnimation();
 
+	/**
+	 * Tint the character's sprite (batched or not).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Animation")
+	void SetSpriteColor(const FLinearColor& Color);
+
+	/**
+	 * Check whether the character's sprite was on screen recently (batched or not).
+	 * Batched characters hide their own component, so the sprite batch answers for them.
+	 * @param Tolerance Seconds since last on screen that still count
+	 */
+	bool WasSpriteRecentlyRendered(float Tolerance) const;
+
 protected:
+	/**
+	 * Fetch and validate character data from the configuration manager.
+	 * @return True if character data was found
+	 */
+	bool ResolveCharacterData();
+
 	/**
 	 * Initialize all character components after data is loaded.
+	 * @param bKeepCurrentStats True to keep damage and modifiers applied before the data arrived
 	 */
-	void InitializeComponents();
+	void InitializeComponents(bool bKeepCurrentStats = false);
 
 	// Blueprint events
 	UFUNCTION(BlueprintImplementableEvent, Category = "DelveDeep|Character")
@@ -161,9 +254,43 @@ protected:
 	void OnWeaponEquipped(const UDelveDeepWeaponData* Weapon);
 
 	/**
-	 * Broadcast damage event through event subsystem.
+	 * Clear death state and restore stats, input, collision and sprite.
+	 * Shared by Respawn() and pool activation.
 	 */
-	void BroadcastDamageEvent(float DamageAmount, AActor* DamageSource);
+	void ResetCharacterState();
+
+	/**
+	 * Adjust the live character count reported to telemetry.
+	 */
+	void TrackCharacterCount(int32 Delta);
+
+	/**
+	 * Add the character to (or remove it from) the targeting spatial hash.
+	 * Dead and pooled characters are not targetable.
+	 */
+	void SetTargetable(bool bTargetable);
+
+	/**
+	 * Hand the AI controller's updates to (or take them back from) the AI LOD subsystem.
+	 * Only live characters possessed by an AI controller are managed.
+	 */
+	void SetAILodManaged(bool bManaged);
+
+	/**
+	 * Stop (or restart) the AI controller's brain. Pooled characters keep their controller but do not think.
+	 */
+	void SetAILogicRunning(bool bRunning);
+
+	/**
+	 * Draw the character through the sprite batch subsystem (or through its own flipbook component again).
+	 * Only live characters with bUseSpriteBatching are batched.
+	 */
+	void SetSpriteBatched(bool bBatched);
+
+	/**
+	 * Play a flipbook on the batched instance or the flipbook component.
+	 */
+	void SetSpriteFlipbook(UPaperFlipbook* Flipbook, bool bLooping = true);
 
 	/**
 	 * Broadcast heal event through event subsystem.
@@ -181,6 +308,26 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DelveDeep|Character")
 	FName CharacterClassName;
 
+	/**
+	 * Stream starting weapon and abilities in the background on BeginPlay and
+	 * finish initializing later, instead of loading them synchronously.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DelveDeep|Character")
+	bool bAsyncInitialization;
+
+	/**
+	 * Draw through the sprite batch subsystem instead of the character's own
+	 * flipbook component (for monsters that appear in large waves).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DelveDeep|Character")
+	bool bUseSpriteBatching;
+
+	/**
+	 * Team used by automatic targeting (see DelveDeepTeam).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DelveDeep|Character|Combat")
+	uint8 TeamId;
+
 	/**
 	 * Stats component managing health, resource, damage, and move speed.
 	 */
@@ -212,7 +359,34 @@ protected:
 	bool bIsDead;
 
 	/**
-	 * Timer handle for destroying actor after death.
+	 * Flag indicating the character is parked in an actor pool.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "DelveDeep|Character")
+	bool bIsPooled;
+
+	/**
+	 * Flag indicating the character spawned and is waiting for its assets.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "DelveDeep|Character")
+	bool bInitializationPending;
+
+	/**
+	 * Timer handle for destroying (or pooling) actor after death.
 	 */
 	FTimerHandle DeathTimerHandle;
+
+	/**
+	 * Handle in the targeting subsystem.
+	 */
+	int32 TargetingHandle;
+
+	/**
+	 * Handle in the AI LOD subsystem.
+	 */
+	int32 AILodHandle;
+
+	/**
+	 * Handle in the sprite batch subsystem.
+	 */
+	int32 SpriteBatchHandle;
 };
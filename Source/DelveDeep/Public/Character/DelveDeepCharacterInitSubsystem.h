@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepCharacterInitSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+class UDelveDeepCharacterData;
+struct FStreamableHandle;
+
+/**
+ * Character Initialization Subsystem
+ *
+ * Initializes characters asynchronously. A character that requests
+ * initialization stays pending while its data's soft references (starting
+ * weapon and abilities) stream in; once they are resident it joins a ready
+ * queue, and the subsystem finishes component initialization for as many
+ * ready characters per frame as fit in the frame budget. The components'
+ * LoadSynchronous calls then only resolve already-loaded assets.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepCharacterInitSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return ReadyHead < ReadyQueue.Num(); }
+
+	/**
+	 * Start streaming a character's assets; the character finishes initializing once they are loaded
+	 * @param Character Character with its data resolved
+	 * @return True if the character was queued
+	 */
+	bool RequestInitialization(ADelveDeepCharacter* Character);
+
+	/**
+	 * Drop a character's request and release its loaded assets
+	 * @param Character Character being removed from play
+	 */
+	void ReleaseCharacter(ADelveDeepCharacter* Character);
+
+	/**
+	 * Finish initializing ready characters until the budget runs out (at least one per call)
+	 * @param BudgetSeconds Time budget
+	 * @return Number of characters initialized
+	 */
+	int32 ProcessReadyCharacters(double BudgetSeconds);
+
+	/**
+	 * Set the per-frame initialization budget
+	 * @param BudgetMs Milliseconds per frame spent finishing characters
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
+	void SetFrameBudget(float BudgetMs) { FrameBudgetMs = FMath::Max(BudgetMs, 0.0f); }
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	float GetFrameBudget() const { return FrameBudgetMs; }
+
+	/**
+	 * Get the number of characters whose assets are still streaming
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	int32 GetLoadingCount() const { return Loading.Num(); }
+
+	/**
+	 * Get the number of characters loaded and waiting for their frame budget
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	int32 GetReadyCount() const { return ReadyQueue.Num() - ReadyHead; }
+
+	/**
+	 * Collect the soft references a character needs before its components can initialize
+	 * @param Data Character data
+	 * @param OutPaths Receives the asset paths
+	 */
+	static void GatherInitializationAssets(const UDelveDeepCharacterData* Data, TArray<FSoftObjectPath>& OutPaths);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Streaming callback: move the character to the ready queue
+	 */
+	void OnAssetsLoaded(TWeakObjectPtr<ADelveDeepCharacter> Character);
+
+	/** Streaming handles, kept while the character lives so its assets stay resident */
+	TMap<TWeakObjectPtr<ADelveDeepCharacter>, TSharedPtr<FStreamableHandle>> Handles;
+
+	/** Loaded characters in arrival order; entries before ReadyHead are done */
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> ReadyQueue;
+	int32 ReadyHead = 0;
+
+	/** Characters whose assets are streaming */
+	TSet<TWeakObjectPtr<ADelveDeepCharacter>> Loading;
+
+	/** Milliseconds per frame spent finishing characters */
+	float FrameBudgetMs = 2.0f;
+};
@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepCooldownSubsystem.generated.h"
+
+/**
+ * Dense table of cooldowns stored as "ready at" timestamps.
+ *
+ * Cooldowns are addressed by slot id. A readiness check is one compare against
+ * the current time; nothing counts down. Every started cooldown is also pushed
+ * on a min-heap keyed by ready time, so the cooldowns that finish during a
+ * frame can be popped without scanning the table. Restarting or releasing a
+ * slot bumps its stamp, which turns heap entries pushed for it earlier stale.
+ */
+struct DELVEDEEP_API FDelveDeepCooldownTable
+{
+	/**
+	 * Get a slot for a new cooldown (reuses released slots)
+	 * @param Owner Object the cooldown belongs to (reported with ready slots)
+	 * @param Source What is on cooldown, e.g. the ability data (optional)
+	 * @return Slot id
+	 */
+	int32 Allocate(UObject* Owner, const UObject* Source = nullptr);
+
+	/**
+	 * Free a slot; pending heap entries for it are ignored
+	 */
+	void Release(int32 Slot);
+
+	/**
+	 * Start (or restart) a cooldown
+	 * @param Slot Slot id
+	 * @param Now Current time in seconds
+	 * @param Duration Cooldown length in seconds
+	 */
+	void Start(int32 Slot, double Now, float Duration);
+
+	/**
+	 * Make a slot ready immediately
+	 */
+	void Reset(int32 Slot);
+
+	/**
+	 * Check if a slot is off cooldown (unknown slots are ready)
+	 */
+	bool IsReady(int32 Slot, double Now) const { return !ReadyAt.IsValidIndex(Slot) || Now >= ReadyAt[Slot]; }
+
+	/**
+	 * Get the seconds left on a slot's cooldown
+	 */
+	float GetRemaining(int32 Slot, double Now) const;
+
+	/**
+	 * Pop every cooldown that became ready at or before Now
+	 * @param Now Current time in seconds
+	 * @param OutSlots Receives the slots that became ready, earliest first
+	 */
+	void PopReady(double Now, TArray<int32>& OutSlots);
+
+	/**
+	 * Get the owner of a slot
+	 */
+	UObject* GetOwner(int32 Slot) const { return Owners.IsValidIndex(Slot) ? Owners[Slot].Get() : nullptr; }
+
+	/**
+	 * Get what a slot tracks the cooldown of
+	 */
+	const UObject* GetSource(int32 Slot) const { return Sources.IsValidIndex(Slot) ? Sources[Slot].Get() : nullptr; }
+
+	/**
+	 * Get the number of cooldowns waiting to finish (including stale heap entries)
+	 */
+	int32 GetPendingCount() const { return Heap.Num(); }
+
+	/**
+	 * Get the number of allocated slots
+	 */
+	int32 GetAllocatedCount() const { return ReadyAt.Num() - FreeSlots.Num(); }
+
+	/**
+	 * Free every slot
+	 */
+	void Empty();
+
+private:
+	struct FHeapEntry
+	{
+		double ReadyAt;
+		int32 Slot;
+		uint32 Stamp;
+
+		bool operator<(const FHeapEntry& Other) const { return ReadyAt < Other.ReadyAt; }
+	};
+
+	/** Per-slot state, all indexed by slot id */
+	TArray<double> ReadyAt;
+	TArray<uint32> Stamps;
+	TArray<TWeakObjectPtr<UObject>> Owners;
+	TArray<TWeakObjectPtr<const UObject>> Sources;
+
+	/** Released slot ids */
+	TArray<int32> FreeSlots;
+
+	/** Started cooldowns, earliest ready time on top */
+	TArray<FHeapEntry> Heap;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDelveDeepCooldownsReady, const TArray<int32>& /*Slots*/);
+
+/**
+ * Cooldown Subsystem
+ *
+ * Holds the cooldowns of every ability in the world in one FDelveDeepCooldownTable.
+ * Components check readiness against world time without ticking; the subsystem
+ * only ticks while cooldowns are pending, to publish the ones that finished
+ * this frame for UI and AI.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepCooldownSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Cooldowns.GetPendingCount() > 0; }
+
+	/**
+	 * Get a slot for a new cooldown
+	 * @param Owner Object the cooldown belongs to
+	 * @param Source What is on cooldown (e.g. ability data)
+	 * @return Slot id
+	 */
+	int32 AllocateCooldown(UObject* Owner, const UObject* Source = nullptr) { return Cooldowns.Allocate(Owner, Source); }
+
+	/**
+	 * Free a cooldown slot
+	 */
+	void ReleaseCooldown(int32 Slot) { Cooldowns.Release(Slot); }
+
+	/**
+	 * Start a cooldown from the current world time
+	 * @param Slot Slot id
+	 * @param Duration Cooldown length in seconds
+	 */
+	void StartCooldown(int32 Slot, float Duration);
+
+	/**
+	 * Make a cooldown ready immediately
+	 */
+	void ResetCooldown(int32 Slot) { Cooldowns.Reset(Slot); }
+
+	/**
+	 * Check if a cooldown is over
+	 */
+	bool IsReady(int32 Slot) const { return Cooldowns.IsReady(Slot, GetNow()); }
+
+	/**
+	 * Get the seconds left on a cooldown
+	 */
+	float GetRemaining(int32 Slot) const { return Cooldowns.GetRemaining(Slot, GetNow()); }
+
+	/**
+	 * Get the cooldowns that became ready this frame
+	 * @return Slots popped by this frame's tick (empty if the subsystem has not ticked this frame)
+	 */
+	const TArray<int32>& GetReadyThisFrame() const;
+
+	/**
+	 * Get the cooldown table
+	 */
+	const FDelveDeepCooldownTable& GetCooldownTable() const { return Cooldowns; }
+
+	/** Broadcast each tick with the cooldowns that became ready */
+	FOnDelveDeepCooldownsReady OnCooldownsReady;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Get the current world time
+	 */
+	double GetNow() const;
+
+	FDelveDeepCooldownTable Cooldowns;
+
+	/** Slots that became ready during the last tick */
+	TArray<int32> ReadyThisFrame;
+
+	/** Frame ReadyThisFrame was filled on; the subsystem stops ticking once nothing is pending */
+	uint64 ReadyFrame = 0;
+};
@@ -0,0 +1,179 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepDamageQueueSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+struct FDelveDeepDamageBatchEventPayload;
+
+/**
+ * Damage Queue Subsystem
+ *
+ * Collects every hit dealt during a frame and resolves them together once per
+ * frame instead of running the full damage path per hit:
+ *
+ * 1. Gather - hits are mapped to unique live targets and each target's armor
+ *    is read once.
+ * 2. Compute - armor and damage-type multipliers are applied over packed
+ *    per-hit arrays.
+ * 3. Apply - hits are summed per target and each target takes one health
+ *    change, one OnDamaged call and one sprite flash (restored here, not by a
+ *    per-hit timer).
+ * 4. Publish - each applied hit's per-character damage event goes out (only
+ *    while something listens for it), then one FDelveDeepDamageBatchEventPayload
+ *    for the frame, then the characters the batch killed die.
+ *
+ * Hits enqueued while a batch resolves (thorns, chain effects) land in the
+ * next frame's batch.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepDamageQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UDelveDeepDamageQueueSubsystem();
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Pending.Num() > 0 || FlashEndTimes.Num() > 0; }
+
+	/**
+	 * Queue a hit for this frame's batch
+	 * @param Target Character to damage
+	 * @param Damage Raw damage before armor and damage type
+	 * @param DamageType Damage type (None = untyped)
+	 * @param Source Actor that dealt the hit
+	 */
+	void EnqueueHit(ADelveDeepCharacter* Target, float Damage, FName DamageType = NAME_None, AActor* Source = nullptr);
+
+	/**
+	 * Get the damage a hit would deal if its batch resolved now
+	 * @param Target Character to damage
+	 * @param Damage Raw damage before armor and damage type
+	 * @param DamageType Damage type (None = untyped)
+	 * @return Damage after the target's current armor and the damage type multiplier
+	 */
+	float GetExpectedDamage(const ADelveDeepCharacter* Target, float Damage, FName DamageType = NAME_None) const;
+
+	/**
+	 * Resolve every queued hit now (called from Tick; public for tests and benchmarks)
+	 * @return Number of hits resolved
+	 */
+	int32 ResolvePendingHits();
+
+	/**
+	 * Set how strongly a damage type hits (1 = unchanged)
+	 * @param DamageType Damage type name (e.g. Physical, Fire)
+	 * @param Multiplier Damage multiplier
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Combat")
+	void SetDamageTypeMultiplier(FName DamageType, float Multiplier);
+
+	/**
+	 * Get a damage type's multiplier (1 for unknown types)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	float GetDamageTypeMultiplier(FName DamageType) const;
+
+	/**
+	 * Get the number of hits waiting for the next resolve
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	int32 GetPendingHitCount() const { return Pending.Num(); }
+
+	/**
+	 * Get the number of characters damaged by the last resolve
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	int32 GetLastResolvedTargetCount() const { return LastResolvedTargetCount; }
+
+	/**
+	 * Get the characters killed by the last resolve
+	 */
+	const TArray<TWeakObjectPtr<ADelveDeepCharacter>>& GetLastDeaths() const { return LastDeaths; }
+
+	/**
+	 * Damage multiplier for an armor value (100 armor halves damage)
+	 * @param Armor Target armor
+	 * @return Multiplier in (0, 1]
+	 */
+	static float GetArmorMultiplier(float Armor) { return 100.0f / (100.0f + FMath::Max(Armor, 0.0f)); }
+
+	/** Seconds a damaged character's sprite stays tinted */
+	static constexpr float FlashDuration = 0.1f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Queued hits, one entry per hit across parallel arrays */
+	struct FHitBuffer
+	{
+		TArray<TWeakObjectPtr<ADelveDeepCharacter>> Targets;
+		TArray<TWeakObjectPtr<AActor>> Sources;
+		TArray<float> Damage;
+		TArray<uint8> DamageTypes;
+
+		int32 Num() const { return Damage.Num(); }
+		void Reset();
+	};
+
+	/**
+	 * Map a damage type name to its index in DamageTypeMultipliers (adds unknown types)
+	 */
+	uint8 GetDamageTypeIndex(FName DamageType);
+
+	/**
+	 * Tint a damaged character's sprite until FlashDuration passes
+	 */
+	void StartFlash(ADelveDeepCharacter* Character);
+
+	/**
+	 * Restore sprites whose flash has run out
+	 */
+	void UpdateFlashes();
+
+	/**
+	 * Broadcast each applied hit's per-character damage event, if anything listens
+	 */
+	void BroadcastHits(int32 NumHits) const;
+
+	/**
+	 * Broadcast the batch through the event subsystem
+	 */
+	void BroadcastBatch(const FDelveDeepDamageBatchEventPayload& Payload) const;
+
+	/** Hits queued for the next resolve */
+	FHitBuffer Pending;
+
+	/** Hits being resolved (swapped with Pending so new hits queue up separately) */
+	FHitBuffer Resolving;
+
+	/** Damage types by index; index 0 is untyped */
+	TArray<FName> DamageTypeNames;
+	TArray<float> DamageTypeMultipliers;
+
+	/** Per-hit scratch */
+	TArray<int32> HitTargetSlots;
+	TArray<float> HitMultipliers;
+
+	/** Per-target scratch */
+	TArray<ADelveDeepCharacter*> Targets;
+	TArray<float> TargetArmorMultipliers;
+	TArray<float> TargetDamage;
+	TArray<AActor*> TargetSources;
+	TArray<bool> TargetApplied;
+	TMap<ADelveDeepCharacter*, int32> TargetSlotLookup;
+
+	/** Sprite flashes in progress (world time they end) */
+	TMap<TWeakObjectPtr<ADelveDeepCharacter>, double> FlashEndTimes;
+
+	/** Results of the last resolve */
+	int32 LastResolvedTargetCount;
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> LastDeaths;
+};
@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepFlowFieldSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * Integration field toward one goal cell, with the steering direction of every cell
+ */
+struct DELVEDEEP_API FDelveDeepFlowField
+{
+	/** Cell the field leads to */
+	FIntPoint GoalCell = FIntPoint(INDEX_NONE, INDEX_NONE);
+
+	/** Path cost from each cell to the goal (MAX_flt = unreachable) */
+	TArray<float> Integration;
+
+	/** Neighbour each cell steers toward (NoDirection at the goal and in unreachable cells) */
+	TArray<uint8> Directions;
+
+	static constexpr uint8 NoDirection = 0xFF;
+
+	/**
+	 * Build the field over a cost grid (runs on worker threads)
+	 * @param Costs Cost of entering each cell, row-major (BlockedCost = impassable)
+	 * @param Dimensions Grid size in cells
+	 * @param Goal Goal cell
+	 * @param MaxRadius Cells further than this from the goal (Chebyshev distance) are left unreachable
+	 * @param OutField Receives the field
+	 */
+	static void Build(const TArray<uint8>& Costs, FIntPoint Dimensions, FIntPoint Goal, int32 MaxRadius, FDelveDeepFlowField& OutField);
+};
+
+/**
+ * Flow Field Subsystem
+ *
+ * Steers monster hordes with one integration field per player instead of a
+ * navmesh path query per monster. The level is covered by a grid of cell
+ * costs (built from the navmesh or set directly); each player's field holds
+ * the path cost to that player from every cell within MaxFieldRadius, plus a
+ * precomputed steering direction per cell, so a monster only samples its cell.
+ *
+ * A field is rebuilt on a worker thread when its player enters another cell
+ * or the cost grid changes, and swapped in on the game thread once ready;
+ * the previous field keeps steering until then. Monsters outside every field
+ * (or special AI) fall back to navmesh path queries.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Costs.Num() > 0; }
+
+	/**
+	 * Set up an open grid (every cell passable at cost 1); drops existing fields
+	 * @param Origin World location of the corner of cell (0, 0)
+	 * @param Dimensions Grid size in cells
+	 * @param InCellSize Cell edge length
+	 */
+	void InitializeGrid(const FVector& Origin, FIntPoint Dimensions, float InCellSize);
+
+	/**
+	 * Set up the grid over an area, blocking every cell whose center is off the navmesh
+	 * @param Bounds Area to cover (the mine level)
+	 * @param InCellSize Cell edge length
+	 * @return False if there is no navigation system
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|AI")
+	bool BuildGridFromNavigation(const FBox& Bounds, float InCellSize = 100.0f);
+
+	/**
+	 * Change the cost of entering a cell (fields are rebuilt on the next update)
+	 * @param Cost 1 for open ground, higher to avoid, BlockedCost for impassable
+	 */
+	void SetCellCost(const FIntPoint& Cell, uint8 Cost);
+
+	/**
+	 * Add a goal with its own field
+	 * @return Goal id
+	 */
+	int32 AddGoal(const FVector& Location);
+
+	/**
+	 * Move a goal (its field is rebuilt once it enters another cell)
+	 */
+	void SetGoalLocation(int32 Goal, const FVector& Location);
+
+	void RemoveGoal(int32 Goal);
+
+	/**
+	 * Get the steering direction toward the nearest goal (by path cost)
+	 * @param Location Location to steer from
+	 * @param OutDirection Receives a normalized 2D direction
+	 * @return False if no field reaches the location (use a path query instead)
+	 */
+	bool SampleDirection(const FVector& Location, FVector& OutDirection) const;
+
+	/**
+	 * Get the path cost from a location to a goal
+	 * @return Cost, or MAX_flt if the goal's field does not reach the location
+	 */
+	float GetPathCost(int32 Goal, const FVector& Location) const;
+
+	/**
+	 * Swap in finished fields and start rebuilds of stale ones (called from Tick; public for tests)
+	 */
+	void UpdateFields();
+
+	/**
+	 * Wait for every rebuild in flight and swap the results in
+	 */
+	void FlushBuilds();
+
+	/**
+	 * Limit how far fields extend from their goal
+	 * @param InMaxFieldRadius Radius in cells
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|AI")
+	void SetMaxFieldRadius(int32 InMaxFieldRadius);
+
+	/**
+	 * Convert a location to a cell
+	 * @return Cell, which may be outside the grid
+	 */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	bool IsCellInGrid(const FIntPoint& Cell) const { return Cell.X >= 0 && Cell.Y >= 0 && Cell.X < GridSize.X && Cell.Y < GridSize.Y; }
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|AI")
+	int32 GetGoalCount() const { return Goals.Num() - FreeGoals.Num(); }
+
+	/**
+	 * Get the number of field rebuilds running on worker threads
+	 */
+	int32 GetBuildsInFlight() const;
+
+	/** Cost of an impassable cell */
+	static constexpr uint8 BlockedCost = 0xFF;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	typedef TSharedPtr<FDelveDeepFlowField, ESPMode::ThreadSafe> FFieldPtr;
+
+	struct FGoal
+	{
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint(INDEX_NONE, INDEX_NONE);
+
+		/** Field monsters sample */
+		FFieldPtr Field;
+
+		/** Rebuild running on a worker thread */
+		TFuture<FFieldPtr> PendingField;
+
+		bool bDirty = false;
+		bool bActive = false;
+	};
+
+	/**
+	 * Keep one goal per player pawn
+	 */
+	void SyncPlayerGoals();
+
+	bool IsGoalValid(int32 Goal) const { return Goals.IsValidIndex(Goal) && Goals[Goal].bActive; }
+
+	/** Cost of entering each cell, row-major */
+	TArray<uint8> Costs;
+
+	/** Copy of the costs shared with rebuilds in flight */
+	TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> CostSnapshot;
+	bool bCostsChanged = false;
+
+	FVector GridOrigin = FVector::ZeroVector;
+	FIntPoint GridSize = FIntPoint::ZeroValue;
+	float CellSize = 100.0f;
+
+	int32 MaxFieldRadius = 64;
+
+	TArray<FGoal> Goals;
+	TArray<int32> FreeGoals;
+
+	/** Goal of each player pawn */
+	TMap<TWeakObjectPtr<APawn>, int32> PlayerGoals;
+};
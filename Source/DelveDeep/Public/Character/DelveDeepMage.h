@@ -21,15 +21,8 @@ public:
 	ADelveDeepMage();
 
 	/**
-	 * Regenerates Mana resource over time
-	 * @param DeltaTime Time elapsed since last regeneration tick
-	 */
-	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Mage")
-	void RegenerateMana(float DeltaTime);
-
-	/**
-	 * Casts a fireball spell that deals AoE damage at target location
-	 * Placeholder for future combat system integration
+	 * Casts a fireball projectile that flies to the target location and explodes
+	 * on the first enemy in its path (or at the target location)
 	 * @param TargetLocation World location where fireball should explode
 	 */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Mage")
@@ -37,7 +30,7 @@ public:
 
 protected:
 	/**
-	 * Override to start Mana regeneration timer
+	 * Override to start Mana regeneration
 	 */
 	virtual void BeginPlay() override;
 
@@ -46,11 +39,6 @@ protected:
 	 */
 	virtual void OnResourceChanged(float OldValue, float NewValue) override;
 
-	/**
-	 * Override to stop Mana regeneration timer
-	 */
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-
 private:
 	/** Mana regeneration rate per second */
 	static constexpr float ManaRegenRate = 5.0f;
@@ -58,9 +46,15 @@ private:
 	/** Maximum Mana the Mage can accumulate */
 	static constexpr float MaxMana = 100.0f;
 
-	/** Timer handle for Mana regeneration */
-	FTimerHandle ManaRegenTimerHandle;
+	/** Fireball speed when the equipped weapon has no projectile */
+	static constexpr float FireballSpeed = 800.0f;
+
+	/** Radius of the fireball's blast */
+	static constexpr float FireballExplosionRadius = 150.0f;
+
+	/** Mana spent per fireball */
+	static constexpr float FireballManaCost = 20.0f;
 
-	/** Starts the Mana regeneration timer */
+	/** Registers Mana with the resource regeneration subsystem */
 	void StartManaRegeneration();
 };
@@ -0,0 +1,174 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepMinionSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+
+/**
+ * Weights and distances of the batched minion steering pass
+ */
+struct FDelveDeepMinionSteering
+{
+	/** Minions closer than this push apart */
+	float SeparationRadius = 80.0f;
+	float SeparationWeight = 1.5f;
+
+	/** Pull toward the center of the owner's minions */
+	float CohesionWeight = 0.3f;
+
+	/** Distance minions keep from their owner while following */
+	float FollowDistance = 200.0f;
+
+	/** Minions pick targets this close to themselves */
+	float AggroRadius = 800.0f;
+
+	/** Minions drop targets (and return) once this far from their owner */
+	float LeashRadius = 1200.0f;
+
+	/**
+	 * Compute a minion's steering direction
+	 * @param Position Minion location
+	 * @param Goal Target or owner location
+	 * @param StopDistance Distance from the goal at which the minion stops seeking it
+	 * @param GroupCenter Center of the owner's minions
+	 * @param Neighbours Locations of nearby combatants (the minion itself excluded)
+	 * @return Movement direction, at most unit length (zero when settled)
+	 */
+	FVector2D ComputeSteering(const FVector2D& Position, const FVector2D& Goal, float StopDistance, const FVector2D& GroupCenter, TConstArrayView<FVector2D> Neighbours) const;
+};
+
+/**
+ * Minion Subsystem
+ *
+ * Owns every summoned minion. Minions come from the actor pool (pre-warmed
+ * when a summoner starts play) and are driven in one batched pass per frame
+ * instead of each running its own AI: a steering pass that follows the owner
+ * or closes on a target with separation and cohesion from the combat spatial
+ * hash, a round-robin retarget slice through the targeting subsystem, and
+ * melee hits through the damage queue.
+ *
+ * Minions are paid for with their owner's resource (a Necromancer's Souls):
+ * each minion drains SoulUpkeep per second in the same pass, and when the
+ * owner can no longer pay, its oldest minion crumbles. There are no
+ * per-minion timers.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepMinionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Minions.Num() > 0; }
+
+	/**
+	 * Spawn and park minions ahead of time so summons reuse pooled actors
+	 * @param MinionClass Class summoned
+	 * @param Count Parked minions wanted
+	 */
+	void PrewarmMinions(TSubclassOf<ADelveDeepCharacter> MinionClass, int32 Count);
+
+	/**
+	 * Summon a minion for an owner, on the owner's team
+	 * @param Owner Summoner; pays the upkeep
+	 * @param MinionClass Class to summon
+	 * @param Location Spawn location
+	 * @return Minion, or nullptr if spawning failed
+	 */
+	ADelveDeepCharacter* SummonMinion(ADelveDeepCharacter* Owner, TSubclassOf<ADelveDeepCharacter> MinionClass, const FVector& Location);
+
+	/**
+	 * Return a minion to its pool
+	 */
+	void DismissMinion(ADelveDeepCharacter* Minion);
+
+	/**
+	 * Return every minion of an owner to its pool
+	 */
+	void DismissAllMinions(const ADelveDeepCharacter* Owner);
+
+	/**
+	 * Run upkeep, retargeting, steering and attacks for every minion (called from Tick; public for tests)
+	 */
+	void UpdateMinions(float DeltaTime);
+
+	int32 GetMinionCount(const ADelveDeepCharacter* Owner) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character")
+	int32 GetTotalMinionCount() const { return Minions.Num(); }
+
+	/**
+	 * Set how much of its owner's resource each minion drains per second
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character")
+	void SetSoulUpkeep(float SoulsPerMinionPerSecond);
+
+	FDelveDeepMinionSteering& GetSteering() { return Steering; }
+
+	/** Frames it takes to retarget every minion */
+	static constexpr int32 RetargetFrames = 8;
+
+	/** Seconds between a minion's attacks at attack speed 1 */
+	static constexpr float BaseAttackInterval = 1.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Drop minions that died or were destroyed, or whose owner is gone
+	 */
+	void RemoveInvalidMinions();
+
+	/**
+	 * Drain each owner's resource; dismiss its oldest minion when it cannot pay
+	 */
+	void ApplyUpkeep(float DeltaTime);
+
+	/**
+	 * Pick new targets for the next slice of minions
+	 */
+	void RetargetSlice();
+
+	/**
+	 * Steer every minion and attack targets in range
+	 */
+	void SteerAndAttack();
+
+	/**
+	 * Park or destroy a minion and drop its entry
+	 */
+	void RemoveMinion(int32 Index);
+
+	/** Per-minion state, in summon order (oldest first) */
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> Minions;
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> Owners;
+	TArray<TWeakObjectPtr<AActor>> Targets;
+	TArray<double> AttackReadyTimes;
+
+	/** Minion locations gathered for the steering pass */
+	TArray<FVector2D> Positions;
+
+	/** Neighbour query results, reused between minions */
+	TArray<int32> NeighbourHandles;
+	TArray<FVector2D> NeighbourPositions;
+
+	/** Upkeep each owner has accrued but not yet paid, in Souls */
+	TMap<TWeakObjectPtr<ADelveDeepCharacter>, float> UpkeepDebts;
+
+	FDelveDeepMinionSteering Steering;
+
+	float SoulUpkeep = 0.1f;
+
+	/** Next minion to retarget */
+	int32 RetargetCursor = 0;
+};
@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepModifierExpirySubsystem.generated.h"
+
+class UDelveDeepStatsComponent;
+
+/**
+ * Modifier waiting to expire
+ */
+struct FDelveDeepModifierExpiry
+{
+	/** Component that owns the modifier (may be gone by the time it expires) */
+	TWeakObjectPtr<UDelveDeepStatsComponent> Component;
+
+	/** Modifier handle returned by AddStatModifierById */
+	int32 Handle = INDEX_NONE;
+
+	/** World time the modifier expires at */
+	double ExpireTime = 0.0;
+};
+
+/**
+ * Hierarchical timing wheel of modifier expirations
+ *
+ * Four levels of 64 slots. Level 0 slots are 1/64 s wide and cover the next
+ * second; each higher level covers 64 times the span of the one below, so
+ * scheduling is O(1) for anything up to about three days out (later expiries
+ * wait in the last level and cascade again). Advancing visits the slots the
+ * clock passed, moving entries down a level as their range comes up, and
+ * jumps straight over ranges whose lower levels are empty.
+ *
+ * Slots are coarser than the expiry times; the slot holding the current time
+ * is filtered against the exact time, so an entry fires on the first Advance
+ * whose time has reached its ExpireTime - never early, never a slot late.
+ *
+ * Cancelled modifiers are not removed from the wheel; their entry fires later
+ * and finds the handle gone.
+ */
+class DELVEDEEP_API FDelveDeepTimingWheel
+{
+public:
+	FDelveDeepTimingWheel();
+
+	/**
+	 * Schedule an expiry
+	 * @param Expiry Entry to fire once Advance reaches its ExpireTime
+	 */
+	void Schedule(const FDelveDeepModifierExpiry& Expiry);
+
+	/**
+	 * Move the clock forward and collect everything that expired
+	 * @param Now Current time (same clock as ExpireTime)
+	 * @param OutExpired Receives expired entries, appended
+	 */
+	void Advance(double Now, TArray<FDelveDeepModifierExpiry>& OutExpired);
+
+	/**
+	 * Get the number of scheduled entries
+	 */
+	int32 Num() const { return NumEntries; }
+
+	/**
+	 * Drop every entry and restart the clock at zero
+	 */
+	void Reset();
+
+	/** Slot width of level 0 in seconds */
+	static constexpr double TickSeconds = 1.0 / 64.0;
+
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr int32 NumLevels = 4;
+
+private:
+	struct FEntry
+	{
+		FDelveDeepModifierExpiry Expiry;
+		uint64 Tick = 0;
+	};
+
+	using FSlot = TArray<FEntry>;
+
+	static uint64 TimeToTick(double Time);
+
+	/** Place an entry in the level and slot for its tick */
+	void Insert(FEntry&& Entry);
+
+	/** Move a higher-level slot's entries down as the clock enters its range */
+	void Cascade(int32 Level);
+
+	/** Slots per level */
+	TStaticArray<TStaticArray<FSlot, SlotsPerLevel>, NumLevels> Levels;
+
+	/** Entries held by each level */
+	TStaticArray<int32, NumLevels> LevelCounts;
+
+	/** Tick whose level 0 slot is the current one */
+	uint64 CurrentTick;
+
+	int32 NumEntries;
+};
+
+/**
+ * Modifier Expiry Subsystem
+ *
+ * Expires timed stat modifiers for every stats component in the world from
+ * one timing wheel, in a single batch per frame at the frame they run out.
+ * It only ticks while something is scheduled, so components without timed
+ * modifiers cost nothing.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepModifierExpirySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Wheel.Num() > 0; }
+
+	/**
+	 * Expire a modifier at a world time
+	 * @param Component Component that owns the modifier
+	 * @param Handle Modifier handle
+	 * @param ExpireTime World time (GetTimeSeconds) to remove it at
+	 */
+	void ScheduleModifierExpiry(UDelveDeepStatsComponent* Component, int32 Handle, double ExpireTime);
+
+	/**
+	 * Get the number of scheduled expiries (includes ones already cancelled)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	int32 GetPendingExpiryCount() const { return Wheel.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FDelveDeepTimingWheel Wheel;
+
+	/** Reused between frames */
+	TArray<FDelveDeepModifierExpiry> ExpiredScratch;
+};
@@ -0,0 +1,234 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepMonsterSimulationSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+class UDelveDeepFlowFieldSubsystem;
+struct FDelveDeepMonsterConfig;
+
+/**
+ * Simulation state of a monster
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepMonsterState : uint8
+{
+	/** Out of detection range and not in combat */
+	Idle,
+	/** Moving toward the player */
+	Chasing,
+	/** Within attack range of the player */
+	Attacking,
+	/** Represented by a full character actor */
+	Promoted,
+	/** Killed; removed at the end of the update */
+	Dead
+};
+
+/**
+ * Monster Simulation Subsystem
+ *
+ * Simulates monster waves without an actor per monster. Position, velocity,
+ * health and state live in structure-of-arrays indexed by slot, with per-type
+ * stats copied from FDelveDeepMonsterConfig at spawn, and the movement update
+ * runs as parallel batches over those arrays. Chasing monsters steer along the
+ * player flow fields where they cover the monster's position.
+ *
+ * Only monsters near the player or in combat are promoted to full character
+ * actors (through SpawnCharacter, so the actor pool applies); they are demoted
+ * back to the simulation once far away and out of combat. Promoted monsters
+ * are driven by their actor and skipped by the batch update.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepMonsterSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Health.Num() > 0; }
+
+	/**
+	 * Register a monster type from the configuration manager's monster table
+	 * @param MonsterName Monster configuration row
+	 * @param ActorClass Character class monsters of this type are promoted to (none = never promoted)
+	 * @return True if the type is registered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Monsters")
+	bool RegisterMonsterType(FName MonsterName, TSubclassOf<ADelveDeepCharacter> ActorClass);
+
+	/**
+	 * Register a monster type from an explicit configuration
+	 * @param MonsterName Name monsters of this type are spawned by
+	 * @param Config Monster stats
+	 * @param ActorClass Character class monsters of this type are promoted to (none = never promoted)
+	 */
+	void RegisterMonsterTypeFromConfig(FName MonsterName, const FDelveDeepMonsterConfig& Config, TSubclassOf<ADelveDeepCharacter> ActorClass = nullptr);
+
+	/**
+	 * Add a simulated monster
+	 * @param MonsterName Registered monster type
+	 * @param Location Spawn location
+	 * @return Monster handle, or INDEX_NONE if the type is unknown
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Monsters")
+	int32 SpawnMonster(FName MonsterName, const FVector& Location);
+
+	/**
+	 * Damage a monster (forwarded to its actor while promoted)
+	 * @param Handle Monster handle
+	 * @param Damage Raw damage before armor
+	 * @return True if the monster died
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Monsters")
+	bool DamageMonster(int32 Handle, float Damage);
+
+	/**
+	 * Run one batch update of every simulated monster (called from Tick; public for tests and benchmarks)
+	 * @param DeltaTime Seconds to simulate
+	 * @param PlayerLocation Location monsters chase
+	 * @param FlowFields Flow fields chasing monsters steer along (null = straight at the player)
+	 */
+	void Simulate(float DeltaTime, const FVector& PlayerLocation, const UDelveDeepFlowFieldSubsystem* FlowFields = nullptr);
+
+	/**
+	 * Set when monsters become full actors
+	 * @param InPromotionRadius Monsters this close to the player are promoted
+	 * @param InDemotionRadius Promoted monsters further than this (and out of combat) are demoted
+	 * @param InMaxPromoted Maximum promoted monsters at once
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Monsters")
+	void SetPromotionSettings(float InPromotionRadius, float InDemotionRadius, int32 InMaxPromoted);
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	bool IsMonsterAlive(int32 Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	FVector GetMonsterLocation(int32 Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	float GetMonsterHealth(int32 Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	EDelveDeepMonsterState GetMonsterState(int32 Handle) const;
+
+	/**
+	 * Get the actor representing a promoted monster
+	 * @return Actor, or nullptr if the monster is simulated
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	ADelveDeepCharacter* GetMonsterActor(int32 Handle) const;
+
+	/**
+	 * Get the number of live monsters (simulated and promoted)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	int32 GetMonsterCount() const { return Health.Num(); }
+
+	/**
+	 * Get the number of monsters currently represented by actors
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Monsters")
+	int32 GetPromotedCount() const { return PromotedCount; }
+
+	/** Seconds a damaged monster stays in combat */
+	static constexpr float CombatDuration = 3.0f;
+
+	/** Monsters per parallel batch */
+	static constexpr int32 BatchSize = 256;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Stats shared by every monster of a type */
+	struct FMonsterType
+	{
+		FName Name;
+		float MaxHealth = 0.0f;
+		float MoveSpeed = 0.0f;
+		float Armor = 0.0f;
+		float DetectionRange = 0.0f;
+		float AttackRange = 0.0f;
+		TSubclassOf<ADelveDeepCharacter> ActorClass;
+	};
+
+	/**
+	 * Promote and demote monsters against the player's position
+	 */
+	void UpdatePromotions(const FVector& PlayerLocation);
+
+	/**
+	 * Replace a simulated monster by a character actor
+	 */
+	bool PromoteMonster(int32 Slot);
+
+	/**
+	 * Hand a promoted monster back to the simulation
+	 */
+	void DemoteMonster(int32 Slot);
+
+	/**
+	 * Remove dead monsters (swap-remove; moved slots keep their handles)
+	 */
+	void RemoveDeadMonsters();
+
+	/**
+	 * Remove one slot from every array
+	 */
+	void RemoveSlot(int32 Slot);
+
+	/**
+	 * Find the slot of a handle
+	 * @return Slot, or INDEX_NONE for unknown handles
+	 */
+	int32 FindSlot(int32 Handle) const;
+
+	/** Registered types */
+	TArray<FMonsterType> Types;
+	TMap<FName, int32> TypeIndexByName;
+
+	/** Per-monster state, all indexed by slot */
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<float> VelocityX;
+	TArray<float> VelocityY;
+	TArray<float> Health;
+	TArray<float> CombatTime;
+	TArray<EDelveDeepMonsterState> States;
+
+	/** Per-monster copies of type stats so the batch update never leaves the arrays */
+	TArray<float> MoveSpeeds;
+	TArray<float> DetectionRangesSq;
+	TArray<float> AttackRangesSq;
+	TArray<uint16> TypeIndices;
+
+	/** Handle of each slot, and slot of each handle */
+	TArray<int32> SlotHandles;
+	TMap<int32, int32> HandleToSlot;
+	int32 NextHandle = 0;
+
+	/** Actors of promoted monsters (null while simulated) */
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> Actors;
+	int32 PromotedCount = 0;
+
+	/** Promotion settings */
+	float PromotionRadius = 800.0f;
+	float DemotionRadius = 1200.0f;
+	int32 MaxPromoted = 48;
+
+	/** Promotion candidates, reused between updates */
+	TArray<TPair<float, int32>> PromotionCandidates;
+
+	/** Last known player location (kept when there is no pawn) */
+	FVector LastPlayerLocation = FVector::ZeroVector;
+};
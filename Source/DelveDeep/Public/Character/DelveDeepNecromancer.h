@@ -30,7 +30,7 @@ public:
 
 	/**
 	 * Summons an undead minion using collected Souls
-	 * Placeholder for future minion system integration
+	 * Minions are driven by the world's minion subsystem and drain Souls while active
 	 */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Necromancer")
 	void SummonMinion();
@@ -40,7 +40,21 @@ public:
 	 * @return Number of active minions
 	 */
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Necromancer")
-	int32 GetActiveMinionCount() const { return ActiveMinions.Num(); }
+	int32 GetActiveMinionCount() const;
+
+	/**
+	 * Sets how many minions can be active at once (raised by upgrades)
+	 * @param NewMaxMinions New limit
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Necromancer")
+	void SetMaxMinions(int32 NewMaxMinions);
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Character|Necromancer")
+	int32 GetMaxMinions() const { return MaxMinions; }
+
+	/** Class of minion summoned (pre-pooled when play starts) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "DelveDeep|Character|Necromancer")
+	TSubclassOf<ADelveDeepCharacter> MinionClass;
 
 protected:
 	/**
@@ -62,12 +76,15 @@ private:
 	/** Maximum Souls the Necromancer can collect */
 	static constexpr float MaxSouls = 10.0f;
 
-	/** Maximum number of minions that can be active simultaneously */
-	static constexpr int32 MaxMinions = 3;
+	/** Souls consumed by each summon */
+	static constexpr float SummonSoulCost = 3.0f;
 
-	/** Array of currently active minions */
-	UPROPERTY()
-	TArray<AActor*> ActiveMinions;
+	/** Distance from the Necromancer at which minions appear */
+	static constexpr float SummonOffset = 150.0f;
+
+	/** Maximum number of minions that can be active simultaneously */
+	UPROPERTY(EditDefaultsOnly, Category = "DelveDeep|Character|Necromancer", meta = (ClampMin = "0"))
+	int32 MaxMinions = 3;
 
 	/** Registers for enemy death events from the event subsystem */
 	void RegisterForEnemyDeathEvents();
@@ -0,0 +1,234 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepProjectileSubsystem.generated.h"
+
+class UDelveDeepTargetingSubsystem;
+class UDelveDeepWeaponData;
+class UPaperSprite;
+class UPaperGroupedSpriteComponent;
+
+/**
+ * Parameters of a fired projectile
+ */
+struct FDelveDeepProjectileParams
+{
+	FVector Origin = FVector::ZeroVector;
+
+	/** Travel direction (flattened to XY and normalized) */
+	FVector Direction = FVector::ForwardVector;
+
+	float Speed = 1000.0f;
+	float Damage = 10.0f;
+
+	/** Distance travelled before the projectile expires */
+	float Range = 1000.0f;
+
+	/** Targets hit before the projectile stops (1 = no pierce) */
+	int32 MaxHits = 1;
+
+	/**
+	 * Blast radius (0 = no blast). An exploding projectile stops at the first
+	 * combatant it reaches, or where its range runs out, and damages every
+	 * opposing combatant in the radius instead of hitting one.
+	 */
+	float ExplosionRadius = 0.0f;
+
+	FName DamageType = NAME_None;
+
+	/** Team of the shooter; only opposing combatants are hit */
+	uint8 Team = 0;
+
+	AActor* Instigator = nullptr;
+
+	/** Sprite drawn for the projectile (none = invisible) */
+	UPaperSprite* Sprite = nullptr;
+};
+
+/**
+ * A projectile hitting a combatant during a batch update
+ */
+struct FDelveDeepProjectileHit
+{
+	int32 TargetHandle = INDEX_NONE;
+	float Damage = 0.0f;
+	FName DamageType = NAME_None;
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+/**
+ * An exploding projectile stopping during a batch update
+ */
+struct FDelveDeepProjectileExplosion
+{
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float Damage = 0.0f;
+	FName DamageType = NAME_None;
+	uint8 Team = 0;
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+/**
+ * Projectile Subsystem
+ *
+ * Simulates every projectile in the world without an actor per projectile.
+ * Projectiles live in structure-of-arrays storage reserved up front and reused
+ * through swap-remove, and advance in one batch per frame. Each step is swept
+ * as a segment against the targeting spatial hash, hitting combatants in order
+ * along the segment until the projectile's pierce count is spent; hits go
+ * through the damage queue. Exploding projectiles blast a circle through the
+ * AoE subsystem where they stop.
+ *
+ * Projectiles are drawn as instances of one grouped sprite component per
+ * sprite, rewritten each frame, instead of one sprite component each.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Speeds.Num() > 0; }
+
+	/**
+	 * Fire a projectile
+	 * @return True if a projectile was fired (false for a zero direction, speed or range)
+	 */
+	bool FireProjectile(const FDelveDeepProjectileParams& Params);
+
+	/**
+	 * Fire a projectile using a weapon's damage, range, speed and pierce settings
+	 * @param Instigator Shooter (credited with hits)
+	 * @param Weapon Weapon data
+	 * @param Origin Launch location
+	 * @param Direction Travel direction
+	 * @param Team Shooter's team
+	 * @return True if a projectile was fired
+	 */
+	bool FireWeaponProjectile(AActor* Instigator, const UDelveDeepWeaponData* Weapon, const FVector& Origin, const FVector& Direction, uint8 Team);
+
+	/**
+	 * Fill projectile parameters from a weapon
+	 * @return False if the weapon does not fire projectiles (ProjectileSpeed is 0)
+	 */
+	static bool MakeWeaponProjectileParams(AActor* Instigator, const UDelveDeepWeaponData* Weapon, const FVector& Origin, const FVector& Direction, uint8 Team, FDelveDeepProjectileParams& OutParams);
+
+	/**
+	 * Advance every projectile and collect hits (called from Tick; public for tests and benchmarks)
+	 * @param DeltaTime Seconds to simulate
+	 * @param Targeting Spatial hash to test hits against (null = no hits)
+	 * @return Number of hits this step (see GetLastHits)
+	 */
+	int32 Simulate(float DeltaTime, const UDelveDeepTargetingSubsystem* Targeting);
+
+	/**
+	 * Get the hits collected by the last Simulate call
+	 */
+	const TArray<FDelveDeepProjectileHit>& GetLastHits() const { return LastHits; }
+
+	/**
+	 * Get the explosions of projectiles that stopped during the last Simulate call
+	 */
+	const TArray<FDelveDeepProjectileExplosion>& GetLastExplosions() const { return LastExplosions; }
+
+	/**
+	 * Set the collision radius of projectiles against combatants
+	 */
+	void SetHitRadius(float InHitRadius) { HitRadius = FMath::Max(InHitRadius, 0.0f); }
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	int32 GetProjectileCount() const { return Speeds.Num(); }
+
+	FVector GetProjectileLocation(int32 Index) const;
+
+	/** Projectiles storage is reserved for up to this many without reallocating */
+	static constexpr int32 InitialCapacity = 512;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Remove a projectile (swap-remove from every array)
+	 */
+	void RemoveProjectile(int32 Index);
+
+	/**
+	 * Send the last step's hits to the damage queue
+	 */
+	void ApplyHits(const UDelveDeepTargetingSubsystem* Targeting);
+
+	/**
+	 * Damage everything inside the last step's explosions through the AoE subsystem
+	 */
+	void ApplyExplosions();
+
+	/**
+	 * Find (or create) the grouped sprite component drawing a sprite
+	 * @return Visual group index, or INDEX_NONE for no sprite
+	 */
+	int32 GetVisualGroup(UPaperSprite* Sprite);
+
+	/**
+	 * Rewrite every visual group's instances from projectile positions
+	 */
+	void UpdateVisuals();
+
+	/** Per-projectile state, all indexed by projectile */
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<float> DirectionX;
+	TArray<float> DirectionY;
+	TArray<float> Speeds;
+	TArray<float> Damages;
+	TArray<float> RemainingRanges;
+	TArray<int32> HitsLeft;
+	TArray<float> ExplosionRadii;
+	TArray<uint8> Teams;
+	TArray<int32> VisualGroups;
+	TArray<FName> DamageTypes;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	/** Combatants each projectile already hit, so pierce never hits one twice */
+	TArray<TArray<int32, TInlineAllocator<4>>> HitTargets;
+
+	/** Projectiles to remove after the step */
+	TArray<int32> Expired;
+
+	/** Hits from the last step */
+	TArray<FDelveDeepProjectileHit> LastHits;
+
+	/** Explosions from the last step */
+	TArray<FDelveDeepProjectileExplosion> LastExplosions;
+
+	/** Query scratch */
+	TArray<int32> Candidates;
+	TArray<TPair<float, int32>> SegmentHits;
+
+	/** Projectile collision radius against combatants */
+	float HitRadius = 24.0f;
+
+	/** One grouped sprite component per projectile sprite */
+	struct FVisualGroup
+	{
+		TWeakObjectPtr<UPaperSprite> Sprite;
+		TWeakObjectPtr<UPaperGroupedSpriteComponent> Component;
+	};
+	TArray<FVisualGroup> VisualGroupList;
+
+	/** Actor owning the grouped sprite components */
+	UPROPERTY(Transient)
+	AActor* VisualsActor = nullptr;
+};
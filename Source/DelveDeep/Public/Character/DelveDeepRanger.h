@@ -21,22 +21,14 @@ public:
 	ADelveDeepRanger();
 
 	/**
-	 * Regenerates Energy resource over time
-	 * @param DeltaTime Time elapsed since last regeneration tick
-	 */
-	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Ranger")
-	void RegenerateEnergy(float DeltaTime);
-
-	/**
-	 * Performs a piercing shot that hits multiple enemies in a line
-	 * Placeholder for future combat system integration
+	 * Fires the equipped weapon's projectile forward, piercing multiple enemies in a line
 	 */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Ranger")
 	void PerformPiercingShot();
 
 protected:
 	/**
-	 * Override to start Energy regeneration timer
+	 * Override to start Energy regeneration
 	 */
 	virtual void BeginPlay() override;
 
@@ -45,11 +37,6 @@ protected:
 	 */
 	virtual void OnResourceChanged(float OldValue, float NewValue) override;
 
-	/**
-	 * Override to stop Energy regeneration timer
-	 */
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-
 private:
 	/** Energy regeneration rate per second */
 	static constexpr float EnergyRegenRate = 10.0f;
@@ -57,9 +44,12 @@ private:
 	/** Maximum Energy the Ranger can accumulate */
 	static constexpr float MaxEnergy = 100.0f;
 
-	/** Timer handle for Energy regeneration */
-	FTimerHandle EnergyRegenTimerHandle;
+	/** Enemies a Piercing Shot passes through at least */
+	static constexpr int32 PiercingShotMinTargets = 3;
+
+	/** Energy spent per Piercing Shot */
+	static constexpr float PiercingShotEnergyCost = 25.0f;
 
-	/** Starts the Energy regeneration timer */
+	/** Registers Energy with the resource regeneration subsystem */
 	void StartEnergyRegeneration();
 };
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepResourceRegenSubsystem.generated.h"
+
+class UDelveDeepStatsComponent;
+
+/**
+ * Resource Regeneration Subsystem
+ *
+ * Regenerates the resource (Energy, Mana, ...) of every registered stats
+ * component in one pass per frame. Current, maximum and rate live in parallel
+ * arrays indexed by slot, so the update is a branch-free loop over contiguous
+ * floats the compiler can vectorize.
+ *
+ * While registered, the subsystem holds the authoritative current resource;
+ * the stats component reads through to it and pushes its own changes back.
+ * Components are only touched - and OnResourceChanged only fires - when the
+ * displayed (whole number) value changes.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepResourceRegenSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Current.Num() > 0; }
+
+	/**
+	 * Start regenerating a component's resource
+	 * @param Component Stats component (must not already be registered)
+	 * @param InCurrent Current resource
+	 * @param InMax Maximum resource
+	 * @param InRate Resource per second
+	 * @return Slot the component is stored in (kept up to date in the component)
+	 */
+	int32 Register(UDelveDeepStatsComponent* Component, float InCurrent, float InMax, float InRate);
+
+	/**
+	 * Stop regenerating the resource in a slot (the last slot moves into it)
+	 * @param Slot Slot returned by Register
+	 */
+	void Unregister(int32 Slot);
+
+	/**
+	 * Set the current resource without notifying (the caller already has)
+	 */
+	void SetCurrent(int32 Slot, float Value);
+
+	/**
+	 * Set the maximum resource
+	 */
+	void SetMax(int32 Slot, float Value);
+
+	/**
+	 * Set the regeneration rate in resource per second
+	 */
+	void SetRate(int32 Slot, float Value);
+
+	/**
+	 * Get the current resource in a slot
+	 */
+	float GetCurrent(int32 Slot) const { return Current.IsValidIndex(Slot) ? Current[Slot] : 0.0f; }
+
+	/**
+	 * Regenerate every registered resource (called from Tick; public for tests and benchmarks)
+	 * @param DeltaTime Seconds to regenerate for
+	 */
+	void Advance(float DeltaTime);
+
+	/**
+	 * Get the number of registered resources
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	int32 GetRegisteredCount() const { return Current.Num(); }
+
+	/**
+	 * Get the number of components notified by the last Advance
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	int32 GetLastNotificationCount() const { return LastNotificationCount; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Per-slot state, all indexed by slot */
+	TArray<float> Current;
+	TArray<float> Max;
+	TArray<float> Rate;
+
+	/** Whole-number value last reported to the component */
+	TArray<int32> Displayed;
+
+	/** Owning components */
+	TArray<TWeakObjectPtr<UDelveDeepStatsComponent>> Components;
+
+	/** Components whose displayed value changed this pass and the value to report (reused) */
+	TArray<TPair<TWeakObjectPtr<UDelveDeepStatsComponent>, float>> PendingNotifications;
+
+	int32 LastNotificationCount = 0;
+};
@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PaperGroupedSpriteComponent.h"
+#include "DelveDeepSpriteBatchComponent.generated.h"
+
+/**
+ * Grouped sprite component whose instances can change sprite in place.
+ *
+ * The base component only lets an instance's transform and color change, so an
+ * animated instance would have to be removed and re-added every frame. This
+ * rewrites instances directly and rebuilds the render state once per batch.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepSpriteBatchComponent : public UPaperGroupedSpriteComponent
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Overwrite an instance (does not update the render state; call FinishBatch)
+	 * @param InstanceIndex Instance to overwrite
+	 * @param Transform World transform (the component stays at the origin)
+	 * @param Sprite Sprite to draw
+	 * @param Color Vertex color
+	 */
+	void SetInstance(int32 InstanceIndex, const FTransform& Transform, UPaperSprite* Sprite, const FLinearColor& Color);
+
+	/**
+	 * Drop instances past a count (does not update the render state)
+	 */
+	void TrimInstances(int32 Count);
+
+	/**
+	 * Push the instances written this frame to the renderer
+	 */
+	void FinishBatch();
+};
@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepSpriteBatchSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+class UDelveDeepSpriteBatchComponent;
+class UPaperFlipbook;
+class UPaperSprite;
+class UTexture;
+struct FConvexVolume;
+
+/**
+ * Sprite Batch Subsystem
+ *
+ * Draws characters as instances of one grouped sprite component per flipbook
+ * atlas texture instead of a flipbook component per actor, so a wave of
+ * monsters sharing an atlas costs a few draw batches and no per-actor
+ * component updates. Each instance keeps its own flipbook, play time, facing
+ * and color; one batch update per frame advances every animation, picks each
+ * instance's frame and facing (from velocity, as the flipbook component did)
+ * and rewrites the atlas components.
+ *
+ * A batched character's own flipbook component stays attached but hidden and
+ * not ticking; it is restored when the character leaves the batch. Since the
+ * hidden component never renders, each instance's bounds are tested against
+ * the player's view frustum instead (see WasInstanceRecentlyVisible).
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepSpriteBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return GetInstanceCount() > 0; }
+
+	/**
+	 * Start drawing a character through the batch, hiding its flipbook component
+	 * @param Character Character to draw; keeps the flipbook its component was playing
+	 * @return Instance handle, or INDEX_NONE if the character has no sprite component
+	 */
+	int32 RegisterCharacter(ADelveDeepCharacter* Character);
+
+	/**
+	 * Stop drawing a character; its flipbook component takes over the current animation
+	 */
+	void UnregisterCharacter(int32 Handle);
+
+	/**
+	 * Play a flipbook on an instance from its first frame
+	 * @param Handle Instance handle
+	 * @param Flipbook Flipbook to play (nullptr hides the instance)
+	 * @param bLooping Whether to loop or hold the last frame
+	 */
+	void PlayFlipbook(int32 Handle, UPaperFlipbook* Flipbook, bool bLooping = true);
+
+	void SetInstanceColor(int32 Handle, const FLinearColor& Color);
+
+	/**
+	 * Advance every instance's animation and facing and rewrite the batches (called from Tick; public for tests)
+	 */
+	void UpdateInstances(float DeltaTime);
+
+	/**
+	 * Get the frame of a flipbook shown at a play time
+	 * @param Time Seconds since the flipbook started
+	 * @param FramesPerSecond Flipbook frame rate
+	 * @param NumFrames Frames in the flipbook
+	 * @param bLooping Whether the flipbook wraps or holds its last frame
+	 * @return Frame index, or INDEX_NONE for an empty flipbook
+	 */
+	static int32 GetFrameAtTime(float Time, float FramesPerSecond, int32 NumFrames, bool bLooping);
+
+	/**
+	 * Get the frame an instance showed at the last update
+	 */
+	int32 GetInstanceFrame(int32 Handle) const;
+
+	bool IsInstanceFacingLeft(int32 Handle) const;
+
+	/**
+	 * Mark every instance whose bounds intersect a view frustum as on screen (called from UpdateInstances; public for tests)
+	 * @param ViewFrustum World-space view frustum
+	 */
+	void UpdateInstanceVisibility(const FConvexVolume& ViewFrustum);
+
+	/**
+	 * Check whether an instance was inside the view frustum recently (the batched counterpart of AActor::WasRecentlyRendered)
+	 * @param Handle Instance handle
+	 * @param Tolerance Seconds since last on screen that still count
+	 */
+	bool WasInstanceRecentlyVisible(int32 Handle, float Tolerance) const;
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Rendering")
+	int32 GetInstanceCount() const { return Characters.Num() - FreeSlots.Num(); }
+
+	/**
+	 * Get the number of atlas components (one draw batch per atlas material)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Rendering")
+	int32 GetBatchCount() const { return Atlases.Num(); }
+
+	/** Horizontal speed below which an instance keeps its facing */
+	static constexpr float FacingSpeedThreshold = 1.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Frames of a flipbook flattened to one sprite per display frame
+	 */
+	struct FAnimation
+	{
+		TArray<UPaperSprite*> Frames;
+		float FramesPerSecond = 15.0f;
+		int32 Atlas = INDEX_NONE;
+	};
+
+	/**
+	 * Grouped sprite component drawing every instance whose sprites share an atlas texture
+	 */
+	struct FAtlas
+	{
+		TWeakObjectPtr<UTexture> Texture;
+		TWeakObjectPtr<UDelveDeepSpriteBatchComponent> Component;
+	};
+
+	/**
+	 * Find (or cache) a flipbook's frames
+	 * @return Animation index
+	 */
+	int32 FindOrAddAnimation(UPaperFlipbook* Flipbook);
+
+	/**
+	 * Find (or create) the component drawing an atlas
+	 * @return Atlas index, or INDEX_NONE without a world
+	 */
+	int32 FindOrAddAtlas(UTexture* Texture);
+
+	/**
+	 * Rewrite every atlas component's instances from the instance state
+	 */
+	void WriteBatches();
+
+	/**
+	 * Build the first local player's view frustum
+	 * @return False without a local player viewport (dedicated servers, tests)
+	 */
+	bool GetPlayerViewFrustum(FConvexVolume& OutFrustum) const;
+
+	bool IsInstanceValid(int32 Handle) const { return Active.IsValidIndex(Handle) && Active[Handle]; }
+
+	/** Per-instance state, indexed by handle */
+	TArray<TWeakObjectPtr<ADelveDeepCharacter>> Characters;
+	TArray<int32> AnimationIndices;
+	TArray<float> PlayTimes;
+	TArray<int32> CurrentFrames;
+	TArray<FLinearColor> Colors;
+	TArray<FTransform> SpriteOffsets;
+	TArray<bool> Looping;
+	TArray<bool> FacingLeft;
+	TArray<double> LastVisibleTimes;
+	TArray<bool> Active;
+
+	/** Released handles */
+	TArray<int32> FreeSlots;
+
+	TArray<FAnimation> Animations;
+
+	/** Flipbook of each animation (keeps the flipbooks and their sprites loaded) */
+	UPROPERTY(Transient)
+	TArray<UPaperFlipbook*> AnimationFlipbooks;
+
+	TArray<FAtlas> Atlases;
+
+	/** Actor owning the atlas components */
+	UPROPERTY(Transient)
+	AActor* VisualsActor = nullptr;
+};
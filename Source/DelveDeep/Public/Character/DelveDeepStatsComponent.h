@@ -3,12 +3,42 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
 #include "Character/DelveDeepCharacterComponent.h"
 #include "DelveDeepStatsComponent.generated.h"
 
 class UDelveDeepCharacterData;
+class UDelveDeepResourceRegenSubsystem;
 struct FDelveDeepValidationContext;
 
+/**
+ * Stats that accept modifiers. Values index the per-stat modifier stacks.
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepStat : uint8
+{
+	MaxHealth,
+	MaxResource,
+	Damage,
+	MoveSpeed,
+
+	Count UMETA(Hidden)
+};
+
+/**
+ * How a modifier combines with the base value.
+ * Final = (Base + sum of Additive) * (1 + sum of Multiplicative), clamped at 0.
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepModifierOp : uint8
+{
+	/** Flat bonus added to the base value */
+	Additive,
+
+	/** Fractional bonus (0.2 = +20%) applied after additive bonuses */
+	Multiplicative
+};
+
 /**
  * Stat modifier structure for temporary stat boosts/debuffs.
  */
@@ -17,7 +47,7 @@ struct DELVEDEEP_API FDelveDeepStatModifier
 {
 	GENERATED_BODY()
 
-	/** Modifier value (additive or multiplicative depending on stat) */
+	/** Modifier value (flat for additive, fraction for multiplicative) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
 	float Modifier = 0.0f;
 
@@ -25,26 +55,48 @@ struct DELVEDEEP_API FDelveDeepStatModifier
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
 	float Duration = 0.0f;
 
-	/** Remaining time in seconds */
+	/** Time left in seconds when the modifier was added */
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	float RemainingTime = 0.0f;
 
+	/** World time the modifier expires at (0 = permanent) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	double ExpireTime = 0.0;
+
+	/** How the modifier combines with the base value */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats")
+	EDelveDeepModifierOp Op = EDelveDeepModifierOp::Additive;
+
+	/** Handle returned when the modifier was added */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Handle = INDEX_NONE;
+
 	FDelveDeepStatModifier()
 		: Modifier(0.0f)
 		, Duration(0.0f)
 		, RemainingTime(0.0f)
 	{}
 
-	FDelveDeepStatModifier(float InModifier, float InDuration)
+	FDelveDeepStatModifier(float InModifier, float InDuration, EDelveDeepModifierOp InOp = EDelveDeepModifierOp::Additive)
 		: Modifier(InModifier)
 		, Duration(InDuration)
 		, RemainingTime(InDuration)
+		, Op(InOp)
 	{}
 };
 
 /**
  * Stats component managing character health, resource, damage, and move speed.
  * Supports temporary stat modifiers with duration tracking.
+ *
+ * Each modifiable stat owns a fixed-capacity stack of modifiers with cached
+ * additive and multiplicative sums, so several modifiers on one stat stack
+ * instead of replacing each other, and adding or removing one only
+ * re-evaluates that stat.
+ *
+ * Timed modifiers are expired by UDelveDeepModifierExpirySubsystem and
+ * resource regeneration runs in UDelveDeepResourceRegenSubsystem, so the
+ * component itself never ticks or runs timers.
  */
 UCLASS(BlueprintType, ClassGroup = (DelveDeep), meta = (BlueprintSpawnableComponent))
 class DELVEDEEP_API UDelveDeepStatsComponent : public UDelveDeepCharacterComponent
@@ -57,6 +109,14 @@ public:
 	// Component lifecycle
 	virtual void InitializeFromCharacterData(const UDelveDeepCharacterData* Data) override;
 	virtual bool ValidateComponent(FDelveDeepValidationContext& Context) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Load base stats from character data without discarding state applied before it arrived.
+	 * Health and resource keep their fraction of the maximum and active modifiers stay applied.
+	 * @param Data Character data to load base stats from
+	 */
+	void RebaseFromCharacterData(const UDelveDeepCharacterData* Data);
 
 	// Base stats (loaded from character data)
 	UPROPERTY(BlueprintReadOnly, Category = "DelveDeep|Stats")
@@ -92,7 +152,7 @@ public:
 	float GetMaxHealth() const { return MaxHealth; }
 
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
-	float GetCurrentResource() const { return CurrentResource; }
+	float GetCurrentResource() const;
 
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
 	float GetMaxResource() const { return MaxResource; }
@@ -101,7 +161,7 @@ public:
 	float GetHealthPercentage() const { return MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 0.0f; }
 
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
-	float GetResourcePercentage() const { return MaxResource > 0.0f ? CurrentResource / MaxResource : 0.0f; }
+	float GetResourcePercentage() const { return MaxResource > 0.0f ? GetCurrentResource() / MaxResource : 0.0f; }
 
 	// Health modification
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
@@ -115,22 +175,92 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
 	void ResetToMaxValues();
 
+	/**
+	 * Regenerate the resource continuously through the world's regeneration subsystem.
+	 * @param RatePerSecond Resource per second (0 or less stops regeneration)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
+	void SetResourceRegenRate(float RatePerSecond);
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	float GetResourceRegenRate() const { return ResourceRegenRate; }
+
+	/**
+	 * Leave (or rejoin) the regeneration subsystem without forgetting the rate (pooled characters).
+	 * @param bPaused True to stop regenerating and free the subsystem slot
+	 */
+	void SetResourceRegenPaused(bool bPaused);
+
 	// Stat modifier system
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
 	void AddStatModifier(FName StatName, float Modifier, float Duration);
 
+	/**
+	 * Add a modifier to a stat's stack.
+	 * @param Stat Stat to modify
+	 * @param Modifier Flat bonus (Additive) or fraction (Multiplicative)
+	 * @param Duration Seconds until it expires (0 or less = permanent)
+	 * @param Op How the modifier combines with the base value
+	 * @return Handle for RemoveStatModifierByHandle, or INDEX_NONE if the stat's stack is full
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
+	int32 AddStatModifierById(EDelveDeepStat Stat, float Modifier, float Duration, EDelveDeepModifierOp Op = EDelveDeepModifierOp::Additive);
+
+	/** Remove every modifier on the named stat */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
 	void RemoveStatModifier(FName StatName);
 
+	/**
+	 * Remove one modifier.
+	 * @param Handle Handle returned by AddStatModifierById
+	 * @return True if the modifier was still active
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
+	bool RemoveStatModifierByHandle(int32 Handle);
+
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Stats")
 	void ClearAllModifiers();
 
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
 	float GetModifiedStat(FName StatName) const;
 
-	// Recalculate all stats with modifiers applied
+	/**
+	 * Get a stat with its modifiers applied (cached, no lookup).
+	 * @param Stat Stat to read
+	 * @return Modified value
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	float GetStatValue(EDelveDeepStat Stat) const;
+
+	/**
+	 * Get the number of active modifiers on a stat.
+	 * @param Stat Stat to query
+	 * @return Modifier count (at most MaxModifiersPerStat)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Stats")
+	int32 GetModifierCount(EDelveDeepStat Stat) const;
+
+	// Recalculate stats whose modifiers changed since the last call
 	void RecalculateStats();
 
+	/**
+	 * Map a stat name to its id.
+	 * @param StatName "MaxHealth", "MaxResource", "Damage" or "MoveSpeed"
+	 * @param OutStat Matching stat
+	 * @return True if the name is a modifiable stat
+	 */
+	static bool FindStatByName(FName StatName, EDelveDeepStat& OutStat);
+
+	/**
+	 * Get the name of a stat (interned once).
+	 * @param Stat Stat id
+	 * @return Stat name as used by OnStatChanged
+	 */
+	static FName GetStatName(EDelveDeepStat Stat);
+
+	/** Modifiers one stat can hold at once */
+	static constexpr int32 MaxModifiersPerStat = 8;
+
 	// Blueprint events
 	UFUNCTION(BlueprintImplementableEvent, Category = "DelveDeep|Stats")
 	void OnStatChanged(FName StatName, float OldValue, float NewValue);
@@ -139,36 +269,109 @@ public:
 	void OnResourceChanged(float OldValue, float NewValue);
 
 protected:
+	friend class UDelveDeepResourceRegenSubsystem;
+
+	/**
+	 * Modifiers on one stat with their cached aggregates.
+	 */
+	struct FStatModifierStack
+	{
+		/** Active modifiers; only the first Num are valid */
+		TStaticArray<FDelveDeepStatModifier, MaxModifiersPerStat> Modifiers;
+		int32 Num = 0;
+
+		/** Sum of additive modifiers */
+		float AdditiveSum = 0.0f;
+
+		/** Sum of multiplicative fractions */
+		float MultiplicativeSum = 0.0f;
+
+		/** Modified value as of the last recalculation */
+		float CachedValue = 0.0f;
+
+		/** Apply the aggregates to a base value */
+		float Evaluate(float BaseValue) const
+		{
+			return FMath::Max((BaseValue + AdditiveSum) * (1.0f + MultiplicativeSum), 0.0f);
+		}
+
+		/** Remove the modifier at Index, keeping the aggregates in sync (order is not preserved) */
+		void RemoveAtSwap(int32 Index);
+
+		/** Remove every modifier */
+		void Reset();
+	};
+
+	static constexpr int32 NumStats = static_cast<int32>(EDelveDeepStat::Count);
+
+	/**
+	 * Per-stat modifier stacks indexed by EDelveDeepStat.
+	 */
+	TStaticArray<FStatModifierStack, NumStats> StatStacks;
+
+	/**
+	 * Bit per stat whose modifiers changed since the last recalculation.
+	 */
+	uint32 DirtyStatMask;
+
+	/**
+	 * Source of modifier handles; the low byte of a handle is the stat.
+	 */
+	int32 NextModifierSerial;
+
+	/**
+	 * Regeneration rate in resource per second (0 = not regenerating).
+	 */
+	float ResourceRegenRate;
+
+	/**
+	 * Subsystem and slot holding the resource while it regenerates.
+	 */
+	TWeakObjectPtr<UDelveDeepResourceRegenSubsystem> ResourceRegenSubsystem;
+	int32 ResourceRegenSlot;
+
+	/**
+	 * Regeneration is suspended; the rate is kept for when it resumes.
+	 */
+	bool bResourceRegenPaused;
+
+	/**
+	 * Whether the regeneration subsystem currently owns the resource value.
+	 */
+	bool IsResourceRegenerating() const { return ResourceRegenSlot != INDEX_NONE && ResourceRegenSubsystem.IsValid(); }
+
+	/**
+	 * Register with the world's regeneration subsystem at the current rate.
+	 */
+	void AcquireResourceRegen();
+
 	/**
-	 * Active stat modifiers mapped by modifier name.
+	 * Take the resource back from the regeneration subsystem and free the slot.
 	 */
-	UPROPERTY(Transient)
-	TMap<FName, FDelveDeepStatModifier> ActiveModifiers;
+	void ReleaseResourceRegen();
 
 	/**
-	 * Flag indicating stats need recalculation.
+	 * Push CurrentResource and MaxResource to the regeneration subsystem.
 	 */
-	bool bStatsDirty;
+	void SyncResourceRegen();
 
 	/**
-	 * Cached modified stats (recalculated when dirty).
+	 * Take a regenerated value from the subsystem and notify (whole-number changes only).
 	 */
-	float CachedMaxHealth;
-	float CachedMaxResource;
-	float CachedMoveSpeed;
+	void ApplyRegeneratedResource(float NewResource);
 
 	/**
-	 * Timer handle for cleaning up expired modifiers.
+	 * Get the unmodified value of a stat.
 	 */
-	FTimerHandle CleanupTimerHandle;
+	float GetBaseStatValue(EDelveDeepStat Stat) const;
 
 	/**
-	 * Apply modifiers to a base stat value.
+	 * Re-evaluate one stat from its cached aggregates and apply the result.
 	 */
-	float ApplyModifiers(FName StatName, float BaseValue) const;
+	void RecalculateStat(EDelveDeepStat Stat);
 
 	/**
-	 * Clean up expired stat modifiers.
+	 * Mark a stat for recalculation.
 	 */
-	void CleanupExpiredModifiers();
+	void MarkStatDirty(EDelveDeepStat Stat) { DirtyStatMask |= 1u << static_cast<uint32>(Stat); }
 };
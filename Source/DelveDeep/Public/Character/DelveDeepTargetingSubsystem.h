@@ -0,0 +1,230 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DelveDeepTargetingSubsystem.generated.h"
+
+class ADelveDeepCharacter;
+
+/** Team ids combatants register with */
+namespace DelveDeepTeam
+{
+	constexpr uint8 Players = 0;
+	constexpr uint8 Monsters = 1;
+
+	/** Mask matching every team */
+	constexpr uint32 All = ~0u;
+
+	/** Bit of a team in a team mask */
+	FORCEINLINE uint32 Bit(uint8 Team) { return 1u << (Team & 31); }
+
+	/** Mask matching every team except the given one */
+	FORCEINLINE uint32 Opposing(uint8 Team) { return ~Bit(Team); }
+}
+
+/**
+ * How automatic targeting picks among candidates
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepTargetPriority : uint8
+{
+	Nearest,
+	LowestHealth,
+	HighestThreat
+};
+
+/**
+ * Combatant considered by a targeting query, passed to scoring functions
+ */
+struct FDelveDeepTargetCandidate
+{
+	int32 Handle = INDEX_NONE;
+	AActor* Actor = nullptr;
+	FVector Location = FVector::ZeroVector;
+	float DistanceSq = 0.0f;
+	uint8 Team = 0;
+	float Threat = 0.0f;
+};
+
+/**
+ * Read-only view of the packed combatant arrays, indexed by handle.
+ * Free handles have no team bits, so any team mask rejects them.
+ */
+struct FDelveDeepCombatantView
+{
+	const float* X = nullptr;
+	const float* Y = nullptr;
+	const uint32* TeamBits = nullptr;
+	int32 Num = 0;
+};
+
+/**
+ * Targeting Subsystem
+ *
+ * Keeps every combatant in a uniform 2D spatial hash so automatic targeting
+ * can answer radius and k-nearest queries by visiting only the cells the query
+ * overlaps. Combatants are addressed by stable handles; a moving combatant is
+ * only re-bucketed when it crosses a cell boundary. Actor-backed combatants
+ * are synced from their actor locations once per frame; actor-less entries
+ * are moved by their owner through UpdateCombatantLocation.
+ *
+ * Query time is reported to telemetry as the "TargetingSystem" budget.
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepTargetingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return ActorBackedCount > 0 || QuerySecondsThisFrame > 0.0; }
+
+	/**
+	 * Add a combatant
+	 * @param Actor Actor whose location is tracked (may be null for simulated combatants)
+	 * @param Location Initial location
+	 * @param Team Team id (0-31)
+	 * @return Combatant handle
+	 */
+	int32 RegisterCombatant(AActor* Actor, const FVector& Location, uint8 Team);
+
+	/**
+	 * Remove a combatant
+	 */
+	void UnregisterCombatant(int32 Handle);
+
+	/**
+	 * Move a combatant (re-buckets it only when it changes cell)
+	 */
+	void UpdateCombatantLocation(int32 Handle, const FVector& Location);
+
+	void SetCombatantTeam(int32 Handle, uint8 Team);
+
+	/**
+	 * Add threat (e.g. damage dealt) to a combatant
+	 */
+	void AddThreat(int32 Handle, float Amount);
+
+	void SetThreat(int32 Handle, float Threat);
+
+	/**
+	 * Collect combatants within a radius
+	 * @param Origin Query center (Z ignored)
+	 * @param Radius Query radius
+	 * @param TeamMask Teams to include (DelveDeepTeam::Bit / Opposing / All)
+	 * @param OutHandles Receives the handles, in no particular order
+	 */
+	void QueryRadius(const FVector& Origin, float Radius, uint32 TeamMask, TArray<int32>& OutHandles) const;
+
+	/**
+	 * Collect the K nearest combatants within a radius
+	 * @param OutHandles Receives up to K handles, nearest first
+	 */
+	void QueryKNearest(const FVector& Origin, int32 K, float MaxRadius, uint32 TeamMask, TArray<int32>& OutHandles) const;
+
+	/**
+	 * Find the combatant within a radius with the highest score
+	 * @param Score Scoring function; higher is better
+	 * @return Handle, or INDEX_NONE if nothing is in range
+	 */
+	int32 FindBestTarget(const FVector& Origin, float Radius, uint32 TeamMask, TFunctionRef<float(const FDelveDeepTargetCandidate&)> Score) const;
+
+	/**
+	 * Find the combatant within a radius that best matches a priority
+	 */
+	int32 FindBestTarget(const FVector& Origin, float Radius, uint32 TeamMask, EDelveDeepTargetPriority Priority) const;
+
+	/**
+	 * Pick a target for a character among opposing combatants within range
+	 * @param Seeker Character looking for a target
+	 * @param Priority How to pick
+	 * @param Range Search radius; zero or less uses the seeker's attack range.
+	 *        Monsters should pass their FDelveDeepMonsterConfig::DetectionRange.
+	 * @return Target actor, or nullptr
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Combat")
+	AActor* FindTargetFor(const ADelveDeepCharacter* Seeker, EDelveDeepTargetPriority Priority, float Range = 0.0f) const;
+
+	/**
+	 * Set the hash cell size (rebuckets every combatant)
+	 * @param InCellSize Cell edge length; roughly the most common query radius works best
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Combat")
+	void SetCellSize(float InCellSize);
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	float GetCellSize() const { return CellSize; }
+
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Combat")
+	int32 GetCombatantCount() const { return PositionX.Num() - FreeSlots.Num(); }
+
+	bool IsCombatantValid(int32 Handle) const { return Active.IsValidIndex(Handle) && Active[Handle]; }
+	AActor* GetCombatantActor(int32 Handle) const { return IsCombatantValid(Handle) ? Actors[Handle].Get() : nullptr; }
+	FVector GetCombatantLocation(int32 Handle) const;
+	uint8 GetCombatantTeam(int32 Handle) const { return IsCombatantValid(Handle) ? Teams[Handle] : 0; }
+	float GetThreat(int32 Handle) const { return IsCombatantValid(Handle) ? Threats[Handle] : 0.0f; }
+
+	/**
+	 * Get the packed combatant arrays for linear (SIMD) scans
+	 */
+	FDelveDeepCombatantView GetPackedCombatants() const;
+
+	/**
+	 * Pull locations from actor-backed combatants (called from Tick; public for tests)
+	 */
+	void SyncActorLocations();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FIntPoint GetCell(float X, float Y) const
+	{
+		return FIntPoint(FMath::FloorToInt32(X * InvCellSize), FMath::FloorToInt32(Y * InvCellSize));
+	}
+
+	void AddToCell(int32 Slot, const FIntPoint& Cell);
+	void RemoveFromCell(int32 Slot);
+
+	/**
+	 * Visit every combatant within a radius that matches a team mask
+	 */
+	template <typename FuncType>
+	void ForEachInRadius(const FVector& Origin, float Radius, uint32 TeamMask, FuncType&& Func) const;
+
+	/** Per-combatant state, indexed by handle */
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<uint8> Teams;
+	TArray<uint32> TeamBits;
+	TArray<float> Threats;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FIntPoint> CellCoords;
+	TArray<int32> IndexInCell;
+	TArray<bool> Active;
+
+	/** Released handles */
+	TArray<int32> FreeSlots;
+
+	/** Handles in each occupied cell */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	float CellSize = 256.0f;
+	float InvCellSize = 1.0f / 256.0f;
+
+	int32 ActorBackedCount = 0;
+
+	/** Query time since the last tick, reported to telemetry */
+	mutable double QuerySecondsThisFrame = 0.0;
+
+	/** Candidate scratch for k-nearest queries */
+	mutable TArray<TPair<float, int32>> NearestScratch;
+};
@@ -28,8 +28,7 @@ public:
 	void GenerateRage(float Amount);
 
 	/**
-	 * Performs a cleave attack that hits multiple enemies in front of the Warrior
-	 * Placeholder for future combat system integration
+	 * Performs a cleave attack that hits every enemy in an arc in front of the Warrior
 	 */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Character|Warrior")
 	void PerformCleaveAttack();
@@ -54,4 +53,13 @@ private:
 
 	/** Maximum Rage the Warrior can accumulate */
 	static constexpr float MaxRage = 100.0f;
+
+	/** Reach of the cleave arc */
+	static constexpr float CleaveRange = 200.0f;
+
+	/** Half angle of the cleave arc in degrees */
+	static constexpr float CleaveHalfAngle = 60.0f;
+
+	/** Rage spent per Cleave Attack */
+	static constexpr float CleaveRageCost = 30.0f;
 };
@@ -3,8 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "DelveDeepAssetLoadTracker.generated.h"
 
+struct FEndLoadPackageContext;
+
 /**
  * Asset load record for tracking asset loading performance
  */
@@ -37,6 +40,29 @@ struct DELVEDEEP_API FAssetLoadRecord
 	UPROPERTY()
 	FDateTime Timestamp;
 
+	/** Package whose load pulled this one in (None for top-level requests) */
+	UPROPERTY()
+	FName RequestingPackage;
+
+	/** Number of dependency packages loaded as part of this request */
+	UPROPERTY()
+	int32 DependencyCount = 0;
+
+	/** Names of dependency packages (first MaxRecordedDependencies only) */
+	UPROPERTY()
+	TArray<FName> Dependencies;
+
+	/** Whether the load happened while gameplay was running */
+	UPROPERTY()
+	bool bDuringGameplay = false;
+
+	/** Engine frame the load completed on */
+	UPROPERTY()
+	int64 FrameNumber = 0;
+
+	/** Maximum dependency names kept per record */
+	static constexpr int32 MaxRecordedDependencies = 16;
+
 	FAssetLoadRecord()
 		: AssetPath(TEXT(""))
 		, AssetType(NAME_None)
@@ -44,6 +70,10 @@ struct DELVEDEEP_API FAssetLoadRecord
 		, AssetSize(0)
 		, bSynchronous(true)
 		, Timestamp(FDateTime::Now())
+		, RequestingPackage(NAME_None)
+		, DependencyCount(0)
+		, bDuringGameplay(false)
+		, FrameNumber(0)
 	{
 	}
 
@@ -54,6 +84,10 @@ struct DELVEDEEP_API FAssetLoadRecord
 		, AssetSize(InSize)
 		, bSynchronous(bInSynchronous)
 		, Timestamp(FDateTime::Now())
+		, RequestingPackage(NAME_None)
+		, DependencyCount(0)
+		, bDuringGameplay(false)
+		, FrameNumber(0)
 	{
 	}
 };
@@ -103,17 +137,29 @@ struct DELVEDEEP_API FAssetLoadStatistics
 	int32 SlowLoadCount = 0;
 };
 
+/** Fired when a synchronous load completes while gameplay is running */
+DECLARE_DELEGATE_OneParam(FOnGameplaySyncAssetLoad, const FAssetLoadRecord&);
+
 /**
  * Asset loading performance tracker
  * 
  * Tracks asset load operations and provides statistics for optimization.
  * Categorizes assets by type and tracks synchronous vs asynchronous loads.
  * Logs warnings for slow loads exceeding 100ms.
+ *
+ * With automatic capture enabled, package loads are recorded from the engine's
+ * sync/async load-start and end-load delegates without manual reporting. Asset
+ * type comes from the package's primary asset class. Packages that finish in the
+ * same end-load batch without a request of their own are attributed to the
+ * requesting package as dependencies. The slowest loads are kept in a bounded
+ * min-heap, and synchronous loads during gameplay are flagged and broadcast via
+ * OnGameplaySyncLoad.
  */
 class DELVEDEEP_API FDelveDeepAssetLoadTracker
 {
 public:
 	FDelveDeepAssetLoadTracker();
+	~FDelveDeepAssetLoadTracker();
 
 	/**
 	 * Record an asset load operation
@@ -124,6 +170,44 @@ public:
 	 */
 	void RecordAssetLoad(const FString& AssetPath, float LoadTimeMs, int64 AssetSize, bool bSynchronous = true);
 
+	/**
+	 * Start capturing package loads from engine load delegates
+	 */
+	void StartAutomaticCapture();
+
+	/**
+	 * Stop capturing package loads and drop in-flight requests
+	 */
+	void StopAutomaticCapture();
+
+	/**
+	 * Check if automatic capture is active
+	 * @return True if engine load delegates are bound
+	 */
+	bool IsAutomaticCaptureActive() const { return bAutomaticCaptureActive; }
+
+	/**
+	 * Mark whether gameplay frames are running (sync loads are then violations).
+	 * Map loads clear this automatically.
+	 * @param bActive True while a game world is ticking gameplay
+	 */
+	void SetGameplayActive(bool bActive) { bGameplayActive = bActive; }
+
+	/**
+	 * Get synchronous loads that happened during gameplay
+	 * @return Most recent gameplay sync loads (up to MaxGameplaySyncLoads)
+	 */
+	TArray<FAssetLoadRecord> GetGameplaySyncLoads() const;
+
+	/**
+	 * Get total number of synchronous loads during gameplay
+	 * @return Gameplay sync load count
+	 */
+	int32 GetGameplaySyncLoadCount() const { return TotalGameplaySyncLoads; }
+
+	/** Fired for each synchronous load during gameplay (game thread) */
+	FOnGameplaySyncAssetLoad OnGameplaySyncLoad;
+
 	/**
 	 * Get asset load statistics for a specific type
 	 * @param AssetType Type of asset
@@ -155,7 +239,7 @@ public:
 	 * Get total number of asset loads
 	 * @return Total load count
 	 */
-	int32 GetTotalAssetLoads() const { return LoadHistory.Num(); }
+	int32 GetTotalAssetLoads() const { return TotalRecordedLoads; }
 
 	/**
 	 * Get total number of slow loads (>100ms)
@@ -168,21 +252,110 @@ public:
 	 */
 	void ResetStatistics();
 
+	/** Number of slowest loads retained by the top-K heap */
+	static constexpr int32 MaxSlowestLoads = 64;
+
 private:
-	/** History of asset loads (limited to MaxHistorySize) */
+	/**
+	 * Load request seen at load start and waiting for its end-load notification
+	 */
+	struct FPendingPackageLoad
+	{
+		/** FPlatformTime::Seconds() when the load started */
+		double StartTime = 0.0;
+
+		/** Whether the request was synchronous */
+		bool bSynchronous = true;
+
+		/** Sync load in progress when this one started */
+		FName RequestingPackage;
+	};
+
+	/** History of asset loads, used as a ring buffer of MaxHistorySize */
 	TArray<FAssetLoadRecord> LoadHistory;
 
+	/** Index of the oldest record once the history is full */
+	int32 HistoryHead = 0;
+
+	/** Min-heap on LoadTimeMs holding the slowest MaxSlowestLoads records */
+	TArray<FAssetLoadRecord> SlowestLoadsHeap;
+
+	/** Synchronous loads during gameplay (most recent MaxGameplaySyncLoads) */
+	TArray<FAssetLoadRecord> GameplaySyncLoads;
+
 	/** Statistics per asset type */
 	TMap<FName, FAssetLoadStatistics> TypeStatistics;
 
+	/** Loads that have started but not finished, keyed by package name */
+	TMap<FName, FPendingPackageLoad> PendingLoads;
+
+	/** Synchronous loads currently on the stack (for nested-load attribution) */
+	TArray<FName> SyncLoadStack;
+
+	/** Total loads recorded since the last reset */
+	int32 TotalRecordedLoads = 0;
+
+	/** Total gameplay sync loads since the last reset */
+	int32 TotalGameplaySyncLoads = 0;
+
+	/** True while gameplay frames are running */
+	bool bGameplayActive = false;
+
+	/** True while engine delegates are bound */
+	bool bAutomaticCaptureActive = false;
+
+	/** Engine delegate handles */
+	FDelegateHandle SyncLoadHandle;
+	FDelegateHandle AsyncLoadHandle;
+	FDelegateHandle EndLoadHandle;
+	FDelegateHandle PreLoadMapHandle;
+
+	/** Guards all tracker state; load delegates may fire off the game thread */
+	mutable FCriticalSection CriticalSection;
+
 	/** Maximum history size */
 	static constexpr int32 MaxHistorySize = 1000;
 
+	/** Maximum gameplay sync loads kept for inspection */
+	static constexpr int32 MaxGameplaySyncLoads = 100;
+
+	/** Pending requests older than this are dropped (already-loaded packages never finish) */
+	static constexpr double PendingLoadTimeoutSeconds = 60.0;
+
+	/** Pending map size that triggers pruning of stale requests */
+	static constexpr int32 PendingLoadPruneThreshold = 256;
+
+	/**
+	 * Add a completed record to history, heap and statistics (CriticalSection held)
+	 * @param Record Completed load record
+	 * @return True if the record is a gameplay sync load
+	 */
+	bool AddRecordLocked(FAssetLoadRecord& Record);
+
+	/**
+	 * Offer a record to the bounded top-K min-heap
+	 * @param Record Completed load record
+	 */
+	void PushSlowestLoad(const FAssetLoadRecord& Record);
+
+	/**
+	 * Note the start of a package load
+	 * @param PackageName Long package name
+	 * @param bSynchronous Whether the load is synchronous
+	 */
+	void BeginPackageLoad(const FString& PackageName, bool bSynchronous);
+
+	/** Engine delegate handlers */
+	void HandleSyncLoadPackage(const FString& PackageName);
+	void HandleAsyncLoadPackage(const FString& PackageName);
+	void HandleEndLoadPackage(const FEndLoadPackageContext& Context);
+	void HandlePreLoadMap(const FString& MapName);
+
 	/** Slow load threshold in milliseconds */
 	static constexpr float SlowLoadThresholdMs = 100.0f;
 
 	/**
-	 * Determine asset type from path
+	 * Determine asset type from path (fallback for manual reports and packages without a primary asset)
 	 * @param AssetPath Path to the asset
 	 * @return Asset type name
 	 */
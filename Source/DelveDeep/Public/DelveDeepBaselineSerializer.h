@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DelveDeepPerformanceBaseline.h"
+
+/**
+ * Binary baseline layout constants.
+ * Bump SchemaVersion when a section's contents change; add a new section id
+ * rather than reshaping an existing one where possible.
+ */
+namespace DelveDeepBaselineFormat
+{
+	/** 'DDBL' */
+	constexpr uint32 Magic = 0x4C424444;
+
+	/** Current schema version (files with a newer version are rejected) */
+	constexpr uint16 SchemaVersion = 1;
+
+	/** Header flag: payload is zlib compressed */
+	constexpr uint16 FlagCompressed = 1 << 0;
+
+	/** Payloads smaller than this are stored uncompressed */
+	constexpr int32 CompressionThresholdBytes = 4 * 1024;
+
+	/** Section ids (FourCC) */
+	constexpr uint32 SectionMeta = 0x4154454D;			// 'META'
+	constexpr uint32 SectionSystems = 0x54535953;		// 'SYST'
+	constexpr uint32 SectionMemory = 0x534D454D;		// 'MEMS'
+	constexpr uint32 SectionFrameTimes = 0x544D5246;	// 'FRMT'
+	constexpr uint32 SectionGarbageCollection = 0x54534347;	// 'GCST'
+
+	/** Extension used for binary baselines */
+	inline const TCHAR* FileExtension() { return TEXT(".ddbaseline"); }
+}
+
+/**
+ * Baseline Serializer
+ *
+ * Converts FPerformanceBaseline to and from a compact, versioned binary form:
+ *
+ *   Header   Magic, SchemaVersion, Flags, SectionCount, RawSize, PayloadSize, PayloadCrc
+ *   Payload  Section table (Id, Offset, Size) followed by the sections,
+ *            optionally zlib compressed as a whole
+ *
+ * Sections are columnar (all names, then all cycle times, then all budgets...)
+ * so numeric columns are bulk-copied on load and compress well. Unknown
+ * section ids are skipped, so older loaders can read files with extra data.
+ *
+ * JSON import/export is kept for humans and for baselines saved before the
+ * binary format existed. All functions are thread-safe (no shared state).
+ */
+class DELVEDEEP_API FDelveDeepBaselineSerializer
+{
+public:
+	/**
+	 * Serialize a baseline to the binary format
+	 * @param Baseline Baseline to write
+	 * @param OutBytes Receives the file contents
+	 * @param bAllowCompression Compress the payload when it is large enough to benefit
+	 */
+	static void SaveToBytes(const FPerformanceBaseline& Baseline, TArray<uint8>& OutBytes, bool bAllowCompression = true);
+
+	/**
+	 * Deserialize a baseline from the binary format
+	 * @param Bytes File contents
+	 * @param OutBaseline Receives the baseline (BaselineName is the one stored in the file)
+	 * @param OutError Reason for failure
+	 * @return True if the data was read successfully
+	 */
+	static bool LoadFromBytes(const TArray<uint8>& Bytes, FPerformanceBaseline& OutBaseline, FString& OutError);
+
+	/**
+	 * Check whether data starts with the binary baseline magic
+	 * @param Bytes File contents
+	 * @return True if the data looks like a binary baseline
+	 */
+	static bool IsBinaryBaseline(const TArray<uint8>& Bytes);
+
+	/**
+	 * Write a baseline as human-readable JSON
+	 * @param Baseline Baseline to write
+	 * @param OutJson Receives the JSON text
+	 * @return True if serialization succeeded
+	 */
+	static bool ExportToJson(const FPerformanceBaseline& Baseline, FString& OutJson);
+
+	/**
+	 * Read a baseline from JSON written by ExportToJson or by older builds
+	 * @param Json JSON text
+	 * @param OutBaseline Receives the baseline
+	 * @param OutError Reason for failure
+	 * @return True if the JSON was parsed
+	 */
+	static bool ImportFromJson(const FString& Json, FPerformanceBaseline& OutBaseline, FString& OutError);
+
+	/**
+	 * Read a baseline from file contents in either format
+	 * @param Bytes File contents
+	 * @param OutBaseline Receives the baseline
+	 * @param OutError Reason for failure
+	 * @return True if the data was read successfully
+	 */
+	static bool LoadFromFileBytes(const TArray<uint8>& Bytes, FPerformanceBaseline& OutBaseline, FString& OutError);
+};
@@ -0,0 +1,267 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DelveDeepDeferredWorkScheduler.generated.h"
+
+class FSystemProfiler;
+
+/**
+ * Priority of deferred work (lower value runs first)
+ */
+UENUM(BlueprintType)
+enum class EDelveDeepWorkPriority : uint8
+{
+	High	UMETA(DisplayName = "High"),
+	Normal	UMETA(DisplayName = "Normal"),
+	Low		UMETA(DisplayName = "Low")
+};
+
+/**
+ * Deferred work statistics for one budgeted system
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDeferredWorkSystemStats
+{
+	GENERATED_BODY()
+
+	/** System whose budget pays for the work */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	FName SystemName;
+
+	/** Items waiting to run */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 PendingItems = 0;
+
+	/** Items completed since the last reset */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 CompletedItems = 0;
+
+	/** Slices executed since the last reset (an item may take several) */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 ExecutedSlices = 0;
+
+	/** Items left over at the end of the last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 CarriedOverItems = 0;
+
+	/** Time spent on deferred work last frame in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	float LastFrameSpentMs = 0.0f;
+
+	/** Headroom the system had for deferred work last frame in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	float LastFrameAllowanceMs = 0.0f;
+
+	/** Frames the oldest pending item has been waiting */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 OldestPendingFrames = 0;
+
+	/** Longest wait before an item completed, in frames */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 MaxWaitFrames = 0;
+
+	/** Average wait before an item completed, in frames */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	float AverageWaitFrames = 0.0f;
+
+	/** Items that waited longer than the starvation threshold */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 StarvedItems = 0;
+
+	/** Frames in which the system had no headroom at all while work was pending */
+	UPROPERTY(BlueprintReadOnly, Category = "Performance")
+	int32 StarvedFrames = 0;
+};
+
+/**
+ * Frame-Budgeted Deferred Work Scheduler
+ *
+ * Systems submit deferrable work (listener cleanup, validation sampling, cache
+ * eviction, AI re-planning, pool pre-warming) against their own performance
+ * budget. Once per frame, after the systems have run, each system's queue is
+ * drained in priority order (FIFO within a priority) until the headroom left
+ * in its budget this frame is spent; the rest carries over.
+ *
+ * Headroom = system budget - time the system recorded this frame. A work item
+ * returns true when it is finished or false to run another slice next time,
+ * so long jobs can be written incrementally. Items that wait longer than
+ * StarvationFrames are guaranteed one slice per frame even without headroom,
+ * and are counted in the starvation metrics.
+ *
+ * Game thread only.
+ */
+class DELVEDEEP_API FDelveDeepDeferredWorkScheduler
+{
+public:
+	/** Work callback: return true when finished, false to run again in a later slice */
+	using FWorkFunction = TFunction<bool()>;
+
+	FDelveDeepDeferredWorkScheduler();
+
+	/**
+	 * Set the per-frame budget work for a system may use
+	 * @param SystemName Budgeted system
+	 * @param BudgetMs Budget in milliseconds
+	 */
+	void SetSystemBudget(FName SystemName, float BudgetMs);
+
+	/**
+	 * Submit deferred work
+	 * @param SystemName Budgeted system that pays for the work
+	 * @param WorkName Short label for logs and stats
+	 * @param Priority Work priority
+	 * @param Work Callback (true = finished)
+	 * @return Handle for CancelWork (0 on failure)
+	 */
+	uint64 SubmitWork(FName SystemName, FName WorkName, EDelveDeepWorkPriority Priority, FWorkFunction Work);
+
+	/**
+	 * Cancel pending work
+	 * @param Handle Handle returned by SubmitWork
+	 * @return True if the item was still pending
+	 */
+	bool CancelWork(uint64 Handle);
+
+	/**
+	 * Run deferred work for this frame
+	 * @param Profiler Source of this frame's measured system times (null = full budget is headroom)
+	 */
+	void ExecuteFrame(const FSystemProfiler* Profiler);
+
+	/**
+	 * Run every pending item to completion, ignoring budgets (shutdown, level transitions)
+	 * @return Number of items completed
+	 */
+	int32 Flush();
+
+	/**
+	 * Drop all pending work without running it
+	 */
+	void Reset();
+
+	/**
+	 * Get the number of pending items
+	 * @param SystemName System to query (None = all systems)
+	 * @return Pending item count
+	 */
+	int32 GetPendingCount(FName SystemName = NAME_None) const;
+
+	/**
+	 * Get statistics for one system
+	 * @param SystemName Budgeted system
+	 * @return Statistics (empty if the system never had work)
+	 */
+	FDeferredWorkSystemStats GetSystemStats(FName SystemName) const;
+
+	/**
+	 * Get statistics for every system that has had work
+	 * @return Array of statistics
+	 */
+	TArray<FDeferredWorkSystemStats> GetAllSystemStats() const;
+
+	/**
+	 * Get total deferred work time last frame
+	 * @return Time in milliseconds
+	 */
+	float GetLastFrameSpentMs() const { return LastFrameSpentMs; }
+
+	/**
+	 * Clear accumulated statistics (pending work is kept)
+	 */
+	void ResetStatistics();
+
+	/** Frames an item may wait before it is forced through and counted as starved */
+	static constexpr int32 StarvationFrames = 120;
+
+	/** Budget used for systems that have not been given one */
+	static constexpr float DefaultSystemBudgetMs = 0.5f;
+
+	/** Upper bound on deferred work per frame across all systems */
+	static constexpr float MaxFrameSpendMs = 2.0f;
+
+private:
+	/** A queued work item */
+	struct FWorkItem
+	{
+		FWorkFunction Work;
+		FName WorkName;
+		uint64 Handle = 0;
+		uint64 SubmitFrame = 0;
+		EDelveDeepWorkPriority Priority = EDelveDeepWorkPriority::Normal;
+		bool bCountedStarved = false;
+	};
+
+	/** Heap ordering: priority first, then submission order */
+	struct FWorkItemOrder
+	{
+		bool operator()(const FWorkItem& A, const FWorkItem& B) const
+		{
+			return A.Priority != B.Priority ? A.Priority < B.Priority : A.Handle < B.Handle;
+		}
+	};
+
+	/** Per-system queue and statistics */
+	struct FSystemQueue
+	{
+		/** Min-heap ordered by FWorkItemOrder */
+		TArray<FWorkItem> Heap;
+
+		/** Per-frame budget for this system */
+		float BudgetMs = DefaultSystemBudgetMs;
+
+		/** Running statistics */
+		FDeferredWorkSystemStats Stats;
+
+		/** Sum of completed item waits (for the average) */
+		int64 TotalWaitFrames = 0;
+	};
+
+	/**
+	 * Run one system's queue within an allowance
+	 * @param Queue Queue to drain
+	 * @param AllowanceMs Time available
+	 * @return Time spent in milliseconds
+	 */
+	double ExecuteQueue(FSystemQueue& Queue, double AllowanceMs);
+
+	/**
+	 * Run one slice of an item (traced as a span while a capture is running)
+	 * @return True if the item finished
+	 */
+	bool ExecuteSlice(FWorkItem& Item);
+
+	/**
+	 * Record a completed item in its queue's statistics
+	 */
+	void RecordCompletion(FSystemQueue& Queue, const FWorkItem& Item);
+
+	/**
+	 * Find or create a system queue
+	 */
+	FSystemQueue& GetOrAddQueue(FName SystemName);
+
+	/** Queues by system */
+	TMap<FName, FSystemQueue> Queues;
+
+	/** Next handle (also the FIFO tiebreaker) */
+	uint64 NextHandle;
+
+	/** Frames executed */
+	uint64 FrameIndex;
+
+	/** Total deferred work time last frame */
+	float LastFrameSpentMs;
+
+	/** True while ExecuteFrame or Flush is running work */
+	bool bExecuting;
+
+	/** Work submitted from inside a work item, queued after the current pass */
+	TArray<TPair<FName, FWorkItem>> IncomingItems;
+
+	/**
+	 * Move work submitted during execution into its queues
+	 */
+	void MergeIncomingItems();
+};
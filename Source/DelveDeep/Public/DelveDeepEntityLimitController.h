@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DelveDeepEntityLimitController.generated.h"
+
+class FSystemProfiler;
+class FDelveDeepGameplayMetrics;
+
+/**
+ * Dynamic spawn cap for a single entity type
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FAdaptiveEntityLimit
+{
+	GENERATED_BODY()
+
+	/** Entity type this limit applies to (e.g., "Monsters") */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	FName EntityType;
+
+	/** Profiled system whose cost scales with this entity count (e.g., "AI") */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	FName CostSystem;
+
+	/** Cap never drops below this, even under sustained overload */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 MinLimit = 0;
+
+	/** Cap never rises above this (the static recommended limit) */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 MaxLimit = 0;
+
+	/** Current dynamic cap */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 CurrentLimit = 0;
+
+	/** Smoothed cost per live entity in milliseconds (0 until measured) */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float CostPerEntityMs = 0.0f;
+
+	/** Number of spawn requests denied by this cap */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 DeniedSpawns = 0;
+};
+
+/**
+ * Adaptive entity limit controller
+ *
+ * Turns the static recommended limits from FDelveDeepGameplayMetrics into
+ * per-type spawn caps driven by frame time. Every UpdateInterval frames the
+ * smoothed frame time is compared against the total frame budget:
+ * - Over budget: the overage is split across entity types by their share of
+ *   measured cost and each cap is cut by the entities needed to recover it
+ *   (multiplicative decrease when no per-entity cost is known yet)
+ * - Under budget by more than the hysteresis band: caps grow by the number of
+ *   entities that fit into a fraction of the headroom, bounded per update
+ * - Inside the band: caps are held
+ *
+ * Per-entity cost comes from the FSystemProfiler average of the type's cost
+ * system divided by the live count. Spawners query CanSpawn/GetSpawnAllowance
+ * before spawning; caps never fall below MinLimit or rise above MaxLimit.
+ */
+class DELVEDEEP_API FDelveDeepEntityLimitController
+{
+public:
+	FDelveDeepEntityLimitController();
+
+	/**
+	 * Register or reconfigure an entity type
+	 * @param EntityType Type of entity
+	 * @param CostSystem Profiled system whose time scales with this type
+	 * @param MinLimit Lowest cap allowed under load
+	 * @param MaxLimit Highest cap allowed (starting cap)
+	 */
+	void ConfigureEntityType(FName EntityType, FName CostSystem, int32 MinLimit, int32 MaxLimit);
+
+	/**
+	 * Set the frame time the controller steers towards
+	 * @param BudgetMs Total frame budget in milliseconds
+	 */
+	void SetTargetFrameTime(float BudgetMs);
+
+	/**
+	 * Get the frame time the controller steers towards
+	 * @return Total frame budget in milliseconds
+	 */
+	float GetTargetFrameTime() const { return TargetFrameTimeMs; }
+
+	/**
+	 * Advance the controller by one frame
+	 * @param DeltaTime Frame time in seconds
+	 * @param Profiler System profiler providing per-system costs
+	 * @param Metrics Gameplay metrics providing live entity counts
+	 */
+	void Update(float DeltaTime, const FSystemProfiler& Profiler, const FDelveDeepGameplayMetrics& Metrics);
+
+	/**
+	 * Check whether spawning more entities of a type stays within its cap
+	 * @param EntityType Type of entity
+	 * @param CurrentCount Live count of this type
+	 * @param Count Number of entities about to be spawned
+	 * @return True if the spawn is allowed (always true for unregistered types)
+	 */
+	bool CanSpawn(FName EntityType, int32 CurrentCount, int32 Count = 1) const;
+
+	/**
+	 * Record that a spawn request was denied
+	 * @param EntityType Type of entity
+	 */
+	void RecordDeniedSpawn(FName EntityType);
+
+	/**
+	 * Get the current dynamic cap for an entity type
+	 * @param EntityType Type of entity
+	 * @return Current cap (0 if the type is not registered)
+	 */
+	int32 GetLimit(FName EntityType) const;
+
+	/**
+	 * Get the smoothed frame time the controller is reacting to
+	 * @return Frame time in milliseconds
+	 */
+	float GetSmoothedFrameTime() const { return SmoothedFrameTimeMs; }
+
+	/**
+	 * Get all registered limits
+	 * @return Map of entity types to limits
+	 */
+	const TMap<FName, FAdaptiveEntityLimit>& GetAllLimits() const { return Limits; }
+
+	/**
+	 * Restore every cap to its maximum and clear cost estimates
+	 */
+	void Reset();
+
+	/** Frames between controller updates */
+	static constexpr int32 UpdateInterval = 10;
+
+	/** Fraction of the frame budget treated as dead band below the target */
+	static constexpr float HysteresisFraction = 0.1f;
+
+	/** Fraction of measured headroom that growth may consume per update */
+	static constexpr float GrowthHeadroomFraction = 0.5f;
+
+	/** Largest per-update growth as a fraction of MaxLimit */
+	static constexpr float MaxGrowthStepFraction = 0.1f;
+
+	/** Cap reduction used when no per-entity cost has been measured */
+	static constexpr float FallbackDecreaseFactor = 0.9f;
+
+private:
+	/** Per-type limits */
+	TMap<FName, FAdaptiveEntityLimit> Limits;
+
+	/** Frame time target in milliseconds */
+	float TargetFrameTimeMs;
+
+	/** Exponential moving average of frame time in milliseconds */
+	float SmoothedFrameTimeMs;
+
+	/** Frame counter for update throttling */
+	int32 FrameCounter;
+
+	/** Smoothing factor for the frame time average */
+	static constexpr float FrameTimeSmoothing = 0.1f;
+
+	/** Smoothing factor for per-entity cost estimates */
+	static constexpr float CostSmoothing = 0.2f;
+
+	/** Longest frame fed into the average, so one hitch does not collapse every cap */
+	static constexpr float MaxSampledFrameTimeMs = 100.0f;
+
+	/**
+	 * Refresh per-entity cost estimates from the profiler
+	 */
+	void UpdateCostEstimates(const FSystemProfiler& Profiler, const FDelveDeepGameplayMetrics& Metrics);
+
+	/**
+	 * Lower caps to recover an overage
+	 * @param OverageMs Milliseconds over the target
+	 */
+	void ShrinkLimits(float OverageMs, const FDelveDeepGameplayMetrics& Metrics);
+
+	/**
+	 * Raise caps into available headroom
+	 * @param HeadroomMs Milliseconds under the target
+	 */
+	void GrowLimits(float HeadroomMs);
+
+	/**
+	 * Register the default entity types
+	 */
+	void InitializeDefaultTypes();
+};
@@ -99,6 +99,38 @@ struct DELVEDEEP_API FDelveDeepDamageEventPayload : public FDelveDeepEventPayloa
 	virtual bool Validate(FDelveDeepValidationContext& Context) const override;
 };
 
+/**
+ * Event payload for a frame's batch of resolved damage.
+ * One entry per damaged character (hits on the same character are summed), plus the characters the batch killed.
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepDamageBatchEventPayload : public FDelveDeepEventPayload
+{
+	GENERATED_BODY()
+
+	/** Characters that took damage */
+	UPROPERTY(BlueprintReadOnly, Category = "Damage")
+	TArray<TWeakObjectPtr<AActor>> Victims;
+
+	/** Damage each victim took after armor and damage type (parallel to Victims) */
+	UPROPERTY(BlueprintReadOnly, Category = "Damage")
+	TArray<float> DamageAmounts;
+
+	/** Victims whose health reached zero */
+	UPROPERTY(BlueprintReadOnly, Category = "Damage")
+	TArray<TWeakObjectPtr<AActor>> Killed;
+
+	/** Hits resolved into this batch */
+	UPROPERTY(BlueprintReadOnly, Category = "Damage")
+	int32 HitCount = 0;
+
+	/** Sum of DamageAmounts */
+	UPROPERTY(BlueprintReadOnly, Category = "Damage")
+	float TotalDamage = 0.0f;
+
+	virtual bool Validate(FDelveDeepValidationContext& Context) const override;
+};
+
 /**
  * Event payload for health change events.
  * Contains information about character health changes, including previous and new values.
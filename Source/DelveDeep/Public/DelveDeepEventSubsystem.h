@@ -216,6 +216,9 @@ private:
 	/** Set of event tags that are marked as network-relevant */
 	TSet<FGameplayTag> NetworkRelevantEventTags;
 
+	/** Whether a stale listener cleanup is already waiting in the deferred work scheduler */
+	bool bStaleListenerCleanupQueued = false;
+
 	/**
 	 * Generates a unique delegate handle.
 	 * @return A new unique FDelegateHandle
@@ -228,6 +231,12 @@ private:
 	 */
 	void CleanupStaleListeners();
 
+	/**
+	 * Queues CleanupStaleListeners as low-priority deferred work under the "Events" budget.
+	 * Runs the cleanup immediately if the telemetry subsystem is unavailable.
+	 */
+	void QueueStaleListenerCleanup();
+
 	/**
 	 * Removes a listener from a specific priority array.
 	 * @param ListenerArray The array to remove from
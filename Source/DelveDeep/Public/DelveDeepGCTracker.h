@@ -0,0 +1,330 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/UObjectArray.h"
+#include "DelveDeepGCTracker.generated.h"
+
+/**
+ * One garbage collection pass
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepGCEvent
+{
+	GENERATED_BODY()
+
+	/** Engine frame the collection ran on */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int64 FrameNumber = 0;
+
+	/** Time from pre- to post-collect in milliseconds (includes purge unless it is incremental) */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float DurationMs = 0.0f;
+
+	/** Live UObjects when the collection started */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 ObjectsBefore = 0;
+
+	/** UObjects destroyed by the collection, including incremental purge */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 ObjectsPurged = 0;
+
+	/** When the collection ran */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	FDateTime Timestamp;
+};
+
+/**
+ * Garbage collection summary (overlay, baselines, reports)
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepGCStats
+{
+	GENERATED_BODY()
+
+	/** Collections since tracking started */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 CollectionCount = 0;
+
+	/** Average collection time in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float AverageGCTimeMs = 0.0f;
+
+	/** Longest collection in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float PeakGCTimeMs = 0.0f;
+
+	/** Most recent collection in milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float LastGCTimeMs = 0.0f;
+
+	/** Objects destroyed by the most recent collection */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 LastObjectsPurged = 0;
+
+	/** Collection time spent in the last tracked frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float FrameGCTimeMs = 0.0f;
+
+	/** Objects destroyed in the last tracked frame (includes incremental purge) */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 FrameObjectsDestroyed = 0;
+
+	/** Live UObjects at the end of the last tracked frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 UObjectCount = 0;
+
+	/** Highest live UObject count seen */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 PeakUObjectCount = 0;
+
+	/** Collections longer than the spike threshold */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 SpikeCount = 0;
+};
+
+/**
+ * Spawn/destroy counts for one class
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepClassChurn
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	FName ClassName;
+
+	/** Instances created since tracking started */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 Spawned = 0;
+
+	/** Tracked instances destroyed since tracking started */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 Destroyed = 0;
+
+	/** Tracked instances currently alive */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 Live = 0;
+
+	/** Most tracked instances alive at once */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 PeakLive = 0;
+};
+
+/**
+ * Suggestion to pool a class that is created and destroyed at a high rate
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepPoolingRecommendation
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	FName ClassName;
+
+	/** Destroyed instances per minute of tracking */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	float DestroysPerMinute = 0.0f;
+
+	/** Pool size that would have covered every simultaneous instance seen */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	int32 SuggestedPoolSize = 0;
+
+	/** Human-readable justification */
+	UPROPERTY(BlueprintReadOnly, Category = "GC")
+	FString Reason;
+};
+
+/**
+ * Garbage collection and UObject churn tracker
+ *
+ * Times every collection from the engine's pre/post garbage collect delegates
+ * and records it once its purge finishes (a frame or more later when purge is
+ * incremental, so the purged count includes every object it destroyed). It
+ * counts UObject creation and deletion through UObject array listeners.
+ * Per frame it reports collection time, objects destroyed and the live UObject
+ * count; per class it counts spawns, destroys and peak live instances so the
+ * classes that churn most can be pooled.
+ *
+ * Only classes declared in the DelveDeep module (and Blueprints derived from
+ * them) are counted per class by default; every deletion still counts toward
+ * the per-frame totals. Listener callbacks can arrive on loading and purge
+ * threads, so per-class state is guarded by a lock.
+ */
+class DELVEDEEP_API FDelveDeepGCTracker
+	: public FUObjectArray::FUObjectCreateListener
+	, public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	FDelveDeepGCTracker();
+	virtual ~FDelveDeepGCTracker();
+
+	/**
+	 * Bind the GC delegates and UObject array listeners
+	 */
+	void StartTracking();
+
+	/**
+	 * Unbind everything (statistics are kept)
+	 */
+	void StopTracking();
+
+	/**
+	 * Check if tracking is active
+	 * @return True while bound to the engine
+	 */
+	bool IsTracking() const { return bTracking; }
+
+	/**
+	 * Count every class, not only DelveDeep classes (takes effect for new objects)
+	 * @param bTrackAll True to count engine classes too
+	 */
+	void SetTrackAllClasses(bool bTrackAll);
+
+	/**
+	 * Close the current frame's totals (game thread, once per frame)
+	 */
+	void UpdateFrame();
+
+	/**
+	 * Get the collection summary
+	 * @return GC statistics
+	 */
+	FDelveDeepGCStats GetStats() const;
+
+	/**
+	 * Get recent collections, oldest first
+	 * @return Up to MaxRecentEvents collections
+	 */
+	TArray<FDelveDeepGCEvent> GetRecentCollections() const;
+
+	/**
+	 * Get per-class churn, highest destroy count first
+	 * @param MaxClasses Maximum classes to return (0 = all)
+	 * @return Class churn records
+	 */
+	TArray<FDelveDeepClassChurn> GetClassChurn(int32 MaxClasses = 0) const;
+
+	/**
+	 * Get classes worth pooling, highest destroy rate first
+	 * @param MinDestroysPerMinute Classes destroyed less often than this are left out
+	 * @return Recommendations
+	 */
+	TArray<FDelveDeepPoolingRecommendation> GetPoolingRecommendations(float MinDestroysPerMinute = DefaultPoolingThresholdPerMinute) const;
+
+	/**
+	 * Reset statistics (in-flight object tracking is kept so destroys still match)
+	 */
+	void ResetStatistics();
+
+	/**
+	 * Record a collection directly (used by the GC delegates and tests)
+	 * @param DurationMs Collection time
+	 * @param ObjectsBefore Live objects when it started
+	 * @param ObjectsPurged Objects destroyed by it
+	 */
+	void RecordCollection(float DurationMs, int32 ObjectsBefore, int32 ObjectsPurged);
+
+	/**
+	 * Record creation of a tracked instance (used by the array listener and tests)
+	 * @param ObjectIndex UObject array index
+	 * @param ClassName Class of the new object
+	 */
+	void RecordSpawn(int32 ObjectIndex, FName ClassName);
+
+	/**
+	 * Record deletion of an object (used by the array listener and tests)
+	 * @param ObjectIndex UObject array index
+	 */
+	void RecordDestroy(int32 ObjectIndex);
+
+	// FUObjectCreateListener / FUObjectDeleteListener
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+	virtual void OnUObjectArrayShutdown() override;
+
+	/** Collections longer than this count as spikes and are logged */
+	static constexpr float SpikeThresholdMs = 5.0f;
+
+	/** Default pooling threshold */
+	static constexpr float DefaultPoolingThresholdPerMinute = 30.0f;
+
+	/** Collections kept for inspection */
+	static constexpr int32 MaxRecentEvents = 64;
+
+private:
+	/** Per-class counters */
+	struct FClassCounters
+	{
+		int32 Spawned = 0;
+		int32 Destroyed = 0;
+		int32 Live = 0;
+		int32 PeakLive = 0;
+	};
+
+	/**
+	 * Check whether instances of a class are counted per class (CriticalSection held)
+	 */
+	bool ShouldTrackClassLocked(const UClass* Class);
+
+	void HandlePreGarbageCollect();
+	void HandlePostGarbageCollect();
+	void HandlePostPurgeGarbage();
+
+	/**
+	 * Record the collection in progress with the objects destroyed since it started
+	 */
+	void SettleCollection();
+
+	/** Recent collections, used as a ring buffer of MaxRecentEvents */
+	TArray<FDelveDeepGCEvent> RecentEvents;
+	int32 RecentEventsHead = 0;
+
+	/** Summary statistics */
+	FDelveDeepGCStats Stats;
+	double TotalGCTimeMs = 0.0;
+
+	/** Collection time accumulated since the last UpdateFrame */
+	float PendingFrameGCTimeMs = 0.0f;
+
+	/** Collection in progress */
+	uint64 CollectStartCycles = 0;
+	uint64 CollectEndCycles = 0;
+	bool bCollectPurged = false;
+	int32 CollectObjectsBefore = 0;
+	int32 CollectDestroyedBefore = 0;
+
+	/** Deletions of any object since tracking started */
+	TAtomic<int32> TotalDestroyed;
+
+	/** TotalDestroyed at the last UpdateFrame */
+	int32 LastFrameDestroyed = 0;
+
+	/** Per-class counters keyed by class name */
+	TMap<FName, FClassCounters> ClassCounters;
+
+	/** Class of each tracked live object, keyed by UObject array index */
+	TMap<int32, FName> TrackedObjects;
+
+	/** Cached per-class tracking decision */
+	TMap<const UClass*, bool> ClassFilterCache;
+
+	/** Tracking start time (for rates) */
+	double TrackingStartSeconds = 0.0;
+
+	/** Count engine classes too */
+	bool bTrackAllClasses = false;
+
+	/** True while bound */
+	bool bTracking = false;
+
+	/** Delegate handles */
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+	FDelegateHandle PostPurgeHandle;
+
+	/** Guards per-class state; listeners fire on loading and purge threads */
+	mutable FCriticalSection CriticalSection;
+};
@@ -71,6 +71,38 @@ struct DELVEDEEP_API FEntityCountData
 	}
 };
 
+/**
+ * Actor pool usage for gameplay metrics
+ */
+USTRUCT(BlueprintType)
+struct DELVEDEEP_API FDelveDeepActorPoolStats
+{
+	GENERATED_BODY()
+
+	/** Pool name (usually the pooled class) */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	FName PoolName;
+
+	/** Acquires served from the pool */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 Hits = 0;
+
+	/** Acquires that had to spawn a new actor */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 Misses = 0;
+
+	/** Actors currently parked in the pool */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	int32 AvailableCount = 0;
+
+	/** Fraction of acquires served from the pool (0-1) */
+	float GetHitRate() const
+	{
+		const int32 Acquires = Hits + Misses;
+		return Acquires > 0 ? static_cast<float>(Hits) / Acquires : 0.0f;
+	}
+};
+
 /**
  * Gameplay metrics tracker for performance correlation
  * 
@@ -132,6 +164,34 @@ public:
 	 */
 	int32 GetRecommendedLimit(FName EntityType) const;
 
+	/**
+	 * Record an acquire from an actor pool
+	 * @param PoolName Pool that was asked for an actor
+	 * @param bHit True if a pooled actor was reused, false if one was spawned
+	 * @param AvailableCount Actors left in the pool afterwards
+	 */
+	void RecordPoolAcquire(FName PoolName, bool bHit, int32 AvailableCount);
+
+	/**
+	 * Record an actor returned to a pool
+	 * @param PoolName Pool the actor went back to
+	 * @param AvailableCount Actors in the pool afterwards
+	 */
+	void RecordPoolRelease(FName PoolName, int32 AvailableCount);
+
+	/**
+	 * Get usage of one actor pool
+	 * @param PoolName Pool to query
+	 * @return Pool statistics (zeroed if the pool was never used)
+	 */
+	FDelveDeepActorPoolStats GetPoolStats(FName PoolName) const;
+
+	/**
+	 * Get all actor pool statistics
+	 * @return Map of pool names to statistics
+	 */
+	const TMap<FName, FDelveDeepActorPoolStats>& GetAllPoolStats() const { return PoolStats; }
+
 	/**
 	 * Reset all statistics
 	 */
@@ -146,6 +206,9 @@ private:
 	/** Entity count tracking */
 	TMap<FName, FEntityCountData> EntityCounts;
 
+	/** Actor pool usage */
+	TMap<FName, FDelveDeepActorPoolStats> PoolStats;
+
 	/** Recommended limits for entity types */
 	TMap<FName, int32> RecommendedLimits;
 
@@ -57,6 +57,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rewards", meta = (ClampMin = "0"))
 	int32 ExperienceReward = 10;
 
+	// Pooling
+	/** Instances kept ready in the actor pool (0 = spawn on demand, no pooling) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pooling", meta = (ClampMin = "0", ClampMax = "256"))
+	int32 PoolSize = 0;
+
 	/**
 	 * Called after data is imported from CSV or other sources.
 	 * Performs validation on the imported data.
@@ -6,6 +6,7 @@
 #include "DelveDeepFramePerformanceTracker.h"
 #include "DelveDeepSystemProfiler.h"
 #include "DelveDeepMemoryTracker.h"
+#include "DelveDeepGCTracker.h"
 #include "DelveDeepPerformanceBaseline.generated.h"
 
 /**
@@ -58,6 +59,14 @@ struct DELVEDEEP_API FPerformanceBaseline
 	UPROPERTY()
 	int32 TotalFramesCaptured = 0;
 
+	/** Frame time distribution at capture in milliseconds (oldest first) */
+	UPROPERTY()
+	TArray<float> FrameTimeSamples;
+
+	/** Garbage collection statistics at capture */
+	UPROPERTY()
+	FDelveDeepGCStats GCData;
+
 	FPerformanceBaseline()
 		: BaselineName(NAME_None)
 		, CaptureTime(FDateTime::Now())
@@ -104,6 +113,10 @@ struct DELVEDEEP_API FPerformanceComparison
 	UPROPERTY(BlueprintReadOnly, Category = "Comparison")
 	float MemoryChangePercent = 0.0f;
 
+	/** Average GC pause change percentage (positive = longer pauses) */
+	UPROPERTY(BlueprintReadOnly, Category = "Comparison")
+	float GCTimeChangePercent = 0.0f;
+
 	/** Per-system performance changes */
 	UPROPERTY(BlueprintReadOnly, Category = "Comparison")
 	TMap<FName, float> SystemTimeChanges;
@@ -127,6 +140,7 @@ struct DELVEDEEP_API FPerformanceComparison
 		, FrameTimeChangePercent(0.0f)
 		, OnePercentLowChangePercent(0.0f)
 		, MemoryChangePercent(0.0f)
+		, GCTimeChangePercent(0.0f)
 		, bIsRegression(false)
 		, bIsImprovement(false)
 	{
@@ -0,0 +1,159 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DelveDeepPerformanceBenchmarkCommandlet.generated.h"
+
+class ADelveDeepCharacter;
+class UDelveDeepTelemetrySubsystem;
+class UDelveDeepEventSubsystem;
+class UGameInstance;
+class UWorld;
+
+/**
+ * Settings for a scripted headless benchmark run, parsed from the commandlet command line.
+ */
+struct FDelveDeepBenchmarkSettings
+{
+	/** Map to load (empty = blank standalone world) */
+	FString MapName;
+
+	/** Number of player characters to spawn */
+	int32 NumCharacters = 4;
+
+	/** Number of monsters to spawn */
+	int32 NumMonsters = 200;
+
+	/** Frames simulated before telemetry capture starts */
+	int32 WarmupFrames = 60;
+
+	/** Frames recorded into telemetry */
+	int32 CaptureFrames = 1800;
+
+	/** Scripted damage hits applied per frame */
+	int32 DamageHitsPerFrame = 50;
+
+	/** Scripted events broadcast per frame */
+	int32 EventsPerFrame = 200;
+
+	/** Fixed simulation step in seconds */
+	float FixedDeltaSeconds = 1.0f / 60.0f;
+
+	/** Seed for the scenario random stream */
+	int32 Seed = 1337;
+
+	/** Name the captured baseline is stored under */
+	FName BaselineName = TEXT("HeadlessBenchmark");
+
+	/** Checked-in reference baseline to compare against (empty = capture only) */
+	FString ReferenceBaselinePath;
+
+	/** Output path for the captured baseline (empty = default baseline directory) */
+	FString OutputBaselinePath;
+
+	/** Monster actor class path (empty = Warrior stand-in) */
+	FString MonsterClassPath;
+};
+
+/**
+ * Headless Performance Benchmark Commandlet
+ *
+ * Loads a map under NullRHI, spawns a scripted scenario (characters, monsters,
+ * damage and event storms) and records telemetry for a fixed number of frames.
+ * The run is captured as an FPerformanceBaseline through the telemetry subsystem
+ * and, when a reference baseline is supplied, compared via CompareToBaseline.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd DelveDeep.uproject -run=DelveDeepPerformanceBenchmark -NullRHI -unattended
+ *     [-Map=/Game/Maps/TestMap] [-Characters=4] [-Monsters=200] [-Frames=1800]
+ *     [-WarmupFrames=60] [-DamagePerFrame=50] [-EventsPerFrame=200] [-Seed=1337]
+ *     [-BaselineName=HeadlessBenchmark] [-Reference=<path>] [-Output=<path>]
+ *     [-MonsterClass=/Game/Monsters/BP_Goblin.BP_Goblin_C]
+ *
+ * Exit codes:
+ *   0 - Benchmark completed with no regression
+ *   1 - Performance regression detected against the reference baseline
+ *   2 - Setup failure (world, subsystems, spawning or baseline I/O)
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepPerformanceBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDelveDeepPerformanceBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+
+	/** Exit code for a run without regressions */
+	static constexpr int32 ExitSuccess = 0;
+
+	/** Exit code when the comparison reports a regression */
+	static constexpr int32 ExitRegression = 1;
+
+	/** Exit code for setup or I/O failures */
+	static constexpr int32 ExitSetupFailure = 2;
+
+private:
+	/**
+	 * Parse benchmark settings from the command line
+	 * @param Params Commandlet parameter string
+	 * @param OutSettings Parsed settings
+	 */
+	static void ParseSettings(const FString& Params, FDelveDeepBenchmarkSettings& OutSettings);
+
+	/**
+	 * Create the game instance and load the benchmark world
+	 * @return World to run the scenario in, or nullptr on failure
+	 */
+	UWorld* CreateBenchmarkWorld();
+
+	/**
+	 * Spawn characters and monsters for the scenario
+	 * @return True if at least one actor was spawned
+	 */
+	bool SpawnScenario(UWorld* World);
+
+	/**
+	 * Advance the scenario by one frame (damage storm, event storm, world tick)
+	 */
+	void RunScenarioFrame(UWorld* World);
+
+	/** Apply the scripted damage storm for this frame */
+	void ApplyDamageStorm();
+
+	/** Broadcast the scripted event storm for this frame */
+	void BroadcastEventStorm();
+
+	/** Destroy spawned actors and shut down the game instance */
+	void Shutdown();
+
+	/** Parsed settings for this run */
+	FDelveDeepBenchmarkSettings Settings;
+
+	/** Random stream driving target selection */
+	FRandomStream RandomStream;
+
+	/** Standalone game instance owning the telemetry subsystem */
+	UPROPERTY()
+	UGameInstance* GameInstance;
+
+	/** Cached telemetry subsystem */
+	UPROPERTY()
+	UDelveDeepTelemetrySubsystem* Telemetry;
+
+	/** Cached event subsystem */
+	UPROPERTY()
+	UDelveDeepEventSubsystem* EventSubsystem;
+
+	/** Spawned player characters */
+	UPROPERTY()
+	TArray<ADelveDeepCharacter*> Characters;
+
+	/** Spawned monsters */
+	UPROPERTY()
+	TArray<ADelveDeepCharacter*> Monsters;
+};
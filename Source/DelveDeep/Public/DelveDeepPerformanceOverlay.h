@@ -6,8 +6,12 @@
 #include "DelveDeepFramePerformanceTracker.h"
 #include "DelveDeepSystemProfiler.h"
 #include "DelveDeepMemoryTracker.h"
+#include "DelveDeepGCTracker.h"
+#include "CanvasTypes.h"
 #include "DelveDeepPerformanceOverlay.generated.h"
 
+class UFont;
+
 /**
  * Overlay display modes for performance visualization
  */
@@ -48,7 +52,10 @@ enum class EPerformanceZone : uint8
  * - Detailed: FPS + graph + system breakdown + memory usage
  * 
  * Designed for minimal overhead (<0.1ms per frame) while providing
- * actionable real-time performance insights.
+ * actionable real-time performance insights. Text is formatted into a cache
+ * that refreshes at most TextRefreshHz and only when a value changes at display
+ * precision; the frame time graph is submitted as a single triangle batch.
+ * The overlay measures its own render cost and shows it in Standard/Detailed.
  */
 class DELVEDEEP_API FDelveDeepPerformanceOverlay
 {
@@ -67,6 +74,12 @@ public:
 	           const TArray<FSystemPerformanceData>& SystemData,
 	           const FMemorySnapshot& MemoryData);
 
+	/**
+	 * Set garbage collection statistics shown under memory in Detailed mode
+	 * @param InGCStats Current GC statistics
+	 */
+	void SetGCStats(const FDelveDeepGCStats& InGCStats) { GCStats = InGCStats; }
+
 	/**
 	 * Set the overlay display mode
 	 * @param NewMode Display mode to set
@@ -90,15 +103,137 @@ public:
 	 */
 	void ClearHistory();
 
+	/**
+	 * Get the number of frame times currently held by the graph
+	 * @return Sample count (at most MaxGraphFrames)
+	 */
+	int32 GetGraphSampleCount() const { return GraphSampleCount; }
+
+	/**
+	 * Get the smoothed cost of the overlay's own Render call
+	 * @return Exponential moving average of render time in milliseconds
+	 */
+	float GetAverageRenderCostMs() const { return AverageRenderCostMs; }
+
+	/**
+	 * Get the cost of the most recent Render call
+	 * @return Render time in milliseconds
+	 */
+	float GetLastRenderCostMs() const { return LastRenderCostMs; }
+
+	/**
+	 * Get the number of times the text cache was rebuilt (for testing)
+	 * @return Text cache refresh count
+	 */
+	int32 GetTextRefreshCount() const { return TextRefreshCount; }
+
+	/** Maximum frames to store in graph */
+	static constexpr int32 MaxGraphFrames = 120;
+
+	/** Maximum rate at which cached text is re-formatted */
+	static constexpr double TextRefreshHz = 4.0;
+
+	/** Target render cost for the overlay itself (in milliseconds) */
+	static constexpr float RenderCostBudgetMs = 0.1f;
+
 private:
+	/**
+	 * Pre-formatted overlay text line, rebuilt only when its display value changes
+	 */
+	struct FOverlayTextLine
+	{
+		/** Formatted text handed to the canvas */
+		FText Text;
+
+		/** Text color */
+		FLinearColor Color = FLinearColor::White;
+
+		/** Value the text was formatted from, quantized to display precision */
+		int64 QuantizedValue = TNumericLimits<int64>::Min();
+
+		/** Identity of the line's subject (system name for breakdown rows) */
+		FName Key;
+
+		/** Width of the optional bar drawn under the line */
+		float BarWidth = 0.0f;
+
+		/**
+		 * Check whether the line must be re-formatted and record the new value
+		 * @return True if the quantized value, key or color changed
+		 */
+		bool NeedsUpdate(int64 NewQuantizedValue, const FLinearColor& NewColor, FName NewKey = NAME_None);
+	};
+
 	/** Current display mode */
 	EOverlayMode Mode;
 
-	/** Frame time history for graph (last 120 frames) */
+	/** Frame time history for graph, used as a ring buffer of MaxGraphFrames */
 	TArray<float> FrameTimeGraph;
 
-	/** Maximum frames to store in graph */
-	static constexpr int32 MaxGraphFrames = 120;
+	/** Index of the oldest sample in the ring buffer */
+	int32 GraphHead;
+
+	/** Number of valid samples in the ring buffer */
+	int32 GraphSampleCount;
+
+	/** Batched graph geometry (background, zone lines, bars, border) */
+	TArray<FCanvasUVTri> GraphTriangles;
+
+	/** Scratch batch for system breakdown bars, reused every frame */
+	TArray<FCanvasUVTri> BarTriangles;
+
+	/** Origin the graph geometry was built for */
+	FVector2D GraphOrigin;
+
+	/** True when graph geometry must be rebuilt before drawing */
+	bool bGraphDirty;
+
+	/** Cached text lines */
+	FOverlayTextLine FPSLine;
+	FOverlayTextLine SelfCostLine;
+	TArray<FOverlayTextLine> SystemLines;
+	int32 NumVisibleSystemLines;
+	FOverlayTextLine TotalMemoryLine;
+	FOverlayTextLine NativeMemoryLine;
+	FOverlayTextLine ManagedMemoryLine;
+	FOverlayTextLine GCLine;
+	FOverlayTextLine UObjectLine;
+
+	/** Latest GC statistics from the subsystem */
+	FDelveDeepGCStats GCStats;
+
+	/** Static labels, formatted once */
+	FText SystemHeaderText;
+	FText MemoryHeaderText;
+	FText GoodLabelText;
+	FText WarningLabelText;
+
+	/** Time of the last text cache refresh */
+	double LastTextRefreshTime;
+
+	/** Forces a text refresh on the next Render (mode change, first frame) */
+	bool bTextCacheDirty;
+
+	/** Number of text cache refreshes performed */
+	int32 TextRefreshCount;
+
+	/** Render cost of the last Render call (ms) */
+	float LastRenderCostMs;
+
+	/** Smoothed render cost (ms) */
+	float AverageRenderCostMs;
+
+	/** True while the over-budget warning has been logged and not yet cleared */
+	bool bRenderCostWarningActive;
+
+	/** Maximum systems shown in the breakdown */
+	static constexpr int32 MaxBreakdownSystems = 5;
+
+	/** Frame time mapped to the top of the graph (30 FPS) */
+	static constexpr float GraphScaleMs = 33.33f;
+
+	/** Smoothing factor for the render cost moving average */
+	static constexpr float RenderCostSmoothing = 0.1f;
 
 	/** Overlay position and sizing */
 	static constexpr float OverlayX = 20.0f;
@@ -111,70 +246,99 @@ private:
 	static constexpr float GoodThreshold = 16.0f;
 	static constexpr float WarningThreshold = 20.0f;
 
+	/**
+	 * Re-format cached text for the sections visible in the current mode
+	 * @param FrameData Frame performance data
+	 * @param SystemData System performance data
+	 * @param MemoryData Memory snapshot
+	 */
+	void RefreshTextCache(const FFramePerformanceData& FrameData,
+	                      const TArray<FSystemPerformanceData>& SystemData,
+	                      const FMemorySnapshot& MemoryData);
+
+	/**
+	 * Rebuild the batched graph triangle list from the ring buffer
+	 * @param X X position
+	 * @param Y Y position
+	 */
+	void RebuildGraphGeometry(float X, float Y);
+
+	/**
+	 * Append an axis-aligned quad to a triangle list
+	 * @param Triangles Triangle list to append to
+	 * @param X X position
+	 * @param Y Y position
+	 * @param Width Quad width
+	 * @param Height Quad height
+	 * @param Color Fill color
+	 */
+	static void AppendQuad(TArray<FCanvasUVTri>& Triangles, float X, float Y, float Width, float Height, const FLinearColor& Color);
+
+	/**
+	 * Update the render cost readout and over-budget warning
+	 * @param RenderTimeMs Time spent in this Render call
+	 */
+	void RecordRenderCost(float RenderTimeMs);
+
 	/**
 	 * Render minimal overlay (FPS only)
 	 * @param Canvas Canvas to draw on
-	 * @param FrameData Frame performance data
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderMinimal(UCanvas* Canvas, const FFramePerformanceData& FrameData, float X, float Y);
+	float RenderMinimal(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
-	 * Render standard overlay (FPS + graph)
+	 * Render standard overlay (FPS + overlay cost + graph)
 	 * @param Canvas Canvas to draw on
-	 * @param FrameData Frame performance data
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderStandard(UCanvas* Canvas, const FFramePerformanceData& FrameData, float X, float Y);
+	float RenderStandard(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
 	 * Render detailed overlay (FPS + graph + systems + memory)
 	 * @param Canvas Canvas to draw on
-	 * @param FrameData Frame performance data
-	 * @param SystemData System performance data
-	 * @param MemoryData Memory snapshot
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderDetailed(UCanvas* Canvas,
-	                    const FFramePerformanceData& FrameData,
-	                    const TArray<FSystemPerformanceData>& SystemData,
-	                    const FMemorySnapshot& MemoryData,
-	                    float X, float Y);
+	float RenderDetailed(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
-	 * Render frame time graph
+	 * Render frame time graph as a single triangle batch
 	 * @param Canvas Canvas to draw on
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderFrameTimeGraph(UCanvas* Canvas, float X, float Y);
+	float RenderFrameTimeGraph(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
-	 * Render system breakdown
+	 * Render cached system breakdown
 	 * @param Canvas Canvas to draw on
-	 * @param SystemData System performance data
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderSystemBreakdown(UCanvas* Canvas, const TArray<FSystemPerformanceData>& SystemData, float X, float Y);
+	float RenderSystemBreakdown(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
-	 * Render memory statistics
+	 * Render cached memory statistics
 	 * @param Canvas Canvas to draw on
-	 * @param MemoryData Memory snapshot
+	 * @param Font Font to draw with
 	 * @param X X position
 	 * @param Y Y position
 	 * @return Next Y position after rendering
 	 */
-	float RenderMemoryStats(UCanvas* Canvas, const FMemorySnapshot& MemoryData, float X, float Y);
+	float RenderMemoryStats(UCanvas* Canvas, UFont* Font, float X, float Y);
 
 	/**
 	 * Get color for performance zone
@@ -191,25 +355,22 @@ private:
 	EPerformanceZone GetPerformanceZone(float FrameTimeMs) const;
 
 	/**
-	 * Draw text with shadow for better visibility
+	 * Draw text with a single shadowed text item for better visibility
 	 * @param Canvas Canvas to draw on
+	 * @param Font Font to draw with
 	 * @param Text Text to draw
 	 * @param X X position
 	 * @param Y Y position
 	 * @param Color Text color
 	 */
-	void DrawTextWithShadow(UCanvas* Canvas, const FString& Text, float X, float Y, const FLinearColor& Color) const;
+	void DrawTextWithShadow(UCanvas* Canvas, UFont* Font, const FText& Text, float X, float Y, const FLinearColor& Color) const;
 
 	/**
-	 * Draw a filled rectangle
+	 * Submit a triangle list as one translucent canvas item
 	 * @param Canvas Canvas to draw on
-	 * @param X X position
-	 * @param Y Y position
-	 * @param Width Rectangle width
-	 * @param Height Rectangle height
-	 * @param Color Fill color
+	 * @param Triangles Triangles to draw
 	 */
-	void DrawFilledRect(UCanvas* Canvas, float X, float Y, float Width, float Height, const FLinearColor& Color) const;
+	void DrawTriangleBatch(UCanvas* Canvas, const TArray<FCanvasUVTri>& Triangles) const;
 
 	/**
 	 * Format bytes to human-readable string
@@ -217,4 +378,11 @@ private:
 	 * @return Formatted string (e.g., "1.5 MB")
 	 */
 	FString FormatBytes(uint64 Bytes) const;
+
+	/**
+	 * Quantize a byte count to the precision FormatBytes displays
+	 * @param Bytes Number of bytes
+	 * @return Value that changes only when the formatted string would change
+	 */
+	static int64 QuantizeBytes(uint64 Bytes);
 };
@@ -0,0 +1,184 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "Async/Future.h"
+
+/**
+ * Fixed-size frame time histogram
+ *
+ * Bucket upper edges are fixed at compile time so recording a frame is a short
+ * linear scan and an increment, with no allocation.
+ */
+struct DELVEDEEP_API FDelveDeepFrameTimeHistogram
+{
+	/** Number of buckets (the last one is open-ended) */
+	static constexpr int32 NumBuckets = 15;
+
+	/** Upper edge of each bucket in milliseconds (last bucket catches everything above) */
+	static const float BucketUpperEdgesMs[NumBuckets - 1];
+
+	/** Frame counts per bucket */
+	TStaticArray<uint32, NumBuckets> Counts;
+
+	/** Total frames recorded */
+	uint32 TotalCount = 0;
+
+	/** Sum of recorded frame times (for the mean) */
+	double SumMs = 0.0;
+
+	/** Longest recorded frame */
+	float MaxMs = 0.0f;
+
+	FDelveDeepFrameTimeHistogram()
+	{
+		Reset();
+	}
+
+	/**
+	 * Record a frame time
+	 * @param FrameTimeMs Frame time in milliseconds
+	 */
+	void Add(float FrameTimeMs);
+
+	/**
+	 * Estimate a percentile from bucket counts
+	 * @param Percentile Percentile to estimate (0.0 to 1.0)
+	 * @return Upper edge of the bucket containing the percentile (MaxMs for the open bucket)
+	 */
+	float GetPercentileMs(float Percentile) const;
+
+	/**
+	 * Get the mean frame time
+	 * @return Mean in milliseconds (0 if empty)
+	 */
+	float GetMeanMs() const { return TotalCount > 0 ? static_cast<float>(SumMs / TotalCount) : 0.0f; }
+
+	/**
+	 * Clear all counts
+	 */
+	void Reset();
+};
+
+/**
+ * Sampled Telemetry
+ *
+ * Shipping-safe frame time collection. Records one in SampleInterval frames into
+ * a distribution histogram and every frame above SpikeThresholdMs into a spike
+ * histogram. Nothing else is stored per frame. Every SummaryIntervalSeconds a
+ * single compact JSON line is appended to
+ * Saved/Telemetry/Sampled/FrameSummary_<SessionStart>.jsonl on a worker thread
+ * and the histograms start over.
+ *
+ * Configured from console variables so it can be tuned from ini in shipping:
+ *   DelveDeep.Telemetry.Sampled                      (enable, default on in shipping)
+ *   DelveDeep.Telemetry.Sampled.Interval             (1-in-N frames, default 60)
+ *   DelveDeep.Telemetry.Sampled.SpikeThresholdMs     (default 20)
+ *   DelveDeep.Telemetry.Sampled.SummaryIntervalSec   (default 300)
+ */
+class DELVEDEEP_API FDelveDeepSampledTelemetry
+{
+public:
+	FDelveDeepSampledTelemetry();
+
+	/**
+	 * Apply sampling settings
+	 * @param InSampleInterval Record one in this many frames (>= 1)
+	 * @param InSpikeThresholdMs Frames above this are always recorded
+	 * @param InSummaryIntervalSeconds Seconds between summary writes (<= 0 disables periodic writes)
+	 */
+	void Configure(int32 InSampleInterval, float InSpikeThresholdMs, float InSummaryIntervalSeconds);
+
+	/**
+	 * Apply settings from the DelveDeep.Telemetry.Sampled.* console variables
+	 */
+	void ConfigureFromConsoleVariables();
+
+	/**
+	 * Check whether sampled telemetry is enabled by console variable
+	 * @return True if DelveDeep.Telemetry.Sampled is non-zero
+	 */
+	static bool IsEnabledByConsoleVariable();
+
+	/**
+	 * Record a frame (cheap; call every frame)
+	 * @param DeltaTime Frame delta time in seconds
+	 */
+	void RecordFrame(float DeltaTime);
+
+	/**
+	 * Write the current summary and start a new interval
+	 * @param bAsync True to write on a worker thread
+	 * @return True if there was anything to write
+	 */
+	bool FlushSummary(bool bAsync = true);
+
+	/** Block until every queued summary write has reached the file */
+	void WaitForPendingWrites();
+
+	/**
+	 * Build the compact JSON summary line for the current interval
+	 * @return Single-line JSON summary
+	 */
+	FString BuildSummaryLine() const;
+
+	/**
+	 * Get the file summaries are appended to
+	 * @return Absolute summary file path
+	 */
+	const FString& GetSummaryFilePath() const { return SummaryFilePath; }
+
+	/** Histogram of 1-in-N sampled frames */
+	const FDelveDeepFrameTimeHistogram& GetSampledHistogram() const { return SampledHistogram; }
+
+	/** Histogram of every frame above the spike threshold */
+	const FDelveDeepFrameTimeHistogram& GetSpikeHistogram() const { return SpikeHistogram; }
+
+	/** Total frames seen in the current interval (sampled or not) */
+	uint32 GetFramesSeen() const { return FramesSeen; }
+
+	/** Maximum summary files kept in the output directory */
+	static constexpr int32 MaxSummaryFiles = 10;
+
+private:
+	/** Distribution of sampled frames */
+	FDelveDeepFrameTimeHistogram SampledHistogram;
+
+	/** Distribution of spike frames */
+	FDelveDeepFrameTimeHistogram SpikeHistogram;
+
+	/** Frames seen in the current interval */
+	uint32 FramesSeen;
+
+	/** Frames until the next sample */
+	int32 FramesUntilSample;
+
+	/** Seconds accumulated in the current interval */
+	double IntervalSeconds;
+
+	/** Record one in this many frames */
+	int32 SampleInterval;
+
+	/** Frames above this are always recorded */
+	float SpikeThresholdMs;
+
+	/** Seconds between summary writes */
+	float SummaryIntervalSeconds;
+
+	/** Index of the next summary line in this session */
+	int32 SummarySequence;
+
+	/** Output file for this session */
+	FString SummaryFilePath;
+
+	/** Most recent async write; the next one waits on it so appends never interleave */
+	TFuture<void> PendingWrite;
+
+	/**
+	 * Delete the oldest summary files beyond MaxSummaryFiles
+	 * @param Directory Summary directory
+	 */
+	static void PruneOldSummaries(const FString& Directory);
+};
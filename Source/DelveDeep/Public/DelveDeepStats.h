@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "DelveDeepTraceRecorder.h"
 
 /**
  * DelveDeep Performance Statistics
@@ -34,21 +36,29 @@ DECLARE_STATS_GROUP(TEXT("DelveDeep.Config"), STATGROUP_DelveDeepConfig, STATCAT
 // Cycle counters - Main
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Frame Total"), STAT_DelveDeep_FrameTotal, STATGROUP_DelveDeep, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Telemetry System"), STAT_DelveDeep_TelemetrySystem, STATGROUP_DelveDeep, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resource Regeneration"), STAT_DelveDeep_ResourceRegen, STATGROUP_DelveDeep, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Initialization"), STAT_DelveDeep_CharacterInitialization, STATGROUP_DelveDeep, DELVEDEEP_API);
 
 // Cycle counters - Combat
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat System"), STAT_DelveDeep_CombatSystem, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Calculation"), STAT_DelveDeep_DamageCalculation, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Targeting System"), STAT_DelveDeep_TargetingSystem, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Modifier Expiry"), STAT_DelveDeep_ModifierExpiry, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cooldowns"), STAT_DelveDeep_Cooldowns, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Simulation"), STAT_DelveDeep_ProjectileSimulation, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AoE Queries"), STAT_DelveDeep_AoEQueries, STATGROUP_DelveDeepCombat, DELVEDEEP_API);
 
 // Cycle counters - AI
 DECLARE_CYCLE_STAT_EXTERN(TEXT("AI System"), STAT_DelveDeep_AISystem, STATGROUP_DelveDeepAI, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Behavior Tree"), STAT_DelveDeep_BehaviorTree, STATGROUP_DelveDeepAI, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Pathfinding"), STAT_DelveDeep_Pathfinding, STATGROUP_DelveDeepAI, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Monster Simulation"), STAT_DelveDeep_MonsterSimulation, STATGROUP_DelveDeepAI, DELVEDEEP_API);
 
 // Cycle counters - World
 DECLARE_CYCLE_STAT_EXTERN(TEXT("World System"), STAT_DelveDeep_WorldSystem, STATGROUP_DelveDeepWorld, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Procedural Generation"), STAT_DelveDeep_ProceduralGeneration, STATGROUP_DelveDeepWorld, DELVEDEEP_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Collision Detection"), STAT_DelveDeep_CollisionDetection, STATGROUP_DelveDeepWorld, DELVEDEEP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sprite Batching"), STAT_DelveDeep_SpriteBatching, STATGROUP_DelveDeepWorld, DELVEDEEP_API);
 
 // Cycle counters - UI
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UI System"), STAT_DelveDeep_UISystem, STATGROUP_DelveDeepUI, DELVEDEEP_API);
@@ -107,6 +117,10 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Loaded Assets"), STAT_DelveDeep_LoadedAs
  *   1. Run with -trace=cpu
  *   2. Open Unreal Insights
  *   3. Load the trace file from Saved/Profiling/UnrealInsights
+ *
+ * The TRACE_DELVEDEEP_* macros also record a span into the telemetry trace
+ * recorder (DelveDeep.Telemetry.StartTrace), which exports Chrome trace JSON
+ * without an Insights session.
  */
 
 // Insights trace channel
@@ -116,29 +130,62 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Loaded Assets"), STAT_DelveDeep_LoadedAs
 	#define DELVEDEEP_TRACE_ENABLED 0
 #endif
 
+#if DELVEDEEP_TRACE_ENABLED
+/**
+ * Opens an Insights CPU event and a telemetry trace span for the enclosing scope
+ */
+class FDelveDeepScopedSystemTrace
+{
+public:
+	FDelveDeepScopedSystemTrace(const TCHAR* InsightsName, FName SpanName, const TCHAR* Category)
+#if CPUPROFILERTRACE_ENABLED
+		: InsightsScope(InsightsName, CpuChannel)
+		, Span(SpanName, Category)
+#else
+		: Span(SpanName, Category)
+#endif
+	{
+	}
+
+private:
+#if CPUPROFILERTRACE_ENABLED
+	FCpuProfilerTrace::FDynamicEventScope InsightsScope;
+#endif
+	FDelveDeepScopedTraceSpan Span;
+};
+
+/**
+ * Trace the enclosing scope in Insights and the telemetry recorder.
+ * Expands to a single declaration, so it is safe as an unbraced statement body.
+ */
+#define DELVEDEEP_SYSTEM_TRACE(InsightsName, SpanName) \
+	FDelveDeepScopedSystemTrace PREPROCESSOR_JOIN(DelveDeepSystemTrace_, __LINE__)( \
+		TEXT(#InsightsName), []() { static const FName TraceName(SpanName); return TraceName; }(), TEXT("DelveDeep"))
+#endif
+
 // Trace macros for major systems
 #if DELVEDEEP_TRACE_ENABLED
-	#define TRACE_DELVEDEEP_COMBAT() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_CombatSystem)
-	#define TRACE_DELVEDEEP_AI() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_AISystem)
-	#define TRACE_DELVEDEEP_WORLD() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_WorldSystem)
-	#define TRACE_DELVEDEEP_UI() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_UISystem)
-	#define TRACE_DELVEDEEP_EVENTS() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_EventSystem)
-	#define TRACE_DELVEDEEP_CONFIG() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_ConfigSystem)
-	#define TRACE_DELVEDEEP_TELEMETRY() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_TelemetrySystem)
+	#define TRACE_DELVEDEEP_COMBAT() DELVEDEEP_SYSTEM_TRACE(DelveDeep_CombatSystem, TEXT("CombatSystem"))
+	#define TRACE_DELVEDEEP_AI() DELVEDEEP_SYSTEM_TRACE(DelveDeep_AISystem, TEXT("AISystem"))
+	#define TRACE_DELVEDEEP_WORLD() DELVEDEEP_SYSTEM_TRACE(DelveDeep_WorldSystem, TEXT("WorldSystem"))
+	#define TRACE_DELVEDEEP_UI() DELVEDEEP_SYSTEM_TRACE(DelveDeep_UISystem, TEXT("UISystem"))
+	#define TRACE_DELVEDEEP_EVENTS() DELVEDEEP_SYSTEM_TRACE(DelveDeep_EventSystem, TEXT("EventSystem"))
+	#define TRACE_DELVEDEEP_CONFIG() DELVEDEEP_SYSTEM_TRACE(DelveDeep_ConfigSystem, TEXT("ConfigSystem"))
+	#define TRACE_DELVEDEEP_TELEMETRY() DELVEDEEP_SYSTEM_TRACE(DelveDeep_TelemetrySystem, TEXT("TelemetrySystem"))
 	
 	// Subsystem traces
-	#define TRACE_DELVEDEEP_DAMAGE() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_DamageCalculation)
-	#define TRACE_DELVEDEEP_TARGETING() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_TargetingSystem)
-	#define TRACE_DELVEDEEP_BEHAVIORTREE() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_BehaviorTree)
-	#define TRACE_DELVEDEEP_PATHFINDING() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_Pathfinding)
-	#define TRACE_DELVEDEEP_PROCGEN() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_ProceduralGeneration)
-	#define TRACE_DELVEDEEP_COLLISION() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_CollisionDetection)
-	#define TRACE_DELVEDEEP_HUD() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_HUDUpdate)
-	#define TRACE_DELVEDEEP_MENU() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_MenuRendering)
-	#define TRACE_DELVEDEEP_EVENT_BROADCAST() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_EventBroadcast)
-	#define TRACE_DELVEDEEP_EVENT_PROCESS() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_EventProcessing)
-	#define TRACE_DELVEDEEP_DATAQUERY() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_DataAssetQuery)
-	#define TRACE_DELVEDEEP_VALIDATION() TRACE_CPUPROFILER_EVENT_SCOPE(DelveDeep_Validation)
+	#define TRACE_DELVEDEEP_DAMAGE() DELVEDEEP_SYSTEM_TRACE(DelveDeep_DamageCalculation, TEXT("DamageCalculation"))
+	#define TRACE_DELVEDEEP_TARGETING() DELVEDEEP_SYSTEM_TRACE(DelveDeep_TargetingSystem, TEXT("TargetingSystem"))
+	#define TRACE_DELVEDEEP_BEHAVIORTREE() DELVEDEEP_SYSTEM_TRACE(DelveDeep_BehaviorTree, TEXT("BehaviorTree"))
+	#define TRACE_DELVEDEEP_PATHFINDING() DELVEDEEP_SYSTEM_TRACE(DelveDeep_Pathfinding, TEXT("Pathfinding"))
+	#define TRACE_DELVEDEEP_PROCGEN() DELVEDEEP_SYSTEM_TRACE(DelveDeep_ProceduralGeneration, TEXT("ProceduralGeneration"))
+	#define TRACE_DELVEDEEP_COLLISION() DELVEDEEP_SYSTEM_TRACE(DelveDeep_CollisionDetection, TEXT("CollisionDetection"))
+	#define TRACE_DELVEDEEP_HUD() DELVEDEEP_SYSTEM_TRACE(DelveDeep_HUDUpdate, TEXT("HUDUpdate"))
+	#define TRACE_DELVEDEEP_MENU() DELVEDEEP_SYSTEM_TRACE(DelveDeep_MenuRendering, TEXT("MenuRendering"))
+	#define TRACE_DELVEDEEP_EVENT_BROADCAST() DELVEDEEP_SYSTEM_TRACE(DelveDeep_EventBroadcast, TEXT("EventBroadcast"))
+	#define TRACE_DELVEDEEP_EVENT_PROCESS() DELVEDEEP_SYSTEM_TRACE(DelveDeep_EventProcessing, TEXT("EventProcessing"))
+	#define TRACE_DELVEDEEP_DATAQUERY() DELVEDEEP_SYSTEM_TRACE(DelveDeep_DataAssetQuery, TEXT("DataAssetQuery"))
+	#define TRACE_DELVEDEEP_VALIDATION() DELVEDEEP_SYSTEM_TRACE(DelveDeep_Validation, TEXT("Validation"))
 #else
 	#define TRACE_DELVEDEEP_COMBAT()
 	#define TRACE_DELVEDEEP_AI()
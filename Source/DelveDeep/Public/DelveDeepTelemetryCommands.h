@@ -54,6 +54,8 @@ public:
 	static void ListBaselines(const TArray<FString>& Args);
 	static void SaveBaseline(const TArray<FString>& Args);
 	static void LoadBaseline(const TArray<FString>& Args);
+	static void LoadBaselines(const TArray<FString>& Args);
+	static void ExportBaselineJSON(const TArray<FString>& Args);
 	static void DeleteBaseline(const TArray<FString>& Args);
 
 	// Reporting commands
@@ -71,9 +73,20 @@ public:
 	static void DisableOverlay(const TArray<FString>& Args);
 	static void SetOverlayMode(const TArray<FString>& Args);
 
+	// Live feed commands
+	static void StartFeed(const TArray<FString>& Args);
+	static void StopFeed(const TArray<FString>& Args);
+	static void StartTrace(const TArray<FString>& Args);
+	static void StopTrace(const TArray<FString>& Args);
+
 	// Gameplay metrics commands
 	static void ShowGameplayMetrics(const TArray<FString>& Args);
 	static void ShowAssetLoads(const TArray<FString>& Args);
+	static void ShowGCStats(const TArray<FString>& Args);
+	static void ShowPoolingRecommendations(const TArray<FString>& Args);
+	static void ShowEntityLimits(const TArray<FString>& Args);
+	static void ShowSampledTelemetry(const TArray<FString>& Args);
+	static void ShowDeferredWork(const TArray<FString>& Args);
 
 private:
 	// Helper functions
@@ -0,0 +1,288 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+
+class FFramePerformanceTracker;
+class FSystemProfiler;
+class FMemoryTracker;
+class FDelveDeepGameplayMetrics;
+class FDelveDeepEntityLimitController;
+
+/**
+ * Shared-memory layout constants for the live telemetry feed.
+ * Bump Version whenever any feed struct below changes.
+ */
+namespace DelveDeepTelemetryFeed
+{
+	/** 'DDTF' */
+	constexpr uint32 Magic = 0x46544444;
+
+	/** Layout version */
+	constexpr uint32 Version = 1;
+
+	/** Frames held in the ring (about 4 seconds at 60 FPS) */
+	constexpr int32 Capacity = 256;
+
+	/** Systems published per frame */
+	constexpr int32 MaxSystems = 24;
+
+	/** Entity types published per frame */
+	constexpr int32 MaxEntityTypes = 8;
+
+	/** Fixed name length including terminator */
+	constexpr int32 NameLength = 32;
+
+	/** Default shared-memory region name */
+	inline const TCHAR* DefaultRegionName() { return TEXT("DelveDeepTelemetryFeed"); }
+}
+
+/** Per-system timing in a feed frame */
+struct FDelveDeepFeedSystemSample
+{
+	ANSICHAR Name[DelveDeepTelemetryFeed::NameLength];
+	float TimeMs;
+	float BudgetMs;
+};
+
+/** Per-entity-type count in a feed frame */
+struct FDelveDeepFeedEntitySample
+{
+	ANSICHAR Name[DelveDeepTelemetryFeed::NameLength];
+	int32 Count;
+	int32 Limit;
+};
+
+/**
+ * One frame of telemetry in the shared ring.
+ * Plain data only: the reader may be a different build or a non-Unreal process.
+ */
+struct FDelveDeepFeedFrame
+{
+	/** Sequence number of the frame in this slot (0 while being written) */
+	volatile int64 Sequence;
+
+	/** Engine frame counter */
+	uint64 FrameNumber;
+
+	/** Writer's FPlatformTime::Seconds() at publish */
+	double TimeSeconds;
+
+	float FrameTimeMs;
+	float AverageFPS;
+
+	int64 TotalMemoryBytes;
+	int64 NativeMemoryBytes;
+
+	/** Cumulative counters; readers diff consecutive frames for per-frame rates */
+	int32 TotalEventsBroadcast;
+	int32 TotalBudgetViolations;
+	int32 TotalGameplaySyncLoads;
+
+	int32 NumSystems;
+	int32 NumEntityTypes;
+	int32 Padding;
+
+	FDelveDeepFeedSystemSample Systems[DelveDeepTelemetryFeed::MaxSystems];
+	FDelveDeepFeedEntitySample Entities[DelveDeepTelemetryFeed::MaxEntityTypes];
+};
+
+/** Header at the start of the shared region */
+struct FDelveDeepFeedHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	uint32 FrameSize;
+	uint32 Capacity;
+	uint32 WriterProcessId;
+	uint32 Padding;
+
+	/** Highest fully published sequence number (frames start at 1) */
+	volatile int64 PublishedSequence;
+
+	/** Writer's FPlatformTime::Seconds() when the feed was opened */
+	double WriterStartSeconds;
+};
+
+/** Cumulative counters sampled by the subsystem for each published frame */
+struct FDelveDeepFeedCounters
+{
+	int32 TotalEventsBroadcast = 0;
+	int32 TotalBudgetViolations = 0;
+	int32 TotalGameplaySyncLoads = 0;
+};
+
+/**
+ * Telemetry Feed Writer
+ *
+ * Publishes one FDelveDeepFeedFrame per tick into a named shared-memory ring so
+ * an external process can watch a run at full rate without in-game rendering
+ * or log output. Single producer, lock-free: each slot is guarded by its own
+ * sequence number (zeroed while the slot is rewritten, stored last), and the
+ * header's PublishedSequence only moves forward after a slot is complete.
+ * Slow readers lose the oldest frames; the writer never waits.
+ */
+class DELVEDEEP_API FDelveDeepTelemetryFeedWriter
+{
+public:
+	FDelveDeepTelemetryFeedWriter();
+	~FDelveDeepTelemetryFeedWriter();
+
+	/**
+	 * Create (or attach to) the shared region and reset the ring
+	 * @param RegionName Shared-memory region name
+	 * @return True if the region is mapped and ready
+	 */
+	bool Open(const FString& RegionName = DelveDeepTelemetryFeed::DefaultRegionName());
+
+	/**
+	 * Unmap the shared region
+	 */
+	void Close();
+
+	/**
+	 * Check if the feed is publishing
+	 * @return True if the region is mapped
+	 */
+	bool IsOpen() const { return Region != nullptr; }
+
+	/**
+	 * Publish a frame built from the telemetry trackers
+	 * @param DeltaTime Frame time in seconds
+	 * @param FrameTracker Frame tracker (average FPS)
+	 * @param Profiler System profiler (per-system times for this frame)
+	 * @param MemoryTracker Memory tracker (latest snapshot)
+	 * @param Metrics Gameplay metrics (entity counts)
+	 * @param LimitController Entity limit controller (current caps, may be null)
+	 * @param Counters Cumulative event/violation/load counters
+	 */
+	void PublishFrame(float DeltaTime,
+		const FFramePerformanceTracker& FrameTracker,
+		const FSystemProfiler& Profiler,
+		const FMemoryTracker& MemoryTracker,
+		const FDelveDeepGameplayMetrics& Metrics,
+		const FDelveDeepEntityLimitController* LimitController,
+		const FDelveDeepFeedCounters& Counters);
+
+	/**
+	 * Publish a pre-filled frame (Sequence is assigned by the writer)
+	 * @param Frame Frame contents
+	 */
+	void PublishFrame(const FDelveDeepFeedFrame& Frame);
+
+	/**
+	 * Get the sequence number of the last published frame
+	 * @return Last sequence (0 if nothing published)
+	 */
+	int64 GetPublishedSequence() const { return NextSequence - 1; }
+
+	/**
+	 * Get the region name the feed was opened with
+	 * @return Region name
+	 */
+	const FString& GetRegionName() const { return RegionName; }
+
+	/** Total bytes of the shared region */
+	static SIZE_T GetRegionSize();
+
+private:
+	/** Mapped region (null when closed) */
+	FPlatformMemory::FSharedMemoryRegion* Region;
+
+	/** Header inside the region */
+	FDelveDeepFeedHeader* Header;
+
+	/** Frame ring inside the region */
+	FDelveDeepFeedFrame* Frames;
+
+	/** Sequence number of the next frame */
+	int64 NextSequence;
+
+	/** Scratch frame filled before the slot copy */
+	FDelveDeepFeedFrame Scratch;
+
+	/** Name the region was opened with */
+	FString RegionName;
+};
+
+/**
+ * Telemetry Feed Reader
+ *
+ * Attaches to a feed created by FDelveDeepTelemetryFeedWriter and copies out
+ * frames published since the last read. Torn slots (overwritten mid-copy) are
+ * discarded and counted as dropped along with frames the writer lapped.
+ */
+class DELVEDEEP_API FDelveDeepTelemetryFeedReader
+{
+public:
+	FDelveDeepTelemetryFeedReader();
+	~FDelveDeepTelemetryFeedReader();
+
+	/**
+	 * Attach to an existing feed region
+	 * @param RegionName Shared-memory region name
+	 * @return True if the region exists and its layout matches this build
+	 */
+	bool Open(const FString& RegionName = DelveDeepTelemetryFeed::DefaultRegionName());
+
+	/**
+	 * Detach from the region
+	 */
+	void Close();
+
+	/**
+	 * Check if attached
+	 * @return True if the region is mapped
+	 */
+	bool IsOpen() const { return Region != nullptr; }
+
+	/**
+	 * Copy frames published since the last call
+	 * @param OutFrames Receives frames in sequence order (appended)
+	 * @param MaxFrames Upper bound on frames copied this call
+	 * @return Number of frames appended
+	 */
+	int32 ReadNewFrames(TArray<FDelveDeepFeedFrame>& OutFrames, int32 MaxFrames = DelveDeepTelemetryFeed::Capacity);
+
+	/**
+	 * Get the writer's latest published sequence
+	 * @return Published sequence (0 if not attached)
+	 */
+	int64 GetPublishedSequence() const;
+
+	/**
+	 * Get the writer's process id
+	 * @return Process id (0 if not attached)
+	 */
+	uint32 GetWriterProcessId() const { return Header ? Header->WriterProcessId : 0; }
+
+	/**
+	 * Check if the writer still has the feed open
+	 * @return True if attached and the writer has not closed the feed
+	 */
+	bool IsWriterActive() const { return Header && Header->Magic == DelveDeepTelemetryFeed::Magic; }
+
+	/**
+	 * Get the number of frames missed because the reader fell behind or a slot tore
+	 * @return Dropped frame count
+	 */
+	int64 GetDroppedFrames() const { return DroppedFrames; }
+
+private:
+	/** Mapped region (null when closed) */
+	FPlatformMemory::FSharedMemoryRegion* Region;
+
+	/** Header inside the region */
+	const FDelveDeepFeedHeader* Header;
+
+	/** Frame ring inside the region */
+	const FDelveDeepFeedFrame* Frames;
+
+	/** Next sequence this reader expects */
+	int64 NextSequence;
+
+	/** Frames missed so far */
+	int64 DroppedFrames;
+};
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DelveDeepTelemetryFeed.h"
+#include "DelveDeepTelemetryFeedReaderCommandlet.generated.h"
+
+/**
+ * Telemetry Feed Reader Commandlet
+ *
+ * Reference reader for the live shared-memory telemetry feed. Run it in a
+ * second process on the same machine while the game publishes with
+ * -TelemetryFeed (or DelveDeep.Telemetry.StartFeed) and it logs a rolling
+ * summary (or every frame) without touching the game's frame time.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd DelveDeep.uproject -run=DelveDeepTelemetryFeedReader -NullRHI
+ *     [-Feed=DelveDeepTelemetryFeed] [-Mode=Summary|Frames] [-Interval=1.0]
+ *     [-Duration=0] [-PollHz=240]
+ *
+ * Exit codes:
+ *   0 - Ran for the requested duration or the writer closed the feed
+ *   2 - Feed not found within the attach timeout
+ */
+UCLASS()
+class DELVEDEEP_API UDelveDeepTelemetryFeedReaderCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDelveDeepTelemetryFeedReaderCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/**
+	 * Log a single frame on one line
+	 * @param Frame Frame to log
+	 */
+	static void LogFrame(const FDelveDeepFeedFrame& Frame);
+
+	/**
+	 * Log a summary of the frames received since the last summary
+	 * @param Window Frames in the summary window
+	 * @param DroppedFrames Total frames dropped so far
+	 */
+	static void LogSummary(const TArray<FDelveDeepFeedFrame>& Window, int64 DroppedFrames);
+};
@@ -14,7 +14,13 @@
 #include "DelveDeepPerformanceOverlay.h"
 #include "DelveDeepProfilingSession.h"
 #include "DelveDeepGameplayMetrics.h"
+#include "DelveDeepEntityLimitController.h"
 #include "DelveDeepAssetLoadTracker.h"
+#include "DelveDeepGCTracker.h"
+#include "DelveDeepSampledTelemetry.h"
+#include "DelveDeepTelemetryFeed.h"
+#include "DelveDeepTraceRecorder.h"
+#include "DelveDeepDeferredWorkScheduler.h"
 #include "DelveDeepTelemetrySubsystem.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDelveDeepTelemetry, Log, All);
@@ -48,7 +54,7 @@ public:
 	// FTickableGameObject interface
 	virtual void Tick(float DeltaTime) override;
 	virtual TStatId GetStatId() const override;
-	virtual bool IsTickable() const override { return !IsTemplate(); }
+	virtual bool IsTickable() const override { return !IsTemplate() && !bManualTick; }
 	virtual bool IsTickableInEditor() const override { return false; }
 	virtual bool IsTickableWhenPaused() const override { return true; }
 	virtual UWorld* GetTickableGameObjectWorld() const override;
@@ -204,6 +210,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
 	int64 GetPeakMemoryUsage() const;
 
+	/**
+	 * Stop (or resume) engine ticks so the owner can call Tick itself with its own frame times
+	 * (headless benchmarks measure each frame and would otherwise be sampled twice)
+	 * @param bManual True to tick only through explicit Tick calls
+	 */
+	void SetManualTick(bool bManual) { bManualTick = bManual; }
+
+	/**
+	 * Drop frame and system timing statistics gathered so far (e.g. after warm-up)
+	 */
+	void ResetFrameStatistics();
+
 	// Baseline Management
 
 	/**
@@ -239,16 +257,25 @@ public:
 	bool GetBaseline(FName BaselineName, FPerformanceBaseline& OutBaseline) const;
 
 	/**
-	 * Save a baseline to disk
+	 * Save a baseline to disk in the binary baseline format
 	 * @param BaselineName Name of the baseline to save
-	 * @param FilePath Path where to save the baseline (optional, uses default if empty)
+	 * @param FilePath Path where to save the baseline (optional, uses default if empty; a .json path exports JSON instead)
 	 * @return True if save was successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
 	bool SaveBaseline(FName BaselineName, const FString& FilePath = TEXT(""));
 
 	/**
-	 * Load a baseline from disk
+	 * Export a baseline as human-readable JSON
+	 * @param BaselineName Name of the baseline to export
+	 * @param FilePath Path to write (optional, uses default if empty)
+	 * @return True if export was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool ExportBaselineJSON(FName BaselineName, const FString& FilePath = TEXT(""));
+
+	/**
+	 * Load a baseline from disk (binary or JSON)
 	 * @param BaselineName Name to assign to the loaded baseline
 	 * @param FilePath Path to the baseline file
 	 * @return True if load was successful
@@ -256,6 +283,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
 	bool LoadBaseline(FName BaselineName, const FString& FilePath);
 
+	/**
+	 * Load every baseline file in a directory, reading and parsing files in parallel.
+	 * Each baseline is named after its file; binary files win over JSON files with the same name.
+	 * @param Directory Directory to scan (optional, uses default if empty)
+	 * @return Number of baselines loaded
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	int32 LoadAllBaselinesInDirectory(const FString& Directory = TEXT(""));
+
 	/**
 	 * Delete a baseline
 	 * @param BaselineName Name of the baseline to delete
@@ -326,6 +362,67 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
 	EOverlayMode GetOverlayMode() const;
 
+	// Live Telemetry Feed
+
+	/**
+	 * Start publishing per-frame telemetry to shared memory for an external reader
+	 * @param RegionName Shared-memory region name (empty = default)
+	 * @return True if the feed is publishing
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool StartTelemetryFeed(const FString& RegionName = TEXT(""));
+
+	/**
+	 * Stop publishing the live telemetry feed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	void StopTelemetryFeed();
+
+	/**
+	 * Check if the live telemetry feed is publishing
+	 * @return True if frames are being published
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	bool IsTelemetryFeedActive() const { return TelemetryFeed.IsOpen(); }
+
+	/**
+	 * Get the live telemetry feed writer
+	 * @return Feed writer
+	 */
+	const FDelveDeepTelemetryFeedWriter& GetTelemetryFeed() const { return TelemetryFeed; }
+
+	// Timeline Trace Capture
+
+	/**
+	 * Start recording a timeline trace (frames, system spans, memory counters, asset loads)
+	 * @param DurationSeconds Stop and export automatically after this long (0 = until StopTraceCapture)
+	 * @return True if the capture started
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool StartTraceCapture(float DurationSeconds = 0.0f);
+
+	/**
+	 * Stop the trace capture and export it as Chrome trace JSON
+	 * @param FilePath Output file (empty = Saved/Telemetry/Traces/Trace_<time>.json)
+	 * @return True if the trace was written
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool StopTraceCapture(const FString& FilePath = TEXT(""));
+
+	/**
+	 * Check if a trace capture is recording
+	 * @return True while recording
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	bool IsTraceCaptureActive() const { return FDelveDeepTraceRecorder::Get().IsCapturing(); }
+
+	/**
+	 * Get the smoothed cost of rendering the overlay itself
+	 * @return Average overlay render time in milliseconds (0 if overlay was never created)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	float GetOverlayRenderCostMs() const;
+
 	/**
 	 * Render the performance overlay (typically called from HUD)
 	 * @param Canvas Canvas to draw on
@@ -429,6 +526,137 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
 	int32 GetRecommendedEntityLimit(FName EntityType) const;
 
+	/**
+	 * Record an acquire from an actor pool
+	 * @param PoolName Pool that was asked for an actor
+	 * @param bHit True if a pooled actor was reused, false if one was spawned
+	 * @param AvailableCount Actors left in the pool afterwards
+	 */
+	void RecordActorPoolAcquire(FName PoolName, bool bHit, int32 AvailableCount);
+
+	/**
+	 * Record an actor returned to a pool
+	 * @param PoolName Pool the actor went back to
+	 * @param AvailableCount Actors in the pool afterwards
+	 */
+	void RecordActorPoolRelease(FName PoolName, int32 AvailableCount);
+
+	/**
+	 * Get the fraction of acquires a pool served without spawning
+	 * @param PoolName Pool to query
+	 * @return Hit rate (0-1, 0 if the pool was never used)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	float GetActorPoolHitRate(FName PoolName) const;
+
+	/**
+	 * Get usage of every actor pool
+	 * @return Pool statistics
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	TArray<FDelveDeepActorPoolStats> GetAllActorPoolStats() const;
+
+	// Adaptive Entity Limits
+
+	/**
+	 * Check whether a spawner may create more entities of a type.
+	 * Uses the adaptive cap when enabled, otherwise the static recommended limit.
+	 * Denied requests are counted per type.
+	 * @param EntityType Type of entity (e.g., "Monsters", "Projectiles")
+	 * @param Count Number of entities about to be spawned
+	 * @return True if the spawn fits within the current cap
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool CanSpawnEntity(FName EntityType, int32 Count = 1);
+
+	/**
+	 * Get how many more entities of a type may be spawned right now
+	 * @param EntityType Type of entity
+	 * @return Remaining allowance (MAX_int32 if the type has no cap)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	int32 GetSpawnAllowance(FName EntityType) const;
+
+	/**
+	 * Get the current adaptive cap for an entity type
+	 * @param EntityType Type of entity
+	 * @return Current cap (0 if the type is not registered)
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	int32 GetAdaptiveEntityLimit(FName EntityType) const;
+
+	/**
+	 * Get all adaptive entity limits
+	 * @return Array of per-type limits
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	TArray<FAdaptiveEntityLimit> GetAllAdaptiveEntityLimits() const;
+
+	/**
+	 * Register or reconfigure an adaptive entity type
+	 * @param EntityType Type of entity
+	 * @param CostSystem Profiled system whose time scales with this type
+	 * @param MinLimit Lowest cap allowed under load
+	 * @param MaxLimit Highest cap allowed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	void ConfigureAdaptiveEntityLimit(FName EntityType, FName CostSystem, int32 MinLimit, int32 MaxLimit);
+
+	/**
+	 * Enable or disable adaptive entity limits
+	 * @param bEnabled True to drive caps from frame time, false to use static limits
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	void SetAdaptiveEntityLimitsEnabled(bool bEnabled);
+
+	/**
+	 * Check if adaptive entity limits are enabled
+	 * @return True if caps are driven from frame time
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	bool AreAdaptiveEntityLimitsEnabled() const { return bAdaptiveEntityLimitsEnabled; }
+
+	// Deferred Work
+
+	/**
+	 * Submit work to run later inside a system's unused frame budget
+	 * @param SystemName Budgeted system that pays for the work (e.g., "Events", "AI")
+	 * @param WorkName Short label for stats and logs
+	 * @param Priority Work priority
+	 * @param Work Callback; return true when finished, false to continue next slice
+	 * @return Handle for CancelDeferredWork (0 on failure)
+	 */
+	uint64 SubmitDeferredWork(FName SystemName, FName WorkName, EDelveDeepWorkPriority Priority,
+		FDelveDeepDeferredWorkScheduler::FWorkFunction Work);
+
+	/**
+	 * Cancel pending deferred work
+	 * @param Handle Handle returned by SubmitDeferredWork
+	 * @return True if the work was still pending
+	 */
+	bool CancelDeferredWork(uint64 Handle);
+
+	/**
+	 * Get deferred work statistics for a system
+	 * @param SystemName Budgeted system
+	 * @return Queue, throughput and starvation statistics
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	FDeferredWorkSystemStats GetDeferredWorkStats(FName SystemName) const;
+
+	/**
+	 * Get deferred work statistics for all systems with work
+	 * @return Array of statistics
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	TArray<FDeferredWorkSystemStats> GetAllDeferredWorkStats() const;
+
+	/**
+	 * Get the deferred work scheduler
+	 * @return Scheduler
+	 */
+	FDelveDeepDeferredWorkScheduler& GetDeferredWorkScheduler() { return DeferredWorkScheduler; }
+
 	// Asset Loading Tracking
 
 	/**
@@ -482,6 +710,79 @@ public:
 	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
 	int32 GetTotalSlowLoads() const;
 
+	/**
+	 * Get number of synchronous asset loads that stalled gameplay frames
+	 * @return Gameplay sync load count
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	int32 GetGameplaySyncLoadCount() const;
+
+	/**
+	 * Get the most recent synchronous asset loads that stalled gameplay frames
+	 * @return Gameplay sync load records
+	 */
+	TArray<FAssetLoadRecord> GetGameplaySyncLoads() const;
+
+	// Garbage Collection and UObject Churn
+
+	/**
+	 * Get garbage collection statistics (time, objects purged, live UObjects)
+	 * @return GC statistics
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	FDelveDeepGCStats GetGCStats() const;
+
+	/**
+	 * Get recent garbage collections, oldest first
+	 * @return Collection records
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	TArray<FDelveDeepGCEvent> GetRecentGarbageCollections() const;
+
+	/**
+	 * Get per-class spawn/destroy counts, highest churn first
+	 * @param MaxClasses Maximum classes to return (0 = all)
+	 * @return Class churn records
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	TArray<FDelveDeepClassChurn> GetClassChurn(int32 MaxClasses = 10) const;
+
+	/**
+	 * Get classes that churn enough to be worth pooling
+	 * @param MinDestroysPerMinute Classes destroyed less often than this are left out
+	 * @return Recommendations, highest destroy rate first
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	TArray<FDelveDeepPoolingRecommendation> GetPoolingRecommendations(float MinDestroysPerMinute = 30.0f) const;
+
+	/**
+	 * Get the GC tracker
+	 * @return GC tracker
+	 */
+	FDelveDeepGCTracker& GetGCTracker() { return GCTracker; }
+
+	// Sampled Telemetry
+
+	/**
+	 * Check if sampled frame telemetry is recording
+	 * @return True if DelveDeep.Telemetry.Sampled is enabled
+	 */
+	UFUNCTION(BlueprintPure, Category = "DelveDeep|Telemetry")
+	bool IsSampledTelemetryEnabled() const;
+
+	/**
+	 * Write the current sampled telemetry summary now and start a new interval
+	 * @return True if a summary was written
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DelveDeep|Telemetry")
+	bool WriteSampledTelemetrySummary();
+
+	/**
+	 * Get the sampled telemetry collector
+	 * @return Sampled telemetry (histograms and summary settings)
+	 */
+	const FDelveDeepSampledTelemetry& GetSampledTelemetry() const { return SampledTelemetry; }
+
 private:
 	// Frame tracking
 	FFramePerformanceTracker FrameTracker;
@@ -505,6 +806,9 @@ private:
 #endif
 	bool bInitialized = false;
 
+	/** Ticked only through explicit Tick calls (see SetManualTick) */
+	bool bManualTick = false;
+
 	// Baseline storage
 	TMap<FName, FPerformanceBaseline> Baselines;
 
@@ -520,14 +824,50 @@ private:
 	// Gameplay metrics
 	FDelveDeepGameplayMetrics GameplayMetrics;
 
+	// Adaptive entity limits (runs in all builds so spawn throttling works in shipping)
+	FDelveDeepEntityLimitController EntityLimitController;
+	bool bAdaptiveEntityLimitsEnabled = true;
+
+	// Deferred work (runs in all builds; work must progress in shipping too)
+	FDelveDeepDeferredWorkScheduler DeferredWorkScheduler;
+
 	// Asset load tracking
 	FDelveDeepAssetLoadTracker AssetLoadTracker;
 
+	// Garbage collection and UObject churn (development builds only)
+	FDelveDeepGCTracker GCTracker;
+
+	// Sampled frame telemetry (runs in all builds, on by default only in shipping)
+	FDelveDeepSampledTelemetry SampledTelemetry;
+
+	// Live shared-memory feed for external viewers (development builds only)
+	FDelveDeepTelemetryFeedWriter TelemetryFeed;
+
+	/**
+	 * Publish this frame to the live feed
+	 * @param DeltaTime Frame time in seconds
+	 */
+	void PublishTelemetryFeedFrame(float DeltaTime);
+
+	// Trace capture auto-stop time (FPlatformTime::Seconds(), 0 = manual stop)
+	double TraceCaptureStopTime = 0.0;
+
+	/**
+	 * Record this frame's memory and entity counters into the trace
+	 */
+	void RecordTraceCounters();
+
 	/**
 	 * Register default system budgets
 	 */
 	void RegisterDefaultBudgets();
 
+	/**
+	 * Record a gameplay-frame synchronous load against the SyncAssetLoad budget
+	 * @param Record Completed load record
+	 */
+	void HandleGameplaySyncAssetLoad(const FAssetLoadRecord& Record);
+
 	/**
 	 * Get the default baseline save directory
 	 * @return Default directory path
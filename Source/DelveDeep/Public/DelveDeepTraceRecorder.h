@@ -0,0 +1,246 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Kind of event in a trace capture (maps to Chrome trace "ph")
+ */
+enum class EDelveDeepTracePhase : uint8
+{
+	/** Span with start and end ("X") */
+	Complete,
+
+	/** Point in time ("i") */
+	Instant,
+
+	/** Sampled value ("C") */
+	Counter
+};
+
+/**
+ * One recorded trace event
+ */
+struct FDelveDeepTraceEvent
+{
+	/** Span, marker or counter name */
+	FName Name;
+
+	/** Category shown in the trace viewer (string literal) */
+	const TCHAR* Category = TEXT("");
+
+	/** Optional detail shown in the event's args (asset path, frame number) */
+	FString Detail;
+
+	/** Start cycles (FPlatformTime::Cycles64) */
+	uint64 StartCycles = 0;
+
+	/** End cycles for spans */
+	uint64 EndCycles = 0;
+
+	/** Counter value */
+	double Value = 0.0;
+
+	EDelveDeepTracePhase Phase = EDelveDeepTracePhase::Complete;
+};
+
+/**
+ * Trace Recorder
+ *
+ * Records spans, frame boundaries, counters and markers from any thread during
+ * a capture and exports them as Chrome trace JSON (chrome://tracing, Perfetto
+ * UI, Unreal Insights' JSON import), so a single frame's time can be read as a
+ * timeline across threads.
+ *
+ * Each thread appends to its own buffer; the buffer's lock is only contended
+ * while a capture starts or an export copies it out. Buffers are bounded per
+ * thread; events past the bound are counted as dropped rather than grown into.
+ *
+ * Process-wide (spans are recorded from code that has no subsystem pointer).
+ */
+class DELVEDEEP_API FDelveDeepTraceRecorder
+{
+public:
+	/**
+	 * Get the process-wide recorder
+	 */
+	static FDelveDeepTraceRecorder& Get();
+
+	/**
+	 * Start a capture, discarding events from any previous capture
+	 * @param MaxEventsPerThread Bound on events buffered per thread
+	 */
+	void StartCapture(int32 MaxEventsPerThread = DefaultMaxEventsPerThread);
+
+	/**
+	 * Stop recording (events are kept for export)
+	 */
+	void StopCapture();
+
+	/**
+	 * Check if a capture is recording
+	 * @return True while recording
+	 */
+	bool IsCapturing() const { return bCapturing.Load(EMemoryOrder::Relaxed); }
+
+	/**
+	 * Record a span on the calling thread
+	 * @param Name Span name
+	 * @param Category Category (string literal)
+	 * @param StartCycles Start (FPlatformTime::Cycles64)
+	 * @param EndCycles End (FPlatformTime::Cycles64)
+	 * @param Detail Optional detail for the event's args
+	 */
+	void RecordSpan(FName Name, const TCHAR* Category, uint64 StartCycles, uint64 EndCycles, const FString& Detail = FString());
+
+	/**
+	 * Record a span that ends now and lasted DurationMs (for timings reported after the fact)
+	 * @param Name Span name
+	 * @param Category Category (string literal)
+	 * @param DurationMs Duration in milliseconds
+	 * @param Detail Optional detail for the event's args
+	 */
+	void RecordSpanEndingNow(FName Name, const TCHAR* Category, double DurationMs, const FString& Detail = FString());
+
+	/**
+	 * Record a point-in-time marker on the calling thread
+	 * @param Name Marker name
+	 * @param Category Category (string literal)
+	 * @param Detail Optional detail for the event's args
+	 */
+	void RecordInstant(FName Name, const TCHAR* Category, const FString& Detail = FString());
+
+	/**
+	 * Record a counter sample (each name becomes its own track)
+	 * @param Name Counter name
+	 * @param Value Sampled value
+	 */
+	void RecordCounter(FName Name, double Value);
+
+	/**
+	 * Close the previous frame span and open the next (game thread, once per frame)
+	 * @param FrameNumber Engine frame number of the frame that just ended
+	 */
+	void MarkFrameBoundary(uint64 FrameNumber);
+
+	/**
+	 * Write the captured events as Chrome trace JSON
+	 * @param FilePath Output file
+	 * @return True if the file was written
+	 */
+	bool ExportChromeTrace(const FString& FilePath) const;
+
+	/**
+	 * Build the Chrome trace JSON in memory
+	 * @return JSON text
+	 */
+	FString BuildChromeTraceJson() const;
+
+	/**
+	 * Get the number of events captured across all threads
+	 */
+	int32 GetEventCount() const;
+
+	/**
+	 * Get the number of events dropped because a thread's buffer was full
+	 */
+	int64 GetDroppedEventCount() const;
+
+	/**
+	 * Get seconds since the capture started (or its length once stopped)
+	 */
+	double GetCaptureSeconds() const;
+
+	/** Default per-thread bound (about a minute of a busy game thread) */
+	static constexpr int32 DefaultMaxEventsPerThread = 256 * 1024;
+
+private:
+	FDelveDeepTraceRecorder();
+
+	/** Events recorded by one thread */
+	struct FThreadBuffer
+	{
+		uint32 ThreadId = 0;
+		int64 DroppedEvents = 0;
+		TArray<FDelveDeepTraceEvent> Events;
+		FCriticalSection Lock;
+	};
+
+	/**
+	 * Append an event to the calling thread's buffer
+	 */
+	void AddEvent(FDelveDeepTraceEvent&& Event);
+
+	/**
+	 * Find or create the calling thread's buffer
+	 */
+	FThreadBuffer& GetThreadBuffer();
+
+	/**
+	 * Append one buffer's events as JSON (each preceded by a comma)
+	 */
+	void AppendThreadEvents(FString& Out, uint32 ThreadId, const TArray<FDelveDeepTraceEvent>& Events) const;
+
+	/** All thread buffers ever created (threads are few and long-lived) */
+	TArray<TUniquePtr<FThreadBuffer>> Buffers;
+
+	/** Guards Buffers */
+	mutable FCriticalSection BuffersLock;
+
+	/** Recording flag checked on every event */
+	TAtomic<bool> bCapturing;
+
+	/** Per-thread bound for the current capture */
+	int32 MaxEventsPerThread;
+
+	/** Capture start (trace time zero) */
+	uint64 CaptureStartCycles;
+
+	/** Capture end (0 while recording) */
+	uint64 CaptureEndCycles;
+
+	/** Start of the frame currently being recorded (game thread only) */
+	uint64 FrameStartCycles;
+};
+
+/**
+ * Records a span for the enclosing scope when a trace capture is running
+ */
+class FDelveDeepScopedTraceSpan
+{
+public:
+	FDelveDeepScopedTraceSpan(FName InName, const TCHAR* InCategory)
+		: Name(InName)
+		, Category(InCategory)
+		, StartCycles(FDelveDeepTraceRecorder::Get().IsCapturing() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FDelveDeepScopedTraceSpan()
+	{
+		if (StartCycles != 0)
+		{
+			FDelveDeepTraceRecorder::Get().RecordSpan(Name, Category, StartCycles, FPlatformTime::Cycles64());
+		}
+	}
+
+private:
+	FName Name;
+	const TCHAR* Category;
+	uint64 StartCycles;
+};
+
+/**
+ * Trace the enclosing scope: DELVEDEEP_TRACE_SPAN(TEXT("Combat"), TEXT("System"));
+ * The name is interned once per call site. Expands to a single declaration.
+ * Compiled out of shipping builds.
+ */
+#if !UE_BUILD_SHIPPING
+	#define DELVEDEEP_TRACE_SPAN(Name, Category) \
+		FDelveDeepScopedTraceSpan PREPROCESSOR_JOIN(DelveDeepTraceSpan_, __LINE__)([]() { static const FName SpanName(Name); return SpanName; }(), Category)
+#else
+	#define DELVEDEEP_TRACE_SPAN(Name, Category)
+#endif
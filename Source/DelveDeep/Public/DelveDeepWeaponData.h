@@ -9,6 +9,7 @@
 
 // Forward declarations
 class UDelveDeepAbilityData;
+class UPaperSprite;
 
 /**
  * Data asset for weapon configuration.
@@ -50,6 +51,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile", meta = (ClampMin = "1"))
 	int32 MaxPierceTargets = 1;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectile")
+	TSoftObjectPtr<UPaperSprite> ProjectileSprite;
+
 	// Special abilities
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Abilities")
 	TSoftObjectPtr<UDelveDeepAbilityData> SpecialAbility;